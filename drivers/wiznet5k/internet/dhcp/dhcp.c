@@ -753,6 +753,10 @@ uint8_t DHCP_run(void)
 
 				DHCP_XID++;
 
+				// Drop broadcasts for other clients that queued up while the lease was held
+				// without DHCP_run() being called, so the reply to this request isn't behind them.
+				while (getSn_RX_RSR(DHCP_SOCKET) > 0) parseDHCPMSG();
+
 				send_DHCP_REQUEST();
 
 				reset_DHCP_timeout();
@@ -937,6 +941,26 @@ void DHCP_time_handler(void)
 	dhcp_tick_1s++;
 }
 
+void DHCP_time_elapsed(uint32_t seconds)
+{
+	dhcp_tick_1s += seconds;
+}
+
+uint32_t DHCP_seconds_to_run(void)
+{
+	switch (dhcp_state) {
+		case STATE_DHCP_LEASED:
+			if (dhcp_lease_time == INFINITE_LEASETIME) return DHCP_RUN_NEVER;
+			// renewal starts once dhcp_tick_1s is past half the lease time
+			if ((dhcp_lease_time/2) < dhcp_tick_1s) return 0;
+			return (dhcp_lease_time/2) - dhcp_tick_1s + 1;
+		case STATE_DHCP_STOP:
+			return DHCP_RUN_NEVER;
+		default:
+			return 0;
+	}
+}
+
 void getIPfromDHCP(uint8_t* ip)
 {
 	ip[0] = DHCP_allocated_ip[0];
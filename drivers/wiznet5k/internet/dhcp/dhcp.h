@@ -93,6 +93,21 @@ void DHCP_init(uint8_t s, DHCP_INIT_BUFFER_TYPE* buf);
  */
 void DHCP_time_handler(void);
 
+/*
+ * @brief Advance the DHCP timer by several seconds at once
+ * @note For callers that don't tick every second, see DHCP_seconds_to_run()
+ */
+void DHCP_time_elapsed(uint32_t seconds);
+
+#define DHCP_RUN_NEVER           0xffffffff   ///< Returned by DHCP_seconds_to_run() when nothing is left to do
+
+/*
+ * @brief Seconds until DHCP_run() next has work to do
+ * @return 0 while an exchange with the server is in progress, the time until the lease is renewed
+ *         while it is held, or @ref DHCP_RUN_NEVER when stopped or the lease doesn't expire
+ */
+uint32_t DHCP_seconds_to_run(void);
+
 /* 
  * @brief Register call back function 
  * @param ip_assign   - callback func when IP is assigned from DHCP server first
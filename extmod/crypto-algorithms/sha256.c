@@ -81,6 +81,17 @@ static void sha256_transform(CRYAL_SHA256_CTX *ctx, const BYTE data[])
 	ctx->state[7] += h;
 }
 
+// Hash whole blocks, on a hash engine when the including code provides one that takes them.
+static void sha256_blocks(CRYAL_SHA256_CTX *ctx, const BYTE data[], size_t nblocks)
+{
+#ifdef SHA256_HW_BLOCKS
+	if (SHA256_HW_BLOCKS(ctx->state, data, nblocks))
+		return;
+#endif
+	for ( ; nblocks > 0; --nblocks, data += 64)
+		sha256_transform(ctx, data);
+}
+
 void sha256_init(CRYAL_SHA256_CTX *ctx)
 {
 	ctx->datalen = 0;
@@ -97,17 +108,28 @@ void sha256_init(CRYAL_SHA256_CTX *ctx)
 
 void sha256_update(CRYAL_SHA256_CTX *ctx, const BYTE data[], size_t len)
 {
-	WORD i;
+	size_t i = 0;
+	size_t nblocks;
 
-	for (i = 0; i < len; ++i) {
-		ctx->data[ctx->datalen] = data[i];
-		ctx->datalen++;
+	// Fill up a partial block left from before.
+	while (ctx->datalen > 0 && i < len) {
+		ctx->data[ctx->datalen++] = data[i++];
 		if (ctx->datalen == 64) {
-			sha256_transform(ctx, ctx->data);
+			sha256_blocks(ctx, ctx->data, 1);
 			ctx->bitlen += 512;
 			ctx->datalen = 0;
 		}
 	}
+
+	// Hash the whole blocks where they are, and keep what's left over.
+	nblocks = (len - i) / 64;
+	if (nblocks > 0) {
+		sha256_blocks(ctx, data + i, nblocks);
+		ctx->bitlen += 512 * (unsigned long long)nblocks;
+		i += nblocks * 64;
+	}
+	while (i < len)
+		ctx->data[ctx->datalen++] = data[i++];
 }
 
 void sha256_final(CRYAL_SHA256_CTX *ctx, BYTE hash[])
@@ -126,7 +148,7 @@ void sha256_final(CRYAL_SHA256_CTX *ctx, BYTE hash[])
 		ctx->data[i++] = 0x80;
 		while (i < 64)
 			ctx->data[i++] = 0x00;
-		sha256_transform(ctx, ctx->data);
+		sha256_blocks(ctx, ctx->data, 1);
 		memset(ctx->data, 0, 56);
 	}
 
@@ -140,7 +162,7 @@ void sha256_final(CRYAL_SHA256_CTX *ctx, BYTE hash[])
 	ctx->data[58] = ctx->bitlen >> 40;
 	ctx->data[57] = ctx->bitlen >> 48;
 	ctx->data[56] = ctx->bitlen >> 56;
-	sha256_transform(ctx, ctx->data);
+	sha256_blocks(ctx, ctx->data, 1);
 
 	// Since this implementation uses little endian byte ordering and SHA uses big endian,
 	// reverse all the bytes when copying the final state to the output hash.
@@ -101,6 +101,38 @@ STATIC mp_obj_t btree_put(size_t n_args, const mp_obj_t *args) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(btree_put_obj, 3, 4, btree_put);
 
+// Store many key/value pairs, given as a dict or an iterable of pairs, and
+// write them out with a single flush at the end.
+STATIC mp_obj_t btree_put_many(mp_obj_t self_in, mp_obj_t items_in) {
+    mp_obj_btree_t *self = MP_OBJ_TO_PTR(self_in);
+    if (MP_OBJ_IS_TYPE(items_in, &mp_type_dict)) {
+        mp_map_t *map = mp_obj_dict_get_map(items_in);
+        for (size_t i = 0; i < map->alloc; i++) {
+            if (MP_MAP_SLOT_IS_FILLED(map, i)) {
+                DBT key, val;
+                key.data = (void*)mp_obj_str_get_data(map->table[i].key, &key.size);
+                val.data = (void*)mp_obj_str_get_data(map->table[i].value, &val.size);
+                CHECK_ERROR(__bt_put(self->db, &key, &val, 0));
+            }
+        }
+    } else {
+        mp_obj_iter_buf_t iter_buf;
+        mp_obj_t iterable = mp_getiter(items_in, &iter_buf);
+        mp_obj_t item;
+        while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+            mp_obj_t *pair;
+            mp_obj_get_array_fixed_n(item, 2, &pair);
+            DBT key, val;
+            key.data = (void*)mp_obj_str_get_data(pair[0], &key.size);
+            val.data = (void*)mp_obj_str_get_data(pair[1], &val.size);
+            CHECK_ERROR(__bt_put(self->db, &key, &val, 0));
+        }
+    }
+    CHECK_ERROR(__bt_sync(self->db, 0));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(btree_put_many_obj, btree_put_many);
+
 STATIC mp_obj_t btree_get(size_t n_args, const mp_obj_t *args) {
     mp_obj_btree_t *self = MP_OBJ_TO_PTR(args[0]);
     DBT key, val;
@@ -300,6 +332,7 @@ STATIC const mp_rom_map_elem_t btree_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&btree_flush_obj) },
     { MP_ROM_QSTR(MP_QSTR_get), MP_ROM_PTR(&btree_get_obj) },
     { MP_ROM_QSTR(MP_QSTR_put), MP_ROM_PTR(&btree_put_obj) },
+    { MP_ROM_QSTR(MP_QSTR_put_many), MP_ROM_PTR(&btree_put_many_obj) },
     { MP_ROM_QSTR(MP_QSTR_seq), MP_ROM_PTR(&btree_seq_obj) },
     { MP_ROM_QSTR(MP_QSTR_keys), MP_ROM_PTR(&btree_keys_obj) },
     { MP_ROM_QSTR(MP_QSTR_values), MP_ROM_PTR(&btree_values_obj) },
@@ -327,6 +360,20 @@ STATIC FILEVTABLE btree_stream_fvtable = {
     mp_stream_posix_fsync
 };
 
+// Default page size for a new database: the block size of the underlying
+// filesystem, so that a page never straddles a FAT cluster or flash sector,
+// unless that is too big to be worth caching.
+STATIC mp_uint_t btree_default_pagesize(mp_obj_t stream, const mp_stream_p_t *stream_p) {
+    int errcode;
+    mp_uint_t size = stream_p->ioctl(stream, MP_STREAM_GET_BLOCK_SIZE, 0, &errcode);
+    if (size == MP_STREAM_ERROR || size < 512 || size > MICROPY_PY_BTREE_MAX_PAGESIZE
+        || (size & (size - 1)) != 0) {
+        // Let berkeley-db pick
+        return 0;
+    }
+    return size;
+}
+
 STATIC mp_obj_t mod_btree_open(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_flags, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
@@ -336,7 +383,7 @@ STATIC mp_obj_t mod_btree_open(size_t n_args, const mp_obj_t *pos_args, mp_map_t
     };
 
     // Make sure we got a stream object
-    mp_get_stream_raise(pos_args[0], MP_STREAM_OP_READ | MP_STREAM_OP_WRITE | MP_STREAM_OP_IOCTL);
+    const mp_stream_p_t *stream_p = mp_get_stream_raise(pos_args[0], MP_STREAM_OP_READ | MP_STREAM_OP_WRITE | MP_STREAM_OP_IOCTL);
 
     struct {
         mp_arg_val_t flags;
@@ -350,6 +397,9 @@ STATIC mp_obj_t mod_btree_open(size_t n_args, const mp_obj_t *pos_args, mp_map_t
     openinfo.flags = args.flags.u_int;
     openinfo.cachesize = args.cachesize.u_int;
     openinfo.psize = args.pagesize.u_int;
+    if (openinfo.psize == 0) {
+        openinfo.psize = btree_default_pagesize(pos_args[0], stream_p);
+    }
     openinfo.minkeypage = args.minkeypage.u_int;
 
     DB *db = __bt_open(pos_args[0], &btree_stream_fvtable, &openinfo, /*dflags*/0);
@@ -40,6 +40,9 @@ typedef struct _mp_obj_framebuf_t {
     void *buf;
     uint16_t width, height, stride;
     uint8_t format;
+    // Bounding box of pixels drawn since dirty() last cleared it, with exclusive ends.
+    // It is empty when dirty_x0 >= dirty_x1.
+    uint16_t dirty_x0, dirty_y0, dirty_x1, dirty_y1;
 } mp_obj_framebuf_t;
 
 typedef void (*setpixel_t)(const mp_obj_framebuf_t*, int, int, uint32_t);
@@ -238,7 +241,31 @@ STATIC mp_framebuf_p_t formats[] = {
     [FRAMEBUF_MHMSB] = {MP_PROTO_IMPLEMENT(MP_QSTR_protocol_framebuf) mono_horiz_setpixel, mono_horiz_getpixel, mono_horiz_fill_rect},
 };
 
-static inline void setpixel(const mp_obj_framebuf_t *fb, int x, int y, uint32_t col) {
+// Grow the dirty box to cover a region that is already clipped to the framebuffer.
+static inline void mark_dirty(mp_obj_framebuf_t *fb, int x, int y, int w, int h) {
+    if (fb->dirty_x0 >= fb->dirty_x1) {
+        fb->dirty_x0 = x;
+        fb->dirty_y0 = y;
+        fb->dirty_x1 = x + w;
+        fb->dirty_y1 = y + h;
+        return;
+    }
+    fb->dirty_x0 = MIN(fb->dirty_x0, x);
+    fb->dirty_y0 = MIN(fb->dirty_y0, y);
+    fb->dirty_x1 = MAX(fb->dirty_x1, x + w);
+    fb->dirty_y1 = MAX(fb->dirty_y1, y + h);
+}
+
+STATIC void init_dirty(mp_obj_framebuf_t *fb) {
+    // Nothing is known about what the display shows yet, so all of it needs sending.
+    fb->dirty_x0 = 0;
+    fb->dirty_y0 = 0;
+    fb->dirty_x1 = fb->width;
+    fb->dirty_y1 = fb->height;
+}
+
+static inline void setpixel(mp_obj_framebuf_t *fb, int x, int y, uint32_t col) {
+    mark_dirty(fb, x, y, 1, 1);
     formats[fb->format].setpixel(fb, x, y, col);
 }
 
@@ -246,7 +273,7 @@ static inline uint32_t getpixel(const mp_obj_framebuf_t *fb, int x, int y) {
     return formats[fb->format].getpixel(fb, x, y);
 }
 
-STATIC void fill_rect(const mp_obj_framebuf_t *fb, int x, int y, int w, int h, uint32_t col) {
+STATIC void fill_rect(mp_obj_framebuf_t *fb, int x, int y, int w, int h, uint32_t col) {
     if (h < 1 || w < 1 || x + w <= 0 || y + h <= 0 || y >= fb->height || x >= fb->width) {
         // No operation needed.
         return;
@@ -258,9 +285,29 @@ STATIC void fill_rect(const mp_obj_framebuf_t *fb, int x, int y, int w, int h, u
     x = MAX(x, 0);
     y = MAX(y, 0);
 
+    mark_dirty(fb, x, y, xend - x, yend - y);
     formats[fb->format].fill_rect(fb, x, y, xend - x, yend - y, col);
 }
 
+// Bits per pixel for the formats that pack pixels along rows, or 0 for MVLSB.
+STATIC int horiz_bits_per_pixel(uint8_t format) {
+    switch (format) {
+        case FRAMEBUF_RGB565:
+            return 16;
+        case FRAMEBUF_GS8:
+            return 8;
+        case FRAMEBUF_GS4_HMSB:
+            return 4;
+        case FRAMEBUF_GS2_HMSB:
+            return 2;
+        case FRAMEBUF_MHLSB:
+        case FRAMEBUF_MHMSB:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
 STATIC mp_obj_t framebuf_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
     mp_arg_check_num(n_args, kw_args, 4, 5, false);
 
@@ -280,6 +327,7 @@ STATIC mp_obj_t framebuf_make_new(const mp_obj_type_t *type, size_t n_args, cons
     } else {
         o->stride = o->width;
     }
+    init_dirty(o);
 
     switch (o->format) {
         case FRAMEBUF_MVLSB:
@@ -316,6 +364,7 @@ STATIC mp_int_t framebuf_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo,
 STATIC mp_obj_t framebuf_fill(mp_obj_t self_in, mp_obj_t col_in) {
     mp_obj_framebuf_t *self = MP_OBJ_TO_PTR(self_in);
     mp_int_t col = mp_obj_get_int(col_in);
+    mark_dirty(self, 0, 0, self->width, self->height);
     formats[self->format].fill_rect(self, 0, 0, self->width, self->height, col);
     return mp_const_none;
 }
@@ -469,6 +518,55 @@ STATIC mp_obj_t framebuf_line(size_t n_args, const mp_obj_t *args) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(framebuf_line_obj, 6, 6, framebuf_line);
 
+// Copy whole bytes row by row when both framebuffers share a format and the clipped
+// region starts and ends on byte boundaries. Returns false if the region doesn't allow it.
+STATIC bool blit_bytes(mp_obj_framebuf_t *self, const mp_obj_framebuf_t *source,
+    int x0, int y0, int x1, int y1, int w, int h) {
+    uint8_t *dest = self->buf;
+    const uint8_t *src = source->buf;
+    int bpp = horiz_bits_per_pixel(self->format);
+    if (bpp == 0) {
+        // MVLSB: each byte is a column of 8 rows, so copy whole pages
+        if (((y0 | y1 | h) & 7) != 0) {
+            return false;
+        }
+        for (int page = 0; page < h / 8; page++) {
+            memmove(dest + ((y0 >> 3) + page) * self->stride + x0,
+                src + ((y1 >> 3) + page) * source->stride + x1, w);
+        }
+        return true;
+    }
+    if (((x0 * bpp) | (x1 * bpp) | (w * bpp)) & 7) {
+        return false;
+    }
+    for (int row = 0; row < h; row++) {
+        memmove(dest + (((y0 + row) * self->stride + x0) * bpp >> 3),
+            src + (((y1 + row) * source->stride + x1) * bpp >> 3), w * bpp >> 3);
+    }
+    return true;
+}
+
+// MONO_HLSB into RGB565 through a two entry palette, the usual way to colour a glyph or icon.
+STATIC void blit_mono_hlsb_rgb565(mp_obj_framebuf_t *self, const mp_obj_framebuf_t *source,
+    int x0, int y0, int x1, int y1, int w, int h, const uint32_t *lut, mp_int_t key) {
+    for (int row = 0; row < h; row++) {
+        uint16_t *dest = &((uint16_t*)self->buf)[x0 + (y0 + row) * self->stride];
+        const uint8_t *src = &((uint8_t*)source->buf)[(x1 + (y1 + row) * source->stride) >> 3];
+        uint8_t mask = 0x80 >> ((x1 + (y1 + row) * source->stride) & 7);
+        for (int i = 0; i < w; i++) {
+            uint32_t col = lut[(*src & mask) != 0];
+            if (col != (uint32_t)key) {
+                dest[i] = col;
+            }
+            mask >>= 1;
+            if (mask == 0) {
+                mask = 0x80;
+                src++;
+            }
+        }
+    }
+}
+
 STATIC mp_obj_t framebuf_blit(size_t n_args, const mp_obj_t *args) {
     mp_obj_framebuf_t *self = MP_OBJ_TO_PTR(args[0]);
     mp_obj_framebuf_t *source = MP_OBJ_TO_PTR(args[1]);
@@ -478,6 +576,10 @@ STATIC mp_obj_t framebuf_blit(size_t n_args, const mp_obj_t *args) {
     if (n_args > 4) {
         key = mp_obj_get_int(args[4]);
     }
+    mp_obj_framebuf_t *palette = NULL;
+    if (n_args > 5 && args[5] != mp_const_none) {
+        palette = MP_OBJ_TO_PTR(args[5]);
+    }
 
     if (
         (x >= self->width) ||
@@ -496,13 +598,44 @@ STATIC mp_obj_t framebuf_blit(size_t n_args, const mp_obj_t *args) {
     int y1 = MAX(0, -y);
     int x0end = MIN(self->width, x + source->width);
     int y0end = MIN(self->height, y + source->height);
+    mark_dirty(self, x0, y0, x0end - x0, y0end - y0);
+
+    if (key == -1 && palette == NULL && self->format == source->format &&
+        blit_bytes(self, source, x0, y0, x1, y1, x0end - x0, y0end - y0)) {
+        return mp_const_none;
+    }
+
+    // Sources of up to 4 bits per pixel get their palette looked up once, not per pixel.
+    // Colours past the end of the palette are drawn unmapped.
+    uint32_t lut[16];
+    int lut_len = 0;
+    if (palette != NULL) {
+        int bpp = horiz_bits_per_pixel(source->format);
+        if (bpp <= 4) {
+            lut_len = 1 << (bpp == 0 ? 1 : bpp);
+            for (int i = 0; i < lut_len; i++) {
+                lut[i] = i < palette->width ? getpixel(palette, i, 0) : (uint32_t)i;
+            }
+        }
+        if (source->format == FRAMEBUF_MHLSB && self->format == FRAMEBUF_RGB565) {
+            blit_mono_hlsb_rgb565(self, source, x0, y0, x1, y1, x0end - x0, y0end - y0, lut, key);
+            return mp_const_none;
+        }
+    }
 
+    getpixel_t get = formats[source->format].getpixel;
+    setpixel_t set = formats[self->format].setpixel;
     for (; y0 < y0end; ++y0) {
         int cx1 = x1;
         for (int cx0 = x0; cx0 < x0end; ++cx0) {
-            uint32_t col = getpixel(source, cx1, y1);
+            uint32_t col = get(source, cx1, y1);
+            if (lut_len > 0) {
+                col = lut[col];
+            } else if (palette != NULL && col < palette->width) {
+                col = getpixel(palette, col, 0);
+            }
             if (col != (uint32_t)key) {
-                setpixel(self, cx0, y0, col);
+                set(self, cx0, y0, col);
             }
             ++cx1;
         }
@@ -510,7 +643,7 @@ STATIC mp_obj_t framebuf_blit(size_t n_args, const mp_obj_t *args) {
     }
     return mp_const_none;
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(framebuf_blit_obj, 4, 5, framebuf_blit);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(framebuf_blit_obj, 4, 6, framebuf_blit);
 
 STATIC mp_obj_t framebuf_scroll(mp_obj_t self_in, mp_obj_t xstep_in, mp_obj_t ystep_in) {
     mp_obj_framebuf_t *self = MP_OBJ_TO_PTR(self_in);
@@ -535,15 +668,35 @@ STATIC mp_obj_t framebuf_scroll(mp_obj_t self_in, mp_obj_t xstep_in, mp_obj_t ys
         yend = ystep - 1;
         dy = -1;
     }
+    mark_dirty(self, 0, 0, self->width, self->height);
+    setpixel_t set = formats[self->format].setpixel;
     for (; y != yend; y += dy) {
         for (int x = sx; x != xend; x += dx) {
-            setpixel(self, x, y, getpixel(self, x - xstep, y - ystep));
+            set(self, x, y, getpixel(self, x - xstep, y - ystep));
         }
     }
     return mp_const_none;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_3(framebuf_scroll_obj, framebuf_scroll);
 
+STATIC mp_obj_t framebuf_dirty(size_t n_args, const mp_obj_t *args) {
+    mp_obj_framebuf_t *self = MP_OBJ_TO_PTR(args[0]);
+    if (self->dirty_x0 >= self->dirty_x1) {
+        return mp_const_none;
+    }
+    mp_obj_t items[4] = {
+        MP_OBJ_NEW_SMALL_INT(self->dirty_x0),
+        MP_OBJ_NEW_SMALL_INT(self->dirty_y0),
+        MP_OBJ_NEW_SMALL_INT(self->dirty_x1 - self->dirty_x0),
+        MP_OBJ_NEW_SMALL_INT(self->dirty_y1 - self->dirty_y0),
+    };
+    if (n_args < 2 || mp_obj_is_true(args[1])) {
+        self->dirty_x0 = self->dirty_x1 = 0;
+    }
+    return mp_obj_new_tuple(4, items);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(framebuf_dirty_obj, 1, 2, framebuf_dirty);
+
 STATIC mp_obj_t framebuf_text(size_t n_args, const mp_obj_t *args) {
     // extract arguments
     mp_obj_framebuf_t *self = MP_OBJ_TO_PTR(args[0]);
@@ -564,6 +717,26 @@ STATIC mp_obj_t framebuf_text(size_t n_args, const mp_obj_t *args) {
         }
         // get char data
         const uint8_t *chr_data = &font_petme128_8x8[(chr - 32) * 8];
+        if (self->format == FRAMEBUF_MVLSB && (y0 & 7) == 0 && 0 <= y0 && y0 + 8 <= self->height) {
+            // the font's columns are already MVLSB bytes, so a page-aligned glyph is just
+            // OR'd into (or, for colour 0, cleared from) the page it covers
+            int xs = MAX(0, x0);
+            int xe = MIN(self->width, x0 + 8);
+            if (xs < xe) {
+                mark_dirty(self, xs, y0, xe - xs, 8);
+            }
+            uint8_t *page = &((uint8_t*)self->buf)[(y0 >> 3) * self->stride];
+            for (int j = 0; j < 8; j++, x0++) {
+                if (0 <= x0 && x0 < self->width) {
+                    if (col) {
+                        page[x0] |= chr_data[j];
+                    } else {
+                        page[x0] &= ~chr_data[j];
+                    }
+                }
+            }
+            continue;
+        }
         // loop over char data
         for (int j = 0; j < 8; j++, x0++) {
             if (0 <= x0 && x0 < self->width) { // clip x
@@ -592,6 +765,7 @@ STATIC const mp_rom_map_elem_t framebuf_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_line), MP_ROM_PTR(&framebuf_line_obj) },
     { MP_ROM_QSTR(MP_QSTR_blit), MP_ROM_PTR(&framebuf_blit_obj) },
     { MP_ROM_QSTR(MP_QSTR_scroll), MP_ROM_PTR(&framebuf_scroll_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dirty), MP_ROM_PTR(&framebuf_dirty_obj) },
     { MP_ROM_QSTR(MP_QSTR_text), MP_ROM_PTR(&framebuf_text_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(framebuf_locals_dict, framebuf_locals_dict_table);
@@ -621,6 +795,7 @@ STATIC mp_obj_t legacy_framebuffer1(size_t n_args, const mp_obj_t *args) {
     } else {
         o->stride = o->width;
     }
+    init_dirty(o);
 
     return MP_OBJ_FROM_PTR(o);
 }
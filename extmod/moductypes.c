@@ -118,6 +118,39 @@ typedef struct _mp_obj_uctypes_struct_t {
     uint32_t flags;
 } mp_obj_uctypes_struct_t;
 
+#if MICROPY_PY_UCTYPES_COMPILE
+
+// A descriptor flattened by uctypes.compile()
+STATIC const mp_obj_type_t uctypes_layout_type;
+#define IS_LAYOUT(desc) MP_OBJ_IS_TYPE(desc, &uctypes_layout_type)
+
+// Aggregate fields are stored with a type above any scalar val_type
+#define FIELD_AGG (16)
+
+typedef struct _uctypes_field_t {
+    qstr name;
+    // Compiled layout for STRUCT fields, descriptor tuple for PTR and ARRAY
+    mp_obj_t desc;
+    uint32_t offset;
+    uint8_t type;
+    uint8_t bit_offset;
+    uint8_t bit_len;
+} uctypes_field_t;
+
+typedef struct _mp_obj_uctypes_layout_t {
+    mp_obj_base_t base;
+    mp_obj_t desc;
+    uint16_t len;
+    uint16_t index_mask;
+    // Sorted by offset. Followed by index_mask + 1 slots of an open-addressed
+    // index keyed by qstr, holding 1 + the field number, or 0 if empty.
+    uctypes_field_t fields[];
+} mp_obj_uctypes_layout_t;
+
+#else
+#define IS_LAYOUT(desc) (false)
+#endif
+
 STATIC NORETURN void syntax_error(void) {
     mp_raise_TypeError(translate("syntax error in uctypes descriptor"));
 }
@@ -139,7 +172,7 @@ STATIC void uctypes_struct_print(const mp_print_t *print, mp_obj_t self_in, mp_p
     (void)kind;
     mp_obj_uctypes_struct_t *self = MP_OBJ_TO_PTR(self_in);
     const char *typen = "unk";
-    if (MP_OBJ_IS_TYPE(self->desc, &mp_type_dict)) {
+    if (MP_OBJ_IS_TYPE(self->desc, &mp_type_dict) || IS_LAYOUT(self->desc)) {
         typen = "STRUCT";
     } else if (MP_OBJ_IS_TYPE(self->desc, &mp_type_tuple)) {
         mp_obj_tuple_t *t = MP_OBJ_TO_PTR(self->desc);
@@ -208,6 +241,10 @@ STATIC mp_uint_t uctypes_struct_agg_size(mp_obj_tuple_t *t, int layout_type, mp_
 }
 
 STATIC mp_uint_t uctypes_struct_size(mp_obj_t desc_in, int layout_type, mp_uint_t *max_field_size) {
+    if (IS_LAYOUT(desc_in)) {
+        // Sizes depend on the layout type, so they are not part of the compiled table
+        desc_in = ((mp_obj_uctypes_layout_t*)MP_OBJ_TO_PTR(desc_in))->desc;
+    }
     if (!MP_OBJ_IS_TYPE(desc_in, &mp_type_dict)) {
         if (MP_OBJ_IS_TYPE(desc_in, &mp_type_tuple)) {
             return uctypes_struct_agg_size((mp_obj_tuple_t*)MP_OBJ_TO_PTR(desc_in), layout_type, max_field_size);
@@ -389,74 +426,285 @@ STATIC void set_aligned(uint val_type, void *p, mp_int_t index, mp_obj_t val) {
     }
 }
 
-STATIC mp_obj_t uctypes_struct_attr_op(mp_obj_t self_in, qstr attr, mp_obj_t set_val) {
-    mp_obj_uctypes_struct_t *self = MP_OBJ_TO_PTR(self_in);
+STATIC mp_obj_t uctypes_struct_new_ref(mp_obj_t desc, byte *addr, uint32_t flags) {
+    mp_obj_uctypes_struct_t *o = m_new_obj(mp_obj_uctypes_struct_t);
+    o->base.type = &uctypes_struct_type;
+    o->desc = desc;
+    o->addr = addr;
+    o->flags = flags;
+    return MP_OBJ_FROM_PTR(o);
+}
 
-    // TODO: Support at least OrderedDict in addition
-    if (!MP_OBJ_IS_TYPE(self->desc, &mp_type_dict)) {
-            mp_raise_TypeError(translate("struct: no fields"));
+// Split a packed scalar field descriptor into its type, byte offset and
+// bitfield position
+STATIC mp_uint_t uctypes_decode_scalar(mp_int_t packed, uint *val_type, uint *bit_offset, uint *bit_len) {
+    *val_type = GET_TYPE(packed, VAL_TYPE_BITS);
+    mp_uint_t offset = packed & VALUE_MASK(VAL_TYPE_BITS);
+    *bit_offset = 0;
+    *bit_len = 0;
+    if (*val_type >= BFUINT8 && *val_type <= BFINT32) {
+        *bit_offset = (offset >> 17) & 31;
+        *bit_len = (offset >> 22) & 31;
+        offset &= (1 << 17) - 1;
     }
+    return offset;
+}
 
-    mp_obj_t deref = mp_obj_dict_get(self->desc, MP_OBJ_NEW_QSTR(attr));
-    if (MP_OBJ_IS_SMALL_INT(deref)) {
-        mp_int_t offset = MP_OBJ_SMALL_INT_VALUE(deref);
-        mp_uint_t val_type = GET_TYPE(offset, VAL_TYPE_BITS);
-        offset &= VALUE_MASK(VAL_TYPE_BITS);
-//printf("scalar type=%d offset=%x\n", val_type, offset);
-
-        if (val_type <= INT64 || val_type == FLOAT32 || val_type == FLOAT64) {
-//            printf("size=%d\n", GET_SCALAR_SIZE(val_type));
-            if (self->flags == LAYOUT_NATIVE) {
-                if (set_val == MP_OBJ_NULL) {
-                    return get_aligned(val_type, self->addr + offset, 0);
-                } else {
-                    set_aligned(val_type, self->addr + offset, 0, set_val);
-                    return set_val; // just !MP_OBJ_NULL
-                }
+STATIC mp_obj_t uctypes_struct_scalar_op(mp_obj_uctypes_struct_t *self, uint val_type, mp_uint_t offset,
+    uint bit_offset, uint bit_len, mp_obj_t set_val) {
+    if (val_type <= INT64 || val_type == FLOAT32 || val_type == FLOAT64) {
+        if (self->flags == LAYOUT_NATIVE) {
+            if (set_val == MP_OBJ_NULL) {
+                return get_aligned(val_type, self->addr + offset, 0);
             } else {
-                if (set_val == MP_OBJ_NULL) {
-                    return get_unaligned(val_type, self->addr + offset, self->flags);
-                } else {
-                    set_unaligned(val_type, self->addr + offset, self->flags, set_val);
-                    return set_val; // just !MP_OBJ_NULL
-                }
+                set_aligned(val_type, self->addr + offset, 0, set_val);
+                return set_val; // just !MP_OBJ_NULL
             }
-        } else if (val_type >= BFUINT8 && val_type <= BFINT32) {
-            uint bit_offset = (offset >> 17) & 31;
-            uint bit_len = (offset >> 22) & 31;
-            offset &= (1 << 17) - 1;
-            mp_uint_t val;
-            if (self->flags == LAYOUT_NATIVE) {
-                val = get_aligned_basic(val_type & 6, self->addr + offset);
+        } else {
+            if (set_val == MP_OBJ_NULL) {
+                return get_unaligned(val_type, self->addr + offset, self->flags);
             } else {
-                val = mp_binary_get_int(GET_SCALAR_SIZE(val_type & 7), val_type & 1, self->flags, self->addr + offset);
+                set_unaligned(val_type, self->addr + offset, self->flags, set_val);
+                return set_val; // just !MP_OBJ_NULL
             }
-            if (set_val == MP_OBJ_NULL) {
-                val >>= bit_offset;
-                val &= (1 << bit_len) - 1;
-                // TODO: signed
-                assert((val_type & 1) == 0);
-                return mp_obj_new_int(val);
+        }
+    } else if (val_type >= BFUINT8 && val_type <= BFINT32) {
+        mp_uint_t val;
+        if (self->flags == LAYOUT_NATIVE) {
+            val = get_aligned_basic(val_type & 6, self->addr + offset);
+        } else {
+            val = mp_binary_get_int(GET_SCALAR_SIZE(val_type & 7), val_type & 1, self->flags, self->addr + offset);
+        }
+        if (set_val == MP_OBJ_NULL) {
+            val >>= bit_offset;
+            val &= (1 << bit_len) - 1;
+            // TODO: signed
+            assert((val_type & 1) == 0);
+            return mp_obj_new_int(val);
+        } else {
+            mp_uint_t set_val_int = (mp_uint_t)mp_obj_get_int(set_val);
+            mp_uint_t mask = (1 << bit_len) - 1;
+            set_val_int &= mask;
+            set_val_int <<= bit_offset;
+            mask <<= bit_offset;
+            val = (val & ~mask) | set_val_int;
+
+            if (self->flags == LAYOUT_NATIVE) {
+                set_aligned_basic(val_type & 6, self->addr + offset, val);
             } else {
-                mp_uint_t set_val_int = (mp_uint_t)mp_obj_get_int(set_val);
-                mp_uint_t mask = (1 << bit_len) - 1;
-                set_val_int &= mask;
-                set_val_int <<= bit_offset;
-                mask <<= bit_offset;
-                val = (val & ~mask) | set_val_int;
+                mp_binary_set_int(GET_SCALAR_SIZE(val_type & 7), self->flags == LAYOUT_BIG_ENDIAN,
+                    self->addr + offset, val);
+            }
+            return set_val; // just !MP_OBJ_NULL
+        }
+    }
 
-                if (self->flags == LAYOUT_NATIVE) {
-                    set_aligned_basic(val_type & 6, self->addr + offset, val);
-                } else {
-                    mp_binary_set_int(GET_SCALAR_SIZE(val_type & 7), self->flags == LAYOUT_BIG_ENDIAN,
-                        self->addr + offset, val);
-                }
-                return set_val; // just !MP_OBJ_NULL
+    assert(0);
+    return MP_OBJ_NULL;
+}
+
+// Load a PTR or ARRAY field described by sub
+STATIC mp_obj_t uctypes_struct_agg_load(mp_obj_uctypes_struct_t *self, mp_obj_tuple_t *sub, mp_uint_t offset) {
+    mp_uint_t dummy;
+    if (IS_SCALAR_ARRAY(sub) && IS_SCALAR_ARRAY_OF_BYTES(sub)
+        && GET_TYPE(MP_OBJ_SMALL_INT_VALUE(sub->items[0]), AGG_TYPE_BITS) == ARRAY) {
+        return mp_obj_new_bytearray_by_ref(uctypes_struct_agg_size(sub, self->flags, &dummy), self->addr + offset);
+    }
+    return uctypes_struct_new_ref(MP_OBJ_FROM_PTR(sub), self->addr + offset, self->flags);
+}
+
+#if MICROPY_PY_UCTYPES_COMPILE
+
+STATIC const mp_obj_type_t uctypes_layout_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_layout,
+};
+
+static inline uint16_t *uctypes_layout_index(mp_obj_uctypes_layout_t *layout) {
+    return (uint16_t*)&layout->fields[layout->len];
+}
+
+/// \function compile()
+/// Flatten a structure descriptor into a table of decoded fields. The result
+/// may be used wherever the descriptor dict is accepted; field access on a
+/// struct created from it skips the dict lookup and offset decoding.
+STATIC mp_obj_t uctypes_compile(mp_obj_t desc_in) {
+    if (MP_OBJ_IS_TYPE(desc_in, &uctypes_layout_type)) {
+        return desc_in;
+    }
+    if (!MP_OBJ_IS_TYPE(desc_in, &mp_type_dict)) {
+        syntax_error();
+    }
+    mp_map_t *map = &((mp_obj_dict_t*)MP_OBJ_TO_PTR(desc_in))->map;
+    if (map->used > 0x7fff) {
+        syntax_error();
+    }
+    size_t n_slots = 4;
+    while (n_slots < 2 * map->used) {
+        n_slots <<= 1;
+    }
+    mp_obj_uctypes_layout_t *layout = m_new_obj_var(mp_obj_uctypes_layout_t, byte,
+        map->used * sizeof(uctypes_field_t) + n_slots * sizeof(uint16_t));
+    layout->base.type = &uctypes_layout_type;
+    layout->desc = desc_in;
+    layout->len = 0;
+    layout->index_mask = n_slots - 1;
+
+    for (size_t i = 0; i < map->alloc; i++) {
+        if (!MP_MAP_SLOT_IS_FILLED(map, i)) {
+            continue;
+        }
+        if (!MP_OBJ_IS_STR(map->table[i].key)) {
+            syntax_error();
+        }
+        uctypes_field_t f = { .name = mp_obj_str_get_qstr(map->table[i].key), .desc = MP_OBJ_NULL };
+        mp_obj_t v = map->table[i].value;
+        if (MP_OBJ_IS_SMALL_INT(v)) {
+            uint val_type, bit_offset, bit_len;
+            f.offset = uctypes_decode_scalar(MP_OBJ_SMALL_INT_VALUE(v), &val_type, &bit_offset, &bit_len);
+            f.type = val_type;
+            f.bit_offset = bit_offset;
+            f.bit_len = bit_len;
+        } else {
+            if (!MP_OBJ_IS_TYPE(v, &mp_type_tuple)) {
+                syntax_error();
             }
+            mp_obj_tuple_t *sub = MP_OBJ_TO_PTR(v);
+            mp_int_t offset = MP_OBJ_SMALL_INT_VALUE(sub->items[0]);
+            uint agg_type = GET_TYPE(offset, AGG_TYPE_BITS);
+            f.offset = offset & VALUE_MASK(AGG_TYPE_BITS);
+            f.type = FIELD_AGG + agg_type;
+            f.desc = agg_type == STRUCT ? uctypes_compile(sub->items[1]) : v;
+        }
+        // Insertion sort by offset; descriptors are small
+        size_t j = layout->len++;
+        while (j > 0 && layout->fields[j - 1].offset > f.offset) {
+            layout->fields[j] = layout->fields[j - 1];
+            j--;
+        }
+        layout->fields[j] = f;
+    }
+
+    uint16_t *index = uctypes_layout_index(layout);
+    memset(index, 0, n_slots * sizeof(uint16_t));
+    for (size_t i = 0; i < layout->len; i++) {
+        size_t slot = layout->fields[i].name & layout->index_mask;
+        while (index[slot] != 0) {
+            slot = (slot + 1) & layout->index_mask;
         }
+        index[slot] = i + 1;
+    }
+    return MP_OBJ_FROM_PTR(layout);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(uctypes_compile_obj, uctypes_compile);
 
-        assert(0);
-        return MP_OBJ_NULL;
+STATIC const uctypes_field_t *uctypes_layout_lookup(mp_obj_uctypes_layout_t *layout, qstr name) {
+    uint16_t *index = uctypes_layout_index(layout);
+    for (size_t slot = name & layout->index_mask;; slot = (slot + 1) & layout->index_mask) {
+        if (index[slot] == 0) {
+            return NULL;
+        }
+        const uctypes_field_t *f = &layout->fields[index[slot] - 1];
+        if (f->name == name) {
+            return f;
+        }
+    }
+}
+
+STATIC mp_obj_t uctypes_struct_field_op(mp_obj_uctypes_struct_t *self, const uctypes_field_t *f, mp_obj_t set_val) {
+    if (f->type < FIELD_AGG) {
+        return uctypes_struct_scalar_op(self, f->type, f->offset, f->bit_offset, f->bit_len, set_val);
+    }
+    if (set_val != MP_OBJ_NULL) {
+        // Cannot assign to aggregate
+        syntax_error();
+    }
+    if (f->type == FIELD_AGG + STRUCT) {
+        return uctypes_struct_new_ref(f->desc, self->addr + f->offset, self->flags);
+    }
+    return uctypes_struct_agg_load(self, MP_OBJ_TO_PTR(f->desc), f->offset);
+}
+
+STATIC mp_obj_uctypes_layout_t *uctypes_struct_get_layout(mp_obj_t self_in) {
+    if (!MP_OBJ_IS_TYPE(self_in, &uctypes_struct_type)) {
+        mp_raise_TypeError(NULL);
+    }
+    mp_obj_uctypes_struct_t *self = MP_OBJ_TO_PTR(self_in);
+    if (!MP_OBJ_IS_TYPE(self->desc, &mp_type_dict) && !MP_OBJ_IS_TYPE(self->desc, &uctypes_layout_type)) {
+        mp_raise_TypeError(translate("struct: no fields"));
+    }
+    return MP_OBJ_TO_PTR(uctypes_compile(self->desc));
+}
+
+/// \function to_tuple()
+/// Read all scalar fields of a structure, in order of their offset, into a
+/// tuple.
+STATIC mp_obj_t uctypes_struct_to_tuple(mp_obj_t self_in) {
+    mp_obj_uctypes_layout_t *layout = uctypes_struct_get_layout(self_in);
+    mp_obj_tuple_t *t = MP_OBJ_TO_PTR(mp_obj_new_tuple(layout->len, NULL));
+    size_t n = 0;
+    for (size_t i = 0; i < layout->len; i++) {
+        const uctypes_field_t *f = &layout->fields[i];
+        if (f->type < FIELD_AGG) {
+            t->items[n++] = uctypes_struct_field_op(MP_OBJ_TO_PTR(self_in), f, MP_OBJ_NULL);
+        }
+    }
+    t->len = n;
+    return MP_OBJ_FROM_PTR(t);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(uctypes_struct_to_tuple_obj, uctypes_struct_to_tuple);
+
+/// \function from_tuple()
+/// Store a sequence of values into the scalar fields of a structure, in the
+/// order to_tuple() returns them.
+STATIC mp_obj_t uctypes_struct_from_tuple(mp_obj_t self_in, mp_obj_t values_in) {
+    mp_obj_uctypes_layout_t *layout = uctypes_struct_get_layout(self_in);
+    size_t n_values;
+    mp_obj_t *values;
+    mp_obj_get_array(values_in, &n_values, &values);
+    size_t n = 0;
+    for (size_t i = 0; i < layout->len; i++) {
+        n += layout->fields[i].type < FIELD_AGG;
+    }
+    if (n != n_values) {
+        mp_raise_ValueError(translate("tuple/list has wrong length"));
+    }
+    n = 0;
+    for (size_t i = 0; i < layout->len; i++) {
+        const uctypes_field_t *f = &layout->fields[i];
+        if (f->type < FIELD_AGG) {
+            uctypes_struct_field_op(MP_OBJ_TO_PTR(self_in), f, values[n++]);
+        }
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(uctypes_struct_from_tuple_obj, uctypes_struct_from_tuple);
+
+#endif // MICROPY_PY_UCTYPES_COMPILE
+
+STATIC mp_obj_t uctypes_struct_attr_op(mp_obj_t self_in, qstr attr, mp_obj_t set_val) {
+    mp_obj_uctypes_struct_t *self = MP_OBJ_TO_PTR(self_in);
+
+    #if MICROPY_PY_UCTYPES_COMPILE
+    if (MP_OBJ_IS_TYPE(self->desc, &uctypes_layout_type)) {
+        const uctypes_field_t *f = uctypes_layout_lookup(MP_OBJ_TO_PTR(self->desc), attr);
+        if (f == NULL) {
+            nlr_raise(mp_obj_new_exception_arg1(&mp_type_KeyError, MP_OBJ_NEW_QSTR(attr)));
+        }
+        return uctypes_struct_field_op(self, f, set_val);
+    }
+    #endif
+
+    // TODO: Support at least OrderedDict in addition
+    if (!MP_OBJ_IS_TYPE(self->desc, &mp_type_dict)) {
+            mp_raise_TypeError(translate("struct: no fields"));
+    }
+
+    mp_obj_t deref = mp_obj_dict_get(self->desc, MP_OBJ_NEW_QSTR(attr));
+    if (MP_OBJ_IS_SMALL_INT(deref)) {
+        uint val_type, bit_offset, bit_len;
+        mp_uint_t offset = uctypes_decode_scalar(MP_OBJ_SMALL_INT_VALUE(deref), &val_type, &bit_offset, &bit_len);
+        return uctypes_struct_scalar_op(self, val_type, offset, bit_offset, bit_len, set_val);
     }
 
     if (!MP_OBJ_IS_TYPE(deref, &mp_type_tuple)) {
@@ -472,33 +720,13 @@ STATIC mp_obj_t uctypes_struct_attr_op(mp_obj_t self_in, qstr attr, mp_obj_t set
     mp_int_t offset = MP_OBJ_SMALL_INT_VALUE(sub->items[0]);
     mp_uint_t agg_type = GET_TYPE(offset, AGG_TYPE_BITS);
     offset &= VALUE_MASK(AGG_TYPE_BITS);
-//printf("agg type=%d offset=%x\n", agg_type, offset);
 
     switch (agg_type) {
-        case STRUCT: {
-            mp_obj_uctypes_struct_t *o = m_new_obj(mp_obj_uctypes_struct_t);
-            o->base.type = &uctypes_struct_type;
-            o->desc = sub->items[1];
-            o->addr = self->addr + offset;
-            o->flags = self->flags;
-            return MP_OBJ_FROM_PTR(o);
-        }
-        case ARRAY: {
-            mp_uint_t dummy;
-            if (IS_SCALAR_ARRAY(sub) && IS_SCALAR_ARRAY_OF_BYTES(sub)) {
-                return mp_obj_new_bytearray_by_ref(uctypes_struct_agg_size(sub, self->flags, &dummy), self->addr + offset);
-            }
-            // Fall thru to return uctypes struct object
-        }
-        case PTR: {
-            mp_obj_uctypes_struct_t *o = m_new_obj(mp_obj_uctypes_struct_t);
-            o->base.type = &uctypes_struct_type;
-            o->desc = MP_OBJ_FROM_PTR(sub);
-            o->addr = self->addr + offset;
-            o->flags = self->flags;
-//printf("PTR/ARR base addr=%p\n", o->addr);
-            return MP_OBJ_FROM_PTR(o);
-        }
+        case STRUCT:
+            return uctypes_struct_new_ref(sub->items[1], self->addr + offset, self->flags);
+        case ARRAY:
+        case PTR:
+            return uctypes_struct_agg_load(self, sub, offset);
     }
 
     // Should be unreachable once all cases are handled
@@ -655,6 +883,11 @@ STATIC const mp_rom_map_elem_t mp_module_uctypes_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_addressof), MP_ROM_PTR(&uctypes_struct_addressof_obj) },
     { MP_ROM_QSTR(MP_QSTR_bytes_at), MP_ROM_PTR(&uctypes_struct_bytes_at_obj) },
     { MP_ROM_QSTR(MP_QSTR_bytearray_at), MP_ROM_PTR(&uctypes_struct_bytearray_at_obj) },
+    #if MICROPY_PY_UCTYPES_COMPILE
+    { MP_ROM_QSTR(MP_QSTR_compile), MP_ROM_PTR(&uctypes_compile_obj) },
+    { MP_ROM_QSTR(MP_QSTR_to_tuple), MP_ROM_PTR(&uctypes_struct_to_tuple_obj) },
+    { MP_ROM_QSTR(MP_QSTR_from_tuple), MP_ROM_PTR(&uctypes_struct_from_tuple_obj) },
+    #endif
 
     /// \moduleref uctypes
 
@@ -250,6 +250,13 @@ const mp_obj_module_t mp_module_uhashlib = {
 };
 
 #if MICROPY_PY_UHASHLIB_SHA256
+#if MICROPY_PY_UHASHLIB_SHA256_HW
+// Provided by ports with a hash engine. Runs the SHA-256 compression function over nblocks
+// 64-byte blocks, updating H0..H7 in state. Returns false to leave the blocks to software,
+// for example when the engine is busy or nblocks is too few to be worth setting it up for.
+bool mp_hal_sha256_blocks(uint32_t state[8], const uint8_t *data, size_t nblocks);
+#define SHA256_HW_BLOCKS(state, data, nblocks) mp_hal_sha256_blocks((uint32_t*)(state), (data), (nblocks))
+#endif
 #include "crypto-algorithms/sha256.c"
 #endif
 
@@ -25,6 +25,7 @@
  */
 
 #include "py/objlist.h"
+#include "py/objtuple.h"
 #include "py/runtime.h"
 
 #include "supervisor/shared/translate.h"
@@ -40,12 +41,57 @@ STATIC mp_obj_list_t *get_heap(mp_obj_t heap_in) {
     return MP_OBJ_TO_PTR(heap_in);
 }
 
+#if MICROPY_PY_BUILTINS_FLOAT
+STATIC bool heap_is_number(mp_obj_t o) {
+    return MP_OBJ_IS_SMALL_INT(o) || mp_obj_is_float(o);
+}
+
+STATIC mp_float_t heap_number(mp_obj_t o) {
+    return MP_OBJ_IS_SMALL_INT(o) ? (mp_float_t)MP_OBJ_SMALL_INT_VALUE(o) : mp_obj_float_get(o);
+}
+#endif
+
+// Heap entries are commonly numbers or (priority, item) tuples. Compare those
+// directly when the priorities differ and only fall back to the generic
+// comparison, which walks the whole tuple, when they don't.
+STATIC bool heap_less(mp_obj_t a, mp_obj_t b) {
+    mp_obj_t ka = a;
+    mp_obj_t kb = b;
+    if (MP_OBJ_IS_TYPE(a, &mp_type_tuple) && MP_OBJ_IS_TYPE(b, &mp_type_tuple)) {
+        mp_obj_tuple_t *ta = MP_OBJ_TO_PTR(a);
+        mp_obj_tuple_t *tb = MP_OBJ_TO_PTR(b);
+        if (ta->len > 0 && tb->len > 0) {
+            ka = ta->items[0];
+            kb = tb->items[0];
+        }
+    }
+    if (MP_OBJ_IS_SMALL_INT(ka) && MP_OBJ_IS_SMALL_INT(kb)) {
+        mp_int_t ia = MP_OBJ_SMALL_INT_VALUE(ka);
+        mp_int_t ib = MP_OBJ_SMALL_INT_VALUE(kb);
+        if (ia != ib || ka == a) {
+            return ia < ib;
+        }
+    }
+    #if MICROPY_PY_BUILTINS_FLOAT
+    else if (heap_is_number(ka) && heap_is_number(kb)) {
+        mp_float_t fa = heap_number(ka);
+        mp_float_t fb = heap_number(kb);
+        if (fa < fb) {
+            return true;
+        } else if (fb < fa) {
+            return false;
+        }
+    }
+    #endif
+    return mp_binary_op(MP_BINARY_OP_LESS, a, b) == mp_const_true;
+}
+
 STATIC void heap_siftdown(mp_obj_list_t *heap, mp_uint_t start_pos, mp_uint_t pos) {
     mp_obj_t item = heap->items[pos];
     while (pos > start_pos) {
         mp_uint_t parent_pos = (pos - 1) >> 1;
         mp_obj_t parent = heap->items[parent_pos];
-        if (mp_binary_op(MP_BINARY_OP_LESS, item, parent) == mp_const_true) {
+        if (heap_less(item, parent)) {
             heap->items[pos] = parent;
             pos = parent_pos;
         } else {
@@ -61,7 +107,7 @@ STATIC void heap_siftup(mp_obj_list_t *heap, mp_uint_t pos) {
     mp_obj_t item = heap->items[pos];
     for (mp_uint_t child_pos = 2 * pos + 1; child_pos < end_pos; child_pos = 2 * pos + 1) {
         // choose right child if it's <= left child
-        if (child_pos + 1 < end_pos && mp_binary_op(MP_BINARY_OP_LESS, heap->items[child_pos], heap->items[child_pos + 1]) == mp_const_false) {
+        if (child_pos + 1 < end_pos && !heap_less(heap->items[child_pos], heap->items[child_pos + 1])) {
             child_pos += 1;
         }
         // bubble up the smaller child
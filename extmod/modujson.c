@@ -25,89 +25,225 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 
+#include "py/formatfloat.h"
+#include "py/gc.h"
 #include "py/objlist.h"
 #include "py/objstringio.h"
 #include "py/parsenum.h"
 #include "py/runtime.h"
+#include "py/stackctrl.h"
 #include "py/stream.h"
 
 #include "supervisor/shared/translate.h"
 
 #if MICROPY_PY_UJSON
 
-STATIC mp_obj_t mod_ujson_dump(mp_obj_t obj, mp_obj_t stream) {
+// Output for a stream is gathered here and written out in chunks of this many bytes instead
+// of a write for every fragment printed.
+#define UJSON_DUMP_BUF_SIZE (256)
+
+typedef struct _ujson_dump_buf_t {
+    mp_obj_t stream_obj;
+    size_t len;
+    byte buf[UJSON_DUMP_BUF_SIZE];
+} ujson_dump_buf_t;
+
+STATIC void ujson_dump_flush(ujson_dump_buf_t *d) {
+    if (d->len > 0) {
+        mp_stream_write(d->stream_obj, d->buf, d->len, MP_STREAM_RW_WRITE);
+        d->len = 0;
+    }
+}
+
+STATIC void ujson_dump_strn(void *env, const char *str, size_t len) {
+    ujson_dump_buf_t *d = env;
+    while (len > 0) {
+        if (d->len == 0 && len >= sizeof(d->buf)) {
+            // Long enough to go straight out.
+            mp_stream_write(d->stream_obj, str, len, MP_STREAM_RW_WRITE);
+            return;
+        }
+        size_t n = MIN(len, sizeof(d->buf) - d->len);
+        memcpy(d->buf + d->len, str, n);
+        d->len += n;
+        str += n;
+        len -= n;
+        if (d->len == sizeof(d->buf)) {
+            ujson_dump_flush(d);
+        }
+    }
+}
+
+// Prints obj as JSON. Lists, tuples and dicts are walked here so their floats can be printed
+// with float_precision significant digits, -1 meaning the usual number. Everything else prints
+// itself.
+STATIC void ujson_encode(const mp_print_t *print, mp_obj_t obj, mp_int_t float_precision) {
+    MP_STACK_CHECK();
+    #if MICROPY_PY_BUILTINS_FLOAT
+    if (float_precision >= 0 && mp_obj_is_float(obj)) {
+        char buf[32];
+        mp_format_float(mp_obj_float_get(obj), buf, sizeof(buf), 'g', float_precision, '\0');
+        mp_print_str(print, buf);
+        if (strchr(buf, '.') == NULL && strchr(buf, 'e') == NULL && strchr(buf, 'n') == NULL) {
+            mp_print_str(print, ".0");
+        }
+        return;
+    }
+    #endif
+    if (MP_OBJ_IS_TYPE(obj, &mp_type_list) || MP_OBJ_IS_TYPE(obj, &mp_type_tuple)) {
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_get_array(obj, &len, &items);
+        mp_print_str(print, "[");
+        for (size_t i = 0; i < len; i++) {
+            if (i > 0) {
+                mp_print_str(print, ", ");
+            }
+            ujson_encode(print, items[i], float_precision);
+        }
+        mp_print_str(print, "]");
+    } else if (MP_OBJ_IS_TYPE(obj, &mp_type_dict)) {
+        mp_map_t *map = mp_obj_dict_get_map(obj);
+        bool first = true;
+        mp_print_str(print, "{");
+        for (size_t i = 0; i < map->alloc; i++) {
+            if (!MP_MAP_SLOT_IS_FILLED(map, i)) {
+                continue;
+            }
+            if (!first) {
+                mp_print_str(print, ", ");
+            }
+            first = false;
+            mp_obj_print_helper(print, map->table[i].key, PRINT_JSON);
+            mp_print_str(print, ": ");
+            ujson_encode(print, map->table[i].value, float_precision);
+        }
+        mp_print_str(print, "}");
+    } else {
+        mp_obj_print_helper(print, obj, PRINT_JSON);
+    }
+}
+
+STATIC mp_int_t ujson_get_float_precision(mp_obj_t precision_obj) {
+    if (precision_obj == mp_const_none) {
+        return -1;
+    }
+    mp_int_t precision = mp_obj_get_int(precision_obj);
+    if (precision < 1 || precision > 16) {
+        mp_raise_ValueError_varg(translate("%q must be between %d and %d"), MP_QSTR_float_precision, 1, 16);
+    }
+    return precision;
+}
+
+STATIC mp_obj_t mod_ujson_dump(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_obj, ARG_stream, ARG_float_precision };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_float_precision, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    mp_int_t float_precision = ujson_get_float_precision(args[ARG_float_precision].u_obj);
+
+    mp_obj_t stream = args[ARG_stream].u_obj;
     mp_get_stream_raise(stream, MP_STREAM_OP_WRITE);
-    mp_print_t print = {MP_OBJ_TO_PTR(stream), mp_stream_write_adaptor};
-    mp_obj_print_helper(&print, obj, PRINT_JSON);
+    ujson_dump_buf_t d;
+    d.stream_obj = stream;
+    d.len = 0;
+    mp_print_t print = {&d, ujson_dump_strn};
+    ujson_encode(&print, args[ARG_obj].u_obj, float_precision);
+    ujson_dump_flush(&d);
     return mp_const_none;
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_ujson_dump_obj, mod_ujson_dump);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(mod_ujson_dump_obj, 2, mod_ujson_dump);
+
+STATIC mp_obj_t mod_ujson_dumps(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_obj, ARG_float_precision };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_float_precision, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    mp_int_t float_precision = ujson_get_float_precision(args[ARG_float_precision].u_obj);
 
-STATIC mp_obj_t mod_ujson_dumps(mp_obj_t obj) {
     vstr_t vstr;
     mp_print_t print;
     vstr_init_print(&vstr, 8, &print);
-    mp_obj_print_helper(&print, obj, PRINT_JSON);
+    ujson_encode(&print, args[ARG_obj].u_obj, float_precision);
     return mp_obj_new_str_from_vstr(&mp_type_str, &vstr);
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_ujson_dumps_obj, mod_ujson_dumps);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(mod_ujson_dumps_obj, 1, mod_ujson_dumps);
 
-// The function below implements a simple non-recursive JSON parser.
-//
-// The JSON specification is at http://www.ietf.org/rfc/rfc4627.txt
-// The parser here will parse any valid JSON and return the correct
-// corresponding Python object.  It allows through a superset of JSON, since
-// it treats commas and colons as "whitespace", and doesn't care if
-// brackets/braces are correctly paired.  It will raise a ValueError if the
-// input is outside it's specs.
-//
-// Most of the work is parsing the primitives (null, false, true, numbers,
-// strings).  It does 1 pass over the input stream.  It tries to be fast and
-// small in code size, while not using more RAM than necessary.
+// Streams are read in chunks of this many bytes rather than a read call per byte. Parsing
+// carries on to the end of the stream so nothing read ahead is lost.
+#define UJSON_STREAM_BUF_SIZE (256)
 
 typedef struct _ujson_stream_t {
     mp_obj_t stream_obj;
+    // NULL when the whole input is already in memory between pos and end.
     mp_uint_t (*read)(mp_obj_t obj, void *buf, mp_uint_t size, int *errcode);
     int errcode;
     byte cur;
+    const byte *pos;
+    const byte *end;
+    byte buf[UJSON_STREAM_BUF_SIZE];
 } ujson_stream_t;
 
 #define S_EOF (0) // null is not allowed in json stream so is ok as EOF marker
-#define S_END(s) ((s).cur == S_EOF)
-#define S_CUR(s) ((s).cur)
-#define S_NEXT(s) (ujson_stream_next(&(s)))
+#define S_END(s) ((s)->cur == S_EOF)
+#define S_CUR(s) ((s)->cur)
+#define S_NEXT(s) (ujson_stream_next(s))
 
 STATIC byte ujson_stream_next(ujson_stream_t *s) {
-    mp_uint_t ret = s->read(s->stream_obj, &s->cur, 1, &s->errcode);
-    if (s->errcode != 0) {
-        mp_raise_OSError(s->errcode);
-    }
-    if (ret == 0) {
-        s->cur = S_EOF;
+    if (s->pos == s->end) {
+        if (s->read == NULL) {
+            s->cur = S_EOF;
+            return s->cur;
+        }
+        mp_uint_t ret = s->read(s->stream_obj, s->buf, sizeof(s->buf), &s->errcode);
+        if (s->errcode != 0) {
+            mp_raise_OSError(s->errcode);
+        }
+        if (ret == 0) {
+            s->cur = S_EOF;
+            return s->cur;
+        }
+        s->pos = s->buf;
+        s->end = s->buf + ret;
     }
+    s->cur = *s->pos++;
     return s->cur;
 }
 
-STATIC mp_obj_t mod_ujson_load(mp_obj_t stream_obj) {
+STATIC void ujson_stream_init(ujson_stream_t *s, mp_obj_t stream_obj) {
     const mp_stream_p_t *stream_p = mp_get_stream_raise(stream_obj, MP_STREAM_OP_READ);
-    ujson_stream_t s = {stream_obj, stream_p->read, 0, 0};
-    vstr_t vstr;
-    vstr_init(&vstr, 8);
-    mp_obj_list_t stack; // we use a list as a simple stack for nested JSON
-    stack.len = 0;
-    stack.items = NULL;
-    mp_obj_t stack_top = MP_OBJ_NULL;
-    mp_obj_type_t *stack_top_type = NULL;
-    mp_obj_t stack_key = MP_OBJ_NULL;
-    S_NEXT(s);
+    s->stream_obj = stream_obj;
+    s->read = stream_p->read;
+    s->errcode = 0;
+    s->pos = s->end = NULL;
+}
+
+STATIC NORETURN void ujson_fail(void) {
+    mp_raise_ValueError(translate("syntax error in JSON"));
+}
+
+#define UJSON_TOKEN_EOF (0)
+#define UJSON_TOKEN_VALUE (1)
+#define UJSON_TOKEN_LIST (2)
+#define UJSON_TOKEN_DICT (3)
+#define UJSON_TOKEN_CLOSE (4)
+
+// Reads the next token. A primitive is returned in *value, with strings interned as qstrs when
+// intern is true. vstr is scratch space for strings and numbers.
+STATIC int ujson_next_token(ujson_stream_t *s, vstr_t *vstr, bool intern, mp_obj_t *value) {
     for (;;) {
-        cont:
         if (S_END(s)) {
-            break;
+            return UJSON_TOKEN_EOF;
         }
-        mp_obj_t next = MP_OBJ_NULL;
-        bool enter = false;
         byte cur = S_CUR(s);
         S_NEXT(s);
         switch (cur) {
@@ -117,33 +253,30 @@ STATIC mp_obj_t mod_ujson_load(mp_obj_t stream_obj) {
             case '\t':
             case '\n':
             case '\r':
-                goto cont;
+                continue;
             case 'n':
                 if (S_CUR(s) == 'u' && S_NEXT(s) == 'l' && S_NEXT(s) == 'l') {
                     S_NEXT(s);
-                    next = mp_const_none;
-                } else {
-                    goto fail;
+                    *value = mp_const_none;
+                    return UJSON_TOKEN_VALUE;
                 }
-                break;
+                ujson_fail();
             case 'f':
                 if (S_CUR(s) == 'a' && S_NEXT(s) == 'l' && S_NEXT(s) == 's' && S_NEXT(s) == 'e') {
                     S_NEXT(s);
-                    next = mp_const_false;
-                } else {
-                    goto fail;
+                    *value = mp_const_false;
+                    return UJSON_TOKEN_VALUE;
                 }
-                break;
+                ujson_fail();
             case 't':
                 if (S_CUR(s) == 'r' && S_NEXT(s) == 'u' && S_NEXT(s) == 'e') {
                     S_NEXT(s);
-                    next = mp_const_true;
-                } else {
-                    goto fail;
+                    *value = mp_const_true;
+                    return UJSON_TOKEN_VALUE;
                 }
-                break;
+                ujson_fail();
             case '"':
-                vstr_reset(&vstr);
+                vstr_reset(vstr);
                 for (; !S_END(s) && S_CUR(s) != '"';) {
                     byte c = S_CUR(s);
                     if (c == '\\') {
@@ -163,27 +296,31 @@ STATIC mp_obj_t mod_ujson_load(mp_obj_t stream_obj) {
                                     }
                                     num = (num << 4) | c;
                                 }
-                                vstr_add_char(&vstr, num);
+                                vstr_add_char(vstr, num);
                                 goto str_cont;
                             }
                         }
                     }
-                    vstr_add_byte(&vstr, c);
+                    vstr_add_byte(vstr, c);
                 str_cont:
                     S_NEXT(s);
                 }
                 if (S_END(s)) {
-                    goto fail;
+                    ujson_fail();
                 }
                 S_NEXT(s);
-                next = mp_obj_new_str(vstr.buf, vstr.len);
-                break;
+                if (intern && vstr->len < (1 << (8 * MICROPY_QSTR_BYTES_IN_LEN))) {
+                    *value = mp_obj_new_str_via_qstr(vstr->buf, vstr->len);
+                } else {
+                    *value = mp_obj_new_str(vstr->buf, vstr->len);
+                }
+                return UJSON_TOKEN_VALUE;
             case '-':
             case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9': {
                 bool flt = false;
-                vstr_reset(&vstr);
+                vstr_reset(vstr);
                 for (;;) {
-                    vstr_add_byte(&vstr, cur);
+                    vstr_add_byte(vstr, cur);
                     cur = S_CUR(s);
                     if (cur == '.' || cur == 'E' || cur == 'e') {
                         flt = true;
@@ -195,44 +332,81 @@ STATIC mp_obj_t mod_ujson_load(mp_obj_t stream_obj) {
                     S_NEXT(s);
                 }
                 if (flt) {
-                    next = mp_parse_num_decimal(vstr.buf, vstr.len, false, false, NULL);
+                    *value = mp_parse_num_decimal(vstr->buf, vstr->len, false, false, NULL);
                 } else {
-                    next = mp_parse_num_integer(vstr.buf, vstr.len, 10, NULL);
+                    *value = mp_parse_num_integer(vstr->buf, vstr->len, 10, NULL);
                 }
-                break;
+                return UJSON_TOKEN_VALUE;
             }
             case '[':
-                next = mp_obj_new_list(0, NULL);
-                enter = true;
-                break;
+                return UJSON_TOKEN_LIST;
             case '{':
-                next = mp_obj_new_dict(0);
-                enter = true;
-                break;
+                return UJSON_TOKEN_DICT;
             case '}':
-            case ']': {
-                if (stack_top == MP_OBJ_NULL) {
-                    // no object at all
-                    goto fail;
-                }
-                if (stack.len == 0) {
-                    // finished; compound object
-                    goto success;
-                }
-                stack.len -= 1;
-                stack_top = stack.items[stack.len];
-                stack_top_type = mp_obj_get_type(stack_top);
-                goto cont;
-            }
+            case ']':
+                return UJSON_TOKEN_CLOSE;
             default:
-                goto fail;
+                ujson_fail();
+        }
+    }
+}
+
+// The function below implements a simple non-recursive JSON parser.
+//
+// The JSON specification is at http://www.ietf.org/rfc/rfc4627.txt
+// The parser here will parse any valid JSON and return the correct
+// corresponding Python object.  It allows through a superset of JSON, since
+// it treats commas and colons as "whitespace", and doesn't care if
+// brackets/braces are correctly paired.  It will raise a ValueError if the
+// input is outside it's specs.
+//
+// Most of the work is parsing the primitives (null, false, true, numbers,
+// strings).  It does 1 pass over the input stream.  It tries to be fast and
+// small in code size, while not using more RAM than necessary.
+
+STATIC mp_obj_t ujson_load(ujson_stream_t *s, bool intern_keys) {
+    vstr_t vstr;
+    vstr_init(&vstr, 8);
+    mp_obj_list_t stack; // we use a list as a simple stack for nested JSON
+    stack.len = 0;
+    stack.items = NULL;
+    mp_obj_t stack_top = MP_OBJ_NULL;
+    mp_obj_type_t *stack_top_type = NULL;
+    mp_obj_t stack_key = MP_OBJ_NULL;
+    S_NEXT(s);
+    for (;;) {
+        bool want_key = stack_top_type == &mp_type_dict && stack_key == MP_OBJ_NULL;
+        mp_obj_t next = MP_OBJ_NULL;
+        bool enter = false;
+        int token = ujson_next_token(s, &vstr, intern_keys && want_key, &next);
+        if (token == UJSON_TOKEN_EOF) {
+            break;
+        } else if (token == UJSON_TOKEN_LIST) {
+            next = mp_obj_new_list(0, NULL);
+            enter = true;
+        } else if (token == UJSON_TOKEN_DICT) {
+            next = mp_obj_new_dict(0);
+            enter = true;
+        } else if (token == UJSON_TOKEN_CLOSE) {
+            if (stack_top == MP_OBJ_NULL) {
+                // no object at all
+                ujson_fail();
+            }
+            if (stack.len == 0) {
+                // finished; compound object
+                break;
+            }
+            stack.len -= 1;
+            stack_top = stack.items[stack.len];
+            stack_top_type = mp_obj_get_type(stack_top);
+            continue;
         }
         if (stack_top == MP_OBJ_NULL) {
             stack_top = next;
             stack_top_type = mp_obj_get_type(stack_top);
             if (!enter) {
                 // finished; single primitive only
-                goto success;
+                break;
             }
         } else {
             // append to list or dict
@@ -242,7 +416,7 @@ STATIC mp_obj_t mod_ujson_load(mp_obj_t stream_obj) {
                 if (stack_key == MP_OBJ_NULL) {
                     stack_key = next;
                     if (enter) {
-                        goto fail;
+                        ujson_fail();
                     }
                 } else {
                     mp_obj_dict_store(stack_top, stack_key, next);
@@ -261,35 +435,190 @@ STATIC mp_obj_t mod_ujson_load(mp_obj_t stream_obj) {
             }
         }
     }
-    success:
     // eat trailing whitespace
     while (unichar_isspace(S_CUR(s))) {
         S_NEXT(s);
     }
     if (!S_END(s)) {
         // unexpected chars
-        goto fail;
+        ujson_fail();
     }
     if (stack_top == MP_OBJ_NULL || stack.len != 0) {
         // not exactly 1 object
-        goto fail;
+        ujson_fail();
     }
     vstr_clear(&vstr);
     return stack_top;
+}
 
-    fail:
-    mp_raise_ValueError(translate("syntax error in JSON"));
+STATIC const mp_arg_t ujson_load_allowed_args[] = {
+    { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ },
+    { MP_QSTR_intern_keys, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+};
+
+STATIC mp_obj_t mod_ujson_load(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    mp_arg_val_t args[MP_ARRAY_SIZE(ujson_load_allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(ujson_load_allowed_args), ujson_load_allowed_args, args);
+    ujson_stream_t s;
+    ujson_stream_init(&s, args[0].u_obj);
+    return ujson_load(&s, args[1].u_bool);
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_ujson_load_obj, mod_ujson_load);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(mod_ujson_load_obj, 1, mod_ujson_load);
 
-STATIC mp_obj_t mod_ujson_loads(mp_obj_t obj) {
+STATIC mp_obj_t mod_ujson_loads(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    mp_arg_val_t args[MP_ARRAY_SIZE(ujson_load_allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(ujson_load_allowed_args), ujson_load_allowed_args, args);
     size_t len;
-    const char *buf = mp_obj_str_get_data(obj, &len);
-    vstr_t vstr = {len, len, (char*)buf, true};
-    mp_obj_stringio_t sio = {{&mp_type_stringio}, &vstr, 0, MP_OBJ_NULL};
-    return mod_ujson_load(MP_OBJ_FROM_PTR(&sio));
+    const char *buf = mp_obj_str_get_data(args[0].u_obj, &len);
+    // Parse straight from the string, there's nothing to read.
+    ujson_stream_t s;
+    s.stream_obj = MP_OBJ_NULL;
+    s.read = NULL;
+    s.errcode = 0;
+    s.pos = (const byte *) buf;
+    s.end = s.pos + len;
+    bool intern_keys = args[1].u_bool;
+    #if MICROPY_GC_ARENA
+    // The objects of a document are usually dropped together, so keep them together. A
+    // document needs about twice its length in objects.
+    gc_arena_t outer;
+    gc_arena_begin(2 * len, &outer);
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_t result = ujson_load(&s, intern_keys);
+        nlr_pop();
+        gc_arena_end(&outer);
+        return result;
+    } else {
+        gc_arena_end(&outer);
+        nlr_jump(nlr.ret_val);
+    }
+    #else
+    return ujson_load(&s, intern_keys);
+    #endif
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(mod_ujson_loads_obj, 1, mod_ujson_loads);
+
+// iterload() parses the same way as load() but instead of building containers it hands out
+// each primitive with its path, so only the values that are wanted need to be kept.
+
+// Flags for each level in ujson_iter_t.levels.
+#define UJSON_LEVEL_DICT (0x01)
+#define UJSON_LEVEL_HAS_ITEMS (0x02)
+
+typedef struct _ujson_iter_t {
+    mp_obj_base_t base;
+    bool intern_keys;
+    bool started;
+    bool finished;
+    // The position in each open container: the current key of a dict, MP_OBJ_NULL while the
+    // key is still to come, or the index into a list.
+    mp_obj_list_t path;
+    vstr_t levels;
+    vstr_t vstr;
+    ujson_stream_t s;
+} ujson_iter_t;
+
+// Moves the innermost container past the item just finished.
+STATIC void ujson_iter_advance(ujson_iter_t *self) {
+    size_t depth = self->path.len;
+    if (depth == 0) {
+        self->finished = true;
+        return;
+    }
+    self->levels.buf[depth - 1] |= UJSON_LEVEL_HAS_ITEMS;
+    if (self->levels.buf[depth - 1] & UJSON_LEVEL_DICT) {
+        self->path.items[depth - 1] = MP_OBJ_NULL;
+    } else {
+        self->path.items[depth - 1] = MP_OBJ_NEW_SMALL_INT(MP_OBJ_SMALL_INT_VALUE(self->path.items[depth - 1]) + 1);
+    }
+}
+
+STATIC mp_obj_t ujson_iter_emit(ujson_iter_t *self, mp_obj_t value) {
+    mp_obj_t pair[2] = {mp_obj_new_tuple(self->path.len, self->path.items), value};
+    ujson_iter_advance(self);
+    return mp_obj_new_tuple(2, pair);
+}
+
+STATIC mp_obj_t ujson_iter_iternext(mp_obj_t self_in) {
+    ujson_iter_t *self = MP_OBJ_TO_PTR(self_in);
+    ujson_stream_t *s = &self->s;
+    if (!self->started) {
+        self->started = true;
+        S_NEXT(s);
+    }
+    for (;;) {
+        if (self->finished) {
+            // eat trailing whitespace
+            while (unichar_isspace(S_CUR(s))) {
+                S_NEXT(s);
+            }
+            if (!S_END(s)) {
+                // unexpected chars
+                ujson_fail();
+            }
+            return MP_OBJ_STOP_ITERATION;
+        }
+        size_t depth = self->path.len;
+        bool in_dict = depth > 0 && (self->levels.buf[depth - 1] & UJSON_LEVEL_DICT);
+        bool want_key = in_dict && self->path.items[depth - 1] == MP_OBJ_NULL;
+        mp_obj_t value = MP_OBJ_NULL;
+        int token = ujson_next_token(s, &self->vstr, self->intern_keys && want_key, &value);
+        if (token == UJSON_TOKEN_EOF) {
+            // not exactly 1 object
+            ujson_fail();
+        } else if (token == UJSON_TOKEN_CLOSE) {
+            if (depth == 0) {
+                ujson_fail();
+            }
+            bool empty = !(self->levels.buf[depth - 1] & UJSON_LEVEL_HAS_ITEMS);
+            bool dict = in_dict;
+            self->path.len -= 1;
+            self->levels.len -= 1;
+            if (empty) {
+                // An empty container has no primitives so it's handed out itself.
+                return ujson_iter_emit(self, dict ? mp_obj_new_dict(0) : mp_obj_new_list(0, NULL));
+            }
+            ujson_iter_advance(self);
+        } else if (token == UJSON_TOKEN_VALUE) {
+            if (want_key) {
+                self->path.items[depth - 1] = value;
+                continue;
+            }
+            return ujson_iter_emit(self, value);
+        } else {
+            if (want_key) {
+                ujson_fail();
+            }
+            bool dict = token == UJSON_TOKEN_DICT;
+            mp_obj_list_append(MP_OBJ_FROM_PTR(&self->path), dict ? MP_OBJ_NULL : MP_OBJ_NEW_SMALL_INT(0));
+            vstr_add_byte(&self->levels, dict ? UJSON_LEVEL_DICT : 0);
+        }
+    }
+}
+
+STATIC const mp_obj_type_t ujson_iter_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_iterator,
+    .getiter = mp_identity_getiter,
+    .iternext = ujson_iter_iternext,
+};
+
+STATIC mp_obj_t mod_ujson_iterload(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    mp_arg_val_t args[MP_ARRAY_SIZE(ujson_load_allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(ujson_load_allowed_args), ujson_load_allowed_args, args);
+    ujson_iter_t *self = m_new_obj(ujson_iter_t);
+    self->base.type = &ujson_iter_type;
+    ujson_stream_init(&self->s, args[0].u_obj);
+    self->intern_keys = args[1].u_bool;
+    self->started = false;
+    self->finished = false;
+    mp_obj_list_init(&self->path, 0);
+    vstr_init(&self->levels, 8);
+    vstr_init(&self->vstr, 8);
+    return MP_OBJ_FROM_PTR(self);
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_ujson_loads_obj, mod_ujson_loads);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(mod_ujson_iterload_obj, 1, mod_ujson_iterload);
 
 STATIC const mp_rom_map_elem_t mp_module_ujson_globals_table[] = {
 #if CIRCUITPY
@@ -300,6 +629,7 @@ STATIC const mp_rom_map_elem_t mp_module_ujson_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_dump), MP_ROM_PTR(&mod_ujson_dump_obj) },
     { MP_ROM_QSTR(MP_QSTR_dumps), MP_ROM_PTR(&mod_ujson_dumps_obj) },
     { MP_ROM_QSTR(MP_QSTR_load), MP_ROM_PTR(&mod_ujson_load_obj) },
+    { MP_ROM_QSTR(MP_QSTR_iterload), MP_ROM_PTR(&mod_ujson_iterload_obj) },
     { MP_ROM_QSTR(MP_QSTR_loads), MP_ROM_PTR(&mod_ujson_loads_obj) },
 };
 
@@ -30,6 +30,7 @@
 
 #include "py/runtime.h"
 #include "py/binary.h"
+#include "py/gc.h"
 #include "py/objstr.h"
 #include "py/stackctrl.h"
 
@@ -233,13 +234,9 @@ STATIC mp_obj_t re_search(size_t n_args, const mp_obj_t *args) {
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(re_search_obj, 2, 4, re_search);
 
-STATIC mp_obj_t re_split(size_t n_args, const mp_obj_t *args) {
+STATIC mp_obj_t re_split_helper(size_t n_args, const mp_obj_t *args, Subject subj) {
     mp_obj_re_t *self = MP_OBJ_TO_PTR(args[0]);
-    Subject subj;
-    size_t len;
     const mp_obj_type_t *str_type = mp_obj_get_type(args[1]);
-    subj.begin = mp_obj_str_get_data(args[1], &len);
-    subj.end = subj.begin + len;
     int caps_num = (self->re.sub + 1) * 2;
 
     int maxsplit = 0;
@@ -276,6 +273,30 @@ STATIC mp_obj_t re_split(size_t n_args, const mp_obj_t *args) {
     mp_obj_list_append(retval, s);
     return retval;
 }
+
+STATIC mp_obj_t re_split(size_t n_args, const mp_obj_t *args) {
+    Subject subj;
+    size_t len;
+    subj.begin = mp_obj_str_get_data(args[1], &len);
+    subj.end = subj.begin + len;
+    #if MICROPY_GC_ARENA
+    // Keep the pieces and the list together so they leave one run of free memory behind.
+    gc_arena_t outer;
+    gc_arena_begin(2 * len, &outer);
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_t result = re_split_helper(n_args, args, subj);
+        nlr_pop();
+        gc_arena_end(&outer);
+        return result;
+    } else {
+        gc_arena_end(&outer);
+        nlr_jump(nlr.ret_val);
+    }
+    #else
+    return re_split_helper(n_args, args, subj);
+    #endif
+}
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(re_split_obj, 2, 3, re_split);
 
 #if MICROPY_PY_URE_SUB
@@ -438,9 +459,43 @@ error:
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_re_compile_obj, 1, 2, mod_re_compile);
 
+#if MICROPY_PY_URE_CACHE
+// Compile a pattern given to one of the module-level functions, reusing the compiled
+// form when it is one of the last few patterns seen. ure_cache holds (pattern, compiled)
+// pairs with the most recently used first.
+STATIC mp_obj_t mod_re_compile_cached(mp_obj_t pattern) {
+    mp_obj_t *cache = MP_STATE_VM(ure_cache);
+    size_t i = 0;
+    for (; i < MICROPY_PY_URE_CACHE; i++) {
+        mp_obj_t cached = cache[i * 2];
+        if (cached == MP_OBJ_NULL) {
+            break;
+        }
+        if (cached == pattern || (mp_obj_get_type(cached) == mp_obj_get_type(pattern) && mp_obj_equal(cached, pattern))) {
+            mp_obj_t re = cache[i * 2 + 1];
+            memmove(cache + 2, cache, i * 2 * sizeof(mp_obj_t));
+            cache[0] = cached;
+            cache[1] = re;
+            return re;
+        }
+    }
+    mp_obj_t re = mod_re_compile(1, &pattern);
+    if (i == MICROPY_PY_URE_CACHE) {
+        // Drop the least recently used pattern.
+        i--;
+    }
+    memmove(cache + 2, cache, i * 2 * sizeof(mp_obj_t));
+    cache[0] = pattern;
+    cache[1] = re;
+    return re;
+}
+#else
+#define mod_re_compile_cached(pattern) mod_re_compile(1, &(pattern))
+#endif
+
 STATIC mp_obj_t mod_re_exec(bool is_anchored, uint n_args, const mp_obj_t *args) {
     (void)n_args;
-    mp_obj_t self = mod_re_compile(1, args);
+    mp_obj_t self = mod_re_compile_cached(args[0]);
 
     const mp_obj_t args2[] = {self, args[1]};
     mp_obj_t match = ure_exec(is_anchored, 2, args2);
@@ -459,7 +514,7 @@ MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_re_search_obj, 2, 4, mod_re_search);
 
 #if MICROPY_PY_URE_SUB
 STATIC mp_obj_t mod_re_sub(size_t n_args, const mp_obj_t *args) {
-    mp_obj_t self = mod_re_compile(1, args);
+    mp_obj_t self = mod_re_compile_cached(args[0]);
     return re_sub_helper(self, n_args, args);
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_re_sub_obj, 3, 5, mod_re_sub);
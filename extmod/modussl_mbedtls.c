@@ -61,10 +61,52 @@ struct ssl_args {
     mp_arg_val_t cert;
     mp_arg_val_t server_side;
     mp_arg_val_t server_hostname;
+    mp_arg_val_t max_fragment_length;
 };
 
 STATIC const mp_obj_type_t ussl_socket_type;
 
+#if MICROPY_PY_USSL_SESSION_CACHE
+// Sessions from past client handshakes, by server_hostname, so that connecting to the same
+// host again can resume one instead of doing a full handshake. The oldest gets replaced.
+typedef struct _ussl_session_entry_t {
+    mp_obj_t hostname; // MP_OBJ_NULL for an unused entry
+    mbedtls_ssl_session session;
+} ussl_session_entry_t;
+
+typedef struct _ussl_session_cache_t {
+    size_t next;
+    ussl_session_entry_t entries[MICROPY_PY_USSL_SESSION_CACHE];
+} ussl_session_cache_t;
+
+STATIC ussl_session_entry_t *ussl_session_find(mp_obj_t hostname, bool add) {
+    ussl_session_cache_t *cache = MP_STATE_VM(ussl_session_cache);
+    if (cache == NULL) {
+        if (!add) {
+            return NULL;
+        }
+        cache = m_new0(ussl_session_cache_t, 1);
+        for (size_t i = 0; i < MICROPY_PY_USSL_SESSION_CACHE; i++) {
+            mbedtls_ssl_session_init(&cache->entries[i].session);
+        }
+        MP_STATE_VM(ussl_session_cache) = cache;
+    }
+    for (size_t i = 0; i < MICROPY_PY_USSL_SESSION_CACHE; i++) {
+        ussl_session_entry_t *e = &cache->entries[i];
+        if (e->hostname != MP_OBJ_NULL && mp_obj_equal(e->hostname, hostname)) {
+            return e;
+        }
+    }
+    if (!add) {
+        return NULL;
+    }
+    ussl_session_entry_t *e = &cache->entries[cache->next];
+    cache->next = (cache->next + 1) % MICROPY_PY_USSL_SESSION_CACHE;
+    e->hostname = hostname;
+    return e;
+}
+#endif
+
 #ifdef MBEDTLS_DEBUG_C
 STATIC void mbedtls_debug(void *ctx, int level, const char *file, int line, const char *str) {
     (void)ctx;
@@ -148,6 +190,17 @@ STATIC mp_obj_ssl_socket_t *socket_new(mp_obj_t sock, struct ssl_args *args) {
     }
 
     mbedtls_ssl_conf_authmode(&o->conf, MBEDTLS_SSL_VERIFY_NONE);
+    #if defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
+    // Ask the server for smaller records, for ports whose mbedtls config makes
+    // MBEDTLS_SSL_MAX_CONTENT_LEN smaller than 16 KB to save RAM.
+    if (args->max_fragment_length.u_int != 0) {
+        unsigned char mfl = MBEDTLS_SSL_MAX_FRAG_LEN_512;
+        while (mfl < MBEDTLS_SSL_MAX_FRAG_LEN_4096 && (256 << mfl) < args->max_fragment_length.u_int) {
+            mfl++;
+        }
+        mbedtls_ssl_conf_max_frag_len(&o->conf, mfl);
+    }
+    #endif
     mbedtls_ssl_conf_rng(&o->conf, mbedtls_ctr_drbg_random, &o->ctr_drbg);
     #ifdef MBEDTLS_DEBUG_C
     mbedtls_ssl_conf_dbg(&o->conf, mbedtls_debug, NULL);
@@ -164,6 +217,16 @@ STATIC mp_obj_ssl_socket_t *socket_new(mp_obj_t sock, struct ssl_args *args) {
         if (ret != 0) {
             goto cleanup;
         }
+
+        #if MICROPY_PY_USSL_SESSION_CACHE
+        if (!args->server_side.u_bool) {
+            ussl_session_entry_t *cached = ussl_session_find(args->server_hostname.u_obj, false);
+            if (cached != NULL) {
+                // If the server won't resume it this is just a full handshake.
+                mbedtls_ssl_set_session(&o->ssl, &cached->session);
+            }
+        }
+        #endif
     }
 
     mbedtls_ssl_set_bio(&o->ssl, &o->sock, _mbedtls_ssl_send, _mbedtls_ssl_recv, NULL);
@@ -192,6 +255,15 @@ STATIC mp_obj_ssl_socket_t *socket_new(mp_obj_t sock, struct ssl_args *args) {
         }
     }
 
+    #if MICROPY_PY_USSL_SESSION_CACHE
+    if (!args->server_side.u_bool && args->server_hostname.u_obj != mp_const_none) {
+        ussl_session_entry_t *e = ussl_session_find(args->server_hostname.u_obj, true);
+        if (mbedtls_ssl_get_session(&o->ssl, &e->session) != 0) {
+            e->hostname = MP_OBJ_NULL;
+        }
+    }
+    #endif
+
     return o;
 
 cleanup:
@@ -329,6 +401,7 @@ STATIC mp_obj_t mod_ssl_wrap_socket(size_t n_args, const mp_obj_t *pos_args, mp_
         { MP_QSTR_cert, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_server_side, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
         { MP_QSTR_server_hostname, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_max_fragment_length, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
     };
 
     // TODO: Check that sock implements stream protocol
@@ -146,6 +146,323 @@ STATIC const mp_obj_type_t decompio_type = {
     .locals_dict = (void*)&decompio_locals_dict,
 };
 
+#if MICROPY_PY_UZLIB_COMPRESS
+
+// Compression writes DEFLATE blocks with the fixed Huffman codes, finding matches
+// with a one-entry-per-hash LZ77 search like uzlib's own compressor. The input is kept in
+// a buffer twice the window size: the window of history the matches can reach back into,
+// then the data not encoded yet. Encoding waits for a full MAX_MATCH of lookahead so that
+// the output doesn't depend on how the input was split into writes.
+
+#define DEFLATE_MIN_MATCH (3)
+#define DEFLATE_MAX_MATCH (258)
+#define DEFLATE_NO_POS (0xffff)
+// Block headers: BFINAL in the first bit, then BTYPE
+#define DEFLATE_STORED_BLOCK (0)
+#define DEFLATE_FIXED_BLOCK (1 << 1)
+#define DEFLATE_FINAL_BLOCK (1)
+
+STATIC const uint16_t deflate_length_base[] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258,
+};
+
+STATIC const uint16_t deflate_dist_base[] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577,
+};
+
+typedef struct _deflate_t {
+    vstr_t out;
+    byte *buf;
+    uint16_t *hash_table;
+    size_t window_size;
+    size_t len;
+    size_t pos;
+    uint32_t adler;
+    uint32_t bits;
+    uint8_t nbits;
+    uint8_t hash_bits;
+    bool raw;
+} deflate_t;
+
+STATIC void deflate_put_bits(deflate_t *d, uint32_t value, uint8_t nbits) {
+    d->bits |= value << d->nbits;
+    d->nbits += nbits;
+    while (d->nbits >= 8) {
+        vstr_add_byte(&d->out, d->bits);
+        d->bits >>= 8;
+        d->nbits -= 8;
+    }
+}
+
+// Huffman codes go out most significant bit first.
+STATIC void deflate_put_code(deflate_t *d, uint32_t code, uint8_t nbits) {
+    uint32_t reversed = 0;
+    for (uint8_t i = 0; i < nbits; i++) {
+        reversed = (reversed << 1) | (code & 1);
+        code >>= 1;
+    }
+    deflate_put_bits(d, reversed, nbits);
+}
+
+STATIC void deflate_put_symbol(deflate_t *d, uint16_t sym) {
+    if (sym < 144) {
+        deflate_put_code(d, 0x30 + sym, 8);
+    } else if (sym < 256) {
+        deflate_put_code(d, 0x190 + sym - 144, 9);
+    } else if (sym < 280) {
+        deflate_put_code(d, sym - 256, 7);
+    } else {
+        deflate_put_code(d, 0xc0 + sym - 280, 8);
+    }
+}
+
+STATIC void deflate_put_match(deflate_t *d, size_t length, size_t dist) {
+    size_t code = MP_ARRAY_SIZE(deflate_length_base) - 1;
+    while (deflate_length_base[code] > length) {
+        code--;
+    }
+    deflate_put_symbol(d, 257 + code);
+    if (code >= 8 && code < 28) {
+        deflate_put_bits(d, length - deflate_length_base[code], (code - 4) / 4);
+    }
+    code = MP_ARRAY_SIZE(deflate_dist_base) - 1;
+    while (deflate_dist_base[code] > dist) {
+        code--;
+    }
+    deflate_put_code(d, code, 5);
+    if (code >= 4) {
+        deflate_put_bits(d, dist - deflate_dist_base[code], (code - 2) / 2);
+    }
+}
+
+STATIC size_t deflate_hash(deflate_t *d, const byte *p) {
+    uint32_t h = (p[0] << 16) | (p[1] << 8) | p[2];
+    return (h * 2654435761u) >> (32 - d->hash_bits);
+}
+
+// Encode the buffered input, keeping back a MAX_MATCH of lookahead unless finishing.
+STATIC void deflate_encode(deflate_t *d, bool finish) {
+    size_t keep = finish ? 0 : DEFLATE_MAX_MATCH;
+    while (d->len - d->pos > keep) {
+        size_t avail = d->len - d->pos;
+        const byte *p = d->buf + d->pos;
+        size_t length = 0;
+        size_t dist = 0;
+        if (avail >= DEFLATE_MIN_MATCH) {
+            size_t h = deflate_hash(d, p);
+            size_t cand = d->hash_table[h];
+            d->hash_table[h] = d->pos;
+            if (cand < d->pos && d->pos - cand <= d->window_size) {
+                const byte *c = d->buf + cand;
+                size_t max = MIN(avail, DEFLATE_MAX_MATCH);
+                while (length < max && c[length] == p[length]) {
+                    length++;
+                }
+                dist = d->pos - cand;
+            }
+        }
+        if (length >= DEFLATE_MIN_MATCH) {
+            deflate_put_match(d, length, dist);
+            // Index the positions inside the match too, for the matches after it.
+            for (size_t i = 1; i < length && i + DEFLATE_MIN_MATCH <= avail; i++) {
+                d->hash_table[deflate_hash(d, p + i)] = d->pos + i;
+            }
+            d->pos += length;
+        } else {
+            deflate_put_symbol(d, *p);
+            d->pos++;
+        }
+    }
+}
+
+STATIC void deflate_init(deflate_t *d, mp_int_t wbits) {
+    d->raw = wbits < 0;
+    if (d->raw) {
+        wbits = -wbits;
+    }
+    if (wbits < 9 || wbits > 15) {
+        mp_raise_ValueError_varg(translate("%q must be between %d and %d"), MP_QSTR_wbits, 9, 15);
+    }
+    d->window_size = 1 << wbits;
+    d->hash_bits = wbits - 2;
+    d->buf = m_new(byte, 2 * d->window_size);
+    d->hash_table = m_new(uint16_t, 1 << d->hash_bits);
+    memset(d->hash_table, 0xff, sizeof(uint16_t) << d->hash_bits);
+    d->len = 0;
+    d->pos = 0;
+    d->adler = 1;
+    d->bits = 0;
+    d->nbits = 0;
+    vstr_init(&d->out, 64);
+    if (!d->raw) {
+        byte cmf = ((wbits - 8) << 4) | 8;
+        vstr_add_byte(&d->out, cmf);
+        vstr_add_byte(&d->out, 31 - (cmf << 8) % 31);
+    }
+    deflate_put_bits(d, DEFLATE_FIXED_BLOCK, 3);
+}
+
+STATIC void deflate_write(deflate_t *d, const byte *data, size_t len) {
+    if (!d->raw) {
+        d->adler = uzlib_adler32(data, len, d->adler);
+    }
+    while (len > 0) {
+        if (d->len == 2 * d->window_size) {
+            // Slide the window down, forgetting positions that have moved out of it.
+            size_t shift = d->pos - d->window_size;
+            memmove(d->buf, d->buf + shift, d->len - shift);
+            d->len -= shift;
+            d->pos -= shift;
+            for (size_t i = 0; i < ((size_t)1 << d->hash_bits); i++) {
+                uint16_t p = d->hash_table[i];
+                d->hash_table[i] = (p == DEFLATE_NO_POS || p < shift) ? DEFLATE_NO_POS : p - shift;
+            }
+        }
+        size_t n = MIN(len, 2 * d->window_size - d->len);
+        memcpy(d->buf + d->len, data, n);
+        d->len += n;
+        data += n;
+        len -= n;
+        deflate_encode(d, false);
+    }
+}
+
+STATIC void deflate_align(deflate_t *d) {
+    if (d->nbits > 0) {
+        deflate_put_bits(d, 0, 8 - d->nbits);
+    }
+}
+
+// End the block and add an empty stored block, like Z_SYNC_FLUSH, so that everything
+// written so far can be decompressed from the bytes output so far.
+STATIC void deflate_flush(deflate_t *d) {
+    deflate_encode(d, true);
+    deflate_put_symbol(d, 256);
+    deflate_put_bits(d, DEFLATE_STORED_BLOCK, 3);
+    deflate_align(d);
+    vstr_add_strn(&d->out, "\x00\x00\xff\xff", 4);
+    deflate_put_bits(d, DEFLATE_FIXED_BLOCK, 3);
+}
+
+STATIC void deflate_finish(deflate_t *d) {
+    deflate_encode(d, true);
+    deflate_put_symbol(d, 256);
+    // An empty final block ends the stream.
+    deflate_put_bits(d, DEFLATE_FINAL_BLOCK | DEFLATE_FIXED_BLOCK, 3);
+    deflate_put_symbol(d, 256);
+    deflate_align(d);
+    if (!d->raw) {
+        for (int i = 24; i >= 0; i -= 8) {
+            vstr_add_byte(&d->out, d->adler >> i);
+        }
+    }
+    m_del(byte, d->buf, 2 * d->window_size);
+    m_del(uint16_t, d->hash_table, 1 << d->hash_bits);
+    d->buf = NULL;
+    d->hash_table = NULL;
+}
+
+typedef struct _mp_obj_compio_t {
+    mp_obj_base_t base;
+    mp_obj_t dest_stream;
+    deflate_t comp;
+} mp_obj_compio_t;
+
+STATIC mp_obj_t compio_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
+    mp_arg_check_num(n_args, kw_args, 1, 2, false);
+    mp_get_stream_raise(args[0], MP_STREAM_OP_WRITE);
+    mp_obj_compio_t *o = m_new_obj(mp_obj_compio_t);
+    o->base.type = type;
+    o->dest_stream = args[0];
+    deflate_init(&o->comp, n_args > 1 ? mp_obj_get_int(args[1]) : 10);
+    return MP_OBJ_FROM_PTR(o);
+}
+
+// Pass the whole bytes encoded so far on to the destination stream.
+STATIC void compio_write_out(mp_obj_compio_t *o) {
+    mp_stream_write(o->dest_stream, o->comp.out.buf, o->comp.out.len, MP_STREAM_RW_WRITE);
+    o->comp.out.len = 0;
+}
+
+STATIC mp_uint_t compio_write(mp_obj_t o_in, const void *buf, mp_uint_t size, int *errcode) {
+    mp_obj_compio_t *o = MP_OBJ_TO_PTR(o_in);
+    if (o->comp.buf == NULL) {
+        *errcode = MP_EINVAL;
+        return MP_STREAM_ERROR;
+    }
+    deflate_write(&o->comp, buf, size);
+    if (o->comp.out.len >= 64) {
+        compio_write_out(o);
+    }
+    return size;
+}
+
+STATIC mp_uint_t compio_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg, int *errcode) {
+    (void)arg;
+    mp_obj_compio_t *o = MP_OBJ_TO_PTR(o_in);
+    if (request == MP_STREAM_FLUSH) {
+        if (o->comp.buf != NULL) {
+            deflate_flush(&o->comp);
+            compio_write_out(o);
+        }
+        return 0;
+    } else if (request == MP_STREAM_CLOSE) {
+        if (o->comp.buf != NULL) {
+            deflate_finish(&o->comp);
+            compio_write_out(o);
+            vstr_clear(&o->comp.out);
+        }
+        return 0;
+    }
+    *errcode = MP_EINVAL;
+    return MP_STREAM_ERROR;
+}
+
+STATIC mp_obj_t compio___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    return mp_stream_close(args[0]);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(compio___exit___obj, 4, 4, compio___exit__);
+
+STATIC const mp_rom_map_elem_t compio_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&mp_stream_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&mp_stream_flush_obj) },
+    { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&mp_stream_close_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&mp_identity_obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&compio___exit___obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(compio_locals_dict, compio_locals_dict_table);
+
+STATIC const mp_stream_p_t compio_stream_p = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_stream)
+    .write = compio_write,
+    .ioctl = compio_ioctl,
+};
+
+STATIC const mp_obj_type_t compio_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_CompressIO,
+    .make_new = compio_make_new,
+    .protocol = &compio_stream_p,
+    .locals_dict = (void*)&compio_locals_dict,
+};
+
+STATIC mp_obj_t mod_uzlib_compress(size_t n_args, const mp_obj_t *args) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[0], &bufinfo, MP_BUFFER_READ);
+    deflate_t comp;
+    deflate_init(&comp, n_args > 1 ? mp_obj_get_int(args[1]) : 10);
+    deflate_write(&comp, bufinfo.buf, bufinfo.len);
+    deflate_finish(&comp);
+    return mp_obj_new_str_from_vstr(&mp_type_bytes, &comp.out);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_uzlib_compress_obj, 1, 2, mod_uzlib_compress);
+
+#endif // MICROPY_PY_UZLIB_COMPRESS
+
 STATIC mp_obj_t mod_uzlib_decompress(size_t n_args, const mp_obj_t *args) {
     mp_obj_t data = args[0];
     mp_buffer_info_t bufinfo;
@@ -156,6 +473,10 @@ STATIC mp_obj_t mod_uzlib_decompress(size_t n_args, const mp_obj_t *args) {
     DEBUG_printf("sizeof(TINF_DATA)=" UINT_FMT "\n", sizeof(*decomp));
     uzlib_uncompress_init(decomp, NULL, 0);
     mp_uint_t dest_buf_size = (bufinfo.len + 15) & ~15;
+    if (n_args > 2 && mp_obj_get_int(args[2]) > 0) {
+        // Caller knows roughly how big the output is.
+        dest_buf_size = mp_obj_get_int(args[2]);
+    }
     byte *dest_buf = m_new(byte, dest_buf_size);
 
     decomp->dest = dest_buf;
@@ -185,11 +506,13 @@ STATIC mp_obj_t mod_uzlib_decompress(size_t n_args, const mp_obj_t *args) {
         if (st == TINF_DONE) {
             break;
         }
+        // Grow by half again so that large outputs aren't copied over and over.
         size_t offset = decomp->dest - dest_buf;
-        dest_buf = m_renew(byte, dest_buf, dest_buf_size, dest_buf_size + 256);
-        dest_buf_size += 256;
+        size_t grow = MAX(256, dest_buf_size / 2);
+        dest_buf = m_renew(byte, dest_buf, dest_buf_size, dest_buf_size + grow);
+        dest_buf_size += grow;
         decomp->dest = dest_buf + offset;
-        decomp->dest_limit = dest_buf + offset + 256;
+        decomp->dest_limit = dest_buf + offset + grow;
     }
 
     mp_uint_t final_sz = decomp->dest - dest_buf;
@@ -208,6 +531,10 @@ STATIC const mp_rom_map_elem_t mp_module_uzlib_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_uzlib) },
     { MP_ROM_QSTR(MP_QSTR_decompress), MP_ROM_PTR(&mod_uzlib_decompress_obj) },
     { MP_ROM_QSTR(MP_QSTR_DecompIO), MP_ROM_PTR(&decompio_type) },
+    #if MICROPY_PY_UZLIB_COMPRESS
+    { MP_ROM_QSTR(MP_QSTR_compress), MP_ROM_PTR(&mod_uzlib_compress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_CompressIO), MP_ROM_PTR(&compio_type) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_uzlib_globals, mp_module_uzlib_globals_table);
@@ -79,8 +79,50 @@ recursiveloop(char *pc, const char *sp, Subject *input, const char **subp, int n
 	}
 }
 
+// If every match has to start by consuming a byte with one particular Char or class
+// instruction, return it, so that a search can skip the places where it can't match.
+static const char *
+leadingconsumer(ByteProg *prog)
+{
+	const char *pc = HANDLE_ANCHORED(prog->insts, 1);
+
+	while(*pc == Save)
+		pc += 2;
+	if(*pc == Char || *pc == Class || *pc == ClassNot || *pc == NamedClass)
+		return pc;
+	return nil;
+}
+
 int
 re1_5_recursiveloopprog(ByteProg *prog, Subject *input, const char **subp, int nsubp, int is_anchored)
 {
-	return recursiveloop(HANDLE_ANCHORED(prog->insts, is_anchored), input->begin, input, subp, nsubp);
+	const char *lead;
+	const char *sp;
+
+	if(is_anchored || (lead = leadingconsumer(prog)) == nil)
+		return recursiveloop(HANDLE_ANCHORED(prog->insts, is_anchored), input->begin, input, subp, nsubp);
+
+	// Run the anchored program only where the leading instruction matches, instead of
+	// the non-anchored prefix trying it at every position.
+	for(sp = input->begin; sp < input->end; sp++) {
+		switch(*lead) {
+		case Char:
+			sp = memchr(sp, lead[1], input->end - sp);
+			if(sp == nil)
+				return 0;
+			break;
+		case Class:
+		case ClassNot:
+			if(!_re1_5_classmatch(lead + 1, sp))
+				continue;
+			break;
+		case NamedClass:
+			if(!_re1_5_namedclassmatch(lead + 1, sp))
+				continue;
+			break;
+		}
+		if(recursiveloop(HANDLE_ANCHORED(prog->insts, 1), sp, input, subp, nsubp))
+			return 1;
+	}
+	return 0;
 }
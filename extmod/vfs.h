@@ -74,6 +74,7 @@ mp_obj_t mp_vfs_ilistdir_it_iternext(mp_obj_t self_in);
 
 mp_vfs_mount_t *mp_vfs_lookup_path(const char *path, const char **path_out);
 mp_import_stat_t mp_vfs_import_stat(const char *path);
+bool mp_vfs_import_file_info(const char *path, mp_uint_t *size, mp_uint_t *mtime);
 mp_obj_t mp_vfs_mount(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args);
 mp_obj_t mp_vfs_umount(mp_obj_t mnt_in);
 mp_obj_t mp_vfs_open(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args);
@@ -205,6 +205,118 @@ STATIC mp_obj_t fat_vfs_ilistdir_func(size_t n_args, const mp_obj_t *args) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(fat_vfs_ilistdir_obj, 1, 2, fat_vfs_ilistdir_func);
 
+// Modification time of a directory entry in seconds since the epoch
+STATIC mp_uint_t fat_vfs_fno_seconds(const FILINFO *fno) {
+    return timeutils_seconds_since_epoch(
+        1980 + ((fno->fdate >> 9) & 0x7f),
+        (fno->fdate >> 5) & 0x0f,
+        fno->fdate & 0x1f,
+        (fno->ftime >> 11) & 0x1f,
+        (fno->ftime >> 5) & 0x3f,
+        2 * (fno->ftime & 0x1f)
+    );
+}
+
+// The entry scandir() yields. The iterator fills the same entry with each
+// file it reads, so the entry is only valid until the next step. The name
+// object is only created if it is asked for.
+typedef struct _mp_vfs_fat_dir_entry_t {
+    mp_obj_base_t base;
+    FILINFO fno;
+} mp_vfs_fat_dir_entry_t;
+
+STATIC void fat_vfs_dir_entry_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
+    if (dest[0] != MP_OBJ_NULL) {
+        // not load attribute
+        return;
+    }
+    mp_vfs_fat_dir_entry_t *self = MP_OBJ_TO_PTR(self_in);
+    switch (attr) {
+        case MP_QSTR_name:
+            dest[0] = mp_obj_new_str(self->fno.fname, strlen(self->fno.fname));
+            break;
+        case MP_QSTR_mode:
+            dest[0] = MP_OBJ_NEW_SMALL_INT((self->fno.fattrib & AM_DIR) ? MP_S_IFDIR : MP_S_IFREG);
+            break;
+        case MP_QSTR_size:
+            dest[0] = mp_obj_new_int_from_uint(self->fno.fsize);
+            break;
+        case MP_QSTR_mtime:
+            dest[0] = mp_obj_new_int_from_uint(fat_vfs_fno_seconds(&self->fno));
+            break;
+    }
+}
+
+STATIC const mp_obj_type_t mp_type_vfs_fat_dir_entry = {
+    { &mp_type_type },
+    .name = MP_QSTR_DirEntry,
+    .attr = fat_vfs_dir_entry_attr,
+};
+
+typedef struct _mp_vfs_fat_scandir_it_t {
+    mp_obj_base_t base;
+    mp_fun_1_t iternext;
+    // Keeps alive the string the directory's pattern points into
+    mp_obj_t pattern;
+    mp_vfs_fat_dir_entry_t *entry;
+    FF_DIR dir;
+} mp_vfs_fat_scandir_it_t;
+
+STATIC mp_obj_t mp_vfs_fat_scandir_it_iternext(mp_obj_t self_in) {
+    mp_vfs_fat_scandir_it_t *self = MP_OBJ_TO_PTR(self_in);
+    FILINFO *fno = &self->entry->fno;
+    FRESULT res;
+    #if _USE_FIND
+    if (self->pattern != mp_const_none) {
+        res = f_findnext(&self->dir, fno);
+    } else
+    #endif
+    {
+        res = f_readdir(&self->dir, fno);
+    }
+    if (res != FR_OK || fno->fname[0] == 0) {
+        // stop on error or end of dir; ignore the close error because we may
+        // be closing a second time
+        f_closedir(&self->dir);
+        return MP_OBJ_STOP_ITERATION;
+    }
+    return MP_OBJ_FROM_PTR(self->entry);
+}
+
+/// \function scandir(path, pattern=None)
+/// Iterate over a directory, yielding an entry with the name, mode, size and
+/// mtime of each file read in the same pass. If given, pattern is a FatFs
+/// wildcard pattern (using ? and *) and only matching names are yielded.
+STATIC mp_obj_t fat_vfs_scandir(size_t n_args, const mp_obj_t *args) {
+    mp_obj_fat_vfs_t *self = MP_OBJ_TO_PTR(args[0]);
+    const char *path = mp_obj_str_get_str(args[1]);
+    mp_obj_t pattern = n_args > 2 ? args[2] : mp_const_none;
+    #if _USE_FIND
+    const char *pattern_str = pattern != mp_const_none ? mp_obj_str_get_str(pattern) : NULL;
+    #else
+    if (pattern != mp_const_none) {
+        mp_raise_NotImplementedError(NULL);
+    }
+    #endif
+
+    mp_vfs_fat_scandir_it_t *iter = m_new_obj(mp_vfs_fat_scandir_it_t);
+    iter->base.type = &mp_type_polymorph_iter;
+    iter->iternext = mp_vfs_fat_scandir_it_iternext;
+    iter->pattern = pattern;
+    iter->entry = m_new_obj(mp_vfs_fat_dir_entry_t);
+    iter->entry->base.type = &mp_type_vfs_fat_dir_entry;
+    FRESULT res = f_opendir(&self->fatfs, &iter->dir, path);
+    if (res != FR_OK) {
+        mp_raise_OSError(fresult_to_errno_table[res]);
+    }
+    #if _USE_FIND
+    iter->dir.pat = pattern_str;
+    #endif
+
+    return MP_OBJ_FROM_PTR(iter);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(fat_vfs_scandir_obj, 2, 3, fat_vfs_scandir);
+
 STATIC mp_obj_t fat_vfs_remove_internal(mp_obj_t vfs_in, mp_obj_t path_in, mp_int_t attr) {
     mp_obj_fat_vfs_t *self = MP_OBJ_TO_PTR(vfs_in);
     verify_fs_writable(self);
@@ -345,14 +457,7 @@ STATIC mp_obj_t fat_vfs_stat(mp_obj_t vfs_in, mp_obj_t path_in) {
     } else {
         mode |= MP_S_IFREG;
     }
-    mp_uint_t seconds = timeutils_seconds_since_epoch(
-        1980 + ((fno.fdate >> 9) & 0x7f),
-        (fno.fdate >> 5) & 0x0f,
-        fno.fdate & 0x1f,
-        (fno.ftime >> 11) & 0x1f,
-        (fno.ftime >> 5) & 0x3f,
-        2 * (fno.ftime & 0x1f)
-    );
+    mp_uint_t seconds = fat_vfs_fno_seconds(&fno);
     t->items[0] = MP_OBJ_NEW_SMALL_INT(mode); // st_mode
     t->items[1] = MP_OBJ_NEW_SMALL_INT(0); // st_ino
     t->items[2] = MP_OBJ_NEW_SMALL_INT(0); // st_dev
@@ -471,6 +576,7 @@ STATIC const mp_rom_map_elem_t fat_vfs_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_mkfs), MP_ROM_PTR(&fat_vfs_mkfs_obj) },
     { MP_ROM_QSTR(MP_QSTR_open), MP_ROM_PTR(&fat_vfs_open_obj) },
     { MP_ROM_QSTR(MP_QSTR_ilistdir), MP_ROM_PTR(&fat_vfs_ilistdir_obj) },
+    { MP_ROM_QSTR(MP_QSTR_scandir), MP_ROM_PTR(&fat_vfs_scandir_obj) },
     { MP_ROM_QSTR(MP_QSTR_mkdir), MP_ROM_PTR(&fat_vfs_mkdir_obj) },
     { MP_ROM_QSTR(MP_QSTR_rmdir), MP_ROM_PTR(&fat_vfs_rmdir_obj) },
     { MP_ROM_QSTR(MP_QSTR_chdir), MP_ROM_PTR(&fat_vfs_chdir_obj) },
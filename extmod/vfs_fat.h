@@ -41,6 +41,16 @@
 // Bit set when the above flag is checked before opening a file for write.
 #define FSUSER_CONCURRENT_WRITE_PROTECTED (0x0020)
 
+#if MICROPY_FATFS_CACHE_SECTORS > 0
+typedef struct {
+    // Sector number plus one held in each slot, zero when the slot is empty.
+    DWORD tag[MICROPY_FATFS_CACHE_SECTORS];
+    uint32_t last_use[MICROPY_FATFS_CACHE_SECTORS];
+    uint32_t use_count;
+    BYTE data[MICROPY_FATFS_CACHE_SECTORS][_MAX_SS];
+} fs_sector_cache_t;
+#endif
+
 typedef struct _fs_user_mount_t {
     mp_obj_base_t base;
     uint16_t flags;
@@ -55,6 +65,9 @@ typedef struct _fs_user_mount_t {
         } old;
     } u;
     FATFS fatfs;
+    #if MICROPY_FATFS_CACHE_SECTORS > 0
+    fs_sector_cache_t cache;
+    #endif
 } fs_user_mount_t;
 
 typedef struct _pyb_file_obj_t {
@@ -32,6 +32,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "py/mphal.h"
 
@@ -57,18 +58,7 @@ STATIC fs_user_mount_t *disk_get_device(void *bdev) {
 /* Read Sector(s)                                                        */
 /*-----------------------------------------------------------------------*/
 
-DRESULT disk_read (
-    bdev_t pdrv,      /* Physical drive nmuber (0..) */
-    BYTE *buff,        /* Data buffer to store read data */
-    DWORD sector,    /* Sector address (LBA) */
-    UINT count        /* Number of sectors to read (1..128) */
-)
-{
-    fs_user_mount_t *vfs = disk_get_device(pdrv);
-    if (vfs == NULL) {
-        return RES_PARERR;
-    }
-
+STATIC DRESULT read_blocks(fs_user_mount_t *vfs, BYTE *buff, DWORD sector, UINT count) {
     if (vfs->flags & FSUSER_NATIVE) {
         mp_uint_t (*f)(uint8_t*, uint32_t, uint32_t) = (void*)(uintptr_t)vfs->readblocks[2];
         if (f(buff, sector, count) != 0) {
@@ -94,6 +84,99 @@ DRESULT disk_read (
     return RES_OK;
 }
 
+#if MICROPY_FATFS_CACHE_SECTORS > 0
+STATIC void cache_invalidate(fs_user_mount_t *vfs) {
+    memset(vfs->cache.tag, 0, sizeof(vfs->cache.tag));
+}
+
+// Forgets cached copies of sectors about to be written. Doing it before the write keeps the
+// cache coherent even when the write fails part way.
+STATIC void cache_drop(fs_user_mount_t *vfs, DWORD sector, UINT count) {
+    fs_sector_cache_t *cache = &vfs->cache;
+    for (size_t i = 0; i < MICROPY_FATFS_CACHE_SECTORS; i++) {
+        if (cache->tag[i] > sector && cache->tag[i] <= sector + count) {
+            cache->tag[i] = 0;
+        }
+    }
+}
+
+STATIC DRESULT cached_read(fs_user_mount_t *vfs, BYTE *buff, DWORD sector) {
+    fs_sector_cache_t *cache = &vfs->cache;
+    for (size_t i = 0; i < MICROPY_FATFS_CACHE_SECTORS; i++) {
+        if (cache->tag[i] == sector + 1) {
+            cache->last_use[i] = ++cache->use_count;
+            memcpy(buff, cache->data[i], SECSIZE(&vfs->fatfs));
+            return RES_OK;
+        }
+    }
+
+    // Read ahead into the run of consecutive slots that was used longest ago so the sectors can
+    // be read with one call.
+    size_t ahead = MICROPY_FATFS_READ_AHEAD_SECTORS;
+    if (ahead < 1 || SECSIZE(&vfs->fatfs) != _MAX_SS) {
+        // Slots are _MAX_SS apart so smaller sectors can only be cached one at a time.
+        ahead = 1;
+    } else if (ahead > MICROPY_FATFS_CACHE_SECTORS) {
+        ahead = MICROPY_FATFS_CACHE_SECTORS;
+    }
+    size_t first = 0;
+    uint32_t first_age = UINT32_MAX;
+    for (size_t start = 0; start + ahead <= MICROPY_FATFS_CACHE_SECTORS; start++) {
+        uint32_t newest = 0;
+        for (size_t i = start; i < start + ahead; i++) {
+            if (cache->tag[i] != 0 && cache->last_use[i] > newest) {
+                newest = cache->last_use[i];
+            }
+        }
+        if (newest < first_age) {
+            first = start;
+            first_age = newest;
+        }
+    }
+    for (size_t i = first; i < first + ahead; i++) {
+        cache->tag[i] = 0;
+    }
+    DRESULT res = read_blocks(vfs, cache->data[first], sector, ahead);
+    if (res != RES_OK) {
+        // Probably past the end of the device.
+        ahead = 1;
+        res = read_blocks(vfs, cache->data[first], sector, 1);
+        if (res != RES_OK) {
+            return res;
+        }
+    }
+    uint32_t use = ++cache->use_count;
+    for (size_t i = 0; i < ahead; i++) {
+        cache->tag[first + i] = sector + i + 1;
+        cache->last_use[first + i] = use;
+    }
+    memcpy(buff, cache->data[first], SECSIZE(&vfs->fatfs));
+    return RES_OK;
+}
+#endif
+
+DRESULT disk_read (
+    bdev_t pdrv,      /* Physical drive nmuber (0..) */
+    BYTE *buff,        /* Data buffer to store read data */
+    DWORD sector,    /* Sector address (LBA) */
+    UINT count        /* Number of sectors to read (1..128) */
+)
+{
+    fs_user_mount_t *vfs = disk_get_device(pdrv);
+    if (vfs == NULL) {
+        return RES_PARERR;
+    }
+
+    #if MICROPY_FATFS_CACHE_SECTORS > 0
+    // Longer reads go straight to the device, which is always up to date because writes go
+    // through.
+    if (count == 1) {
+        return cached_read(vfs, buff, sector);
+    }
+    #endif
+    return read_blocks(vfs, buff, sector, count);
+}
+
 /*-----------------------------------------------------------------------*/
 /* Write Sector(s)                                                       */
 /*-----------------------------------------------------------------------*/
@@ -115,6 +198,10 @@ DRESULT disk_write (
         return RES_WRPRT;
     }
 
+    #if MICROPY_FATFS_CACHE_SECTORS > 0
+    cache_drop(vfs, sector, count);
+    #endif
+
     if (vfs->flags & FSUSER_NATIVE) {
         mp_uint_t (*f)(const uint8_t*, uint32_t, uint32_t) = (void*)(uintptr_t)vfs->writeblocks[2];
         if (f(buff, sector, count) != 0) {
@@ -225,6 +312,12 @@ DRESULT disk_ioctl (
 
         case IOCTL_INIT:
         case IOCTL_STATUS: {
+            #if MICROPY_FATFS_CACHE_SECTORS > 0
+            if (cmd == IOCTL_INIT) {
+                // A new mount or format, whatever was cached may be out of date.
+                cache_invalidate(vfs);
+            }
+            #endif
             DSTATUS stat;
             if (ret != mp_const_none && MP_OBJ_SMALL_INT_VALUE(ret) != 0) {
                 // error initialising
@@ -28,6 +28,7 @@
 #if MICROPY_VFS && MICROPY_VFS_FAT
 
 #include <stdio.h>
+#include <string.h>
 
 #include "py/runtime.h"
 #include "py/stream.h"
@@ -36,6 +37,12 @@
 #include "extmod/vfs_fat.h"
 #include "supervisor/filesystem.h"
 
+#if _MAX_SS == _MIN_SS
+#define SECSIZE(fs) (_MIN_SS)
+#else
+#define SECSIZE(fs) ((fs)->ssize)
+#endif
+
 // this table converts from FRESULT to POSIX errno
 const byte fresult_to_errno_table[20] = {
     [FR_OK] = 0,
@@ -133,6 +140,10 @@ STATIC mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
     } else if (request == MP_STREAM_CLOSE) {
         // if fs==NULL then the file is closed and in that case this method is a no-op
         if (self->fp.obj.fs != NULL) {
+            if (self->fp.cltbl != NULL) {
+                m_del(DWORD, self->fp.cltbl, self->fp.cltbl[0]);
+                self->fp.cltbl = NULL;
+            }
             FRESULT res = f_close(&self->fp);
             if (res != FR_OK) {
                 *errcode = fresult_to_errno_table[res];
@@ -141,12 +152,60 @@ STATIC mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
         }
         return 0;
 
+    } else if (request == MP_STREAM_GET_BLOCK_SIZE) {
+        FATFS *fs = self->fp.obj.fs;
+        return (mp_uint_t)fs->csize * SECSIZE(fs);
+
     } else {
         *errcode = MP_EINVAL;
         return MP_STREAM_ERROR;
     }
 }
 
+// Number of DWORDs in a link map with room for the given number of fragments: the table size,
+// a length and start cluster per fragment and the terminator.
+#define LINKMAP_SIZE(fragments) (2 + 2 * (fragments))
+
+// Builds the fast seek cluster link map for a file opened read-only. The chain is walked into a
+// table on the stack first, which covers the usual barely fragmented file in one pass, and then
+// copied into a heap table of exactly the size FatFs reported. Files that gain little from the
+// map or that need a big one keep seeking through the FAT.
+STATIC void file_create_linkmap(FIL *fp) {
+    FATFS *fs = fp->obj.fs;
+    DWORD cluster_size = (DWORD)fs->csize * SECSIZE(fs);
+    if (f_size(fp) <= cluster_size * MICROPY_FATFS_FASTSEEK_MIN_CLUSTERS) {
+        return;
+    }
+    DWORD temp_table[LINKMAP_SIZE(4)];
+    temp_table[0] = MP_ARRAY_SIZE(temp_table);
+    fp->cltbl = temp_table;
+    FRESULT res = f_lseek(fp, CREATE_LINKMAP);
+    fp->cltbl = NULL;
+    DWORD size = temp_table[0];
+    if ((res != FR_OK && res != FR_NOT_ENOUGH_CORE) ||
+        size > LINKMAP_SIZE(MICROPY_FATFS_FASTSEEK_MAX_FRAGMENTS)) {
+        fp->err = 0;
+        return;
+    }
+    DWORD *table = m_new_maybe(DWORD, size);
+    if (table == NULL) {
+        return;
+    }
+    if (res == FR_OK) {
+        memcpy(table, temp_table, size * sizeof(DWORD));
+    } else {
+        table[0] = size;
+        fp->cltbl = table;
+        if (f_lseek(fp, CREATE_LINKMAP) != FR_OK) {
+            fp->cltbl = NULL;
+            fp->err = 0;
+            m_del(DWORD, table, size);
+            return;
+        }
+    }
+    fp->cltbl = table;
+}
+
 // Note: encoding is ignored for now; it's also not a valid kwarg for CPython's FileIO,
 // but by adding it here we can use one single mp_arg_t array for open() and FileIO's constructor
 STATIC const mp_arg_t file_open_args[] = {
@@ -201,22 +260,10 @@ STATIC mp_obj_t file_open(fs_user_mount_t *vfs, const mp_obj_type_t *type, mp_ar
         m_del_obj(pyb_file_obj_t, o);
         mp_raise_OSError(fresult_to_errno_table[res]);
     }
-    // If we're reading, turn on fast seek.
+    // If we're reading, turn on fast seek. Files in fast seek mode can't grow so it's only for
+    // read-only files.
     if (mode == FA_READ) {
-        // one call to determine how much space we need.
-        DWORD temp_table[2];
-        temp_table[0] = 2;
-        o->fp.cltbl = temp_table;
-        f_lseek(&o->fp, CREATE_LINKMAP);
-        DWORD size = (temp_table[0] + 1) * 2;
-        o->fp.cltbl = m_malloc_maybe(size * sizeof(DWORD), false);
-        if (o->fp.cltbl != NULL) {
-            o->fp.cltbl[0] = size;
-            res = f_lseek(&o->fp, CREATE_LINKMAP);
-            if (res != FR_OK) {
-                o->fp.cltbl = NULL;
-            }
-        }
+        file_create_linkmap(&o->fp);
     }
 
     // for 'a' mode, we must begin at the end of the file
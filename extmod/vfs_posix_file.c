@@ -32,6 +32,7 @@
 #if defined(MICROPY_VFS_POSIX) && MICROPY_VFS_POSIX
 
 #include <fcntl.h>
+#include <sys/stat.h>
 
 #ifdef _WIN32
 #define fsync _commit
@@ -195,6 +196,14 @@ STATIC mp_uint_t vfs_posix_file_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_
             o->fd = -1;
             #endif
             return 0;
+        case MP_STREAM_GET_BLOCK_SIZE: {
+            struct stat st;
+            if (fstat(o->fd, &st) < 0) {
+                *errcode = errno;
+                return MP_STREAM_ERROR;
+            }
+            return st.st_blksize;
+        }
         default:
             *errcode = EINVAL;
             return MP_STREAM_ERROR;
@@ -118,17 +118,38 @@ int memcmp(const void *s1, const void *s2, size_t n) {
     return 0;
 }
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-align"
 void *memchr(const void *s, int c, size_t n) {
-    if (n != 0) {
-        const unsigned char *p = s;
+    const uint8_t *p = s;
+    uint8_t b = c;
+
+    // bytes up to a word boundary
+    for (; n && (((uintptr_t)p) & 3); n--, p++) {
+        if (*p == b) {
+            return (void*)p;
+        }
+    }
 
-        do {
-            if (*p++ == c)
-                return ((void *)(p - 1));
-        } while (--n != 0);
+    // then whole words, stopping at the first one that has a zero byte after
+    // being xor'd with b in every byte
+    uint32_t pattern = b * 0x01010101u;
+    for (; n >= 4; n -= 4, p += 4) {
+        uint32_t w = *(const uint32_t*)p ^ pattern;
+        if ((w - 0x01010101u) & ~w & 0x80808080u) {
+            break;
+        }
+    }
+
+    // and the bytes of that word or the tail
+    for (; n; n--, p++) {
+        if (*p == b) {
+            return (void*)p;
+        }
     }
     return 0;
 }
+#pragma GCC diagnostic pop
 
 size_t strlen(const char *str) {
     int len = 0;
@@ -65,7 +65,11 @@
 /  2: Enable with LF-CRLF conversion. */
 
 
+#ifdef MICROPY_FATFS_USE_FIND
+#define _USE_FIND       (MICROPY_FATFS_USE_FIND)
+#else
 #define _USE_FIND       0
+#endif
 /* This option switches filtered directory read functions, f_findfirst() and
 /  f_findnext(). (0:Disable, 1:Enable 2:Enable with matching altname[] too) */
 
@@ -78,7 +82,11 @@
 /* This option switches fast seek function. (0:Disable or 1:Enable) */
 
 
+#ifdef MICROPY_FATFS_USE_EXPAND
+#define _USE_EXPAND     (MICROPY_FATFS_USE_EXPAND)
+#else
 #define _USE_EXPAND     0
+#endif
 /* This option switches f_expand function. (0:Disable or 1:Enable) */
 
 
@@ -69,11 +69,39 @@
 #include "shared-module/board/__init__.h"
 #endif
 
+#if CIRCUITPY_BUSIO
+#include "shared-bindings/busio/SPI.h"
+#endif
+
+#if CIRCUITPY_KEYPAD
+#include "shared-module/keypad/__init__.h"
+#endif
+
+#if CIRCUITPY_TOUCHIO
+#include "shared-bindings/touchio/TouchIn.h"
+#endif
+
+#if CIRCUITPY_USB_CDC
+#include "shared-module/usb_cdc/__init__.h"
+#endif
+
+#if CIRCUITPY_USB_MIDI
+#include "shared-module/usb_midi/PortIn.h"
+#endif
+
 #if CIRCUITPY_BLEIO
 #include "shared-bindings/_bleio/__init__.h"
 #include "supervisor/shared/bluetooth.h"
 #endif
 
+#if CIRCUITPY_STORAGE_LOGFILE
+#include "shared-module/storage/LogFile.h"
+#endif
+
+#if CIRCUITPY_NVM
+#include "shared-module/nvm/ByteArray.h"
+#endif
+
 void do_str(const char *src, mp_parse_input_kind_t input_kind) {
     mp_lexer_t *lex = mp_lexer_new_from_str_len(MP_QSTR__lt_stdin_gt_, src, strlen(src), 0);
     if (lex == NULL) {
@@ -118,9 +146,19 @@ void start_mp(supervisor_allocation* heap) {
     // Clear the readline history. It references the heap we're about to destroy.
     readline_init0();
 
+    // Every VM starts from an empty heap rather than a saved image of a previous
+    // boot. Long-lived objects hold pointers to peripheral objects whose hardware
+    // was reset, into supervisor allocations that may have moved, and into the
+    // firmware's own ROM tables. That makes a flash snapshot only valid for one
+    // firmware build and board state. It would also need relocating everything the
+    // GC can't identify as a pointer. Frozen modules and the .mpy cache are the
+    // supported ways to cut import time.
     #if MICROPY_ENABLE_GC
     gc_init(heap->ptr, heap->ptr + heap->length / 4);
     #endif
+    #if MICROPY_ENABLE_PYSTACK
+    init_pystack();
+    #endif
     mp_init();
     mp_obj_list_init(mp_sys_path, 0);
     mp_obj_list_append(mp_sys_path, MP_OBJ_NEW_QSTR(MP_QSTR_)); // current dir (or base dir of the script)
@@ -185,11 +223,37 @@ bool maybe_run_list(const char ** filenames, pyexec_result_t* exec_result) {
 }
 
 void cleanup_after_vm(supervisor_allocation* heap) {
+    // Show what the VM printed last before anything the supervisor writes directly.
+    serial_flush_stdout();
+    // Let SPI transfers still in progress finish before their buffers are freed.
+    #if CIRCUITPY_BUSIO
+    busio_spi_finish_transfers();
+    #endif
+    // Stop scanning keys and touch pads in the background. Their state is on the heap.
+    #if CIRCUITPY_KEYPAD
+    keypad_reset();
+    #endif
+    #if CIRCUITPY_TOUCHIO
+    touchin_reset();
+    #endif
+    #if CIRCUITPY_USB_CDC
+    usb_cdc_reset();
+    #endif
+    #if CIRCUITPY_USB_MIDI
+    usb_midi_portin_reset();
+    #endif
     // Turn off the display and flush the fileystem before the heap disappears.
     #if CIRCUITPY_DISPLAYIO
     reset_displays();
     #endif
+    #if CIRCUITPY_STORAGE_LOGFILE
+    storage_logfile_close_all();
+    #endif
+    #if CIRCUITPY_NVM
+    nvm_bytearray_flush_all();
+    #endif
     filesystem_flush();
+    autoreload_disable_hot_reload();
     stop_mp();
     free_memory(heap);
     supervisor_move_memory();
@@ -374,6 +438,7 @@ void __attribute__ ((noinline)) run_boot_py(safe_mode_t safe_mode) {
         (void) found_boot;
 
         #ifdef CIRCUITPY_BOOT_OUTPUT_FILE
+        serial_flush_stdout();
         if (!skip_boot_output) {
             f_close(boot_output_file);
             filesystem_flush();
@@ -0,0 +1,4 @@
+const uint8_t lengths[] = { 0, 0, 1, 8, 6, 5, 7, 4, 9, 14, 12, 5, 6, 0 };
+const uint8_t values[] = { 32, 97, 101, 105, 110, 111, 114, 115, 116, 95, 99, 100, 108, 112, 117, 39, 98, 102, 103, 109, 37, 69, 104, 118, 119, 120, 121, 78, 106, 107, 113, 40, 41, 45, 65, 73, 79, 82, 83, 84, 42, 44, 47, 48, 58, 60, 62, 67, 68, 70, 77, 80, 85, 122, 10, 35, 46, 49, 50, 51, 61, 66, 71, 72, 76, 86, 13, 34, 75, 123, 125, 54, 56, 59, 88, 89, 90 };
+#define DECODE_TABLE_BITS (8)
+const uint16_t decode_table[] = { 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 16385, 16385, 16385, 16385, 16385, 16385, 16385, 16385, 16385, 16385, 16385, 16385, 16385, 16385, 16385, 16385, 16386, 16386, 16386, 16386, 16386, 16386, 16386, 16386, 16386, 16386, 16386, 16386, 16386, 16386, 16386, 16386, 16387, 16387, 16387, 16387, 16387, 16387, 16387, 16387, 16387, 16387, 16387, 16387, 16387, 16387, 16387, 16387, 16388, 16388, 16388, 16388, 16388, 16388, 16388, 16388, 16388, 16388, 16388, 16388, 16388, 16388, 16388, 16388, 16389, 16389, 16389, 16389, 16389, 16389, 16389, 16389, 16389, 16389, 16389, 16389, 16389, 16389, 16389, 16389, 16390, 16390, 16390, 16390, 16390, 16390, 16390, 16390, 16390, 16390, 16390, 16390, 16390, 16390, 16390, 16390, 16391, 16391, 16391, 16391, 16391, 16391, 16391, 16391, 16391, 16391, 16391, 16391, 16391, 16391, 16391, 16391, 16392, 16392, 16392, 16392, 16392, 16392, 16392, 16392, 16392, 16392, 16392, 16392, 16392, 16392, 16392, 16392, 20489, 20489, 20489, 20489, 20489, 20489, 20489, 20489, 20490, 20490, 20490, 20490, 20490, 20490, 20490, 20490, 20491, 20491, 20491, 20491, 20491, 20491, 20491, 20491, 20492, 20492, 20492, 20492, 20492, 20492, 20492, 20492, 20493, 20493, 20493, 20493, 20493, 20493, 20493, 20493, 20494, 20494, 20494, 20494, 20494, 20494, 20494, 20494, 24591, 24591, 24591, 24591, 24592, 24592, 24592, 24592, 24593, 24593, 24593, 24593, 24594, 24594, 24594, 24594, 24595, 24595, 24595, 24595, 28692, 28692, 28693, 28693, 28694, 28694, 28695, 28695, 28696, 28696, 28697, 28697, 28698, 28698, 32795, 32796, 32797, 32798, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
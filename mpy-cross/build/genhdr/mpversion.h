@@ -0,0 +1,9 @@
+// This file was generated by py/makeversionhdr.py
+#define MICROPY_GIT_TAG "4360e4e-dirty"
+#define MICROPY_GIT_HASH "4360e4e-dirty"
+#define MICROPY_BUILD_DATE "2026-10-15"
+#define MICROPY_VERSION_MAJOR (0)
+#define MICROPY_VERSION_MINOR (0)
+#define MICROPY_VERSION_MICRO (0)
+#define MICROPY_VERSION_STRING "4360e4e-dirty"
+#define MICROPY_FULL_VERSION_INFO ("Adafruit CircuitPython " MICROPY_GIT_TAG " on " MICROPY_BUILD_DATE "; " MICROPY_HW_BOARD_NAME " with " MICROPY_HW_MCU_NAME)
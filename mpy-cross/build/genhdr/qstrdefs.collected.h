@@ -0,0 +1,1429 @@
+Q( )
+
+Q(%#o)
+
+Q(%#x)
+
+Q(*)
+
+Q(*)
+
+Q(<dictcomp>)
+
+Q(<genexpr>)
+
+Q(<lambda>)
+
+Q(<listcomp>)
+
+Q(<module>)
+
+Q(<setcomp>)
+
+Q(<string>)
+
+Q(ArithmeticError)
+
+Q(ArithmeticError)
+
+Q(AssertionError)
+
+Q(AssertionError)
+
+Q(AssertionError)
+
+Q(AttributeError)
+
+Q(AttributeError)
+
+Q(BaseException)
+
+Q(BaseException)
+
+Q(EACCES)
+
+Q(EADDRINUSE)
+
+Q(EAGAIN)
+
+Q(EALREADY)
+
+Q(EBADF)
+
+Q(ECONNABORTED)
+
+Q(ECONNREFUSED)
+
+Q(ECONNRESET)
+
+Q(EEXIST)
+
+Q(EHOSTUNREACH)
+
+Q(EINPROGRESS)
+
+Q(EINVAL)
+
+Q(EIO)
+
+Q(EISDIR)
+
+Q(ENOBUFS)
+
+Q(ENODEV)
+
+Q(ENOENT)
+
+Q(ENOMEM)
+
+Q(ENOTCONN)
+
+Q(EOFError)
+
+Q(EOFError)
+
+Q(EOPNOTSUPP)
+
+Q(EPERM)
+
+Q(ETIMEDOUT)
+
+Q(Ellipsis)
+
+Q(Ellipsis)
+
+Q(Exception)
+
+Q(Exception)
+
+Q(GeneratorExit)
+
+Q(GeneratorExit)
+
+Q(ImportError)
+
+Q(ImportError)
+
+Q(IndentationError)
+
+Q(IndentationError)
+
+Q(IndexError)
+
+Q(IndexError)
+
+Q(KeyError)
+
+Q(KeyError)
+
+Q(KeyboardInterrupt)
+
+Q(KeyboardInterrupt)
+
+Q(LookupError)
+
+Q(LookupError)
+
+Q(MemoryError)
+
+Q(MemoryError)
+
+Q(MpyError)
+
+Q(MpyError)
+
+Q(NameError)
+
+Q(NameError)
+
+Q(NoneType)
+
+Q(NotImplementedError)
+
+Q(NotImplementedError)
+
+Q(OSError)
+
+Q(OSError)
+
+Q(OverflowError)
+
+Q(OverflowError)
+
+Q(ReloadException)
+
+Q(ReloadException)
+
+Q(RuntimeError)
+
+Q(RuntimeError)
+
+Q(StopAsyncIteration)
+
+Q(StopAsyncIteration)
+
+Q(StopAsyncIteration)
+
+Q(StopIteration)
+
+Q(StopIteration)
+
+Q(Struct)
+
+Q(Struct)
+
+Q(SyntaxError)
+
+Q(SyntaxError)
+
+Q(SystemExit)
+
+Q(SystemExit)
+
+Q(TimeoutError)
+
+Q(TypeError)
+
+Q(TypeError)
+
+Q(UnicodeError)
+
+Q(UnicodeError)
+
+Q(ValueError)
+
+Q(ValueError)
+
+Q(ZeroDivisionError)
+
+Q(ZeroDivisionError)
+
+Q(_0x0a_)
+
+Q(__add__)
+
+Q(__aenter__)
+
+Q(__aenter__)
+
+Q(__aexit__)
+
+Q(__aiter__)
+
+Q(__anext__)
+
+Q(__bool__)
+
+Q(__build_class__)
+
+Q(__bytes__)
+
+Q(__call__)
+
+Q(__class__)
+
+Q(__class__)
+
+Q(__class__)
+
+Q(__class__)
+
+Q(__class__)
+
+Q(__class__)
+
+Q(__class__)
+
+Q(__contains__)
+
+Q(__contains__)
+
+Q(__delitem__)
+
+Q(__delitem__)
+
+Q(__dict__)
+
+Q(__enter__)
+
+Q(__eq__)
+
+Q(__eq__)
+
+Q(__exit__)
+
+Q(__ge__)
+
+Q(__getattr__)
+
+Q(__getattr__)
+
+Q(__getitem__)
+
+Q(__getitem__)
+
+Q(__getitem__)
+
+Q(__getitem__)
+
+Q(__gt__)
+
+Q(__hash__)
+
+Q(__iadd__)
+
+Q(__import__)
+
+Q(__init__)
+
+Q(__init__)
+
+Q(__init__)
+
+Q(__isub__)
+
+Q(__iter__)
+
+Q(__le__)
+
+Q(__len__)
+
+Q(__lt__)
+
+Q(__main__)
+
+Q(__main__)
+
+Q(__main__)
+
+Q(__main__)
+
+Q(__main__)
+
+Q(__main__)
+
+Q(__main__)
+
+Q(__module__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__name__)
+
+Q(__new__)
+
+Q(__new__)
+
+Q(__new__)
+
+Q(__next__)
+
+Q(__next__)
+
+Q(__next__)
+
+Q(__next__)
+
+Q(__path__)
+
+Q(__path__)
+
+Q(__path__)
+
+Q(__qualname__)
+
+Q(__repl_print__)
+
+Q(__repl_print__)
+
+Q(__repr__)
+
+Q(__repr__)
+
+Q(__reversed__)
+
+Q(__setitem__)
+
+Q(__setitem__)
+
+Q(__str__)
+
+Q(__sub__)
+
+Q(__traceback__)
+
+Q(abs)
+
+Q(add)
+
+Q(all)
+
+Q(any)
+
+Q(append)
+
+Q(append)
+
+Q(args)
+
+Q(bin)
+
+Q(bool)
+
+Q(bool)
+
+Q(bound_method)
+
+Q(builtins)
+
+Q(builtins)
+
+Q(bytearray)
+
+Q(bytearray)
+
+Q(bytecode)
+
+Q(bytes)
+
+Q(bytes)
+
+Q(bytes)
+
+Q(calcsize)
+
+Q(callable)
+
+Q(chr)
+
+Q(classmethod)
+
+Q(classmethod)
+
+Q(clear)
+
+Q(clear)
+
+Q(clear)
+
+Q(close)
+
+Q(close)
+
+Q(closure)
+
+Q(closure)
+
+Q(complex)
+
+Q(complex)
+
+Q(const)
+
+Q(const)
+
+Q(copy)
+
+Q(copy)
+
+Q(copy)
+
+Q(count)
+
+Q(count)
+
+Q(count)
+
+Q(count)
+
+Q(decode)
+
+Q(default)
+
+Q(delattr)
+
+Q(deleter)
+
+Q(dict)
+
+Q(dict)
+
+Q(dict_view)
+
+Q(difference)
+
+Q(difference_update)
+
+Q(dir)
+
+Q(discard)
+
+Q(divmod)
+
+Q(doc)
+
+Q(encode)
+
+Q(end)
+
+Q(endswith)
+
+Q(endswith)
+
+Q(enumerate)
+
+Q(enumerate)
+
+Q(errno)
+
+Q(eval)
+
+Q(exec)
+
+Q(extend)
+
+Q(extend)
+
+Q(filename)
+
+Q(filename2)
+
+Q(filter)
+
+Q(filter)
+
+Q(find)
+
+Q(find)
+
+Q(float)
+
+Q(float)
+
+Q(flush)
+
+Q(format)
+
+Q(format)
+
+Q(format)
+
+Q(from_bytes)
+
+Q(fromkeys)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(function)
+
+Q(generator)
+
+Q(generator)
+
+Q(generator)
+
+Q(get)
+
+Q(getattr)
+
+Q(getter)
+
+Q(globals)
+
+Q(hasattr)
+
+Q(hash)
+
+Q(heap_lock)
+
+Q(heap_unlock)
+
+Q(hex)
+
+Q(id)
+
+Q(imag)
+
+Q(index)
+
+Q(index)
+
+Q(index)
+
+Q(index)
+
+Q(insert)
+
+Q(int)
+
+Q(int)
+
+Q(intersection)
+
+Q(intersection_update)
+
+Q(isalpha)
+
+Q(isalpha)
+
+Q(isdigit)
+
+Q(isdigit)
+
+Q(isdisjoint)
+
+Q(isinstance)
+
+Q(islower)
+
+Q(islower)
+
+Q(isspace)
+
+Q(isspace)
+
+Q(issubclass)
+
+Q(issubset)
+
+Q(issuperset)
+
+Q(isupper)
+
+Q(isupper)
+
+Q(items)
+
+Q(iter)
+
+Q(iter_unpack)
+
+Q(iterable)
+
+Q(iterator)
+
+Q(iterator)
+
+Q(iterator)
+
+Q(iterator)
+
+Q(iterator)
+
+Q(iterator)
+
+Q(join)
+
+Q(join)
+
+Q(key)
+
+Q(key)
+
+Q(keys)
+
+Q(keys)
+
+Q(len)
+
+Q(list)
+
+Q(list)
+
+Q(little)
+
+Q(little)
+
+Q(little)
+
+Q(locals)
+
+Q(lower)
+
+Q(lower)
+
+Q(lstrip)
+
+Q(lstrip)
+
+Q(map)
+
+Q(map)
+
+Q(max)
+
+Q(micropython)
+
+Q(micropython)
+
+Q(micropython)
+
+Q(min)
+
+Q(module)
+
+Q(native)
+
+Q(next)
+
+Q(object)
+
+Q(object)
+
+Q(oct)
+
+Q(opt_level)
+
+Q(ord)
+
+Q(pack)
+
+Q(pack)
+
+Q(pack_into)
+
+Q(pack_into)
+
+Q(pend_throw)
+
+Q(pop)
+
+Q(pop)
+
+Q(pop)
+
+Q(popitem)
+
+Q(pow)
+
+Q(print)
+
+Q(property)
+
+Q(property)
+
+Q(protocol_pin)
+
+Q(protocol_pin)
+
+Q(protocol_stream)
+
+Q(protocol_stream)
+
+Q(protocol_stream)
+
+Q(protocol_stream)
+
+Q(protocol_stream)
+
+Q(protocol_stream)
+
+Q(protocol_stream)
+
+Q(protocol_stream)
+
+Q(protocol_stream)
+
+Q(protocol_stream)
+
+Q(protocol_stream)
+
+Q(protocol_stream)
+
+Q(protocol_stream)
+
+Q(protocol_stream)
+
+Q(protocol_stream)
+
+Q(protocol_stream)
+
+Q(range)
+
+Q(range)
+
+Q(range)
+
+Q(real)
+
+Q(remove)
+
+Q(remove)
+
+Q(replace)
+
+Q(replace)
+
+Q(repr)
+
+Q(reverse)
+
+Q(reverse)
+
+Q(reversed)
+
+Q(reversed)
+
+Q(rfind)
+
+Q(rfind)
+
+Q(rindex)
+
+Q(rindex)
+
+Q(round)
+
+Q(rsplit)
+
+Q(rsplit)
+
+Q(rstrip)
+
+Q(rstrip)
+
+Q(send)
+
+Q(send)
+
+Q(sep)
+
+Q(set)
+
+Q(set)
+
+Q(setattr)
+
+Q(setdefault)
+
+Q(setter)
+
+Q(size)
+
+Q(slice)
+
+Q(slice)
+
+Q(sort)
+
+Q(sorted)
+
+Q(split)
+
+Q(split)
+
+Q(start)
+
+Q(start)
+
+Q(startswith)
+
+Q(startswith)
+
+Q(staticmethod)
+
+Q(staticmethod)
+
+Q(step)
+
+Q(stop)
+
+Q(str)
+
+Q(str)
+
+Q(str)
+
+Q(str)
+
+Q(strerror)
+
+Q(strip)
+
+Q(strip)
+
+Q(sum)
+
+Q(super)
+
+Q(super)
+
+Q(super)
+
+Q(symmetric_difference)
+
+Q(symmetric_difference_update)
+
+Q(throw)
+
+Q(throw)
+
+Q(to_bytes)
+
+Q(tuple)
+
+Q(tuple)
+
+Q(type)
+
+Q(type)
+
+Q(union)
+
+Q(unpack)
+
+Q(unpack)
+
+Q(unpack_from)
+
+Q(unpack_from)
+
+Q(unpack_into)
+
+Q(update)
+
+Q(update)
+
+Q(upper)
+
+Q(upper)
+
+Q(ustruct)
+
+Q(ustruct)
+
+Q(utf-8)
+
+Q(utf-8)
+
+Q(value)
+
+Q(values)
+
+Q(zip)
+
+Q(zip)
+
+Q({_colon_#b})
+
+TRANSLATE("  File \"%q\", line %d")
+
+TRANSLATE("%%c requires int or char")
+
+TRANSLATE("%q index out of range")
+
+TRANSLATE("%q indices must be integers, not %s")
+
+TRANSLATE("%q() takes %d positional arguments but %d were given")
+
+TRANSLATE("'%q' argument required")
+
+TRANSLATE("'%s' object does not support '%q'")
+
+TRANSLATE("'%s' object does not support item assignment")
+
+TRANSLATE("'%s' object does not support item deletion")
+
+TRANSLATE("'%s' object has no attribute '%q'")
+
+TRANSLATE("'%s' object has no attribute '%q'")
+
+TRANSLATE("'%s' object is not an iterator")
+
+TRANSLATE("'%s' object is not an iterator")
+
+TRANSLATE("'%s' object is not callable")
+
+TRANSLATE("'%s' object is not callable")
+
+TRANSLATE("'%s' object is not iterable")
+
+TRANSLATE("'%s' object is not subscriptable")
+
+TRANSLATE("'=' alignment not allowed in string format specifier")
+
+TRANSLATE("'await' outside function")
+
+TRANSLATE("'break' outside loop")
+
+TRANSLATE("'continue' outside loop")
+
+TRANSLATE("'return' outside function")
+
+TRANSLATE("'yield' outside function")
+
+TRANSLATE("*x must be assignment target")
+
+TRANSLATE(", in %q\n")
+
+TRANSLATE("0.0 to a complex power")
+
+TRANSLATE("3-arg pow() not supported")
+
+TRANSLATE("Call super().__init__() before accessing native object.")
+
+TRANSLATE("Corrupt raw code")
+
+TRANSLATE("File exists")
+
+TRANSLATE("Input/output error")
+
+TRANSLATE("Invalid argument")
+
+TRANSLATE("LHS of keyword arg must be an id")
+
+TRANSLATE("No space left on device")
+
+TRANSLATE("No such file/directory")
+
+TRANSLATE("Permission denied")
+
+TRANSLATE("Permission denied")
+
+TRANSLATE("Read-only filesystem")
+
+TRANSLATE("Traceback (most recent call last):\n")
+
+TRANSLATE("Unable to init parser")
+
+TRANSLATE("Unsupported operation")
+
+TRANSLATE("__init__() should return None")
+
+TRANSLATE("__init__() should return None, not '%s'")
+
+TRANSLATE("__new__ arg must be a user-type")
+
+TRANSLATE("a bytes-like object is required")
+
+TRANSLATE("abort() called")
+
+TRANSLATE("arg is an empty sequence")
+
+TRANSLATE("argument has wrong type")
+
+TRANSLATE("argument num/types mismatch")
+
+TRANSLATE("argument num/types mismatch")
+
+TRANSLATE("argument should be a '%q' not a '%q'")
+
+TRANSLATE("attributes not supported yet")
+
+TRANSLATE("bad conversion specifier")
+
+TRANSLATE("bad typecode")
+
+TRANSLATE("buffer size must match format")
+
+TRANSLATE("buffer too small")
+
+TRANSLATE("buffer too small")
+
+TRANSLATE("buffer too small")
+
+TRANSLATE("buffer too small")
+
+TRANSLATE("buffer too small")
+
+TRANSLATE("byte code not implemented")
+
+TRANSLATE("bytes value out of range")
+
+TRANSLATE("can only save bytecode")
+
+TRANSLATE("can't add special method to already-subclassed class")
+
+TRANSLATE("can't assign to expression")
+
+TRANSLATE("can't assign to expression")
+
+TRANSLATE("can't convert %s to complex")
+
+TRANSLATE("can't convert %s to float")
+
+TRANSLATE("can't convert %s to int")
+
+TRANSLATE("can't convert '%q' object to %q implicitly")
+
+TRANSLATE("can't convert NaN to int")
+
+TRANSLATE("can't convert inf to int")
+
+TRANSLATE("can't convert to complex")
+
+TRANSLATE("can't convert to float")
+
+TRANSLATE("can't convert to int")
+
+TRANSLATE("can't convert to str implicitly")
+
+TRANSLATE("can't declare nonlocal in outer code")
+
+TRANSLATE("can't delete expression")
+
+TRANSLATE("can't do truncated division of a complex number")
+
+TRANSLATE("can't have multiple **x")
+
+TRANSLATE("can't have multiple *x")
+
+TRANSLATE("can't pend throw to just-started generator")
+
+TRANSLATE("can't send non-None value to a just-started generator")
+
+TRANSLATE("can't switch from automatic field numbering to manual field specification")
+
+TRANSLATE("can't switch from manual field specification to automatic field numbering")
+
+TRANSLATE("cannot create '%q' instances")
+
+TRANSLATE("cannot create instance")
+
+TRANSLATE("cannot import name %q")
+
+TRANSLATE("cannot perform relative import")
+
+TRANSLATE("chr() arg not in range(0x110000)")
+
+TRANSLATE("complex division by zero")
+
+TRANSLATE("constant must be an integer")
+
+TRANSLATE("default 'except' must be last")
+
+TRANSLATE("dict update sequence has wrong length")
+
+TRANSLATE("division by zero")
+
+TRANSLATE("division by zero")
+
+TRANSLATE("division by zero")
+
+TRANSLATE("empty separator")
+
+TRANSLATE("empty separator")
+
+TRANSLATE("end of format while looking for conversion specifier")
+
+TRANSLATE("exceptions must derive from BaseException")
+
+TRANSLATE("expected ':' after format specifier")
+
+TRANSLATE("expected tuple/list")
+
+TRANSLATE("expecting just a value for set")
+
+TRANSLATE("expecting key:value for dict")
+
+TRANSLATE("extra keyword arguments given")
+
+TRANSLATE("extra positional arguments given")
+
+TRANSLATE("first argument to super() must be type")
+
+TRANSLATE("format requires a dict")
+
+TRANSLATE("function does not take keyword arguments")
+
+TRANSLATE("function expected at most %d arguments, got %d")
+
+TRANSLATE("function got multiple values for argument '%q'")
+
+TRANSLATE("function missing %d required positional arguments")
+
+TRANSLATE("function missing keyword-only argument")
+
+TRANSLATE("function missing required keyword argument '%q'")
+
+TRANSLATE("function missing required positional argument #%d")
+
+TRANSLATE("function takes %d positional arguments but %d were given")
+
+TRANSLATE("generator already executing")
+
+TRANSLATE("generator ignored GeneratorExit")
+
+TRANSLATE("identifier redefined as global")
+
+TRANSLATE("identifier redefined as nonlocal")
+
+TRANSLATE("incomplete format key")
+
+TRANSLATE("incomplete format")
+
+TRANSLATE("incorrect padding")
+
+TRANSLATE("index out of range")
+
+TRANSLATE("indices must be integers")
+
+TRANSLATE("int() arg 2 must be >= 2 and <= 36")
+
+TRANSLATE("integer required")
+
+TRANSLATE("invalid format specifier")
+
+TRANSLATE("invalid micropython decorator")
+
+TRANSLATE("invalid micropython decorator")
+
+TRANSLATE("invalid syntax for integer with base %d")
+
+TRANSLATE("invalid syntax for integer")
+
+TRANSLATE("invalid syntax for number")
+
+TRANSLATE("invalid syntax")
+
+TRANSLATE("invalid syntax")
+
+TRANSLATE("invalid syntax")
+
+TRANSLATE("invalid syntax")
+
+TRANSLATE("invalid syntax")
+
+TRANSLATE("issubclass() arg 1 must be a class")
+
+TRANSLATE("issubclass() arg 2 must be a class or a tuple of classes")
+
+TRANSLATE("join expects a list of str/bytes objects consistent with self object")
+
+TRANSLATE("keyword argument(s) not yet implemented - use normal args instead")
+
+TRANSLATE("keywords must be strings")
+
+TRANSLATE("length argument not allowed for this type")
+
+TRANSLATE("local variable referenced before assignment")
+
+TRANSLATE("maximum recursion depth exceeded")
+
+TRANSLATE("memory allocation failed, allocating %u bytes")
+
+TRANSLATE("memory allocation failed, heap is locked")
+
+TRANSLATE("module not found")
+
+TRANSLATE("multiple *x in assignment")
+
+TRANSLATE("multiple bases have instance lay-out conflict")
+
+TRANSLATE("must use keyword argument for key function")
+
+TRANSLATE("name '%q' is not defined")
+
+TRANSLATE("name not defined")
+
+TRANSLATE("name reused for argument")
+
+TRANSLATE("need more than %d values to unpack")
+
+TRANSLATE("need more than %d values to unpack")
+
+TRANSLATE("negative shift count")
+
+TRANSLATE("negative shift count")
+
+TRANSLATE("negative shift count")
+
+TRANSLATE("no active exception to reraise")
+
+TRANSLATE("no binding for nonlocal found")
+
+TRANSLATE("no module named '%q'")
+
+TRANSLATE("no such attribute")
+
+TRANSLATE("no such attribute")
+
+TRANSLATE("non-default argument follows default argument")
+
+TRANSLATE("non-hex digit found")
+
+TRANSLATE("non-keyword arg after */**")
+
+TRANSLATE("non-keyword arg after keyword arg")
+
+TRANSLATE("not all arguments converted during string formatting")
+
+TRANSLATE("not enough arguments for format string")
+
+TRANSLATE("object '%s' is not a tuple or list")
+
+TRANSLATE("object does not support item assignment")
+
+TRANSLATE("object does not support item deletion")
+
+TRANSLATE("object has no len")
+
+TRANSLATE("object is not subscriptable")
+
+TRANSLATE("object not an iterator")
+
+TRANSLATE("object not an iterator")
+
+TRANSLATE("object not callable")
+
+TRANSLATE("object not callable")
+
+TRANSLATE("object not in sequence")
+
+TRANSLATE("object not iterable")
+
+TRANSLATE("object of type '%s' has no len()")
+
+TRANSLATE("object with buffer protocol required")
+
+TRANSLATE("odd-length string")
+
+TRANSLATE("offset out of bounds")
+
+TRANSLATE("only slices with step=1 (aka None) are supported")
+
+TRANSLATE("only slices with step=1 (aka None) are supported")
+
+TRANSLATE("only slices with step=1 (aka None) are supported")
+
+TRANSLATE("only slices with step=1 (aka None) are supported")
+
+TRANSLATE("ord expects a character")
+
+TRANSLATE("ord() expected a character, but string of length %d found")
+
+TRANSLATE("overflow converting long int to machine word")
+
+TRANSLATE("pop from an empty set")
+
+TRANSLATE("pop from empty list")
+
+TRANSLATE("popitem(): dictionary is empty")
+
+TRANSLATE("requested length %d but object has length %d")
+
+TRANSLATE("rsplit(None,n)")
+
+TRANSLATE("sign not allowed in string format specifier")
+
+TRANSLATE("sign not allowed with integer format specifier 'c'")
+
+TRANSLATE("single '}' encountered in format string")
+
+TRANSLATE("slice step cannot be zero")
+
+TRANSLATE("small int overflow")
+
+TRANSLATE("start/end indices")
+
+TRANSLATE("stream operation not supported")
+
+TRANSLATE("string index out of range")
+
+TRANSLATE("string index out of range")
+
+TRANSLATE("string indices must be integers, not %s")
+
+TRANSLATE("string not supported; use bytes or bytearray")
+
+TRANSLATE("substring not found")
+
+TRANSLATE("super() can't find self")
+
+TRANSLATE("too many values to unpack (expected %d)")
+
+TRANSLATE("tuple index out of range")
+
+TRANSLATE("tuple index out of range")
+
+TRANSLATE("tuple/list has wrong length")
+
+TRANSLATE("type '%q' is not an acceptable base type")
+
+TRANSLATE("type is not an acceptable base type")
+
+TRANSLATE("type is not an acceptable base type")
+
+TRANSLATE("type object '%q' has no attribute '%q'")
+
+TRANSLATE("type takes 1 or 3 arguments")
+
+TRANSLATE("unexpected indent")
+
+TRANSLATE("unexpected keyword argument '%q'")
+
+TRANSLATE("unicode name escapes")
+
+TRANSLATE("unindent does not match any outer indentation level")
+
+TRANSLATE("unknown conversion specifier %c")
+
+TRANSLATE("unknown format code '%c' for object of type '%s'")
+
+TRANSLATE("unknown format code '%c' for object of type 'float'")
+
+TRANSLATE("unknown format code '%c' for object of type 'str'")
+
+TRANSLATE("unmatched '{' in format")
+
+TRANSLATE("unreadable attribute")
+
+TRANSLATE("unreadable attribute")
+
+TRANSLATE("unreadable attribute")
+
+TRANSLATE("unsupported format character '%c' (0x%x) at index %d")
+
+TRANSLATE("unsupported type for %q: '%s'")
+
+TRANSLATE("unsupported type for operator")
+
+TRANSLATE("unsupported type for operator")
+
+TRANSLATE("unsupported types for %q: '%s', '%s'")
+
+TRANSLATE("value must fit in %d byte(s)")
+
+TRANSLATE("value must fit in %d byte(s)")
+
+TRANSLATE("wrong number of arguments")
+
+TRANSLATE("wrong number of values to unpack")
+
+TRANSLATE("wrong number of values to unpack")
+
+TRANSLATE("wrong number of values to unpack")
+
+TRANSLATE("zero step")
@@ -0,0 +1,1092 @@
+// 32   837 000 0
+// 97 a 434 0010 2
+// 101 e 816 0011 3
+// 105 i 447 0100 4
+// 110 n 543 0101 5
+// 111 o 554 0110 6
+// 114 r 515 0111 7
+// 115 s 414 1000 8
+// 116 t 712 1001 9
+// 95 _ 210 10100 20
+// 99 c 300 10101 21
+// 100 d 264 10110 22
+// 108 l 259 10111 23
+// 112 p 227 11000 24
+// 117 u 258 11001 25
+// 39 \' 116 110100 52
+// 98 b 130 110101 53
+// 102 f 157 110110 54
+// 103 g 137 110111 55
+// 109 m 205 111000 56
+// 37 % 72 1110010 114
+// 69 E 69 1110011 115
+// 104 h 73 1110100 116
+// 118 v 65 1110101 117
+// 119 w 55 1110110 118
+// 120 x 69 1110111 119
+// 121 y 101 1111000 120
+// 78 N 32 11110010 242
+// 106 j 36 11110011 243
+// 107 k 45 11110100 244
+// 113 q 39 11110101 245
+// 40 ( 24 111101100 492
+// 41 ) 24 111101101 493
+// 45 - 17 111101110 494
+// 65 A 14 111101111 495
+// 73 I 18 111110000 496
+// 79 O 19 111110001 497
+// 82 R 13 111110010 498
+// 83 S 18 111110011 499
+// 84 T 13 111110100 500
+// 42 * 9 1111101010 1002
+// 44 , 11 1111101011 1003
+// 47 / 9 1111101100 1004
+// 48 0 8 1111101101 1005
+// 58 : 7 1111101110 1006
+// 60 < 9 1111101111 1007
+// 62 > 9 1111110000 1008
+// 67 C 9 1111110001 1009
+// 68 D 10 1111110010 1010
+// 70 F 6 1111110011 1011
+// 77 M 6 1111110100 1012
+// 80 P 6 1111110101 1013
+// 85 U 9 1111110110 1014
+// 122 z 8 1111110111 1015
+// 10 \n 3 11111110000 2032
+// 35 # 4 11111110001 2033
+// 46 . 3 11111110010 2034
+// 49 1 5 11111110011 2035
+// 50 2 4 11111110100 2036
+// 51 3 3 11111110101 2037
+// 61 = 4 11111110110 2038
+// 66 B 5 11111110111 2039
+// 71 G 4 11111111000 2040
+// 72 H 3 11111111001 2041
+// 76 L 4 11111111010 2042
+// 86 V 3 11111111011 2043
+// 13 \r 2 111111111000 4088
+// 34 \" 2 111111111001 4089
+// 75 K 2 111111111010 4090
+// 123 { 2 111111111011 4091
+// 125 } 2 111111111100 4092
+// 54 6 1 1111111111010 8186
+// 56 8 1 1111111111011 8187
+// 59 ; 1 1111111111100 8188
+// 88 X 1 1111111111101 8189
+// 89 Y 1 1111111111110 8190
+// 90 Z 1 1111111111111 8191
+// length count {3: 1, 4: 8, 5: 6, 6: 5, 7: 7, 8: 4, 9: 9, 10: 14, 11: 12, 12: 5, 13: 6}
+// values [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', '_', 'c', 'd', 'l', 'p', 'u', "'", 'b', 'f', 'g', 'm', '%', 'E', 'h', 'v', 'w', 'x', 'y', 'N', 'j', 'k', 'q', '(', ')', '-', 'A', 'I', 'O', 'R', 'S', 'T', '*', ',', '/', '0', ':', '<', '>', 'C', 'D', 'F', 'M', 'P', 'U', 'z', '\n', '#', '.', '1', '2', '3', '=', 'B', 'G', 'H', 'L', 'V', '\r', '"', 'K', '{', '}', '6', '8', ';', 'X', 'Y', 'Z'] lengths 14 bytearray(b'\x00\x00\x01\x08\x06\x05\x07\x04\t\x0e\x0c\x05\x06\x00')
+// estimated total memory size 40516
+// [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', '_', 'c', 'd', 'l', 'p', 'u', "'", 'b', 'f', 'g', 'm', '%', 'E', 'h', 'v', 'w', 'x', 'y', 'N', 'j', 'k', 'q', '(', ')', '-', 'A', 'I', 'O', 'R', 'S', 'T', '*', ',', '/', '0', ':', '<', '>', 'C', 'D', 'F', 'M', 'P', 'U', 'z', '\n', '#', '.', '1', '2', '3', '=', 'B', 'G', 'H', 'L', 'V', '\r', '"', 'K', '{', '}', '6', '8', ';', 'X', 'Y', 'Z'] bytearray(b'\x00\x00\x01\x08\x06\x05\x07\x04\t\x0e\x0c\x05\x06\x00')
+// This file was automatically generated by makeqstrdata.py
+
+QDEF(MP_QSTR_NULL, (const byte*)"\x00\x00\x00" "")
+QDEF(MP_QSTR_, (const byte*)"\x05\x15\x00" "")
+QDEF(MP_QSTR___add__, (const byte*)"\xc4\x82\x07" "__add__")
+QDEF(MP_QSTR___aenter__, (const byte*)"\x4c\x84\x0a" "__aenter__")
+QDEF(MP_QSTR___aexit__, (const byte*)"\xc4\xcf\x09" "__aexit__")
+QDEF(MP_QSTR___aiter__, (const byte*)"\x4e\x2b\x09" "__aiter__")
+QDEF(MP_QSTR___anext__, (const byte*)"\x83\xb4\x09" "__anext__")
+QDEF(MP_QSTR___bool__, (const byte*)"\x2b\x65\x08" "__bool__")
+QDEF(MP_QSTR___build_class__, (const byte*)"\x42\x88\x0f" "__build_class__")
+QDEF(MP_QSTR___bytes__, (const byte*)"\xdc\x81\x09" "__bytes__")
+QDEF(MP_QSTR___call__, (const byte*)"\xa7\xf9\x08" "__call__")
+QDEF(MP_QSTR___class__, (const byte*)"\x2b\xc5\x09" "__class__")
+QDEF(MP_QSTR___contains__, (const byte*)"\xc6\x5f\x0c" "__contains__")
+QDEF(MP_QSTR___delitem__, (const byte*)"\xfd\x35\x0b" "__delitem__")
+QDEF(MP_QSTR___dict__, (const byte*)"\x7f\x54\x08" "__dict__")
+QDEF(MP_QSTR___enter__, (const byte*)"\x6d\xba\x09" "__enter__")
+QDEF(MP_QSTR___eq__, (const byte*)"\x71\x3e\x06" "__eq__")
+QDEF(MP_QSTR___exit__, (const byte*)"\x45\xf8\x08" "__exit__")
+QDEF(MP_QSTR___ge__, (const byte*)"\xa7\x46\x06" "__ge__")
+QDEF(MP_QSTR___getattr__, (const byte*)"\x40\xf8\x0b" "__getattr__")
+QDEF(MP_QSTR___getitem__, (const byte*)"\x26\x39\x0b" "__getitem__")
+QDEF(MP_QSTR___gt__, (const byte*)"\xb6\x82\x06" "__gt__")
+QDEF(MP_QSTR___hash__, (const byte*)"\xf7\xc8\x08" "__hash__")
+QDEF(MP_QSTR___iadd__, (const byte*)"\x6d\x4a\x08" "__iadd__")
+QDEF(MP_QSTR___import__, (const byte*)"\x38\x3e\x0a" "__import__")
+QDEF(MP_QSTR___init__, (const byte*)"\x5f\xa5\x08" "__init__")
+QDEF(MP_QSTR___isub__, (const byte*)"\x08\x78\x08" "__isub__")
+QDEF(MP_QSTR___iter__, (const byte*)"\xcf\x32\x08" "__iter__")
+QDEF(MP_QSTR___le__, (const byte*)"\xcc\x13\x06" "__le__")
+QDEF(MP_QSTR___len__, (const byte*)"\xe2\xb0\x07" "__len__")
+QDEF(MP_QSTR___lt__, (const byte*)"\x5d\x68\x06" "__lt__")
+QDEF(MP_QSTR___main__, (const byte*)"\x8e\x13\x08" "__main__")
+QDEF(MP_QSTR___module__, (const byte*)"\xff\x30\x0a" "__module__")
+QDEF(MP_QSTR___name__, (const byte*)"\xe2\x38\x08" "__name__")
+QDEF(MP_QSTR___new__, (const byte*)"\x79\x15\x07" "__new__")
+QDEF(MP_QSTR___next__, (const byte*)"\x02\x73\x08" "__next__")
+QDEF(MP_QSTR___path__, (const byte*)"\xc8\x23\x08" "__path__")
+QDEF(MP_QSTR___qualname__, (const byte*)"\x6b\x00\x0c" "__qualname__")
+QDEF(MP_QSTR___repl_print__, (const byte*)"\x00\xbb\x0e" "__repl_print__")
+QDEF(MP_QSTR___repr__, (const byte*)"\x10\x0b\x08" "__repr__")
+QDEF(MP_QSTR___reversed__, (const byte*)"\x61\xff\x0c" "__reversed__")
+QDEF(MP_QSTR___setitem__, (const byte*)"\x32\x3e\x0b" "__setitem__")
+QDEF(MP_QSTR___str__, (const byte*)"\xd0\xcd\x07" "__str__")
+QDEF(MP_QSTR___sub__, (const byte*)"\x21\x09\x07" "__sub__")
+QDEF(MP_QSTR___traceback__, (const byte*)"\x4f\xcf\x0d" "__traceback__")
+QDEF(MP_QSTR__star_, (const byte*)"\x8f\xb5\x01" "*")
+QDEF(MP_QSTR__, (const byte*)"\xfa\xb5\x01" "_")
+QDEF(MP_QSTR__slash_, (const byte*)"\x8a\xb5\x01" "/")
+QDEF(MP_QSTR__percent__hash_o, (const byte*)"\x6c\x1a\x03" "%#o")
+QDEF(MP_QSTR__percent__hash_x, (const byte*)"\x7b\x1a\x03" "%#x")
+QDEF(MP_QSTR__brace_open__colon__hash_b_brace_close_, (const byte*)"\x58\x37\x05" "{:#b}")
+QDEF(MP_QSTR__space_, (const byte*)"\x85\xb5\x01" " ")
+QDEF(MP_QSTR__0x0a_, (const byte*)"\xaf\xb5\x01" "\x0a")
+QDEF(MP_QSTR_maximum_space_recursion_space_depth_space_exceeded, (const byte*)"\x73\x1e\x20" "maximum recursion depth exceeded")
+QDEF(MP_QSTR__lt_module_gt_, (const byte*)"\xbd\x94\x08" "<module>")
+QDEF(MP_QSTR__lt_lambda_gt_, (const byte*)"\x80\x8c\x08" "<lambda>")
+QDEF(MP_QSTR__lt_listcomp_gt_, (const byte*)"\xd4\x15\x0a" "<listcomp>")
+QDEF(MP_QSTR__lt_dictcomp_gt_, (const byte*)"\xcc\x8d\x0a" "<dictcomp>")
+QDEF(MP_QSTR__lt_setcomp_gt_, (const byte*)"\x54\x51\x09" "<setcomp>")
+QDEF(MP_QSTR__lt_genexpr_gt_, (const byte*)"\x34\x6a\x09" "<genexpr>")
+QDEF(MP_QSTR__lt_string_gt_, (const byte*)"\x52\x53\x08" "<string>")
+QDEF(MP_QSTR__lt_stdin_gt_, (const byte*)"\xe3\x63\x07" "<stdin>")
+QDEF(MP_QSTR_utf_hyphen_8, (const byte*)"\xb7\x82\x05" "utf-8")
+QDEF(MP_QSTR_ArithmeticError, (const byte*)"\x2d\x8c\x0f" "ArithmeticError")
+QDEF(MP_QSTR_AssertionError, (const byte*)"\x97\x5a\x0e" "AssertionError")
+QDEF(MP_QSTR_AttributeError, (const byte*)"\x21\xde\x0e" "AttributeError")
+QDEF(MP_QSTR_BaseException, (const byte*)"\x07\x92\x0d" "BaseException")
+QDEF(MP_QSTR_EACCES, (const byte*)"\x37\xc2\x06" "EACCES")
+QDEF(MP_QSTR_EADDRINUSE, (const byte*)"\x17\x11\x0a" "EADDRINUSE")
+QDEF(MP_QSTR_EAGAIN, (const byte*)"\x20\xec\x06" "EAGAIN")
+QDEF(MP_QSTR_EALREADY, (const byte*)"\x46\x15\x08" "EALREADY")
+QDEF(MP_QSTR_EBADF, (const byte*)"\x61\xa3\x05" "EBADF")
+QDEF(MP_QSTR_ECONNABORTED, (const byte*)"\x27\xab\x0c" "ECONNABORTED")
+QDEF(MP_QSTR_ECONNREFUSED, (const byte*)"\x3a\x2c\x0c" "ECONNREFUSED")
+QDEF(MP_QSTR_ECONNRESET, (const byte*)"\x19\xfb\x0a" "ECONNRESET")
+QDEF(MP_QSTR_EEXIST, (const byte*)"\x53\xad\x06" "EEXIST")
+QDEF(MP_QSTR_EHOSTUNREACH, (const byte*)"\x86\x25\x0c" "EHOSTUNREACH")
+QDEF(MP_QSTR_EINPROGRESS, (const byte*)"\x9a\xa0\x0b" "EINPROGRESS")
+QDEF(MP_QSTR_EINVAL, (const byte*)"\x5c\xff\x06" "EINVAL")
+QDEF(MP_QSTR_EIO, (const byte*)"\x86\xa6\x03" "EIO")
+QDEF(MP_QSTR_EISDIR, (const byte*)"\xa5\x4f\x06" "EISDIR")
+QDEF(MP_QSTR_ENOBUFS, (const byte*)"\xe3\x87\x07" "ENOBUFS")
+QDEF(MP_QSTR_ENODEV, (const byte*)"\xb6\x67\x06" "ENODEV")
+QDEF(MP_QSTR_ENOENT, (const byte*)"\x5e\x65\x06" "ENOENT")
+QDEF(MP_QSTR_ENOMEM, (const byte*)"\xa4\x85\x06" "ENOMEM")
+QDEF(MP_QSTR_ENOTCONN, (const byte*)"\x79\xd7\x08" "ENOTCONN")
+QDEF(MP_QSTR_EOFError, (const byte*)"\x91\xbf\x08" "EOFError")
+QDEF(MP_QSTR_EOPNOTSUPP, (const byte*)"\xac\x97\x0a" "EOPNOTSUPP")
+QDEF(MP_QSTR_EPERM, (const byte*)"\xea\x7f\x05" "EPERM")
+QDEF(MP_QSTR_ETIMEDOUT, (const byte*)"\xff\xf8\x09" "ETIMEDOUT")
+QDEF(MP_QSTR_Ellipsis, (const byte*)"\xf0\xe0\x08" "Ellipsis")
+QDEF(MP_QSTR_Exception, (const byte*)"\xf2\x29\x09" "Exception")
+QDEF(MP_QSTR_GeneratorExit, (const byte*)"\x16\x62\x0d" "GeneratorExit")
+QDEF(MP_QSTR_ImportError, (const byte*)"\x20\x9c\x0b" "ImportError")
+QDEF(MP_QSTR_IndentationError, (const byte*)"\x5c\x20\x10" "IndentationError")
+QDEF(MP_QSTR_IndexError, (const byte*)"\x83\xad\x0a" "IndexError")
+QDEF(MP_QSTR_KeyError, (const byte*)"\xea\x00\x08" "KeyError")
+QDEF(MP_QSTR_KeyboardInterrupt, (const byte*)"\xaf\xe2\x11" "KeyboardInterrupt")
+QDEF(MP_QSTR_LookupError, (const byte*)"\xff\x69\x0b" "LookupError")
+QDEF(MP_QSTR_MemoryError, (const byte*)"\xdc\x83\x0b" "MemoryError")
+QDEF(MP_QSTR_MpyError, (const byte*)"\x39\x7f\x08" "MpyError")
+QDEF(MP_QSTR_NameError, (const byte*)"\xba\x2d\x09" "NameError")
+QDEF(MP_QSTR_NoneType, (const byte*)"\x17\x68\x08" "NoneType")
+QDEF(MP_QSTR_NotImplementedError, (const byte*)"\xc6\x98\x13" "NotImplementedError")
+QDEF(MP_QSTR_OSError, (const byte*)"\xa1\x65\x07" "OSError")
+QDEF(MP_QSTR_OverflowError, (const byte*)"\x81\xe1\x0d" "OverflowError")
+QDEF(MP_QSTR_ReloadException, (const byte*)"\x03\xc2\x0f" "ReloadException")
+QDEF(MP_QSTR_RuntimeError, (const byte*)"\x61\xf1\x0c" "RuntimeError")
+QDEF(MP_QSTR_StopAsyncIteration, (const byte*)"\xec\xf0\x12" "StopAsyncIteration")
+QDEF(MP_QSTR_StopIteration, (const byte*)"\xea\x1c\x0d" "StopIteration")
+QDEF(MP_QSTR_Struct, (const byte*)"\xf2\x94\x06" "Struct")
+QDEF(MP_QSTR_SyntaxError, (const byte*)"\x94\x8f\x0b" "SyntaxError")
+QDEF(MP_QSTR_SystemExit, (const byte*)"\x20\xff\x0a" "SystemExit")
+QDEF(MP_QSTR_TimeoutError, (const byte*)"\x66\x4b\x0c" "TimeoutError")
+QDEF(MP_QSTR_TypeError, (const byte*)"\x25\x96\x09" "TypeError")
+QDEF(MP_QSTR_UnicodeError, (const byte*)"\x22\xd1\x0c" "UnicodeError")
+QDEF(MP_QSTR_ValueError, (const byte*)"\x96\x87\x0a" "ValueError")
+QDEF(MP_QSTR_ZeroDivisionError, (const byte*)"\xb6\x27\x11" "ZeroDivisionError")
+QDEF(MP_QSTR_abs, (const byte*)"\x95\x32\x03" "abs")
+QDEF(MP_QSTR_add, (const byte*)"\x44\x32\x03" "add")
+QDEF(MP_QSTR_all, (const byte*)"\x44\x33\x03" "all")
+QDEF(MP_QSTR_any, (const byte*)"\x13\x33\x03" "any")
+QDEF(MP_QSTR_append, (const byte*)"\x6b\x97\x06" "append")
+QDEF(MP_QSTR_args, (const byte*)"\xc2\xc6\x04" "args")
+QDEF(MP_QSTR_bin, (const byte*)"\xe0\x48\x03" "bin")
+QDEF(MP_QSTR_bool, (const byte*)"\xeb\x3c\x04" "bool")
+QDEF(MP_QSTR_bound_method, (const byte*)"\x97\xa2\x0c" "bound_method")
+QDEF(MP_QSTR_builtins, (const byte*)"\xf7\x31\x08" "builtins")
+QDEF(MP_QSTR_bytearray, (const byte*)"\x76\xa3\x09" "bytearray")
+QDEF(MP_QSTR_bytecode, (const byte*)"\x22\x7d\x08" "bytecode")
+QDEF(MP_QSTR_bytes, (const byte*)"\x5c\xb2\x05" "bytes")
+QDEF(MP_QSTR_calcsize, (const byte*)"\x4d\x38\x08" "calcsize")
+QDEF(MP_QSTR_callable, (const byte*)"\x0d\x70\x08" "callable")
+QDEF(MP_QSTR_chr, (const byte*)"\xdc\x4c\x03" "chr")
+QDEF(MP_QSTR_classmethod, (const byte*)"\xb4\x8c\x0b" "classmethod")
+QDEF(MP_QSTR_clear, (const byte*)"\x7c\xa0\x05" "clear")
+QDEF(MP_QSTR_close, (const byte*)"\x33\x67\x05" "close")
+QDEF(MP_QSTR_closure, (const byte*)"\x74\xca\x07" "closure")
+QDEF(MP_QSTR_complex, (const byte*)"\xc5\x9d\x07" "complex")
+QDEF(MP_QSTR_const, (const byte*)"\xc0\xff\x05" "const")
+QDEF(MP_QSTR_copy, (const byte*)"\xe0\xdb\x04" "copy")
+QDEF(MP_QSTR_count, (const byte*)"\xa6\x4d\x05" "count")
+QDEF(MP_QSTR_decode, (const byte*)"\xa9\x59\x06" "decode")
+QDEF(MP_QSTR_default, (const byte*)"\xce\x7d\x07" "default")
+QDEF(MP_QSTR_delattr, (const byte*)"\xdb\xc8\x07" "delattr")
+QDEF(MP_QSTR_deleter, (const byte*)"\x6e\xdb\x07" "deleter")
+QDEF(MP_QSTR_dict, (const byte*)"\x3f\xfc\x04" "dict")
+QDEF(MP_QSTR_dict_view, (const byte*)"\x2d\xa9\x09" "dict_view")
+QDEF(MP_QSTR_difference, (const byte*)"\x72\x24\x0a" "difference")
+QDEF(MP_QSTR_difference_update, (const byte*)"\x9c\xfa\x11" "difference_update")
+QDEF(MP_QSTR_dir, (const byte*)"\xfa\x1e\x03" "dir")
+QDEF(MP_QSTR_discard, (const byte*)"\x0f\x71\x07" "discard")
+QDEF(MP_QSTR_divmod, (const byte*)"\xb8\x04\x06" "divmod")
+QDEF(MP_QSTR_doc, (const byte*)"\x2d\x1f\x03" "doc")
+QDEF(MP_QSTR_encode, (const byte*)"\x43\xca\x06" "encode")
+QDEF(MP_QSTR_end, (const byte*)"\x0a\x23\x03" "end")
+QDEF(MP_QSTR_endswith, (const byte*)"\x1b\xa3\x08" "endswith")
+QDEF(MP_QSTR_enumerate, (const byte*)"\x71\xba\x09" "enumerate")
+QDEF(MP_QSTR_errno, (const byte*)"\xc1\x11\x05" "errno")
+QDEF(MP_QSTR_eval, (const byte*)"\x9b\xa6\x04" "eval")
+QDEF(MP_QSTR_exec, (const byte*)"\x1e\xc0\x04" "exec")
+QDEF(MP_QSTR_extend, (const byte*)"\x63\xe8\x06" "extend")
+QDEF(MP_QSTR_filename, (const byte*)"\xe4\x54\x08" "filename")
+QDEF(MP_QSTR_filename2, (const byte*)"\x56\xf1\x09" "filename2")
+QDEF(MP_QSTR_filter, (const byte*)"\x25\xbe\x06" "filter")
+QDEF(MP_QSTR_find, (const byte*)"\x00\x34\x04" "find")
+QDEF(MP_QSTR_float, (const byte*)"\x35\x44\x05" "float")
+QDEF(MP_QSTR_flush, (const byte*)"\x61\xc1\x05" "flush")
+QDEF(MP_QSTR_format, (const byte*)"\x26\x33\x06" "format")
+QDEF(MP_QSTR_from_bytes, (const byte*)"\x35\x74\x0a" "from_bytes")
+QDEF(MP_QSTR_fromkeys, (const byte*)"\x37\xbd\x08" "fromkeys")
+QDEF(MP_QSTR_function, (const byte*)"\x27\x02\x08" "function")
+QDEF(MP_QSTR_generator, (const byte*)"\x96\xc3\x09" "generator")
+QDEF(MP_QSTR_get, (const byte*)"\x33\x3b\x03" "get")
+QDEF(MP_QSTR_getattr, (const byte*)"\xc0\x17\x07" "getattr")
+QDEF(MP_QSTR_getter, (const byte*)"\x90\xb2\x06" "getter")
+QDEF(MP_QSTR_globals, (const byte*)"\x9d\x49\x07" "globals")
+QDEF(MP_QSTR_hasattr, (const byte*)"\x8c\xb0\x07" "hasattr")
+QDEF(MP_QSTR_hash, (const byte*)"\xb7\x70\x04" "hash")
+QDEF(MP_QSTR_heap_lock, (const byte*)"\xad\x8c\x09" "heap_lock")
+QDEF(MP_QSTR_heap_unlock, (const byte*)"\x56\x2d\x0b" "heap_unlock")
+QDEF(MP_QSTR_hex, (const byte*)"\x70\x50\x03" "hex")
+QDEF(MP_QSTR_id, (const byte*)"\x28\x6f\x02" "id")
+QDEF(MP_QSTR_imag, (const byte*)"\x47\xb7\x04" "imag")
+QDEF(MP_QSTR_index, (const byte*)"\x7b\x28\x05" "index")
+QDEF(MP_QSTR_insert, (const byte*)"\x12\x54\x06" "insert")
+QDEF(MP_QSTR_int, (const byte*)"\x16\x53\x03" "int")
+QDEF(MP_QSTR_intersection, (const byte*)"\x28\x2a\x0c" "intersection")
+QDEF(MP_QSTR_intersection_update, (const byte*)"\x06\xdd\x13" "intersection_update")
+QDEF(MP_QSTR_isalpha, (const byte*)"\xeb\x37\x07" "isalpha")
+QDEF(MP_QSTR_isdigit, (const byte*)"\xa8\x9a\x07" "isdigit")
+QDEF(MP_QSTR_isdisjoint, (const byte*)"\xf7\x68\x0a" "isdisjoint")
+QDEF(MP_QSTR_isinstance, (const byte*)"\xb6\xbe\x0a" "isinstance")
+QDEF(MP_QSTR_islower, (const byte*)"\xfc\x80\x07" "islower")
+QDEF(MP_QSTR_isspace, (const byte*)"\x5b\xf8\x07" "isspace")
+QDEF(MP_QSTR_issubclass, (const byte*)"\xb5\x7f\x0a" "issubclass")
+QDEF(MP_QSTR_issubset, (const byte*)"\xb9\xc1\x08" "issubset")
+QDEF(MP_QSTR_issuperset, (const byte*)"\xfc\xec\x0a" "issuperset")
+QDEF(MP_QSTR_isupper, (const byte*)"\xdd\xa7\x07" "isupper")
+QDEF(MP_QSTR_items, (const byte*)"\xe3\x53\x05" "items")
+QDEF(MP_QSTR_iter, (const byte*)"\x8f\x21\x04" "iter")
+QDEF(MP_QSTR_iter_unpack, (const byte*)"\xb2\x2f\x0b" "iter_unpack")
+QDEF(MP_QSTR_iterable, (const byte*)"\x25\x92\x08" "iterable")
+QDEF(MP_QSTR_iterator, (const byte*)"\x47\xbe\x08" "iterator")
+QDEF(MP_QSTR_join, (const byte*)"\xa7\x5c\x04" "join")
+QDEF(MP_QSTR_key, (const byte*)"\x32\x6d\x03" "key")
+QDEF(MP_QSTR_keys, (const byte*)"\x01\x13\x04" "keys")
+QDEF(MP_QSTR_len, (const byte*)"\x62\x40\x03" "len")
+QDEF(MP_QSTR_list, (const byte*)"\x27\x1d\x04" "list")
+QDEF(MP_QSTR_little, (const byte*)"\x89\x6a\x06" "little")
+QDEF(MP_QSTR_locals, (const byte*)"\x3b\xa1\x06" "locals")
+QDEF(MP_QSTR_lower, (const byte*)"\xc6\xcb\x05" "lower")
+QDEF(MP_QSTR_lstrip, (const byte*)"\xe5\xb9\x06" "lstrip")
+QDEF(MP_QSTR_map, (const byte*)"\xb9\x43\x03" "map")
+QDEF(MP_QSTR_max, (const byte*)"\xb1\x43\x03" "max")
+QDEF(MP_QSTR_micropython, (const byte*)"\x0b\x7c\x0b" "micropython")
+QDEF(MP_QSTR_min, (const byte*)"\xaf\x42\x03" "min")
+QDEF(MP_QSTR_module, (const byte*)"\xbf\x99\x06" "module")
+QDEF(MP_QSTR_native, (const byte*)"\x84\x0b\x06" "native")
+QDEF(MP_QSTR_next, (const byte*)"\x42\x88\x04" "next")
+QDEF(MP_QSTR_object, (const byte*)"\x90\x8d\x06" "object")
+QDEF(MP_QSTR_oct, (const byte*)"\xfd\x5c\x03" "oct")
+QDEF(MP_QSTR_opt_level, (const byte*)"\x87\x67\x09" "opt_level")
+QDEF(MP_QSTR_ord, (const byte*)"\x1c\x5e\x03" "ord")
+QDEF(MP_QSTR_pack, (const byte*)"\xbc\xd1\x04" "pack")
+QDEF(MP_QSTR_pack_into, (const byte*)"\x1f\xa9\x09" "pack_into")
+QDEF(MP_QSTR_pend_throw, (const byte*)"\xf3\x74\x0a" "pend_throw")
+QDEF(MP_QSTR_pop, (const byte*)"\x2a\x73\x03" "pop")
+QDEF(MP_QSTR_popitem, (const byte*)"\xbf\x2c\x07" "popitem")
+QDEF(MP_QSTR_pow, (const byte*)"\x2d\x73\x03" "pow")
+QDEF(MP_QSTR_print, (const byte*)"\x54\xc6\x05" "print")
+QDEF(MP_QSTR_property, (const byte*)"\xc2\x29\x08" "property")
+QDEF(MP_QSTR_protocol_pin, (const byte*)"\x1b\x57\x0c" "protocol_pin")
+QDEF(MP_QSTR_protocol_stream, (const byte*)"\x90\x24\x0f" "protocol_stream")
+QDEF(MP_QSTR_range, (const byte*)"\x1a\x5e\x05" "range")
+QDEF(MP_QSTR_real, (const byte*)"\xbf\xf9\x04" "real")
+QDEF(MP_QSTR_remove, (const byte*)"\x63\x8a\x06" "remove")
+QDEF(MP_QSTR_replace, (const byte*)"\x49\x25\x07" "replace")
+QDEF(MP_QSTR_repr, (const byte*)"\xd0\xf7\x04" "repr")
+QDEF(MP_QSTR_reverse, (const byte*)"\x25\x2a\x07" "reverse")
+QDEF(MP_QSTR_reversed, (const byte*)"\xa1\x6e\x08" "reversed")
+QDEF(MP_QSTR_rfind, (const byte*)"\xd2\x9c\x05" "rfind")
+QDEF(MP_QSTR_rindex, (const byte*)"\xe9\x2b\x06" "rindex")
+QDEF(MP_QSTR_round, (const byte*)"\xe7\x25\x05" "round")
+QDEF(MP_QSTR_rsplit, (const byte*)"\xa5\x00\x06" "rsplit")
+QDEF(MP_QSTR_rstrip, (const byte*)"\x3b\x95\x06" "rstrip")
+QDEF(MP_QSTR_send, (const byte*)"\xb9\x76\x04" "send")
+QDEF(MP_QSTR_sep, (const byte*)"\x23\x8f\x03" "sep")
+QDEF(MP_QSTR_set, (const byte*)"\x27\x8f\x03" "set")
+QDEF(MP_QSTR_setattr, (const byte*)"\xd4\xa8\x07" "setattr")
+QDEF(MP_QSTR_setdefault, (const byte*)"\x6c\xa3\x0a" "setdefault")
+QDEF(MP_QSTR_setter, (const byte*)"\x04\x59\x06" "setter")
+QDEF(MP_QSTR_size, (const byte*)"\x20\xa5\x04" "size")
+QDEF(MP_QSTR_slice, (const byte*)"\xb5\xf4\x05" "slice")
+QDEF(MP_QSTR_sort, (const byte*)"\xbf\x9d\x04" "sort")
+QDEF(MP_QSTR_sorted, (const byte*)"\x5e\x15\x06" "sorted")
+QDEF(MP_QSTR_split, (const byte*)"\xb7\x33\x05" "split")
+QDEF(MP_QSTR_start, (const byte*)"\x85\xef\x05" "start")
+QDEF(MP_QSTR_startswith, (const byte*)"\x74\xe8\x0a" "startswith")
+QDEF(MP_QSTR_staticmethod, (const byte*)"\x62\xaf\x0c" "staticmethod")
+QDEF(MP_QSTR_step, (const byte*)"\x57\x36\x04" "step")
+QDEF(MP_QSTR_stop, (const byte*)"\x9d\x36\x04" "stop")
+QDEF(MP_QSTR_str, (const byte*)"\x50\x8d\x03" "str")
+QDEF(MP_QSTR_strerror, (const byte*)"\x48\x71\x08" "strerror")
+QDEF(MP_QSTR_strip, (const byte*)"\x29\x1e\x05" "strip")
+QDEF(MP_QSTR_sum, (const byte*)"\x2e\x8d\x03" "sum")
+QDEF(MP_QSTR_super, (const byte*)"\xc4\xb2\x05" "super")
+QDEF(MP_QSTR_symmetric_difference, (const byte*)"\xce\x67\x14" "symmetric_difference")
+QDEF(MP_QSTR_symmetric_difference_update, (const byte*)"\x60\xf8\x1b" "symmetric_difference_update")
+QDEF(MP_QSTR_throw, (const byte*)"\xb3\x44\x05" "throw")
+QDEF(MP_QSTR_to_bytes, (const byte*)"\xd8\x3e\x08" "to_bytes")
+QDEF(MP_QSTR_tuple, (const byte*)"\xfd\x41\x05" "tuple")
+QDEF(MP_QSTR_type, (const byte*)"\x9d\x7f\x04" "type")
+QDEF(MP_QSTR_union, (const byte*)"\xf6\x7c\x05" "union")
+QDEF(MP_QSTR_unpack, (const byte*)"\x07\x3c\x06" "unpack")
+QDEF(MP_QSTR_unpack_from, (const byte*)"\x0e\x6d\x0b" "unpack_from")
+QDEF(MP_QSTR_unpack_into, (const byte*)"\x04\xa2\x0b" "unpack_into")
+QDEF(MP_QSTR_update, (const byte*)"\xb4\x76\x06" "update")
+QDEF(MP_QSTR_upper, (const byte*)"\x27\x94\x05" "upper")
+QDEF(MP_QSTR_ustruct, (const byte*)"\x47\x08\x07" "ustruct")
+QDEF(MP_QSTR_value, (const byte*)"\x4e\x34\x05" "value")
+QDEF(MP_QSTR_values, (const byte*)"\x7d\xbe\x06" "values")
+QDEF(MP_QSTR_zip, (const byte*)"\xe6\xac\x03" "zip")
+QINDEX(MP_QSTR_find)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_ReloadException)
+QINDEX(MP_QSTR_unpack_into)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_BaseException)
+QINDEX(MP_QSTR___isub__)
+QINDEX(MP_QSTR_unpack)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_micropython)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_callable)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_insert)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_GeneratorExit)
+QINDEX(MP_QSTR_NoneType)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_range)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_ord)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_exec)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_EAGAIN)
+QINDEX(MP_QSTR_AttributeError)
+QINDEX(MP_QSTR_ImportError)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_TypeError)
+QINDEX(MP_QSTR_filter)
+QINDEX(MP_QSTR_function)
+QINDEX(MP_QSTR_intersection)
+QINDEX(MP_QSTR_iterable)
+QINDEX(MP_QSTR_reverse)
+QINDEX(MP_QSTR_strip)
+QINDEX(MP_QSTR_upper)
+QINDEX(MP_QSTR_ArithmeticError)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___setitem__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR__lt_genexpr_gt_)
+QINDEX(MP_QSTR_float)
+QINDEX(MP_QSTR_from_bytes)
+QINDEX(MP_QSTR_EACCES)
+QINDEX(MP_QSTR___import__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_ECONNREFUSED)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_dict)
+QINDEX(MP_QSTR___getattr__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___build_class__)
+QINDEX(MP_QSTR_encode)
+QINDEX(MP_QSTR_add)
+QINDEX(MP_QSTR___exit__)
+QINDEX(MP_QSTR_next)
+QINDEX(MP_QSTR_iterator)
+QINDEX(MP_QSTR_ustruct)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___aenter__)
+QINDEX(MP_QSTR_calcsize)
+QINDEX(MP_QSTR_value)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_print)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_step)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_isspace)
+QINDEX(MP_QSTR_IndentationError)
+QINDEX(MP_QSTR___lt__)
+QINDEX(MP_QSTR_bytes)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_symmetric_difference_update)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_len)
+QINDEX(MP_QSTR_extend)
+QINDEX(MP_QSTR_remove)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___qualname__)
+QINDEX(MP_QSTR__percent__hash_o)
+QINDEX(MP_QSTR___enter__)
+QINDEX(MP_QSTR___iadd__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_hex)
+QINDEX(MP_QSTR___eq__)
+QINDEX(MP_QSTR_difference)
+QINDEX(MP_QSTR_maximum_space_recursion_space_depth_space_exceeded)
+QINDEX(MP_QSTR_closure)
+QINDEX(MP_QSTR_enumerate)
+QINDEX(MP_QSTR_startswith)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR__percent__hash_x)
+QINDEX(MP_QSTR_clear)
+QINDEX(MP_QSTR_index)
+QINDEX(MP_QSTR_values)
+QINDEX(MP_QSTR___dict__)
+QINDEX(MP_QSTR__lt_lambda_gt_)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___anext__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_EIO)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_little)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_hasattr)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_getter)
+QINDEX(MP_QSTR_protocol_stream)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_abs)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_AssertionError)
+QINDEX(MP_QSTR_bound_method)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_EINPROGRESS)
+QINDEX(MP_QSTR_eval)
+QINDEX(MP_QSTR_difference_update)
+QINDEX(MP_QSTR_stop)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_reversed)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_rsplit)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___ge__)
+QINDEX(MP_QSTR_isdigit)
+QINDEX(MP_QSTR_join)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_heap_lock)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_KeyboardInterrupt)
+QINDEX(MP_QSTR_min)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_throw)
+QINDEX(MP_QSTR_classmethod)
+QINDEX(MP_QSTR_slice)
+QINDEX(MP_QSTR___gt__)
+QINDEX(MP_QSTR_utf_hyphen_8)
+QINDEX(MP_QSTR_divmod)
+QINDEX(MP_QSTR_hash)
+QINDEX(MP_QSTR_isinstance)
+QINDEX(MP_QSTR_send)
+QINDEX(MP_QSTR_update)
+QINDEX(MP_QSTR__lt_module_gt_)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_popitem)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_args)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___add__)
+QINDEX(MP_QSTR_super)
+QINDEX(MP_QSTR_NotImplementedError)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___iter__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_rfind)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_setattr)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_to_bytes)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_delattr)
+QINDEX(MP_QSTR_chr)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_bin)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___len__)
+QINDEX(MP_QSTR___name__)
+QINDEX(MP_QSTR_filename)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_zip)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_KeyError)
+QINDEX(MP_QSTR_StopIteration)
+QINDEX(MP_QSTR_StopAsyncIteration)
+QINDEX(MP_QSTR_bool)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_Ellipsis)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_Struct)
+QINDEX(MP_QSTR_pend_throw)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_union)
+QINDEX(MP_QSTR___hash__)
+QINDEX(MP_QSTR_isdisjoint)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_dir)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_islower)
+QINDEX(MP_QSTR_issuperset)
+QINDEX(MP_QSTR_oct)
+QINDEX(MP_QSTR___module__)
+QINDEX(MP_QSTR___repl_print__)
+QINDEX(MP_QSTR_ETIMEDOUT)
+QINDEX(MP_QSTR___next__)
+QINDEX(MP_QSTR_keys)
+QINDEX(MP_QSTR_setter)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_intersection_update)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_end)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_unpack_from)
+QINDEX(MP_QSTR_discard)
+QINDEX(MP_QSTR___repr__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_any)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_int)
+QINDEX(MP_QSTR_EADDRINUSE)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_ECONNRESET)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_endswith)
+QINDEX(MP_QSTR_protocol_pin)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_pack_into)
+QINDEX(MP_QSTR_SystemExit)
+QINDEX(MP_QSTR___sub__)
+QINDEX(MP_QSTR_UnicodeError)
+QINDEX(MP_QSTR_bytecode)
+QINDEX(MP_QSTR_sep)
+QINDEX(MP_QSTR_size)
+QINDEX(MP_QSTR___getitem__)
+QINDEX(MP_QSTR_ECONNABORTED)
+QINDEX(MP_QSTR_format)
+QINDEX(MP_QSTR_id)
+QINDEX(MP_QSTR_list)
+QINDEX(MP_QSTR___bool__)
+QINDEX(MP_QSTR___class__)
+QINDEX(MP_QSTR_dict_view)
+QINDEX(MP_QSTR_doc)
+QINDEX(MP_QSTR_pop)
+QINDEX(MP_QSTR_pow)
+QINDEX(MP_QSTR_set)
+QINDEX(MP_QSTR_key)
+QINDEX(MP_QSTR_close)
+QINDEX(MP_QSTR_get)
+QINDEX(MP_QSTR_sum)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_fromkeys)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_MpyError)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_locals)
+QINDEX(MP_QSTR_rstrip)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_all)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_EALREADY)
+QINDEX(MP_QSTR_imag)
+QINDEX(MP_QSTR_strerror)
+QINDEX(MP_QSTR_replace)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___aiter__)
+QINDEX(MP_QSTR___traceback__)
+QINDEX(MP_QSTR_str)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR__lt_string_gt_)
+QINDEX(MP_QSTR_EEXIST)
+QINDEX(MP_QSTR__lt_setcomp_gt_)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_filename2)
+QINDEX(MP_QSTR_heap_unlock)
+QINDEX(MP_QSTR__brace_open__colon__hash_b_brace_close_)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_EINVAL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_ENOENT)
+QINDEX(MP_QSTR___init__)
+QINDEX(MP_QSTR_sorted)
+QINDEX(MP_QSTR___reversed__)
+QINDEX(MP_QSTR_EBADF)
+QINDEX(MP_QSTR_RuntimeError)
+QINDEX(MP_QSTR_flush)
+QINDEX(MP_QSTR_staticmethod)
+QINDEX(MP_QSTR_TimeoutError)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_append)
+QINDEX(MP_QSTR_setdefault)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_deleter)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_bytearray)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___new__)
+QINDEX(MP_QSTR_ENOTCONN)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_OverflowError)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_IndexError)
+QINDEX(MP_QSTR_native)
+QINDEX(MP_QSTR__space_)
+QINDEX(MP_QSTR_EHOSTUNREACH)
+QINDEX(MP_QSTR_opt_level)
+QINDEX(MP_QSTR_start)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR__slash_)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___main__)
+QINDEX(MP_QSTR__star_)
+QINDEX(MP_QSTR_iter)
+QINDEX(MP_QSTR_EOFError)
+QINDEX(MP_QSTR_object)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_SyntaxError)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_ValueError)
+QINDEX(MP_QSTR_generator)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_globals)
+QINDEX(MP_QSTR_type)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_OSError)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_ENOMEM)
+QINDEX(MP_QSTR_EISDIR)
+QINDEX(MP_QSTR_count)
+QINDEX(MP_QSTR___call__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_decode)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_EOPNOTSUPP)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR__0x0a_)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_max)
+QINDEX(MP_QSTR_iter_unpack)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_issubclass)
+QINDEX(MP_QSTR_ENODEV)
+QINDEX(MP_QSTR_ZeroDivisionError)
+QINDEX(MP_QSTR_split)
+QINDEX(MP_QSTR_issubset)
+QINDEX(MP_QSTR_NameError)
+QINDEX(MP_QSTR_map)
+QINDEX(MP_QSTR_pack)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_module)
+QINDEX(MP_QSTR_const)
+QINDEX(MP_QSTR_errno)
+QINDEX(MP_QSTR_getattr)
+QINDEX(MP_QSTR_property)
+QINDEX(MP_QSTR___aexit__)
+QINDEX(MP_QSTR_complex)
+QINDEX(MP_QSTR___contains__)
+QINDEX(MP_QSTR_lower)
+QINDEX(MP_QSTR___path__)
+QINDEX(MP_QSTR_real)
+QINDEX(MP_QSTR_sort)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___le__)
+QINDEX(MP_QSTR__lt_dictcomp_gt_)
+QINDEX(MP_QSTR_default)
+QINDEX(MP_QSTR_symmetric_difference)
+QINDEX(MP_QSTR___str__)
+QINDEX(MP_QSTR_repr)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR__lt_listcomp_gt_)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___bytes__)
+QINDEX(MP_QSTR_MemoryError)
+QINDEX(MP_QSTR_isupper)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_copy)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR__lt_stdin_gt_)
+QINDEX(MP_QSTR_ENOBUFS)
+QINDEX(MP_QSTR_items)
+QINDEX(MP_QSTR_lstrip)
+QINDEX(MP_QSTR_round)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_rindex)
+QINDEX(MP_QSTR_EPERM)
+QINDEX(MP_QSTR_isalpha)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_Exception)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_builtins)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___delitem__)
+QINDEX(MP_QSTR_tuple)
+QINDEX(MP_QSTR_LookupError)
+TRANSLATION("argument num/types mismatch", 28, { 0x27, 0xdf, 0x3c, 0x1a, 0xc8, 0x5c, 0xf1, 0xf6, 0x4f, 0x8c, 0x1c, 0x0e, 0x12, 0x38, 0x29, 0xaf, 0x40 }) // argument num/types mismatch
+TRANSLATION("start/end indices", 18, { 0x89, 0x27, 0x9f, 0xb0, 0xd6, 0xc1, 0x16, 0xc9, 0x53, 0x80 }) // start/end indices
+TRANSLATION("Permission denied", 18, { 0xfd, 0x4d, 0xf8, 0x48, 0x84, 0x65, 0x16, 0x35, 0x43, 0xb0 }) // Permission denied
+TRANSLATION("can't switch from automatic field numbering to manual field specification", 74, { 0xa9, 0x2e, 0x92, 0x23, 0xb2, 0x4d, 0x7a, 0x0d, 0x9d, 0xb8, 0x05, 0x99, 0x6e, 0x0a, 0x52, 0xa3, 0x64, 0x3b, 0xd8, 0x2e, 0x78, 0xd4, 0xdd, 0x17, 0x71, 0x2c, 0x38, 0x25, 0xc9, 0x5c, 0x6c, 0x87, 0x7b, 0x08, 0xc1, 0xd5, 0x36, 0x4a, 0x94, 0xa3, 0x28 }) // can\'t switch from automatic field numbering to manual field specification
+TRANSLATION("'%q' argument required", 23, { 0xd3, 0x97, 0xae, 0x80, 0x9f, 0x7c, 0xf0, 0x6b, 0x21, 0xcf, 0xd7, 0x28, 0xe7, 0x60 }) // \'%q\' argument required
+TRANSLATION("requested length %d but object has length %d", 45, { 0x73, 0xf5, 0xc9, 0xc4, 0x9d, 0x85, 0xcd, 0x77, 0x9e, 0x83, 0x95, 0x86, 0xb9, 0x90, 0xda, 0xf9, 0x9d, 0x64, 0x74, 0x28, 0x17, 0x35, 0xde, 0x7a, 0x0e, 0x56 }) // requested length %d but object has length %d
+TRANSLATION("incomplete format", 18, { 0x45, 0xab, 0x71, 0x8b, 0x9c, 0x98, 0xd9, 0x9f, 0x82, 0x90 }) // incomplete format
+TRANSLATION("extra positional arguments given", 33, { 0x3e, 0xf2, 0xe4, 0x30, 0xd0, 0x92, 0x8c, 0xa5, 0x70, 0x4f, 0xbe, 0x78, 0x35, 0x98, 0x1b, 0xa7, 0x53, 0x50 }) // extra positional arguments given
+TRANSLATION("bytes value out of range", 25, { 0xd7, 0xc4, 0x9c, 0x0e, 0xa5, 0x7c, 0x98, 0x6c, 0xc8, 0x6d, 0x83, 0x92, 0xee, 0x60 }) // bytes value out of range
+TRANSLATION("join expects a list of str/bytes objects consistent with self object", 69, { 0xf3, 0x64, 0x50, 0x7d, 0xf0, 0x75, 0x98, 0x04, 0x2e, 0x91, 0x21, 0xb6, 0x11, 0x2f, 0xf6, 0x6b, 0xe2, 0x4e, 0x03, 0x6b, 0xe6, 0x75, 0x98, 0x15, 0x65, 0x84, 0x89, 0x35, 0x91, 0xd9, 0x27, 0xa0, 0x83, 0xbe, 0xc1, 0xb5, 0xf3, 0x3a, 0xc8 }) // join expects a list of str/bytes objects consistent with self object
+TRANSLATION("tuple/list has wrong length", 28, { 0x9c, 0xe2, 0xe7, 0xf6, 0x5d, 0x22, 0x47, 0x42, 0x81, 0xd9, 0xd9, 0x77, 0x17, 0x35, 0xde, 0x7a, 0x00 }) // tuple/list has wrong length
+TRANSLATION("unsupported type for %q: '%s'", 30, { 0xca, 0xc6, 0x71, 0x86, 0x79, 0x3b, 0x09, 0xf1, 0x83, 0x1b, 0x33, 0x8e, 0x5e, 0xbf, 0x70, 0xd3, 0x94, 0x68 }) // unsupported type for %q: \'%s\'
+TRANSLATION("can't convert %s to float", 26, { 0xa9, 0x2e, 0x92, 0x2a, 0xcb, 0xd4, 0xde, 0x47, 0x28, 0x12, 0xc3, 0x6b, 0xb1, 0x48 }) // can\'t convert %s to float
+TRANSLATION("format requires a dict", 23, { 0xd9, 0x9f, 0x82, 0x90, 0xe7, 0xeb, 0x94, 0x73, 0x80, 0x42, 0xc9, 0x59 }) // format requires a dict
+TRANSLATION("identifier redefined as nonlocal", 33, { 0x4b, 0x1a, 0xca, 0x6c, 0x86, 0xe1, 0xce, 0xc7, 0xb2, 0x29, 0xd8, 0x14, 0x05, 0x65, 0xbb, 0x54, 0xae }) // identifier redefined as nonlocal
+TRANSLATION("__init__() should return None, not '%s'", 40, { 0xa5, 0x11, 0x52, 0x69, 0x4f, 0x67, 0xb4, 0x47, 0x46, 0xcd, 0xec, 0x1c, 0xe7, 0x2e, 0xa3, 0xc9, 0x94, 0xfe, 0xb0, 0xad, 0x23, 0x4e, 0x51, 0xa0 }) // __init__() should return None, not \'%s\'
+TRANSLATION("invalid syntax for number", 26, { 0x45, 0xea, 0x57, 0x4b, 0x08, 0xf0, 0xb2, 0x5d, 0xc6, 0xcc, 0xe1, 0x73, 0xc6, 0xa6, 0xe0 }) // invalid syntax for number
+TRANSLATION("odd-length string", 18, { 0x6b, 0x5b, 0xdd, 0x73, 0x5d, 0xe7, 0xa0, 0x89, 0x74, 0x5d, 0xc0 }) // odd-length string
+TRANSLATION("*x must be assignment target", 29, { 0xfa, 0xbb, 0x8e, 0x33, 0x12, 0x35, 0x30, 0x51, 0x09, 0xba, 0xf0, 0x6b, 0x22, 0x49, 0xf7, 0x39 }) // *x must be assignment target
+TRANSLATION("can't convert to str implicitly", 32, { 0xa9, 0x2e, 0x92, 0x2a, 0xcb, 0xd4, 0xde, 0x44, 0xb0, 0x89, 0x70, 0x9c, 0x62, 0xe9, 0x54, 0x9b, 0xf8 }) // can\'t convert to str implicitly
+TRANSLATION("%q() takes %d positional arguments but %d were given", 53, { 0xe5, 0xeb, 0xec, 0xf6, 0x89, 0x2f, 0x43, 0x81, 0xca, 0xc3, 0x0d, 0x09, 0x28, 0xca, 0x57, 0x04, 0xfb, 0xe7, 0x83, 0x59, 0x81, 0xae, 0x64, 0x72, 0xb0, 0xec, 0x6e, 0x63, 0x74, 0xea, 0x6a }) // %q() takes %d positional arguments but %d were given
+TRANSLATION("invalid syntax for integer", 27, { 0x45, 0xea, 0x57, 0x4b, 0x08, 0xf0, 0xb2, 0x5d, 0xc6, 0xcc, 0xe1, 0x16, 0x4f, 0x73, 0x70 }) // invalid syntax for integer
+TRANSLATION("'return' outside function", 26, { 0xd1, 0xce, 0x72, 0xeb, 0xa0, 0x6c, 0xcc, 0x25, 0x8c, 0x6d, 0x95, 0xac, 0xa3, 0x28 }) // \'return\' outside function
+TRANSLATION("invalid micropython decorator", 30, { 0x45, 0xea, 0x57, 0x4b, 0x0e, 0x12, 0xae, 0xd8, 0xf1, 0x3d, 0x19, 0x45, 0x8e, 0xac, 0xe5, 0x2c, 0xe0 }) // invalid micropython decorator
+TRANSLATION("substring not found", 20, { 0x8c, 0xeb, 0x12, 0xe8, 0xbb, 0x85, 0x69, 0x1b, 0x36, 0x56, 0xc0 }) // substring not found
+TRANSLATION("can't convert %s to complex", 28, { 0xa9, 0x2e, 0x92, 0x2a, 0xcb, 0xd4, 0xde, 0x47, 0x28, 0x12, 0xc2, 0xad, 0xc6, 0x2e, 0x7d, 0xc0 }) // can\'t convert %s to complex
+TRANSLATION("default 'except' must be last", 30, { 0xb1, 0xec, 0x59, 0xbc, 0x8d, 0x0f, 0xbd, 0x4f, 0x13, 0xa0, 0xe3, 0x31, 0x23, 0x53, 0x17, 0x28, 0x90 }) // default \'except\' must be last
+TRANSLATION("object does not support item assignment", 40, { 0x6d, 0x7c, 0xce, 0xb2, 0x2c, 0xc7, 0x01, 0x5a, 0x44, 0x67, 0x18, 0x67, 0x90, 0x92, 0x7c, 0x02, 0x88, 0x4d, 0xd7, 0x83, 0x59 }) // object does not support item assignment
+TRANSLATION("object not iterable", 20, { 0x6d, 0x7c, 0xce, 0xb2, 0x15, 0xa4, 0x24, 0x9b, 0x96, 0xb7, 0x30 }) // object not iterable
+TRANSLATION("not all arguments converted during string formatting", 53, { 0x56, 0x90, 0x57, 0xb8, 0x27, 0xdf, 0x3c, 0x1a, 0xcc, 0x0a, 0xb2, 0xf5, 0x37, 0x93, 0xb0, 0xb6, 0x5d, 0x17, 0x71, 0x12, 0xe8, 0xbb, 0x8d, 0x99, 0xf8, 0x29, 0x94, 0x5d, 0xc0 }) // not all arguments converted during string formatting
+TRANSLATION("rsplit(None,n)", 15, { 0x78, 0xc5, 0xd2, 0x7d, 0x9e, 0x4c, 0xa7, 0xf5, 0xaf, 0xb4 }) // rsplit(None,n)
+TRANSLATION("can't have multiple *x", 23, { 0xa9, 0x2e, 0x92, 0x3a, 0x17, 0x53, 0x1c, 0x66, 0xf2, 0x98, 0xb9, 0x8f, 0xab, 0xb8 }) // can\'t have multiple *x
+TRANSLATION("LHS of keyword arg must be an id", 33, { 0xff, 0x5f, 0xe7, 0xe6, 0x1b, 0x61, 0xe8, 0x7e, 0x3b, 0x33, 0xd8, 0x13, 0xee, 0x38, 0xcc, 0x48, 0xd4, 0xc1, 0x28, 0x4b, 0x00 }) // LHS of keyword arg must be an id
+TRANSLATION("super() can't find self", 24, { 0x8c, 0xe0, 0xdf, 0xd9, 0xed, 0x15, 0x25, 0xd2, 0x46, 0xc8, 0xb6, 0x10, 0x77, 0xd8 }) // super() can\'t find self
+TRANSLATION("keyword argument(s) not yet implemented - use normal args instead", 66, { 0xf4, 0x3f, 0x1d, 0x99, 0xec, 0x09, 0xf7, 0xcf, 0x06, 0xb3, 0xec, 0x8f, 0x68, 0x56, 0x91, 0xe0, 0xe4, 0x27, 0x18, 0xb9, 0xf0, 0x6b, 0x27, 0x61, 0xee, 0x19, 0x83, 0x0a, 0xcf, 0xc1, 0x5c, 0x13, 0xef, 0x01, 0x16, 0x24, 0xca, 0xc0 }) // keyword argument(s) not yet implemented - use normal args instead
+TRANSLATION("index out of range", 19, { 0x45, 0xb1, 0xf7, 0x0d, 0x99, 0x0d, 0xb0, 0x72, 0x5d, 0xcc }) // index out of range
+TRANSLATION("name not defined", 17, { 0x52, 0xe0, 0xc2, 0xb4, 0x8b, 0x1e, 0xc8, 0xa7, 0x60 }) // name not defined
+TRANSLATION("sign not allowed with integer format specifier 'c'", 51, { 0x84, 0xdd, 0x42, 0xb4, 0x82, 0xbd, 0xdb, 0xb1, 0xd8, 0x76, 0x49, 0xe8, 0x11, 0x64, 0xf7, 0x37, 0x1b, 0x33, 0xf0, 0x52, 0x23, 0x07, 0x54, 0xd9, 0x0d, 0xc6, 0x95, 0xd0 }) // sign not allowed with integer format specifier \'c\'
+TRANSLATION("only slices with step=1 (aka None) are supported", 49, { 0x65, 0xbf, 0x81, 0x17, 0x4a, 0x9c, 0x0e, 0xc9, 0x3d, 0x04, 0x49, 0xe3, 0xfb, 0x7f, 0x31, 0xec, 0x2f, 0x42, 0x1e, 0x4c, 0xa7, 0xed, 0x04, 0xe6, 0x23, 0x38, 0xc3, 0x3c, 0x9d, 0x80 }) // only slices with step=1 (aka None) are supported
+TRANSLATION("multiple bases have instance lay-out conflict", 46, { 0xe3, 0x37, 0x94, 0xc5, 0xcc, 0x6a, 0x50, 0x70, 0x3a, 0x17, 0x53, 0x08, 0xb1, 0x24, 0xb5, 0x31, 0x72, 0xf1, 0xee, 0x6c, 0xc8, 0xab, 0x2e, 0xd7, 0x4a, 0xc8 }) // multiple bases have instance lay-out conflict
+TRANSLATION("unreadable attribute", 21, { 0xca, 0xb9, 0x95, 0x8b, 0x5b, 0x98, 0x29, 0x97, 0x4d, 0x73, 0x26 }) // unreadable attribute
+TRANSLATION("expected tuple/list", 20, { 0x3e, 0xf8, 0x3a, 0xc9, 0xd8, 0x4e, 0x71, 0x73, 0xfb, 0x2e, 0x91, 0x20 }) // expected tuple/list
+TRANSLATION("local variable referenced before assignment", 44, { 0xbb, 0x54, 0xae, 0x3a, 0x93, 0xa1, 0x6b, 0x73, 0x0e, 0x7b, 0x1b, 0x9a, 0xd4, 0xec, 0x35, 0x3d, 0x99, 0xcc, 0x14, 0x42, 0x6e, 0xbc, 0x1a, 0xc8 }) // local variable referenced before assignment
+TRANSLATION("object does not support item deletion", 38, { 0x6d, 0x7c, 0xce, 0xb2, 0x2c, 0xc7, 0x01, 0x5a, 0x44, 0x67, 0x18, 0x67, 0x90, 0x92, 0x7c, 0x0b, 0x1d, 0xce, 0x51, 0x94 }) // object does not support item deletion
+TRANSLATION("bad conversion specifier", 25, { 0xd4, 0xac, 0x2a, 0xcb, 0xd4, 0xde, 0x11, 0x94, 0x46, 0x0e, 0xa9, 0xb2, 0x1b, 0x80 }) // bad conversion specifier
+TRANSLATION("unsupported types for %q: '%s', '%s'", 37, { 0xca, 0xc6, 0x71, 0x86, 0x79, 0x3b, 0x09, 0xf1, 0x83, 0x81, 0xb3, 0x38, 0xe5, 0xeb, 0xf7, 0x0d, 0x39, 0x46, 0x9f, 0x58, 0xd3, 0x94, 0x68 }) // unsupported types for %q: \'%s\', \'%s\'
+TRANSLATION("'await' outside function", 25, { 0xd0, 0xbb, 0x12, 0x4e, 0x81, 0xb3, 0x30, 0x96, 0x31, 0xb6, 0x56, 0xb2, 0x8c, 0xa0 }) // \'await\' outside function
+TRANSLATION("object of type '%s' has no len()", 33, { 0x6d, 0x7c, 0xce, 0xb2, 0x1b, 0x61, 0x3e, 0x30, 0x63, 0x4e, 0x51, 0xa0, 0xe8, 0x50, 0x15, 0x85, 0xcd, 0x7d, 0x9e, 0xd0 }) // object of type \'%s\' has no len()
+TRANSLATION("Corrupt raw code", 17, { 0xfc, 0x59, 0xdf, 0x38, 0x90, 0xe5, 0xd8, 0x55, 0xac, 0x60 }) // Corrupt raw code
+TRANSLATION("%%c requires int or char", 25, { 0xe5, 0xca, 0xa1, 0xcf, 0xd7, 0x28, 0xe7, 0x01, 0x16, 0x43, 0x38, 0xaf, 0x42, 0x70 }) // %%c requires int or char
+TRANSLATION("function missing %d required positional arguments", 50, { 0xdb, 0x2b, 0x59, 0x46, 0x51, 0xc2, 0x44, 0x22, 0xee, 0x39, 0x58, 0x39, 0xfa, 0xe5, 0x1c, 0xec, 0x30, 0xd0, 0x92, 0x8c, 0xa5, 0x70, 0x4f, 0xbe, 0x78, 0x35, 0x98 }) // function missing %d required positional arguments
+TRANSLATION("no active exception to reraise", 31, { 0x56, 0x05, 0x59, 0x4e, 0xa6, 0x0f, 0xbd, 0x4f, 0x12, 0x8c, 0xa2, 0x58, 0x39, 0xb9, 0x24, 0x18 }) // no active exception to reraise
+TRANSLATION("object not an iterator", 23, { 0x6d, 0x7c, 0xce, 0xb2, 0x15, 0xa4, 0x12, 0x84, 0x93, 0x72, 0x96, 0x70 }) // object not an iterator
+TRANSLATION("arg is an empty sequence", 25, { 0x27, 0xdc, 0x24, 0x02, 0x50, 0x7c, 0x62, 0x7c, 0x08, 0x3f, 0x5c, 0x9a, 0xd4, 0xc0 }) // arg is an empty sequence
+TRANSLATION("invalid syntax", 15, { 0x45, 0xea, 0x57, 0x4b, 0x08, 0xf0, 0xb2, 0x5d, 0xc0 }) // invalid syntax
+TRANSLATION("popitem(): dictionary is empty", 31, { 0xc3, 0x61, 0x24, 0xf8, 0xf6, 0x7b, 0x7e, 0xe1, 0x64, 0xac, 0xa3, 0x29, 0x3f, 0x80, 0x90, 0x0f, 0x8c, 0x4f, 0x80 }) // popitem(): dictionary is empty
+TRANSLATION("function expected at most %d arguments, got %d", 47, { 0xdb, 0x2b, 0x59, 0x46, 0x50, 0x7d, 0xf0, 0x75, 0x93, 0xb0, 0x29, 0x1c, 0x34, 0x48, 0xe5, 0x60, 0x4f, 0xbe, 0x78, 0x35, 0x98, 0xfa, 0xc6, 0xed, 0x23, 0x95, 0x80 }) // function expected at most %d arguments, got %d
+TRANSLATION("multiple *x in assignment", 26, { 0xe3, 0x37, 0x94, 0xc5, 0xcc, 0x7d, 0x5d, 0xc2, 0x28, 0x28, 0x84, 0xdd, 0x78, 0x35, 0x90 }) // multiple *x in assignment
+TRANSLATION("a bytes-like object is required", 32, { 0x21, 0xaf, 0x89, 0x38, 0xf7, 0x5d, 0x3d, 0x0c, 0x36, 0xbe, 0x67, 0x59, 0x09, 0x01, 0xcf, 0xd7, 0x28, 0xe7, 0x60 }) // a bytes-like object is required
+TRANSLATION("type object '%q' has no attribute '%q'", 39, { 0x9f, 0x18, 0x30, 0xda, 0xf9, 0x9d, 0x64, 0x69, 0xcb, 0xd7, 0x41, 0xd0, 0xa0, 0x2b, 0x02, 0x99, 0x74, 0xd7, 0x32, 0x63, 0x4e, 0x5e, 0xba, 0x00 }) // type object \'%q\' has no attribute \'%q\'
+TRANSLATION("expecting key:value for dict", 29, { 0x3e, 0xf8, 0x3a, 0xca, 0x2e, 0xe3, 0xd0, 0xfc, 0x7d, 0xdd, 0x4a, 0xf9, 0x31, 0xb3, 0x38, 0xb2, 0x56, 0x40 }) // expecting key:value for dict
+TRANSLATION("function does not take keyword arguments", 41, { 0xdb, 0x2b, 0x59, 0x46, 0x51, 0x66, 0x38, 0x0a, 0xd2, 0x24, 0xbd, 0x0c, 0x7a, 0x1f, 0x8e, 0xcc, 0xf6, 0x04, 0xfb, 0xe7, 0x83, 0x59, 0x80 }) // function does not take keyword arguments
+TRANSLATION("non-default argument follows default argument", 46, { 0x56, 0x5f, 0x75, 0x8f, 0x62, 0xcd, 0xe4, 0x13, 0xef, 0x9e, 0x0d, 0x64, 0x6c, 0xd7, 0xbb, 0x76, 0x81, 0x63, 0xd8, 0xb3, 0x79, 0x04, 0xfb, 0xe7, 0x83, 0x59 }) // non-default argument follows default argument
+TRANSLATION("cannot perform relative import", 31, { 0xa9, 0x2a, 0xb4, 0x8c, 0x1b, 0xec, 0xcf, 0xc0, 0x73, 0xb9, 0x4a, 0x75, 0x30, 0x9c, 0x61, 0x9e, 0x40 }) // cannot perform relative import
+TRANSLATION("can't convert inf to int", 25, { 0xa9, 0x2e, 0x92, 0x2a, 0xcb, 0xd4, 0xde, 0x42, 0x2e, 0xc2, 0x58, 0x22, 0xc8 }) // can\'t convert inf to int
+TRANSLATION("bad typecode", 13, { 0xd4, 0xac, 0x27, 0xc6, 0x0e, 0xad, 0x63 }) // bad typecode
+TRANSLATION("can't pend throw to just-started generator", 43, { 0xa9, 0x2e, 0x92, 0x30, 0x6b, 0x61, 0x3d, 0x1d, 0xbb, 0x09, 0x61, 0xe7, 0x98, 0x9f, 0x74, 0x49, 0x3c, 0x9d, 0x86, 0xe6, 0xa6, 0xe5, 0x2c, 0xe0 }) // can\'t pend throw to just-started generator
+TRANSLATION("maximum recursion depth exceeded", 33, { 0xe0, 0xbb, 0xa7, 0x19, 0xe0, 0x39, 0xd7, 0x2f, 0x08, 0xca, 0x2c, 0x78, 0x9e, 0x80, 0xfb, 0xd4, 0xce, 0xc7, 0x60 }) // maximum recursion depth exceeded
+TRANSLATION("generator already executing", 28, { 0xdc, 0xd4, 0xdc, 0xa5, 0x9c, 0x15, 0xdc, 0xca, 0xde, 0x01, 0xf7, 0x3a, 0xe6, 0x51, 0x77 }) // generator already executing
+TRANSLATION("type '%q' is not an acceptable base type", 41, { 0x9f, 0x18, 0x31, 0xa7, 0x2f, 0x5d, 0x02, 0x40, 0x56, 0x90, 0x4a, 0x0a, 0xb5, 0x3c, 0x49, 0x6b, 0x73, 0x1a, 0x94, 0x18, 0x9f, 0x18, 0x30 }) // type \'%q\' is not an acceptable base type
+TRANSLATION("  File \"%q\", line %d", 21, { 0x03, 0xf3, 0x4b, 0x98, 0xff, 0x9e, 0x5e, 0xbf, 0xf3, 0xf5, 0x8b, 0xa2, 0x98, 0xe5, 0x60 }) //   File \"%q\", line %d
+TRANSLATION("can't convert %s to int", 24, { 0xa9, 0x2e, 0x92, 0x2a, 0xcb, 0xd4, 0xde, 0x47, 0x28, 0x12, 0xc1, 0x16, 0x40 }) // can\'t convert %s to int
+TRANSLATION("can't declare nonlocal in outer code", 37, { 0xa9, 0x2e, 0x92, 0x2c, 0x75, 0xb9, 0x39, 0x85, 0x65, 0xbb, 0x54, 0xae, 0x11, 0x43, 0x66, 0x4d, 0xc5, 0x5a, 0xc6 }) // can\'t declare nonlocal in outer code
+TRANSLATION("length argument not allowed for this type", 42, { 0xb9, 0xae, 0xf3, 0xd0, 0x13, 0xef, 0x9e, 0x0d, 0x64, 0x2b, 0x48, 0x2b, 0xdd, 0xbb, 0x1d, 0x86, 0xcc, 0xe2, 0x7a, 0x24, 0x09, 0xf1, 0x83 }) // length argument not allowed for this type
+TRANSLATION("value must fit in %d byte(s)", 29, { 0xea, 0x57, 0xc9, 0x8e, 0x33, 0x12, 0x36, 0x49, 0x08, 0xa3, 0x95, 0x86, 0xbe, 0x24, 0xfd, 0x91, 0xed }) // value must fit in %d byte(s)
+TRANSLATION("Unsupported operation", 22, { 0xfd, 0x96, 0x33, 0x8c, 0x33, 0xc9, 0xd8, 0x36, 0x0d, 0xca, 0x51, 0x94 }) // Unsupported operation
+TRANSLATION("chr() arg not in range(0x110000)", 33, { 0xaf, 0x47, 0xf6, 0x7b, 0x41, 0x3e, 0xe1, 0x5a, 0x42, 0x28, 0x72, 0x5d, 0xcf, 0xd9, 0xf6, 0xf7, 0xfe, 0x7f, 0xcf, 0xed, 0xfb, 0x7e, 0xdf, 0xb7, 0xda }) // chr() arg not in range(0x110000)
+TRANSLATION("no such attribute", 18, { 0x56, 0x11, 0x9a, 0xf4, 0x05, 0x32, 0xe9, 0xae, 0x64, 0xc0 }) // no such attribute
+TRANSLATION("offset out of bounds", 21, { 0x6d, 0xb6, 0x83, 0x90, 0xd9, 0x90, 0xdb, 0x0d, 0x5b, 0x2b, 0x68 }) // offset out of bounds
+TRANSLATION("Call super().__init__() before accessing native object.", 56, { 0xfc, 0x4a, 0xf7, 0x11, 0x9c, 0x1b, 0xfb, 0x3d, 0xbf, 0xca, 0x94, 0x45, 0x49, 0xa5, 0x3d, 0x9e, 0xd1, 0xa9, 0xec, 0xce, 0x60, 0xab, 0x53, 0x88, 0x45, 0xdc, 0x29, 0x4a, 0x75, 0x30, 0xda, 0xf9, 0x9d, 0x67, 0xf9, 0x00 }) // Call super().__init__() before accessing native object.
+TRANSLATION("end of format while looking for conversion specifier", 53, { 0x35, 0xb0, 0x6d, 0x86, 0xcc, 0xfc, 0x14, 0x8e, 0xdd, 0x12, 0xe6, 0x2e, 0xcd, 0xe8, 0x8b, 0xb8, 0xd9, 0x9c, 0x55, 0x97, 0xa9, 0xbc, 0x23, 0x28, 0x8c, 0x1d, 0x53, 0x64, 0x37 }) // end of format while looking for conversion specifier
+TRANSLATION("object with buffer protocol required", 37, { 0x6d, 0x7c, 0xce, 0xb2, 0x3b, 0x24, 0xf4, 0x1a, 0xe7, 0x6d, 0x8d, 0xc6, 0x1d, 0xa5, 0xaa, 0xd7, 0x0e, 0x7e, 0xb9, 0x47, 0x3b, 0x00 }) // object with buffer protocol required
+TRANSLATION("overflow converting long int to machine word", 45, { 0x6e, 0xa6, 0xfb, 0x5d, 0xbb, 0x0a, 0xb2, 0xf5, 0x37, 0x94, 0x5d, 0xc5, 0xd9, 0x77, 0x08, 0xb2, 0x25, 0x87, 0x05, 0x5e, 0x88, 0xa6, 0x3b, 0x33, 0xd8 }) // overflow converting long int to machine word
+TRANSLATION("non-keyword arg after */**", 27, { 0x56, 0x5f, 0x77, 0xa1, 0xf8, 0xec, 0xcf, 0x60, 0x4f, 0xb8, 0x2d, 0xa4, 0xdc, 0x7d, 0x5f, 0x67, 0xd5, 0xf5, 0x00 }) // non-keyword arg after */**
+TRANSLATION("ord expects a character", 24, { 0x67, 0xb0, 0x3e, 0xf8, 0x3a, 0xcc, 0x02, 0x15, 0xe8, 0x4e, 0x55, 0x93, 0x70 }) // ord expects a character
+TRANSLATION("name '%q' is not defined", 25, { 0x52, 0xe0, 0xc6, 0x9c, 0xbd, 0x74, 0x09, 0x01, 0x5a, 0x45, 0x8f, 0x64, 0x53, 0xb0 }) // name \'%q\' is not defined
+TRANSLATION("small int overflow", 19, { 0x8e, 0x0a, 0xf7, 0x08, 0xb2, 0x1b, 0xa9, 0xbe, 0xd7, 0x6e, 0xc0 }) // small int overflow
+TRANSLATION("object has no len", 18, { 0x6d, 0x7c, 0xce, 0xb2, 0x3a, 0x14, 0x05, 0x61, 0x73, 0x50 }) // object has no len
+TRANSLATION("non-keyword arg after keyword arg", 34, { 0x56, 0x5f, 0x77, 0xa1, 0xf8, 0xec, 0xcf, 0x60, 0x4f, 0xb8, 0x2d, 0xa4, 0xdc, 0x7a, 0x1f, 0x8e, 0xcc, 0xf6, 0x04, 0xfb, 0x80 }) // non-keyword arg after keyword arg
+TRANSLATION("single '}' encountered in format string", 40, { 0x84, 0x5d, 0xee, 0x63, 0x4f, 0xfc, 0xd0, 0x1a, 0xd5, 0xb2, 0xb2, 0x6e, 0x76, 0x08, 0xa3, 0x66, 0x7e, 0x0a, 0x44, 0x4b, 0xa2, 0xee }) // single \'}\' encountered in format string
+TRANSLATION("'%s' object does not support item assignment", 45, { 0xd3, 0x94, 0x68, 0x1b, 0x5f, 0x33, 0xac, 0x8b, 0x31, 0xc0, 0x56, 0x91, 0x19, 0xc6, 0x19, 0xe4, 0x24, 0x9f, 0x00, 0xa2, 0x13, 0x75, 0xe0, 0xd6, 0x40 }) // \'%s\' object does not support item assignment
+TRANSLATION("'%s' object is not iterable", 28, { 0xd3, 0x94, 0x68, 0x1b, 0x5f, 0x33, 0xac, 0x84, 0x80, 0xad, 0x21, 0x24, 0xdc, 0xb5, 0xb9, 0x80 }) // \'%s\' object is not iterable
+TRANSLATION("%q indices must be integers, not %s", 36, { 0xe5, 0xea, 0x11, 0x6c, 0x95, 0x38, 0x1c, 0x66, 0x24, 0x6a, 0x61, 0x16, 0x4f, 0x73, 0x78, 0xfa, 0xc2, 0xb4, 0x8e, 0x50 }) // %q indices must be integers, not %s
+TRANSLATION("unsupported format character '%c' (0x%x) at index %d", 53, { 0xca, 0xc6, 0x71, 0x86, 0x79, 0x3b, 0x0d, 0x99, 0xf8, 0x29, 0x15, 0xe8, 0x4e, 0x55, 0x93, 0x71, 0xa7, 0x2a, 0xe8, 0x3d, 0x9f, 0x6f, 0x7e, 0x5d, 0xfd, 0xa0, 0xa4, 0x22, 0xd8, 0xfb, 0x8e, 0x56 }) // unsupported format character \'%c\' (0x%x) at index %d
+TRANSLATION("non-hex digit found", 20, { 0x56, 0x5f, 0x77, 0x43, 0xee, 0x2c, 0x9b, 0xa4, 0x8d, 0x9b, 0x2b, 0x60 }) // non-hex digit found
+TRANSLATION("first argument to super() must be type", 39, { 0xd9, 0x1e, 0x24, 0x13, 0xef, 0x9e, 0x0d, 0x64, 0x4b, 0x08, 0xce, 0x0d, 0xfd, 0x9e, 0xd1, 0xc6, 0x62, 0x46, 0xa6, 0x27, 0xc6, 0x0c }) // first argument to super() must be type
+TRANSLATION("need more than %d values to unpack", 35, { 0x53, 0x3b, 0x0e, 0x19, 0xcc, 0x4f, 0x42, 0x51, 0xca, 0xc3, 0xa9, 0x5f, 0x27, 0x02, 0x58, 0x65, 0x70, 0x55, 0xf4 }) // need more than %d values to unpack
+TRANSLATION("not enough arguments for format string", 39, { 0x56, 0x90, 0x6a, 0xd9, 0xdf, 0xa0, 0x27, 0xdf, 0x3c, 0x1a, 0xcc, 0x0d, 0x99, 0xc6, 0xcc, 0xfc, 0x14, 0x88, 0x97, 0x45, 0xdc }) // not enough arguments for format string
+TRANSLATION("expecting just a value for set", 31, { 0x3e, 0xf8, 0x3a, 0xca, 0x2e, 0xe3, 0xcf, 0x31, 0x20, 0x87, 0x52, 0xbe, 0x4c, 0x6c, 0xce, 0x20, 0xe4 }) // expecting just a value for set
+TRANSLATION("zero step", 10, { 0xfd, 0xcd, 0xd8, 0x44, 0x9e, 0x00 }) // zero step
+TRANSLATION("unindent does not match any outer indentation level", 52, { 0xca, 0xa2, 0xd8, 0xd6, 0x45, 0x98, 0xe0, 0x2b, 0x48, 0xe0, 0xa6, 0xbd, 0x01, 0x2f, 0x80, 0xd9, 0x93, 0x70, 0x8b, 0x63, 0x59, 0x29, 0x46, 0x51, 0x73, 0xea, 0x77 }) // unindent does not match any outer indentation level
+TRANSLATION("pop from empty list", 20, { 0xc3, 0x60, 0x6c, 0xed, 0xc0, 0x3e, 0x31, 0x3e, 0x05, 0xd2, 0x24 }) // pop from empty list
+TRANSLATION(", in %q\n", 10, { 0xfa, 0xc2, 0x28, 0xe5, 0xeb, 0xff, 0x1f, 0xc0 }) // , in %q\r\n
+TRANSLATION("exceptions must derive from BaseException", 42, { 0x3e, 0xf5, 0x3c, 0x4a, 0x32, 0xc0, 0xe3, 0x31, 0x22, 0xc6, 0xe9, 0xd4, 0xc6, 0xce, 0xdc, 0x0f, 0xee, 0x50, 0x7c, 0xfb, 0xd4, 0xf1, 0x28, 0xca }) // exceptions must derive from BaseException
+TRANSLATION("'%s' object does not support '%q'", 34, { 0xd3, 0x94, 0x68, 0x1b, 0x5f, 0x33, 0xac, 0x8b, 0x31, 0xc0, 0x56, 0x91, 0x19, 0xc6, 0x19, 0xe4, 0x69, 0xcb, 0xd7, 0x40 }) // \'%s\' object does not support \'%q\'
+TRANSLATION("dict update sequence has wrong length", 38, { 0xb2, 0x56, 0x46, 0x71, 0x62, 0x93, 0x10, 0x7e, 0xb9, 0x35, 0xa9, 0x8e, 0x85, 0x03, 0xb3, 0xb2, 0xee, 0x2e, 0x6b, 0xbc, 0xf4 }) // dict update sequence has wrong length
+TRANSLATION("unknown format code '%c' for object of type 'str'", 50, { 0xca, 0xfa, 0x2b, 0x76, 0x51, 0xb3, 0x3f, 0x05, 0x22, 0xad, 0x63, 0x1a, 0x72, 0xae, 0x83, 0x66, 0x70, 0xda, 0xf9, 0x9d, 0x64, 0x36, 0xc2, 0x7c, 0x60, 0xc6, 0x91, 0x2f, 0xa0 }) // unknown format code \'%c\' for object of type \'str\'
+TRANSLATION("'yield' outside function", 25, { 0xd3, 0xc2, 0x1d, 0xed, 0xa0, 0x6c, 0xcc, 0x25, 0x8c, 0x6d, 0x95, 0xac, 0xa3, 0x28 }) // \'yield\' outside function
+TRANSLATION("No such file/directory", 23, { 0xf2, 0x61, 0x19, 0xaf, 0x41, 0xb2, 0x5c, 0xfe, 0xcb, 0x23, 0x9d, 0x65, 0x9f, 0xc0 }) // No such file/directory
+TRANSLATION("memory allocation failed, allocating %u bytes", 46, { 0xe0, 0xf8, 0x67, 0xf0, 0x0a, 0xf7, 0x6a, 0x94, 0xa3, 0x28, 0xd8, 0x92, 0xe7, 0x6f, 0xac, 0x15, 0xee, 0xd5, 0x29, 0x45, 0xdc, 0x72, 0xc8, 0xd7, 0xc4, 0x9c, 0x00 }) // memory allocation failed, allocating %u bytes
+TRANSLATION("wrong number of values to unpack", 33, { 0xec, 0xec, 0xbb, 0x85, 0xcf, 0x1a, 0x9b, 0x86, 0xd8, 0x75, 0x2b, 0xe4, 0xe0, 0x4b, 0x0c, 0xae, 0x0a, 0xbe, 0x80 }) // wrong number of values to unpack
+TRANSLATION("Traceback (most recent call last):\n", 37, { 0xfa, 0x39, 0x54, 0xf5, 0x2a, 0xfa, 0x0f, 0x67, 0x0d, 0x12, 0x1c, 0xea, 0x6b, 0x22, 0xa5, 0x7b, 0x8b, 0x94, 0x4f, 0xb7, 0xee, 0xff, 0x8f, 0xe0 }) // Traceback (most recent call last):\r\n
+TRANSLATION("can't switch from manual field specification to automatic field numbering", 74, { 0xa9, 0x2e, 0x92, 0x23, 0xb2, 0x4d, 0x7a, 0x0d, 0x9d, 0xb8, 0x1c, 0x12, 0xe4, 0xae, 0x36, 0x43, 0xbd, 0x84, 0x60, 0xea, 0x9b, 0x25, 0x4a, 0x51, 0x94, 0x4b, 0x02, 0xcc, 0xb7, 0x05, 0x29, 0x51, 0xb2, 0x1d, 0xec, 0x17, 0x3c, 0x6a, 0x6e, 0x8b, 0xb8 }) // can\'t switch from manual field specification to automatic field numbering
+TRANSLATION("complex division by zero", 25, { 0xab, 0x71, 0x8b, 0x9f, 0x71, 0x64, 0xea, 0x90, 0x8c, 0xa3, 0x5f, 0x03, 0xf7, 0x37, 0x60 }) // complex division by zero
+TRANSLATION("can only save bytecode", 23, { 0xa9, 0x28, 0x65, 0xbf, 0x81, 0x05, 0xd4, 0xc6, 0xbe, 0x24, 0xea, 0xd6, 0x30 }) // can only save bytecode
+TRANSLATION("int() arg 2 must be >= 2 and <= 36", 35, { 0x45, 0x9f, 0x67, 0xb4, 0x13, 0xee, 0x3f, 0xa0, 0xe3, 0x31, 0x23, 0x53, 0x1f, 0x87, 0xf6, 0x1f, 0xd0, 0x12, 0xd8, 0x7d, 0xff, 0xd8, 0x7f, 0x5f, 0xfd, 0x00 }) // int() arg 2 must be >= 2 and <= 36
+TRANSLATION("can't convert to complex", 25, { 0xa9, 0x2e, 0x92, 0x2a, 0xcb, 0xd4, 0xde, 0x44, 0xb0, 0xab, 0x71, 0x8b, 0x9f, 0x70 }) // can\'t convert to complex
+TRANSLATION("invalid syntax for integer with base %d", 40, { 0x45, 0xea, 0x57, 0x4b, 0x08, 0xf0, 0xb2, 0x5d, 0xc6, 0xcc, 0xe1, 0x16, 0x4f, 0x73, 0x71, 0xd9, 0x27, 0xa0, 0xd4, 0xa0, 0xc7, 0x2b, 0x00 }) // invalid syntax for integer with base %d
+TRANSLATION("unexpected keyword argument '%q'", 33, { 0xca, 0x9f, 0x7c, 0x1d, 0x64, 0xec, 0x3d, 0x0f, 0xc7, 0x66, 0x7b, 0x02, 0x7d, 0xf3, 0xc1, 0xac, 0x8d, 0x39, 0x7a, 0xe8 }) // unexpected keyword argument \'%q\'
+TRANSLATION("string not supported; use bytes or bytearray", 45, { 0x89, 0x74, 0x5d, 0xc2, 0xb4, 0x88, 0xce, 0x30, 0xcf, 0x27, 0x6f, 0xfe, 0x0c, 0xc1, 0x8d, 0x7c, 0x49, 0xc0, 0x67, 0x1a, 0xf8, 0x93, 0x27, 0x72, 0xf0 }) // string not supported; use bytes or bytearray
+TRANSLATION("keywords must be strings", 25, { 0xf4, 0x3f, 0x1d, 0x99, 0xed, 0x03, 0x8c, 0xc4, 0x8d, 0x4c, 0x44, 0xba, 0x2e, 0xf0 }) // keywords must be strings
+TRANSLATION("wrong number of arguments", 26, { 0xec, 0xec, 0xbb, 0x85, 0xcf, 0x1a, 0x9b, 0x86, 0xd8, 0x13, 0xef, 0x9e, 0x0d, 0x66, 0x00 }) // wrong number of arguments
+TRANSLATION("function takes %d positional arguments but %d were given", 57, { 0xdb, 0x2b, 0x59, 0x46, 0x51, 0x25, 0xe8, 0x70, 0x39, 0x58, 0x61, 0xa1, 0x25, 0x19, 0x4a, 0xe0, 0x9f, 0x7c, 0xf0, 0x6b, 0x30, 0x35, 0xcc, 0x8e, 0x56, 0x1d, 0x8d, 0xcc, 0x6e, 0x9d, 0x4d, 0x40 }) // function takes %d positional arguments but %d were given
+TRANSLATION("can't convert to float", 23, { 0xa9, 0x2e, 0x92, 0x2a, 0xcb, 0xd4, 0xde, 0x44, 0xb0, 0xda, 0xec, 0x52 }) // can\'t convert to float
+TRANSLATION("3-arg pow() not supported", 26, { 0xfe, 0xbe, 0xe2, 0x7d, 0xc6, 0x1b, 0xb7, 0xb3, 0xda, 0x15, 0xa4, 0x46, 0x71, 0x86, 0x79, 0x3b, 0x00 }) // 3-arg pow() not supported
+TRANSLATION("tuple index out of range", 25, { 0x9c, 0xe2, 0xe6, 0x11, 0x6c, 0x7d, 0xc3, 0x66, 0x43, 0x6c, 0x1c, 0x97, 0x73 }) // tuple index out of range
+TRANSLATION("object not in sequence", 23, { 0x6d, 0x7c, 0xce, 0xb2, 0x15, 0xa4, 0x22, 0x88, 0x3f, 0x5c, 0x9a, 0xd4, 0xc0 }) // object not in sequence
+TRANSLATION("no binding for nonlocal found", 30, { 0x56, 0x1a, 0xa2, 0xd9, 0x17, 0x71, 0xb3, 0x38, 0x56, 0x5b, 0xb5, 0x4a, 0xe3, 0x66, 0xca, 0xd8 }) // no binding for nonlocal found
+TRANSLATION("Unable to init parser", 22, { 0xfd, 0x94, 0xb5, 0xb9, 0x89, 0x60, 0x8a, 0x92, 0x30, 0x4f, 0x06, 0xe0 }) // Unable to init parser
+TRANSLATION("'=' alignment not allowed in string format specifier", 53, { 0xd3, 0xfb, 0x68, 0x0a, 0xe9, 0xba, 0xf0, 0x6b, 0x21, 0x5a, 0x41, 0x5e, 0xed, 0xd8, 0xec, 0x11, 0x44, 0x4b, 0xa2, 0xee, 0x36, 0x67, 0xe0, 0xa4, 0x46, 0x0e, 0xa9, 0xb2, 0x1b, 0x80 }) // \'=\' alignment not allowed in string format specifier
+TRANSLATION("can't do truncated division of a complex number", 48, { 0xa9, 0x2e, 0x92, 0x2c, 0xc2, 0x5f, 0x2b, 0x52, 0x93, 0xb0, 0xb2, 0x75, 0x48, 0x46, 0x50, 0xdb, 0x02, 0x15, 0x6e, 0x31, 0x73, 0xee, 0x17, 0x3c, 0x6a, 0x6e }) // can\'t do truncated division of a complex number
+TRANSLATION("generator ignored GeneratorExit", 32, { 0xdc, 0xd4, 0xdc, 0xa5, 0x9c, 0x26, 0xea, 0xce, 0x76, 0x1f, 0xe0, 0xd4, 0xdc, 0xa5, 0x9f, 0x9f, 0x74, 0x90 }) // generator ignored GeneratorExit
+TRANSLATION("integer required", 17, { 0x45, 0x93, 0xdc, 0xdc, 0x39, 0xfa, 0xe5, 0x1c, 0xec }) // integer required
+TRANSLATION("byte code not implemented", 26, { 0xd7, 0xc4, 0x98, 0xab, 0x58, 0xc2, 0xb4, 0x84, 0xe3, 0x17, 0x3e, 0x0d, 0x64, 0xec }) // byte code not implemented
+TRANSLATION("memory allocation failed, heap is locked", 41, { 0xe0, 0xf8, 0x67, 0xf0, 0x0a, 0xf7, 0x6a, 0x94, 0xa3, 0x28, 0xd8, 0x92, 0xe7, 0x6f, 0xac, 0x74, 0x32, 0xc0, 0x48, 0x17, 0x6a, 0xfa, 0x1d, 0x80 }) // memory allocation failed, heap is locked
+TRANSLATION("object is not subscriptable", 28, { 0x6d, 0x7c, 0xce, 0xb2, 0x12, 0x02, 0xb4, 0x88, 0xce, 0xb1, 0x57, 0x4c, 0x49, 0x6b, 0x73 }) // object is not subscriptable
+TRANSLATION("'%s' object is not an iterator", 31, { 0xd3, 0x94, 0x68, 0x1b, 0x5f, 0x33, 0xac, 0x84, 0x80, 0xad, 0x20, 0x94, 0x24, 0x9b, 0x94, 0xb3, 0x80 }) // \'%s\' object is not an iterator
+TRANSLATION("empty separator", 16, { 0x3e, 0x31, 0x3e, 0x04, 0x1e, 0x09, 0xca, 0x59, 0xc0 }) // empty separator
+TRANSLATION("indices must be integers", 25, { 0x45, 0xb2, 0x54, 0xe0, 0x71, 0x98, 0x91, 0xa9, 0x84, 0x59, 0x3d, 0xcd, 0xe0 }) // indices must be integers
+TRANSLATION("unknown conversion specifier %c", 32, { 0xca, 0xfa, 0x2b, 0x76, 0x51, 0x56, 0x5e, 0xa6, 0xf0, 0x8c, 0xa2, 0x30, 0x75, 0x4d, 0x90, 0xdc, 0x72, 0xa8 }) // unknown conversion specifier %c
+TRANSLATION("can't delete expression", 24, { 0xa9, 0x2e, 0x92, 0x2c, 0x77, 0x39, 0x30, 0x7d, 0xf0, 0xe7, 0x10, 0x8c, 0xa0 }) // can\'t delete expression
+TRANSLATION("negative shift count", 21, { 0x53, 0xdc, 0xa5, 0x3a, 0x98, 0x8e, 0x89, 0xb4, 0x8a, 0xb6, 0x56, 0x40 }) // negative shift count
+TRANSLATION("module not found", 17, { 0xe1, 0xad, 0x9b, 0x98, 0x56, 0x91, 0xb3, 0x65, 0x6c }) // module not found
+TRANSLATION("can't convert to int", 21, { 0xa9, 0x2e, 0x92, 0x2a, 0xcb, 0xd4, 0xde, 0x44, 0xb0, 0x45, 0x90 }) // can\'t convert to int
+TRANSLATION("__init__() should return None", 30, { 0xa5, 0x11, 0x52, 0x69, 0x4f, 0x67, 0xb4, 0x47, 0x46, 0xcd, 0xec, 0x1c, 0xe7, 0x2e, 0xa3, 0xc9, 0x94, 0xc0 }) // __init__() should return None
+TRANSLATION("function missing keyword-only argument", 39, { 0xdb, 0x2b, 0x59, 0x46, 0x51, 0xc2, 0x44, 0x22, 0xee, 0x3d, 0x0f, 0xc7, 0x66, 0x7b, 0x7b, 0x99, 0x6f, 0xe0, 0x13, 0xef, 0x9e, 0x0d, 0x64 }) // function missing keyword-only argument
+TRANSLATION("'%s' object is not subscriptable", 33, { 0xd3, 0x94, 0x68, 0x1b, 0x5f, 0x33, 0xac, 0x84, 0x80, 0xad, 0x22, 0x33, 0xac, 0x55, 0xd3, 0x12, 0x5a, 0xdc, 0xc0 }) // \'%s\' object is not subscriptable
+TRANSLATION("extra keyword arguments given", 30, { 0x3e, 0xf2, 0xe4, 0x3d, 0x0f, 0xc7, 0x66, 0x7b, 0x02, 0x7d, 0xf3, 0xc1, 0xac, 0xc0, 0xdd, 0x3a, 0x9a, 0x80 }) // extra keyword arguments given
+TRANSLATION("Input/output error", 19, { 0xf8, 0x2e, 0x33, 0x3f, 0x63, 0x66, 0x71, 0x99, 0x06, 0xee, 0xce }) // Input/output error
+TRANSLATION("ord() expected a character, but string of length %d found", 58, { 0x67, 0xb7, 0xb3, 0xda, 0x0f, 0xbe, 0x0e, 0xb2, 0x76, 0x04, 0x2b, 0xd0, 0x9c, 0xab, 0x26, 0xff, 0x58, 0xd7, 0x32, 0x22, 0x5d, 0x17, 0x70, 0xdb, 0x0b, 0x9a, 0xef, 0x3d, 0x07, 0x2b, 0x0d, 0x9b, 0x2b, 0x60 }) // ord() expected a character, but string of length %d found
+TRANSLATION("division by zero", 17, { 0xb2, 0x75, 0x48, 0x46, 0x51, 0xaf, 0x81, 0xfb, 0x9b, 0xb0 }) // division by zero
+TRANSLATION("'%s' object has no attribute '%q'", 34, { 0xd3, 0x94, 0x68, 0x1b, 0x5f, 0x33, 0xac, 0x8e, 0x85, 0x01, 0x58, 0x14, 0xcb, 0xa6, 0xb9, 0x93, 0x1a, 0x72, 0xf5, 0xd0 }) // \'%s\' object has no attribute \'%q\'
+TRANSLATION("issubclass() arg 2 must be a class or a tuple of classes", 57, { 0x48, 0x8c, 0xeb, 0x5b, 0x94, 0x47, 0xb3, 0xda, 0x09, 0xf7, 0x1f, 0xd0, 0x71, 0x98, 0x91, 0xa9, 0x82, 0x15, 0xb9, 0x44, 0x06, 0x70, 0x42, 0x73, 0x8b, 0x98, 0x6d, 0x85, 0x6e, 0x51, 0x07, 0x00 }) // issubclass() arg 2 must be a class or a tuple of classes
+TRANSLATION("pop from an empty set", 22, { 0xc3, 0x60, 0x6c, 0xed, 0xc0, 0x25, 0x07, 0xc6, 0x27, 0xc0, 0x83, 0x90 }) // pop from an empty set
+TRANSLATION("no module named '%q'", 21, { 0x56, 0x1c, 0x35, 0xb3, 0x73, 0x0a, 0x5c, 0x1d, 0x86, 0x9c, 0xbd, 0x74 }) // no module named \'%q\'
+TRANSLATION("incorrect padding", 18, { 0x45, 0xab, 0x3b, 0x9d, 0x64, 0x60, 0xad, 0x64, 0x5d, 0xc0 }) // incorrect padding
+TRANSLATION("unicode name escapes", 21, { 0xca, 0xa5, 0x5a, 0xc6, 0x14, 0xb8, 0x30, 0x71, 0x52, 0xc1, 0xc0 }) // unicode name escapes
+TRANSLATION("stream operation not supported", 31, { 0x89, 0x73, 0x2e, 0x03, 0x60, 0xdc, 0xa5, 0x19, 0x42, 0xb4, 0x88, 0xce, 0x30, 0xcf, 0x27, 0x60 }) // stream operation not supported
+TRANSLATION("identifier redefined as global", 31, { 0x4b, 0x1a, 0xca, 0x6c, 0x86, 0xe1, 0xce, 0xc7, 0xb2, 0x29, 0xd8, 0x14, 0x0d, 0xee, 0xda, 0x95, 0xc0 }) // identifier redefined as global
+TRANSLATION("'break' outside loop", 21, { 0xd3, 0x57, 0x32, 0xf4, 0xd0, 0x36, 0x66, 0x12, 0xc6, 0x2e, 0xcd, 0x80 }) // \'break\' outside loop
+TRANSLATION("sign not allowed in string format specifier", 44, { 0x84, 0xdd, 0x42, 0xb4, 0x82, 0xbd, 0xdb, 0xb1, 0xd8, 0x22, 0x88, 0x97, 0x45, 0xdc, 0x6c, 0xcf, 0xc1, 0x48, 0x8c, 0x1d, 0x53, 0x64, 0x37 }) // sign not allowed in string format specifier
+TRANSLATION("argument has wrong type", 24, { 0x27, 0xdf, 0x3c, 0x1a, 0xc8, 0xe8, 0x50, 0x3b, 0x3b, 0x2e, 0xe2, 0x7c, 0x60, 0xc0 }) // argument has wrong type
+TRANSLATION("%q index out of range", 22, { 0xe5, 0xea, 0x11, 0x6c, 0x7d, 0xc3, 0x66, 0x43, 0x6c, 0x1c, 0x97, 0x73 }) // %q index out of range
+TRANSLATION("incomplete format key", 22, { 0x45, 0xab, 0x71, 0x8b, 0x9c, 0x98, 0xd9, 0x9f, 0x82, 0x91, 0xe8, 0x7e, 0x00 }) // incomplete format key
+TRANSLATION("'%s' object does not support item deletion", 43, { 0xd3, 0x94, 0x68, 0x1b, 0x5f, 0x33, 0xac, 0x8b, 0x31, 0xc0, 0x56, 0x91, 0x19, 0xc6, 0x19, 0xe4, 0x24, 0x9f, 0x02, 0xc7, 0x73, 0x94, 0x65 }) // \'%s\' object does not support item deletion
+TRANSLATION("function missing required positional argument #%d", 50, { 0xdb, 0x2b, 0x59, 0x46, 0x51, 0xc2, 0x44, 0x22, 0xee, 0x1c, 0xfd, 0x72, 0x8e, 0x76, 0x18, 0x68, 0x49, 0x46, 0x52, 0xb8, 0x27, 0xdf, 0x3c, 0x1a, 0xc8, 0xfe, 0x3c, 0xac }) // function missing required positional argument #%d
+TRANSLATION("__new__ arg must be a user-type", 32, { 0xa5, 0x14, 0xfb, 0x52, 0x80, 0x9f, 0x71, 0xc6, 0x62, 0x46, 0xa6, 0x08, 0x66, 0x0d, 0xfd, 0xd3, 0xe3, 0x06 }) // __new__ arg must be a user-type
+TRANSLATION("unknown format code '%c' for object of type '%s'", 49, { 0xca, 0xfa, 0x2b, 0x76, 0x51, 0xb3, 0x3f, 0x05, 0x22, 0xad, 0x63, 0x1a, 0x72, 0xae, 0x83, 0x66, 0x70, 0xda, 0xf9, 0x9d, 0x64, 0x36, 0xc2, 0x7c, 0x60, 0xc6, 0x9c, 0xa3, 0x40 }) // unknown format code \'%c\' for object of type \'%s\'
+TRANSLATION("unmatched '{' in format", 24, { 0xca, 0xf0, 0x53, 0x5e, 0x87, 0x61, 0xa7, 0xfd, 0xe8, 0x11, 0x46, 0xcc, 0xfc, 0x14, 0x80 }) // unmatched \'{\' in format
+TRANSLATION("must use keyword argument for key function", 43, { 0xe3, 0x31, 0x23, 0x30, 0x63, 0xd0, 0xfc, 0x76, 0x67, 0xb0, 0x27, 0xdf, 0x3c, 0x1a, 0xc8, 0xd9, 0x9c, 0x7a, 0x1f, 0x81, 0xb6, 0x56, 0xb2, 0x8c, 0xa0 }) // must use keyword argument for key function
+TRANSLATION("too many values to unpack (expected %d)", 40, { 0x96, 0x61, 0xc1, 0x2f, 0x81, 0xd4, 0xaf, 0x93, 0x81, 0x2c, 0x32, 0xb8, 0x2a, 0xfa, 0x0f, 0x61, 0xf7, 0xc1, 0xd6, 0x4e, 0xc3, 0x95, 0xbd, 0xa0 }) // too many values to unpack (expected %d)
+TRANSLATION("No space left on device", 24, { 0xf2, 0x61, 0x18, 0x2a, 0x98, 0xb9, 0xed, 0x21, 0x94, 0x58, 0xfa, 0xa5, 0x4c }) // No space left on device
+TRANSLATION("can't convert NaN to int", 25, { 0xa9, 0x2e, 0x92, 0x2a, 0xcb, 0xd4, 0xde, 0x47, 0x91, 0x79, 0x09, 0x60, 0x8b, 0x20 }) // can\'t convert NaN to int
+TRANSLATION("Invalid argument", 17, { 0xf8, 0x2f, 0x52, 0xba, 0x58, 0x13, 0xef, 0x9e, 0x0d, 0x64 }) // Invalid argument
+TRANSLATION("File exists", 12, { 0xfc, 0xd2, 0xe6, 0x0f, 0xba, 0x44, 0xc0 }) // File exists
+TRANSLATION("0.0 to a complex power", 23, { 0xfb, 0x7f, 0x97, 0xda, 0x25, 0x81, 0x0a, 0xb7, 0x18, 0xb9, 0xf7, 0x18, 0x6e, 0xc6, 0xe0 }) // 0.0 to a complex power
+TRANSLATION("buffer size must match format", 30, { 0xd7, 0x3b, 0x6c, 0x6e, 0x21, 0x3f, 0x73, 0x1c, 0x66, 0x24, 0x70, 0x53, 0x5e, 0x83, 0x66, 0x7e, 0x0a, 0x40 }) // buffer size must match format
+TRANSLATION("abort() called", 15, { 0x2d, 0x59, 0xe7, 0xd9, 0xed, 0x15, 0x2b, 0xdc, 0xec }) // abort() called
+TRANSLATION("constant must be an integer", 28, { 0xab, 0x2c, 0x49, 0x2c, 0x8e, 0x33, 0x12, 0x35, 0x30, 0x4a, 0x11, 0x64, 0xf7, 0x37 }) // constant must be an integer
+TRANSLATION("string index out of range", 26, { 0x89, 0x74, 0x5d, 0xc2, 0x2d, 0x8f, 0xb8, 0x6c, 0xc8, 0x6d, 0x83, 0x92, 0xee, 0x60 }) // string index out of range
+TRANSLATION("cannot create instance", 23, { 0xa9, 0x2a, 0xb4, 0x8a, 0xb9, 0x94, 0x98, 0x45, 0x89, 0x25, 0xa9, 0x80 }) // cannot create instance
+TRANSLATION("function got multiple values for argument '%q'", 47, { 0xdb, 0x2b, 0x59, 0x46, 0x51, 0xbb, 0x48, 0xe3, 0x37, 0x94, 0xc5, 0xcc, 0x75, 0x2b, 0xe4, 0xe0, 0x6c, 0xce, 0x09, 0xf7, 0xcf, 0x06, 0xb2, 0x34, 0xe5, 0xeb, 0xa0 }) // function got multiple values for argument \'%q\'
+TRANSLATION("object '%s' is not a tuple or list", 35, { 0x6d, 0x7c, 0xce, 0xb2, 0x34, 0xe5, 0x1a, 0x04, 0x80, 0xad, 0x20, 0x84, 0xe7, 0x17, 0x30, 0xce, 0x2e, 0x91, 0x20 }) // object \'%s\' is not a tuple or list
+TRANSLATION("Read-only filesystem", 21, { 0xf9, 0x19, 0x5b, 0xdc, 0xcb, 0x7f, 0x03, 0x64, 0xb9, 0xc7, 0x88, 0x93, 0xe0 }) // Read-only filesystem
+TRANSLATION("attributes not supported yet", 29, { 0x29, 0x97, 0x4d, 0x73, 0x27, 0x01, 0x5a, 0x44, 0x67, 0x18, 0x67, 0x93, 0xb0, 0xf0, 0x72 }) // attributes not supported yet
+TRANSLATION("expected ':' after format specifier", 36, { 0x3e, 0xf8, 0x3a, 0xc9, 0xd8, 0x69, 0xf7, 0x68, 0x0b, 0x69, 0x37, 0x1b, 0x33, 0xf0, 0x52, 0x23, 0x07, 0x54, 0xd9, 0x0d, 0xc0 }) // expected \':\' after format specifier
+TRANSLATION("function missing required keyword argument '%q'", 48, { 0xdb, 0x2b, 0x59, 0x46, 0x51, 0xc2, 0x44, 0x22, 0xee, 0x1c, 0xfd, 0x72, 0x8e, 0x76, 0x1e, 0x87, 0xe3, 0xb3, 0x3d, 0x81, 0x3e, 0xf9, 0xe0, 0xd6, 0x46, 0x9c, 0xbd, 0x74 }) // function missing required keyword argument \'%q\'
+TRANSLATION("invalid format specifier", 25, { 0x45, 0xea, 0x57, 0x4b, 0x0d, 0x99, 0xf8, 0x29, 0x11, 0x83, 0xaa, 0x6c, 0x86, 0xe0 }) // invalid format specifier
+TRANSLATION("can't have multiple **x", 24, { 0xa9, 0x2e, 0x92, 0x3a, 0x17, 0x53, 0x1c, 0x66, 0xf2, 0x98, 0xb9, 0x8f, 0xab, 0xea, 0xee }) // can\'t have multiple **x
+TRANSLATION("name reused for argument", 25, { 0x52, 0xe0, 0xc3, 0x9e, 0x60, 0xec, 0x36, 0x67, 0x04, 0xfb, 0xe7, 0x83, 0x59 }) // name reused for argument
+TRANSLATION("buffer too small", 17, { 0xd7, 0x3b, 0x6c, 0x6e, 0x25, 0x98, 0x47, 0x05, 0x7b, 0x80 }) // buffer too small
+TRANSLATION("can't convert '%q' object to %q implicitly", 43, { 0xa9, 0x2e, 0x92, 0x2a, 0xcb, 0xd4, 0xde, 0x46, 0x9c, 0xbd, 0x74, 0x0d, 0xaf, 0x99, 0xd6, 0x44, 0xb0, 0xe5, 0xea, 0x13, 0x8c, 0x5d, 0x2a, 0x93, 0x7f, 0x00 }) // can\'t convert \'%q\' object to %q implicitly
+TRANSLATION("issubclass() arg 1 must be a class", 35, { 0x48, 0x8c, 0xeb, 0x5b, 0x94, 0x47, 0xb3, 0xda, 0x09, 0xf7, 0x1f, 0xcc, 0x71, 0x98, 0x91, 0xa9, 0x82, 0x15, 0xb9, 0x44, 0x00 }) // issubclass() arg 1 must be a class
+TRANSLATION("argument should be a '%q' not a '%q'", 37, { 0x27, 0xdf, 0x3c, 0x1a, 0xc8, 0x8e, 0x8d, 0x9b, 0xd8, 0x6a, 0x60, 0x86, 0x9c, 0xbd, 0x74, 0x0a, 0xd2, 0x08, 0x69, 0xcb, 0xd7, 0x40 }) // argument should be a \'%q\' not a \'%q\'
+TRANSLATION("unexpected indent", 18, { 0xca, 0x9f, 0x7c, 0x1d, 0x64, 0xec, 0x11, 0x6c, 0x6b, 0x20 }) // unexpected indent
+TRANSLATION("can't add special method to already-subclassed class", 53, { 0xa9, 0x2e, 0x92, 0x0a, 0xd6, 0x11, 0x83, 0xaa, 0x15, 0xc7, 0x07, 0x3d, 0x1a, 0xc2, 0x58, 0x15, 0xdc, 0xca, 0xde, 0x3d, 0xd1, 0x9d, 0x6b, 0x72, 0x88, 0x3b, 0x0a, 0xdc, 0xa2, 0x00 }) // can\'t add special method to already-subclassed class
+TRANSLATION("unsupported type for operator", 30, { 0xca, 0xc6, 0x71, 0x86, 0x79, 0x3b, 0x09, 0xf1, 0x83, 0x1b, 0x33, 0x86, 0xc1, 0xb9, 0x4b, 0x38 }) // unsupported type for operator
+TRANSLATION("unknown format code '%c' for object of type 'float'", 52, { 0xca, 0xfa, 0x2b, 0x76, 0x51, 0xb3, 0x3f, 0x05, 0x22, 0xad, 0x63, 0x1a, 0x72, 0xae, 0x83, 0x66, 0x70, 0xda, 0xf9, 0x9d, 0x64, 0x36, 0xc2, 0x7c, 0x60, 0xc6, 0x9b, 0x5d, 0x8a, 0x74 }) // unknown format code \'%c\' for object of type \'float\'
+TRANSLATION("slice step cannot be zero", 26, { 0x8b, 0xa5, 0x4c, 0x44, 0x9e, 0x05, 0x49, 0x55, 0xa4, 0x6a, 0x63, 0xf7, 0x37, 0x60 }) // slice step cannot be zero
+TRANSLATION("type takes 1 or 3 arguments", 28, { 0x9f, 0x18, 0x31, 0x25, 0xe8, 0x70, 0x3f, 0x98, 0x67, 0x1f, 0xd4, 0x13, 0xef, 0x9e, 0x0d, 0x66, 0x00 }) // type takes 1 or 3 arguments
+TRANSLATION("'continue' outside loop", 24, { 0xd2, 0xac, 0xb2, 0x8b, 0x93, 0xd0, 0x36, 0x66, 0x12, 0xc6, 0x2e, 0xcd, 0x80 }) // \'continue\' outside loop
+TRANSLATION("can't assign to expression", 27, { 0xa9, 0x2e, 0x92, 0x0a, 0x21, 0x37, 0x51, 0x2c, 0x0f, 0xbe, 0x1c, 0xe2, 0x11, 0x94 }) // can\'t assign to expression
+TRANSLATION("cannot import name %q", 22, { 0xa9, 0x2a, 0xb4, 0x84, 0xe3, 0x0c, 0xf2, 0x14, 0xb8, 0x31, 0xcb, 0xd4 }) // cannot import name %q
+TRANSLATION("can't send non-None value to a just-started generator", 54, { 0xa9, 0x2e, 0x92, 0x20, 0xd6, 0xc1, 0x59, 0x7d, 0xde, 0x4c, 0xa6, 0x3a, 0x95, 0xf2, 0x62, 0x58, 0x10, 0xf3, 0xcc, 0x4f, 0xba, 0x24, 0x9e, 0x4e, 0xc3, 0x73, 0x53, 0x72, 0x96, 0x70 }) // can\'t send non-None value to a just-started generator
+TRANSLATION("'%s' object is not callable", 28, { 0xd3, 0x94, 0x68, 0x1b, 0x5f, 0x33, 0xac, 0x84, 0x80, 0xad, 0x22, 0xa5, 0x7b, 0x96, 0xb7, 0x30 }) // \'%s\' object is not callable
+TRANSLATION("string indices must be integers, not %s", 40, { 0x89, 0x74, 0x5d, 0xc2, 0x2d, 0x92, 0xa7, 0x03, 0x8c, 0xc4, 0x8d, 0x4c, 0x22, 0xc9, 0xee, 0x6f, 0x1f, 0x58, 0x56, 0x91, 0xca, 0x00 }) // string indices must be integers, not %s
+TRANSLATION("type is not an acceptable base type", 36, { 0x9f, 0x18, 0x30, 0x90, 0x15, 0xa4, 0x12, 0x82, 0xad, 0x4f, 0x12, 0x5a, 0xdc, 0xc6, 0xa5, 0x06, 0x27, 0xc6, 0x0c }) // type is not an acceptable base type
+TRANSLATION("object not callable", 20, { 0x6d, 0x7c, 0xce, 0xb2, 0x15, 0xa4, 0x54, 0xaf, 0x72, 0xd6, 0xe6 }) // object not callable
+TRANSLATION("cannot create '%q' instances", 29, { 0xa9, 0x2a, 0xb4, 0x8a, 0xb9, 0x94, 0x98, 0xd3, 0x97, 0xae, 0x81, 0x16, 0x24, 0x96, 0xa7, 0x00 }) // cannot create \'%q\' instances
+
+// 2130 bytes worth of qstr
+// 6398 bytes worth of translations
+// 3764 bytes worth of translations compressed
+// 2634 bytes saved
@@ -32,6 +32,7 @@
 #include "py/compile.h"
 #include "py/persistentcode.h"
 #include "py/runtime.h"
+#include "py/smallint.h"
 #include "py/gc.h"
 #include "py/stackctrl.h"
 #ifdef _WIN32
@@ -96,6 +97,21 @@ STATIC int compile_and_save(const char *file, const char *output_file, const cha
     }
 }
 
+#if MICROPY_COMP_EXTRA_OPT
+// Add the public const() definitions of file to the constants every later parse starts with.
+STATIC int import_consts(const char *file) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_parse_import_consts(mp_lexer_new_from_file(file));
+        nlr_pop();
+        return 0;
+    } else {
+        mp_obj_print_exception(&mp_stderr_print, (mp_obj_t)nlr.ret_val);
+        return 1;
+    }
+}
+#endif
+
 STATIC int usage(char **argv) {
     printf(
 "usage: %s [<opts>] [-X <implopt>] <input filename>\n"
@@ -104,6 +120,10 @@ STATIC int usage(char **argv) {
 "-s : source filename to embed in the compiled bytecode (defaults to input file)\n"
 "-v : verbose (trace various operations); can be multiple\n"
 "-O[N] : apply bytecode optimizations of level N\n"
+#if MICROPY_COMP_EXTRA_OPT
+"-D NAME=VALUE : use the integer VALUE for NAME = const(...) wherever it is defined\n"
+"-C <filename> : make the public const() definitions of another module constants in this one\n"
+#endif
 "\n"
 "Target specific options:\n"
 "-msmall-int-bits=number : set the maximum bits used to encode a small-int\n"
@@ -218,6 +238,29 @@ MP_NOINLINE int main_(int argc, char **argv) {
                 }
                 a += 1;
                 output_file = argv[a];
+            #if MICROPY_COMP_EXTRA_OPT
+            } else if (strcmp(argv[a], "-D") == 0) {
+                if (a + 1 >= argc) {
+                    exit(usage(argv));
+                }
+                a += 1;
+                const char *eq = strchr(argv[a], '=');
+                char *end;
+                long long value = eq == NULL ? 0 : strtoll(eq + 1, &end, 0);
+                if (eq == NULL || eq == argv[a] || eq[1] == '\0' || *end) {
+                    return usage(argv);
+                }
+                qstr name = qstr_from_strn(argv[a], eq - argv[a]);
+                mp_map_lookup(&MP_STATE_VM(mp_comp_const_overrides), MP_OBJ_NEW_QSTR(name),
+                    MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)->value = MP_SMALL_INT_FITS(value)
+                    ? MP_OBJ_NEW_SMALL_INT(value) : mp_obj_new_int_from_ll(value);
+            } else if (strcmp(argv[a], "-C") == 0) {
+                // read once all the -D and -O options are known, see below
+                if (a + 1 >= argc) {
+                    exit(usage(argv));
+                }
+                a += 1;
+            #endif
             } else if (strcmp(argv[a], "-s") == 0) {
                 if (a + 1 >= argc) {
                     exit(usage(argv));
@@ -257,6 +300,21 @@ MP_NOINLINE int main_(int argc, char **argv) {
         exit(1);
     }
 
+    #if MICROPY_COMP_EXTRA_OPT
+    // now the -D and -O options are known, read the constants of the -C modules
+    for (int a = 1; a < argc; a++) {
+        if (strcmp(argv[a], "-X") == 0 || strcmp(argv[a], "-D") == 0
+            || strcmp(argv[a], "-o") == 0 || strcmp(argv[a], "-s") == 0) {
+            a += 1;
+        } else if (strcmp(argv[a], "-C") == 0) {
+            a += 1;
+            if (import_consts(argv[a]) != 0) {
+                return 1;
+            }
+        }
+    }
+    #endif
+
     int ret = compile_and_save(input_file, output_file, source_file);
 
     #if MICROPY_PY_MICROPYTHON_MEM_INFO
@@ -31,17 +31,19 @@
 
 #include "shared-bindings/audiocore/RawSample.h"
 #include "shared-bindings/audiocore/WaveFile.h"
+#if CIRCUITPY_AUDIOBUSIO
+#include "common-hal/audiobusio/PDMIn.h"
+#endif
+#if CIRCUITPY_ANALOGBUFIO
+#include "common-hal/analogbufio/BufferedIn.h"
+#endif
 
 #include "py/mpstate.h"
 #include "py/runtime.h"
 
-#if CIRCUITPY_AUDIOIO || CIRCUITPY_AUDIOBUSIO
-
-static audio_dma_t* audio_dma_state[AUDIO_DMA_CHANNEL_COUNT];
-
-// This cannot be in audio_dma_state because it's volatile.
-static volatile bool audio_dma_pending[AUDIO_DMA_CHANNEL_COUNT];
+#include "tick.h"
 
+// Channel allocation is always built because busio.SPI uses it for background transfers.
 static bool audio_dma_allocated[AUDIO_DMA_CHANNEL_COUNT];
 
 uint8_t audio_dma_allocate_channel(void) {
@@ -74,6 +76,147 @@ void audio_dma_enable_channel(uint8_t channel) {
     dma_enable_channel(channel);
 }
 
+#if CIRCUITPY_AUDIOIO || CIRCUITPY_AUDIOBUSIO || CIRCUITPY_ANALOGBUFIO
+
+static audio_dma_t* audio_dma_state[AUDIO_DMA_CHANNEL_COUNT];
+
+// This cannot be in audio_dma_state because it's volatile.
+static volatile bool audio_dma_pending[AUDIO_DMA_CHANNEL_COUNT];
+// Set by the block done interrupt when the sample wasn't ready to refill from it.
+static volatile bool audio_dma_background_refill[AUDIO_DMA_CHANNEL_COUNT];
+
+static uint64_t audio_dma_now_us(void) {
+    uint64_t ms;
+    uint32_t us_until_ms;
+    current_tick(&ms, &us_until_ms);
+    return ms * 1000 + (1000 - us_until_ms);
+}
+
+void audio_dma_enable_event_interrupt(uint8_t event_channel, bool enable) {
+    if (event_channel >= EVSYS_SYNCH_NUM) {
+        return;
+    }
+    #ifdef SAMD21
+    uint32_t mask = EVSYS_INTENSET_EVD0 << event_channel;
+    if (event_channel >= 8) {
+        mask = EVSYS_INTENSET_EVD8 << (event_channel - 8);
+    }
+    if (enable) {
+        EVSYS->INTENSET.reg = mask;
+        NVIC_EnableIRQ(EVSYS_IRQn);
+    } else {
+        EVSYS->INTENCLR.reg = mask;
+    }
+    #endif
+    #ifdef SAMD51
+    if (enable) {
+        EVSYS->Channel[event_channel].CHINTENSET.reg = EVSYS_CHINTENSET_EVD;
+        NVIC_EnableIRQ(EVSYS_0_IRQn + MIN(event_channel, 4));
+    } else {
+        EVSYS->Channel[event_channel].CHINTENCLR.reg = EVSYS_CHINTENCLR_EVD;
+    }
+    #endif
+}
+
+// Signed and unsigned samples only differ in the top bit so both directions are the same XOR.
+// The kernel is picked once at setup and the output buffers are always word aligned.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-align"
+static void audio_dma_convert_8(const uint8_t* in, uint8_t* out, uint32_t out_length, uint8_t spacing) {
+    for (uint32_t i = 0; i < out_length; i++) {
+        out[i] = in[i * spacing] ^ 0x80;
+    }
+}
+
+static void audio_dma_convert_16(const uint8_t* in, uint8_t* out, uint32_t out_length, uint8_t spacing) {
+    const uint16_t* in16 = (const uint16_t*) in;
+    uint16_t* out16 = (uint16_t*) out;
+    for (uint32_t i = 0; i < out_length / 2; i++) {
+        out16[i] = in16[i * spacing] ^ 0x8000;
+    }
+}
+
+static void audio_dma_convert_contiguous(const uint8_t* in, uint8_t* out, uint32_t out_length,
+                                         uint32_t mask) {
+    const uint32_t* in32 = (const uint32_t*) in;
+    uint32_t* out32 = (uint32_t*) out;
+    uint32_t words = out_length / 4;
+    for (uint32_t i = 0; i < words; i++) {
+        out32[i] = in32[i] ^ mask;
+    }
+    for (uint32_t i = words * 4; i < out_length; i++) {
+        out[i] = in[i] ^ (mask >> (8 * (i % 4)));
+    }
+}
+
+static void audio_dma_convert_8_contiguous(const uint8_t* in, uint8_t* out, uint32_t out_length, uint8_t spacing) {
+    if (((uint32_t) in & 3) != 0) {
+        audio_dma_convert_8(in, out, out_length, 1);
+        return;
+    }
+    audio_dma_convert_contiguous(in, out, out_length, 0x80808080);
+}
+
+static void audio_dma_convert_16_contiguous(const uint8_t* in, uint8_t* out, uint32_t out_length, uint8_t spacing) {
+    if (((uint32_t) in & 3) != 0) {
+        audio_dma_convert_16(in, out, out_length, 1);
+        return;
+    }
+    audio_dma_convert_contiguous(in, out, out_length, 0x80008000);
+}
+
+// One channel of interleaved 16 bit stereo. Each pair of input words holds two samples of the
+// channel, in the bottom halves when the channel starts word aligned and in the top halves
+// otherwise.
+static void audio_dma_convert_16_stereo(const uint8_t* in, uint8_t* out, uint32_t out_length, uint8_t spacing) {
+    uint32_t offset = (uint32_t) in & 3;
+    if ((offset & 1) != 0) {
+        audio_dma_convert_16(in, out, out_length, 2);
+        return;
+    }
+    const uint32_t* in32 = (const uint32_t*) (in - offset);
+    uint32_t* out32 = (uint32_t*) out;
+    uint32_t words = out_length / 4;
+    if (offset == 0) {
+        for (uint32_t i = 0; i < words; i++) {
+            #ifdef SAMD51
+            uint32_t pair = __PKHBT(in32[2 * i], in32[2 * i + 1], 16);
+            #else
+            uint32_t pair = (in32[2 * i] & 0xffff) | (in32[2 * i + 1] << 16);
+            #endif
+            out32[i] = pair ^ 0x80008000;
+        }
+    } else {
+        for (uint32_t i = 0; i < words; i++) {
+            #ifdef SAMD51
+            uint32_t pair = __PKHTB(in32[2 * i + 1], in32[2 * i], 16);
+            #else
+            uint32_t pair = (in32[2 * i + 1] & 0xffff0000) | (in32[2 * i] >> 16);
+            #endif
+            out32[i] = pair ^ 0x80008000;
+        }
+    }
+    if ((out_length & 2) != 0) {
+        ((uint16_t*) out)[words * 2] = ((const uint16_t*) in)[words * 4] ^ 0x8000;
+    }
+}
+#pragma GCC diagnostic pop
+
+static audio_dma_convert_t audio_dma_pick_convert(uint8_t bytes_per_sample, uint8_t spacing) {
+    if (bytes_per_sample == 2) {
+        if (spacing == 1) {
+            return audio_dma_convert_16_contiguous;
+        } else if (spacing == 2) {
+            return audio_dma_convert_16_stereo;
+        }
+        return audio_dma_convert_16;
+    }
+    if (spacing == 1) {
+        return audio_dma_convert_8_contiguous;
+    }
+    return audio_dma_convert_8;
+}
+
 void audio_dma_convert_signed(audio_dma_t* dma, uint8_t* buffer, uint32_t buffer_length,
                               uint8_t** output_buffer, uint32_t* output_buffer_length,
                               uint8_t* output_spacing) {
@@ -82,37 +225,15 @@ void audio_dma_convert_signed(audio_dma_t* dma, uint8_t* buffer, uint32_t buffer
     } else {
         *output_buffer = dma->second_buffer;
     }
-    #pragma GCC diagnostic push
-    #pragma GCC diagnostic ignored "-Wcast-align"
-    if (dma->signed_to_unsigned || dma->unsigned_to_signed) {
+    if (dma->convert != NULL) {
         *output_buffer_length = buffer_length / dma->spacing;
         *output_spacing = 1;
-        uint32_t out_i = 0;
-        if (dma->bytes_per_sample == 1) {
-            for (uint32_t i = 0; i < buffer_length; i += dma->spacing) {
-                if (dma->signed_to_unsigned) {
-                    ((uint8_t*) *output_buffer)[out_i] = ((int8_t*) buffer)[i] + 0x80;
-                } else {
-                    ((int8_t*) *output_buffer)[out_i] = ((uint8_t*) buffer)[i] - 0x80;
-                }
-                out_i += 1;
-            }
-        } else if (dma->bytes_per_sample == 2) {
-            for (uint32_t i = 0; i < buffer_length / 2; i += dma->spacing) {
-                if (dma->signed_to_unsigned) {
-                    ((uint16_t*) *output_buffer)[out_i] = ((int16_t*) buffer)[i] + 0x8000;
-                } else {
-                    ((int16_t*) *output_buffer)[out_i] = ((uint16_t*) buffer)[i] - 0x8000;
-                }
-                out_i += 1;
-            }
-        }
+        dma->convert(buffer, *output_buffer, *output_buffer_length, dma->spacing);
     } else {
         *output_buffer = buffer;
         *output_buffer_length = buffer_length;
         *output_spacing = dma->spacing;
     }
-    #pragma GCC diagnostic pop
     dma->first_buffer_free = !dma->first_buffer_free;
 }
 
@@ -187,11 +308,11 @@ audio_dma_result audio_dma_setup_playback(audio_dma_t* dma,
     dma->single_channel = single_channel;
     dma->audio_channel = audio_channel;
     dma->dma_channel = dma_channel;
-    dma->signed_to_unsigned = false;
-    dma->unsigned_to_signed = false;
+    dma->convert = NULL;
     dma->second_descriptor = NULL;
     dma->spacing = 1;
     dma->first_descriptor_free = true;
+    audioio_output_stats_reset(&dma->stats);
     audiosample_reset_buffer(sample, single_channel, audio_channel);
 
     bool single_buffer;
@@ -214,8 +335,6 @@ audio_dma_result audio_dma_setup_playback(audio_dma_t* dma,
                 return AUDIO_DMA_MEMORY_ERROR;
             }
         }
-        dma->signed_to_unsigned = !output_signed && samples_signed;
-        dma->unsigned_to_signed = output_signed && !samples_signed;
     }
 
     dma->event_channel = 0xff;
@@ -251,6 +370,9 @@ audio_dma_result audio_dma_setup_playback(audio_dma_t* dma,
             output_register_address += 1;
         }
     }
+    if (output_signed != samples_signed) {
+        dma->convert = audio_dma_pick_convert(dma->bytes_per_sample, dma->spacing);
+    }
     // Transfer both channels at once.
     if (!single_channel && audiosample_channel_count(sample) == 2) {
         dma->beat_size *= 2;
@@ -277,6 +399,8 @@ audio_dma_result audio_dma_setup_playback(audio_dma_t* dma,
 
     dma_configure(dma_channel, dma_trigger_source, true);
     audio_dma_enable_channel(dma_channel);
+    audio_dma_background_refill[dma_channel] = false;
+    audio_dma_enable_event_interrupt(dma->event_channel, true);
 
     return AUDIO_DMA_OK;
 }
@@ -284,6 +408,7 @@ audio_dma_result audio_dma_setup_playback(audio_dma_t* dma,
 void audio_dma_stop(audio_dma_t* dma) {
     uint8_t channel = dma->dma_channel;
     if (channel < AUDIO_DMA_CHANNEL_COUNT) {
+        audio_dma_enable_event_interrupt(dma->event_channel, false);
         audio_dma_disable_channel(channel);
         disable_event_channel(dma->event_channel);
         MP_STATE_PORT(playing_audio)[channel] = NULL;
@@ -316,8 +441,12 @@ void audio_dma_init(audio_dma_t* dma) {
 
 void audio_dma_reset(void) {
     for (uint8_t i = 0; i < AUDIO_DMA_CHANNEL_COUNT; i++) {
+        if (audio_dma_state[i] != NULL) {
+            audio_dma_enable_event_interrupt(audio_dma_state[i]->event_channel, false);
+        }
         audio_dma_state[i] = NULL;
         audio_dma_pending[i] = false;
+        audio_dma_background_refill[i] = false;
         audio_dma_allocated[i] = false;
         audio_dma_disable_channel(i);
         dma_descriptor(i)->BTCTRL.bit.VALID = false;
@@ -350,16 +479,115 @@ void audio_dma_background(void) {
             continue;
         }
 
-        bool block_done = event_interrupt_active(dma->event_channel);
-        if (!block_done) {
-            continue;
-        }
-
         // audio_dma_load_next_block() can call Python code, which can call audio_dma_background()
         // recursively at the next background processing time. So disallow recursive calls to here.
         audio_dma_pending[i] = true;
-        audio_dma_load_next_block(dma);
+        if (audio_dma_background_refill[i]) {
+            uint64_t start = audio_dma_now_us();
+            audio_dma_load_next_block(dma);
+            audioio_output_stats_record(&dma->stats, dma->event_underrun, start - dma->event_time,
+                                        audio_dma_now_us() - start);
+            // Any block that finished meanwhile is still flagged so the interrupt fires right away.
+            audio_dma_background_refill[i] = false;
+            if (audio_dma_state[i] != NULL) {
+                audio_dma_enable_event_interrupt(dma->event_channel, true);
+            }
+        }
+        // Load ahead while the DMA has plenty to play so the next block is ready right away.
+        if (audio_dma_state[i] != NULL) {
+            audiosample_fill_ahead(dma->sample);
+        }
         audio_dma_pending[i] = false;
     }
 }
+
+// Refills straight from the block done event when the sample can supply the next buffer without
+// waiting, so playback doesn't depend on how often background tasks run. Otherwise the refill is
+// left to audio_dma_background().
+static void audio_dma_event_handler(void) {
+    for (uint8_t i = 0; i < AUDIO_DMA_CHANNEL_COUNT; i++) {
+        audio_dma_t* dma = audio_dma_state[i];
+        if (dma == NULL || audio_dma_background_refill[i] ||
+            !event_interrupt_active(dma->event_channel)) {
+            continue;
+        }
+        // The event overflows when the other block finished too before we got here. The DMA
+        // has then started replaying the block we are about to load.
+        bool underrun = event_interrupt_overflow(dma->event_channel);
+        uint64_t start = audio_dma_now_us();
+        if (audiosample_buffer_ready(dma->sample, dma->single_channel, dma->audio_channel)) {
+            audio_dma_load_next_block(dma);
+            audioio_output_stats_record(&dma->stats, underrun, 0, audio_dma_now_us() - start);
+        } else {
+            dma->event_time = start;
+            dma->event_underrun = underrun;
+            audio_dma_enable_event_interrupt(dma->event_channel, false);
+            audio_dma_background_refill[i] = true;
+        }
+    }
+}
+
+#ifdef SAMD21
+void EVSYS_Handler(void) {
+    audio_dma_event_handler();
+    #if CIRCUITPY_AUDIOBUSIO
+    pdmin_event_handler();
+    #endif
+    #if CIRCUITPY_ANALOGBUFIO
+    bufferedin_event_handler();
+    #endif
+}
+#endif
+
+#ifdef SAMD51
+void EVSYS_0_Handler(void) {
+    audio_dma_event_handler();
+    #if CIRCUITPY_AUDIOBUSIO
+    pdmin_event_handler();
+    #endif
+    #if CIRCUITPY_ANALOGBUFIO
+    bufferedin_event_handler();
+    #endif
+}
+
+void EVSYS_1_Handler(void) {
+    audio_dma_event_handler();
+    #if CIRCUITPY_AUDIOBUSIO
+    pdmin_event_handler();
+    #endif
+    #if CIRCUITPY_ANALOGBUFIO
+    bufferedin_event_handler();
+    #endif
+}
+
+void EVSYS_2_Handler(void) {
+    audio_dma_event_handler();
+    #if CIRCUITPY_AUDIOBUSIO
+    pdmin_event_handler();
+    #endif
+    #if CIRCUITPY_ANALOGBUFIO
+    bufferedin_event_handler();
+    #endif
+}
+
+void EVSYS_3_Handler(void) {
+    audio_dma_event_handler();
+    #if CIRCUITPY_AUDIOBUSIO
+    pdmin_event_handler();
+    #endif
+    #if CIRCUITPY_ANALOGBUFIO
+    bufferedin_event_handler();
+    #endif
+}
+
+void EVSYS_4_Handler(void) {
+    audio_dma_event_handler();
+    #if CIRCUITPY_AUDIOBUSIO
+    pdmin_event_handler();
+    #endif
+    #if CIRCUITPY_ANALOGBUFIO
+    bufferedin_event_handler();
+    #endif
+}
+#endif
 #endif
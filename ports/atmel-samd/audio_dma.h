@@ -29,9 +29,14 @@
 
 #include "extmod/vfs_fat.h"
 #include "py/obj.h"
+#include "shared-module/audiocore/__init__.h"
 #include "shared-module/audiocore/RawSample.h"
 #include "shared-module/audiocore/WaveFile.h"
 
+// Converts out_length bytes of samples between signed and unsigned while packing every spacing-th
+// sample of the input together.
+typedef void (*audio_dma_convert_t)(const uint8_t* in, uint8_t* out, uint32_t out_length, uint8_t spacing);
+
 typedef struct {
     mp_obj_t sample;
     uint8_t dma_channel;
@@ -42,13 +47,17 @@ typedef struct {
     uint8_t spacing;
     bool loop;
     bool single_channel;
-    bool signed_to_unsigned;
-    bool unsigned_to_signed;
+    audio_dma_convert_t convert; // NULL when the samples are played as they are.
     bool first_buffer_free;
     uint8_t* first_buffer;
     uint8_t* second_buffer;
     bool first_descriptor_free;
     DmacDescriptor* second_descriptor;
+    // Refill timing since playback started. When the block done interrupt leaves a refill to
+    // background tasks it notes when, in microseconds, and whether the refill was already late.
+    audioio_output_stats_t stats;
+    uint64_t event_time;
+    bool event_underrun;
 } audio_dma_t;
 
 typedef enum {
@@ -60,6 +69,7 @@ typedef enum {
 uint32_t audiosample_sample_rate(mp_obj_t sample_obj);
 uint8_t audiosample_bits_per_sample(mp_obj_t sample_obj);
 uint8_t audiosample_channel_count(mp_obj_t sample_obj);
+void audiosample_fill_ahead(mp_obj_t sample_obj);
 
 void audio_dma_init(audio_dma_t* dma);
 void audio_dma_reset(void);
@@ -86,6 +96,8 @@ audio_dma_result audio_dma_setup_playback(audio_dma_t* dma,
                                           uint8_t dma_trigger_source);
 
 void audio_dma_disable_channel(uint8_t channel);
+// Unmasks the block done event interrupt. PDMIn uses it too for continuous recording.
+void audio_dma_enable_event_interrupt(uint8_t event_channel, bool enable);
 void audio_dma_enable_channel(uint8_t channel);
 void audio_dma_stop(audio_dma_t* dma);
 bool audio_dma_get_playing(audio_dma_t* dma);
@@ -31,20 +31,46 @@
 #include "supervisor/shared/tick.h"
 #include "supervisor/usb.h"
 
+#include "py/gc.h"
 #include "py/runtime.h"
 #include "shared-module/network/__init__.h"
+#include "supervisor/shared/background_task.h"
 #include "supervisor/shared/stack.h"
 
 #ifdef CIRCUITPY_DISPLAYIO
 #include "shared-module/displayio/__init__.h"
 #endif
 
+#if CIRCUITPY_PULSEIO
+#include "common-hal/pulseio/PulseIn.h"
+#endif
+
 volatile uint64_t last_finished_tick = 0;
 
 bool stack_ok_so_far = true;
 
 static bool running_background_tasks = false;
 
+STATIC background_task_t background_tasks[] = {
+    #if CIRCUITPY_AUDIOIO || CIRCUITPY_AUDIOBUSIO
+    BACKGROUND_TASK(audio_dma_background, BACKGROUND_TASK_PRIORITY_HIGH, 0),
+    #endif
+    BACKGROUND_TASK(usb_background, BACKGROUND_TASK_PRIORITY_HIGH, 0),
+    #if CIRCUITPY_PULSEIO && defined(SAMD51)
+    BACKGROUND_TASK(pulsein_background, BACKGROUND_TASK_PRIORITY_HIGH, 0),
+    #endif
+    #if CIRCUITPY_NETWORK
+    BACKGROUND_TASK(network_module_background, BACKGROUND_TASK_PRIORITY_NORMAL, 0),
+    #endif
+    BACKGROUND_TASK(filesystem_background, BACKGROUND_TASK_PRIORITY_NORMAL, 0),
+    #if CIRCUITPY_DISPLAYIO
+    BACKGROUND_TASK(displayio_background, BACKGROUND_TASK_PRIORITY_LOW, 5),
+    #endif
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    BACKGROUND_TASK(gc_sweep_background, BACKGROUND_TASK_PRIORITY_LOW, 2),
+    #endif
+};
+
 #ifdef MONITOR_BACKGROUND_TASKS
 // PB03 is physical pin "SCL" on the Metro M4 express
 // so you can't use this code AND an i2c peripheral
@@ -77,18 +103,8 @@ void run_background_tasks(void) {
     assert_heap_ok();
     running_background_tasks = true;
 
-    #if CIRCUITPY_AUDIOIO || CIRCUITPY_AUDIOBUSIO
-    audio_dma_background();
-    #endif
-    #if CIRCUITPY_DISPLAYIO
-    displayio_background();
-    #endif
-
-    #if CIRCUITPY_NETWORK
-    network_module_background();
-    #endif
-    filesystem_background();
-    usb_background();
+    background_task_register_all(background_tasks, MP_ARRAY_SIZE(background_tasks));
+    background_task_run_all();
     running_background_tasks = false;
     assert_heap_ok();
 
@@ -96,7 +96,12 @@ void board_init(void) {
         &pin_PA01, // busy_pin
         false, // busy_state
         5, // seconds_per_frame
-        false); // chip_select (don't always toggle chip select)
+        false, // chip_select (don't always toggle chip select)
+        0, // refresh_buffer_bytes
+        NULL, // partial_start_sequence
+        0, // partial_start_sequence_len
+        0, // partial_refresh_time
+        0); // full_refresh_interval
 }
 
 bool board_requests_safe_mode(void) {
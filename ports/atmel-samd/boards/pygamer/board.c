@@ -110,7 +110,8 @@ void board_init(void) {
         false, // single_byte_bounds
         false, // data_as_commands
         true, // auto_refresh
-        60); // native_frames_per_second
+        60, // native_frames_per_second
+        0); // refresh_buffer_bytes
 }
 
 bool board_requests_safe_mode(void) {
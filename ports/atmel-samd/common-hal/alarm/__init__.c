@@ -0,0 +1,308 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "common-hal/alarm/__init__.h"
+
+#include "hal/include/hal_gpio.h"
+#include "py/mphal.h"
+#include "py/runtime.h"
+#include "lib/utils/interrupt_char.h"
+#include "eic_handler.h"
+#include "timer_handler.h"
+#include "samd/clocks.h"
+#include "samd/external_interrupts.h"
+#include "samd/timers.h"
+#include "shared-bindings/alarm/__init__.h"
+#include "shared-bindings/alarm/PinAlarm.h"
+#include "supervisor/port.h"
+#include "supervisor/shared/tick.h"
+#include "supervisor/shared/translate.h"
+#include "supervisor/usb.h"
+
+// A TC clocked from OSCULP32K, which keeps running in standby, measures the time asleep while
+// SysTick is stopped. At 1024Hz the 16 bit counter wraps every 64 seconds so it is read at least
+// every 32.
+#define SLEEP_TC_HZ (1024)
+#define SLEEP_TC_MAX_TICKS (1 << 15)
+
+void alarm_timer_interrupt_handler(uint8_t index) {
+    // The compare match only needs to wake the CPU.
+    tc_insts[index]->COUNT16.INTFLAG.reg = TC_INTFLAG_MC0;
+}
+
+void alarm_pin_interrupt_handler(uint8_t channel) {
+    // The level stays until the pin changes so stop the channel interrupting again. The pins are
+    // read after waking.
+    EIC->INTENCLR.reg = 1 << (EIC_INTENCLR_EXTINT_Pos + channel);
+}
+
+STATIC mp_obj_t triggered_pin_alarm(size_t n_alarms, const mp_obj_t* alarms) {
+    for (size_t i = 0; i < n_alarms; i++) {
+        if (!MP_OBJ_IS_TYPE(alarms[i], &alarm_pinalarm_type)) {
+            continue;
+        }
+        alarm_pinalarm_obj_t* alarm = MP_OBJ_TO_PTR(alarms[i]);
+        if (gpio_get_pin_level(alarm->pin->number) == alarm->value) {
+            return alarms[i];
+        }
+    }
+    return mp_const_none;
+}
+
+STATIC uint16_t read_count(Tc* tc) {
+    #ifdef SAMD21
+    tc->COUNT16.READREQ.reg = TC_READREQ_RREQ | TC_READREQ_ADDR(TC_COUNT16_COUNT_OFFSET);
+    tc_wait_for_sync(tc);
+    #endif
+    #ifdef SAMD51
+    tc->COUNT16.CTRLBSET.reg = TC_CTRLBSET_CMD_READSYNC;
+    while (tc->COUNT16.SYNCBUSY.bit.CTRLB || tc->COUNT16.SYNCBUSY.bit.COUNT) {}
+    #endif
+    return tc->COUNT16.COUNT.reg;
+}
+
+STATIC void set_gclk_run_in_standby(uint8_t gclk) {
+    #ifdef SAMD21
+    // Select the generator with an 8 bit write so GENCTRL reads back its settings.
+    *((uint8_t*) &GCLK->GENCTRL.reg) = gclk;
+    uint32_t genctrl = GCLK->GENCTRL.reg;
+    GCLK->GENCTRL.reg = genctrl | GCLK_GENCTRL_RUNSTDBY;
+    while (GCLK->STATUS.bit.SYNCBUSY) {}
+    #endif
+    #ifdef SAMD51
+    GCLK->GENCTRL[gclk].bit.RUNSTDBY = 1;
+    while ((GCLK->SYNCBUSY.vec.GENCTRL & (1 << gclk)) != 0) {}
+    #endif
+}
+
+STATIC void set_standby(bool standby) {
+    #ifdef SAMD21
+    if (standby) {
+        SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+    } else {
+        SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+    }
+    #endif
+    #ifdef SAMD51
+    static uint8_t idle_sleepmode;
+    if (standby) {
+        idle_sleepmode = PM->SLEEPCFG.bit.SLEEPMODE;
+        PM->SLEEPCFG.reg = PM_SLEEPCFG_SLEEPMODE_STANDBY;
+        while (PM->SLEEPCFG.bit.SLEEPMODE != PM_SLEEPCFG_SLEEPMODE_STANDBY_Val) {}
+    } else {
+        PM->SLEEPCFG.reg = idle_sleepmode;
+        while (PM->SLEEPCFG.bit.SLEEPMODE != idle_sleepmode) {}
+    }
+    #endif
+}
+
+// With USB connected the host expects the tick and background tasks to keep running, so sleep a
+// tick at a time as time.sleep does.
+STATIC mp_obj_t sleep_with_tick(size_t n_alarms, const mp_obj_t* alarms, uint64_t wake_ms) {
+    while (true) {
+        RUN_BACKGROUND_TASKS;
+        mp_obj_t woken_by = triggered_pin_alarm(n_alarms, alarms);
+        if (woken_by != mp_const_none) {
+            return woken_by;
+        }
+        if (supervisor_ticks_ms64() >= wake_ms || mp_hal_is_interrupted()) {
+            return mp_const_none;
+        }
+        port_sleep_until_interrupt();
+    }
+}
+
+// Stop SysTick and enter standby. Everything but the sleep timer and the EIC stops, but RAM and
+// registers are kept so returning is only as slow as restarting the clocks.
+STATIC mp_obj_t sleep_without_tick(size_t n_alarms, const mp_obj_t* alarms, uint64_t wake_ms) {
+    Tc* tc = NULL;
+    int8_t tc_index = TC_INST_NUM - 1;
+    for (; tc_index >= 0; tc_index--) {
+        if (tc_is_free(tc_index)) {
+            tc = tc_insts[tc_index];
+            break;
+        }
+    }
+    uint8_t gclk = find_free_gclk(32768 / SLEEP_TC_HZ);
+    if (tc == NULL || gclk == 0xff) {
+        // Without a timer to wake it, sleep a tick at a time instead.
+        return sleep_with_tick(n_alarms, alarms, wake_ms);
+    }
+    enable_clock_generator(gclk, GCLK_GENCTRL_SRC_OSCULP32K_Val, 32768 / SLEEP_TC_HZ);
+    set_gclk_run_in_standby(gclk);
+
+    set_timer_handler(true, tc_index, TC_HANDLER_ALARM);
+    turn_on_clocks(true, tc_index, gclk);
+    #ifdef SAMD21
+    tc->COUNT16.CTRLA.reg = TC_CTRLA_MODE_COUNT16 | TC_CTRLA_PRESCALER_DIV1 |
+                            TC_CTRLA_WAVEGEN_NFRQ | TC_CTRLA_RUNSTDBY;
+    #endif
+    #ifdef SAMD51
+    tc_reset(tc);
+    tc_set_enable(tc, false);
+    tc->COUNT16.CTRLA.reg = TC_CTRLA_MODE_COUNT16 | TC_CTRLA_PRESCALER_DIV1 | TC_CTRLA_RUNSTDBY;
+    tc->COUNT16.WAVE.reg = TC_WAVE_WAVEGEN_NFRQ;
+    #endif
+    tc->COUNT16.INTFLAG.reg = TC_INTFLAG_MC0;
+    tc->COUNT16.INTENSET.reg = TC_INTENSET_MC0;
+    tc_enable_interrupts(tc_index);
+    tc_set_enable(tc, true);
+
+    uint64_t start_ms = supervisor_ticks_ms64();
+    SysTick->CTRL &= ~(SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk);
+    set_standby(true);
+
+    mp_obj_t woken_by = mp_const_none;
+    uint64_t slept_ticks = 0;
+    uint16_t last_count = read_count(tc);
+    while (true) {
+        uint16_t count = read_count(tc);
+        slept_ticks += (uint16_t) (count - last_count);
+        last_count = count;
+        uint64_t now_ms = start_ms + slept_ticks * 1000 / SLEEP_TC_HZ;
+
+        woken_by = triggered_pin_alarm(n_alarms, alarms);
+        if (woken_by != mp_const_none || now_ms >= wake_ms || mp_hal_is_interrupted()) {
+            break;
+        }
+
+        uint64_t remaining_ms = wake_ms - now_ms;
+        uint32_t remaining_ticks = SLEEP_TC_MAX_TICKS;
+        if (remaining_ms < (uint64_t) SLEEP_TC_MAX_TICKS * 1000 / SLEEP_TC_HZ) {
+            remaining_ticks = remaining_ms * SLEEP_TC_HZ / 1000 + 2;
+        }
+        tc->COUNT16.CC[0].reg = (uint16_t) (count + remaining_ticks);
+        tc_wait_for_sync(tc);
+
+        // Pins that have reached their level already stopped interrupting.
+        for (size_t i = 0; i < n_alarms; i++) {
+            if (MP_OBJ_IS_TYPE(alarms[i], &alarm_pinalarm_type)) {
+                alarm_pinalarm_obj_t* alarm = MP_OBJ_TO_PTR(alarms[i]);
+                uint8_t channel = alarm->pin->extint_channel;
+                EIC->INTFLAG.reg = 1 << (EIC_INTFLAG_EXTINT_Pos + channel);
+                EIC->INTENSET.reg = 1 << (EIC_INTENSET_EXTINT_Pos + channel);
+            }
+        }
+        __WFI();
+    }
+
+    set_standby(false);
+    supervisor_ticks_ms_advance(slept_ticks * 1000 / SLEEP_TC_HZ);
+    SysTick->VAL = 0;
+    SysTick->CTRL |= SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+
+    tc->COUNT16.INTENCLR.reg = TC_INTENCLR_MC0;
+    tc_disable_interrupts(tc_index);
+    tc_reset(tc);
+    set_timer_handler(true, tc_index, TC_HANDLER_NO_INTERRUPT);
+    disable_clock_generator(gclk);
+    return woken_by;
+}
+
+mp_obj_t common_hal_alarm_light_sleep_until_alarms(size_t n_alarms, const mp_obj_t* alarms, uint64_t wake_ms) {
+    uint32_t channels = 0;
+    for (size_t i = 0; i < n_alarms; i++) {
+        if (!MP_OBJ_IS_TYPE(alarms[i], &alarm_pinalarm_type)) {
+            continue;
+        }
+        const mcu_pin_obj_t* pin = ((alarm_pinalarm_obj_t*) MP_OBJ_TO_PTR(alarms[i]))->pin;
+        if (!pin->has_extint) {
+            mp_raise_RuntimeError(translate("No hardware support on pin"));
+        }
+        if ((channels & (1 << pin->extint_channel)) != 0 ||
+            (eic_get_enable() && !eic_channel_free(pin->extint_channel))) {
+            mp_raise_RuntimeError(translate("A hardware interrupt channel is already in use"));
+        }
+        channels |= 1 << pin->extint_channel;
+    }
+
+    if (channels != 0 && !eic_get_enable()) {
+        turn_on_external_interrupt_controller();
+    }
+    #ifdef SAMD21
+    // Level detection without the filter needs no clock, so these channels work in standby.
+    EIC->WAKEUP.reg |= channels << EIC_WAKEUP_WAKEUPEN_Pos;
+    #endif
+    #ifdef SAMD51
+    // ASYNCH can only be changed while the EIC is off.
+    EIC->CTRLA.bit.ENABLE = 0;
+    while (EIC->SYNCBUSY.bit.ENABLE) {}
+    EIC->ASYNCH.reg |= channels << EIC_ASYNCH_ASYNCH_Pos;
+    EIC->CTRLA.bit.ENABLE = 1;
+    while (EIC->SYNCBUSY.bit.ENABLE) {}
+    #endif
+    for (size_t i = 0; i < n_alarms; i++) {
+        if (!MP_OBJ_IS_TYPE(alarms[i], &alarm_pinalarm_type)) {
+            continue;
+        }
+        alarm_pinalarm_obj_t* alarm = MP_OBJ_TO_PTR(alarms[i]);
+        uint8_t pin_number = alarm->pin->number;
+        uint8_t channel = alarm->pin->extint_channel;
+        gpio_set_pin_direction(pin_number, GPIO_DIRECTION_IN);
+        if (alarm->pull) {
+            gpio_set_pin_pull_mode(pin_number, alarm->value ? GPIO_PULL_DOWN : GPIO_PULL_UP);
+        } else {
+            gpio_set_pin_pull_mode(pin_number, GPIO_PULL_OFF);
+        }
+        gpio_set_pin_function(pin_number, GPIO_PIN_FUNCTION_A);
+        set_eic_handler(channel, EIC_HANDLER_ALARM);
+        turn_on_cpu_interrupt(channel);
+        turn_on_eic_channel(channel, alarm->value ? EIC_CONFIG_SENSE0_HIGH_Val : EIC_CONFIG_SENSE0_LOW_Val);
+    }
+
+    mp_obj_t woken_by;
+    if (usb_connected()) {
+        woken_by = sleep_with_tick(n_alarms, alarms, wake_ms);
+    } else {
+        woken_by = sleep_without_tick(n_alarms, alarms, wake_ms);
+    }
+
+    for (size_t i = 0; i < n_alarms; i++) {
+        if (!MP_OBJ_IS_TYPE(alarms[i], &alarm_pinalarm_type)) {
+            continue;
+        }
+        alarm_pinalarm_obj_t* alarm = MP_OBJ_TO_PTR(alarms[i]);
+        set_eic_handler(alarm->pin->extint_channel, EIC_HANDLER_NO_INTERRUPT);
+        turn_off_eic_channel(alarm->pin->extint_channel);
+        reset_pin_number(alarm->pin->number);
+    }
+    if (channels != 0) {
+        #ifdef SAMD21
+        EIC->WAKEUP.reg &= ~(channels << EIC_WAKEUP_WAKEUPEN_Pos);
+        #endif
+        #ifdef SAMD51
+        EIC->CTRLA.bit.ENABLE = 0;
+        while (EIC->SYNCBUSY.bit.ENABLE) {}
+        EIC->ASYNCH.reg &= ~(channels << EIC_ASYNCH_ASYNCH_Pos);
+        EIC->CTRLA.bit.ENABLE = 1;
+        while (EIC->SYNCBUSY.bit.ENABLE) {}
+        #endif
+        if (EIC->EVCTRL.reg == 0 && EIC->INTENSET.reg == 0) {
+            turn_off_external_interrupt_controller();
+        }
+    }
+    return woken_by;
+}
@@ -0,0 +1,495 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "lib/utils/interrupt_char.h"
+#include "py/gc.h"
+#include "py/mphal.h"
+#include "py/runtime.h"
+#include "common-hal/analogbufio/BufferedIn.h"
+#include "shared-bindings/analogbufio/BufferedIn.h"
+#include "shared-bindings/microcontroller/Pin.h"
+#include "supervisor/shared/translate.h"
+
+#include "atmel_start_pins.h"
+#include "hal/include/hal_gpio.h"
+#include "hal/utils/include/utils.h"
+
+#include "samd/adc.h"
+#include "samd/dma.h"
+#include "samd/events.h"
+#include "samd/timers.h"
+
+#include "audio_dma.h"
+#include "timer_handler.h"
+
+// Results in each of the two DMA blocks used by start(). At 100kHz the event interrupt copies
+// one block every 2.5ms.
+#define SAMPLES_PER_STREAM_BLOCK 256
+
+// One descriptor of a record() moves at most this many results.
+#define MAX_SAMPLES_PER_DESCRIPTOR 0xffff
+
+// Conversions per second the ADC clock set up below can keep up with, including the summed
+// ones of oversampling.
+#ifdef SAMD21
+#define MAX_CONVERSION_RATE 100000
+#endif
+#ifdef SAMD51
+#define MAX_CONVERSION_RATE 350000
+#endif
+
+#ifdef SAMD21
+#define FIRST_TC_GEN_ID EVSYS_ID_GEN_TC3_OVF
+#endif
+#ifdef SAMD51
+#define FIRST_TC_GEN_ID EVSYS_ID_GEN_TC0_OVF
+#endif
+
+static uint32_t set_timer_frequency(Tc* timer, uint32_t frequency) {
+    uint32_t system_clock = 48000000;
+    uint32_t new_top;
+    uint8_t new_divisor;
+    for (new_divisor = 0; new_divisor < 8; new_divisor++) {
+        new_top = (system_clock / prescaler[new_divisor] / frequency) - 1;
+        if (new_top < (1u << 16)) {
+            break;
+        }
+    }
+    tc_set_enable(timer, false);
+    timer->COUNT16.CTRLA.bit.PRESCALER = new_divisor;
+    tc_set_enable(timer, true);
+    tc_wait_for_sync(timer);
+    timer->COUNT16.CC[0].reg = new_top;
+    tc_wait_for_sync(timer);
+    return system_clock / prescaler[new_divisor] / (new_top + 1);
+}
+
+void common_hal_analogbufio_bufferedin_construct(analogbufio_bufferedin_obj_t* self,
+        const mcu_pin_obj_t *pin, uint32_t sample_rate, uint8_t oversample) {
+    uint8_t adc_index;
+    uint8_t adc_channel = 0xff;
+    for (adc_index = 0; adc_index < NUM_ADC_PER_PIN; adc_index++) {
+        if (pin->adc_input[adc_index] != 0xff) {
+            adc_channel = pin->adc_input[adc_index];
+            break;
+        }
+    }
+    if (adc_channel == 0xff) {
+        // No ADC function on that pin
+        mp_raise_ValueError(translate("Pin does not have ADC capabilities"));
+    }
+    if (sample_rate == 0 || sample_rate * oversample > MAX_CONVERSION_RATE) {
+        mp_raise_ValueError(translate("sampling rate out of range"));
+    }
+
+    // Use a timer to start each conversion so the samples are evenly spaced.
+    Tc *t = NULL;
+    uint8_t tc_index = TC_INST_NUM;
+    for (uint8_t i = TC_INST_NUM; i > 0; i--) {
+        if (tc_is_free(i - 1)) {
+            t = tc_insts[i - 1];
+            tc_index = i - 1;
+            break;
+        }
+    }
+    if (t == NULL) {
+        mp_raise_RuntimeError(translate("All timers in use"));
+    }
+
+    turn_on_event_system();
+    uint8_t channel = find_async_event_channel();
+    if (channel >= EVSYS_CHANNELS) {
+        mp_raise_RuntimeError(translate("All event channels in use"));
+    }
+
+    // Use the 48mhz clocks on both the SAMD21 and 51 like AudioOut.
+    uint8_t tc_gclk = 0;
+    #ifdef SAMD51
+    tc_gclk = 1;
+    #endif
+
+    set_timer_handler(true, tc_index, TC_HANDLER_NO_INTERRUPT);
+    turn_on_clocks(true, tc_index, tc_gclk);
+
+    tc_set_enable(t, false);
+    tc_reset(t);
+    #ifdef SAMD51
+    t->COUNT16.WAVE.reg = TC_WAVE_WAVEGEN_MFRQ;
+    #endif
+    #ifdef SAMD21
+    t->COUNT16.CTRLA.bit.WAVEGEN = TC_CTRLA_WAVEGEN_MFRQ_Val;
+    #endif
+    t->COUNT16.EVCTRL.reg = TC_EVCTRL_OVFEO;
+    tc_set_enable(t, true);
+    self->sample_rate = set_timer_frequency(t, sample_rate);
+    t->COUNT16.CTRLBSET.reg = TC_CTRLBSET_CMD_STOP;
+    self->tc_index = tc_index;
+
+    // Connect the timer overflow event to the conversion start of the ADC.
+    #ifdef SAMD21
+    connect_event_user_to_channel(EVSYS_ID_USER_ADC_START, channel);
+    #endif
+    #ifdef SAMD51
+    connect_event_user_to_channel(adc_index == 0 ? EVSYS_ID_USER_ADC0_START : EVSYS_ID_USER_ADC1_START,
+                                  channel);
+    #endif
+    init_async_event_channel(channel, FIRST_TC_GEN_ID + 3 * tc_index);
+    self->tc_event_channel = channel;
+
+    claim_pin(pin);
+    gpio_set_pin_function(pin->number, GPIO_PIN_FUNCTION_B);
+
+    static Adc* adc_insts[] = ADC_INSTS;
+    self->instance = adc_insts[adc_index];
+    self->adc_index = adc_index;
+    self->channel = adc_channel;
+    self->pin = pin;
+    self->oversample_shift = 0;
+    while ((1 << self->oversample_shift) < oversample) {
+        self->oversample_shift++;
+    }
+    self->blocks = NULL;
+    self->second_descriptor = NULL;
+    self->ring = NULL;
+    self->ring_size = 0;
+    self->ring_head = 0;
+    self->ring_tail = 0;
+    self->overflows = 0;
+}
+
+bool common_hal_analogbufio_bufferedin_deinited(analogbufio_bufferedin_obj_t *self) {
+    return self->pin == mp_const_none;
+}
+
+void common_hal_analogbufio_bufferedin_deinit(analogbufio_bufferedin_obj_t *self) {
+    if (common_hal_analogbufio_bufferedin_deinited(self)) {
+        return;
+    }
+    common_hal_analogbufio_bufferedin_stop(self);
+    self->ring = NULL;
+    self->ring_size = 0;
+
+    disable_event_channel(self->tc_event_channel);
+    tc_set_enable(tc_insts[self->tc_index], false);
+
+    reset_pin_number(self->pin->number);
+    self->pin = mp_const_none;
+}
+
+uint32_t common_hal_analogbufio_bufferedin_get_sample_rate(analogbufio_bufferedin_obj_t *self) {
+    return self->sample_rate;
+}
+
+static void wait_for_adc_sync(Adc* adc) {
+    #ifdef SAMD21
+    while (adc->STATUS.bit.SYNCBUSY == 1) {}
+    #endif
+    #ifdef SAMD51
+    while (adc->SYNCBUSY.reg != 0) {}
+    #endif
+}
+
+// AnalogIn sets the ADC up its own way on every read, so set it up again before each run.
+static void configure_adc(analogbufio_bufferedin_obj_t* self) {
+    Adc* adc = self->instance;
+    samd_peripherals_adc_setup(&self->adc, adc);
+
+    // Full scale is 3.3V (VDDANA) like AnalogIn.
+    adc_sync_set_reference(&self->adc, ADC_REFCTRL_REFSEL_INTVCC1_Val);
+    #ifdef SAMD21
+    adc_sync_set_channel_gain(&self->adc, self->channel, ADC_INPUTCTRL_GAIN_DIV2_Val);
+    #endif
+
+    if (self->oversample_shift == 0) {
+        adc_sync_set_resolution(&self->adc, ADC_CTRLB_RESSEL_12BIT_Val);
+    } else {
+        // Sum the conversions without shifting. Up to 16 12-bit results fit in 16 bits.
+        adc_sync_set_resolution(&self->adc, ADC_CTRLB_RESSEL_16BIT_Val);
+        adc->AVGCTRL.reg = ADC_AVGCTRL_SAMPLENUM(self->oversample_shift) | ADC_AVGCTRL_ADJRES(0);
+        wait_for_adc_sync(adc);
+    }
+
+    // Run the ADC clock fast enough for MAX_CONVERSION_RATE. These are enable protected.
+    #ifdef SAMD21
+    adc->CTRLB.bit.PRESCALER = ADC_CTRLB_PRESCALER_DIV32_Val;
+    #endif
+    #ifdef SAMD51
+    adc->CTRLA.bit.PRESCALER = ADC_CTRLA_PRESCALER_DIV8_Val;
+    #endif
+    adc->EVCTRL.reg = ADC_EVCTRL_STARTEI;
+    wait_for_adc_sync(adc);
+
+    adc_sync_enable_channel(&self->adc, self->channel);
+    // We need to set the inputs because the above channel enable only enables the ADC.
+    adc_sync_set_inputs(&self->adc, self->channel, ADC_INPUTCTRL_MUXNEG_GND_Val, self->channel);
+    wait_for_adc_sync(adc);
+
+    // Discard the first conversion after the configuration changes, as AnalogIn does. The DMA
+    // isn't triggered by it because it is set up afterwards.
+    uint16_t value;
+    adc_sync_read_channel(&self->adc, self->channel, ((uint8_t*) &value), 2);
+}
+
+static uint8_t result_trigger(analogbufio_bufferedin_obj_t* self) {
+    #ifdef SAMD21
+    return ADC_DMAC_ID_RESRDY;
+    #endif
+    #ifdef SAMD51
+    return self->adc_index == 0 ? ADC0_DMAC_ID_RESRDY : ADC1_DMAC_ID_RESRDY;
+    #endif
+}
+
+static void setup_descriptor(analogbufio_bufferedin_obj_t* self, DmacDescriptor* descriptor,
+                             uint16_t* destination, uint32_t count, uint32_t event_output,
+                             DmacDescriptor* next) {
+    descriptor->BTCTRL.reg = DMAC_BTCTRL_VALID |
+                             DMAC_BTCTRL_BLOCKACT_NOACT |
+                             event_output |
+                             DMAC_BTCTRL_DSTINC |
+                             DMAC_BTCTRL_BEATSIZE_HWORD;
+    descriptor->BTCNT.reg = count;
+    descriptor->SRCADDR.reg = (uint32_t) &self->instance->RESULT.reg;
+    // The destination address is the end of the block when it increments.
+    descriptor->DSTADDR.reg = (uint32_t) (destination + count);
+    descriptor->DESCADDR.reg = (uint32_t) next;
+}
+
+static void start_timer(analogbufio_bufferedin_obj_t* self) {
+    Tc* timer = tc_insts[self->tc_index];
+    timer->COUNT16.CTRLBSET.reg = TC_CTRLBSET_CMD_RETRIGGER;
+    while (timer->COUNT16.STATUS.bit.STOP == 1) {}
+}
+
+static void stop_sampling(analogbufio_bufferedin_obj_t* self) {
+    tc_insts[self->tc_index]->COUNT16.CTRLBSET.reg = TC_CTRLBSET_CMD_STOP;
+    adc_sync_deinit(&self->adc);
+}
+
+// Shifts the results up so full scale is 65535 like AnalogIn.value.
+static inline uint16_t scale_result(analogbufio_bufferedin_obj_t* self, uint16_t result) {
+    return result << (4 - self->oversample_shift);
+}
+
+uint32_t common_hal_analogbufio_bufferedin_record(analogbufio_bufferedin_obj_t* self,
+        uint16_t* buffer, uint32_t length) {
+    analogbufio_bufferedin_obj_t* sampling = MP_STATE_PORT(sampling_bufferedin);
+    if (sampling != NULL && sampling->instance == self->instance) {
+        mp_raise_RuntimeError(translate("Already recording"));
+    }
+    if (length == 0) {
+        return 0;
+    }
+    // Allocate before claiming the DMA channel so a MemoryError doesn't leak it.
+    uint32_t descriptor_count = (length + MAX_SAMPLES_PER_DESCRIPTOR - 1) / MAX_SAMPLES_PER_DESCRIPTOR;
+    DmacDescriptor* more_descriptors = NULL;
+    if (descriptor_count > 1) {
+        more_descriptors = m_malloc((descriptor_count - 1) * sizeof(DmacDescriptor), false);
+    }
+
+    uint8_t dma_channel = audio_dma_allocate_channel();
+    if (dma_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        m_free(more_descriptors);
+        mp_raise_RuntimeError(translate("No DMA channel found"));
+    }
+
+    // The results go straight into the buffer, chaining descriptors when there are too many
+    // for one.
+    DmacDescriptor* descriptor = dma_descriptor(dma_channel);
+    uint32_t offset = 0;
+    for (uint32_t i = 0; i < descriptor_count; i++) {
+        uint32_t count = MIN(length - offset, MAX_SAMPLES_PER_DESCRIPTOR);
+        DmacDescriptor* next = i + 1 < descriptor_count ? &more_descriptors[i] : NULL;
+        setup_descriptor(self, descriptor, buffer + offset, count, DMAC_BTCTRL_EVOSEL_DISABLE, next);
+        offset += count;
+        descriptor = next;
+    }
+
+    configure_adc(self);
+    dma_configure(dma_channel, result_trigger(self), false);
+    audio_dma_enable_channel(dma_channel);
+    start_timer(self);
+
+    uint32_t status;
+    do {
+        RUN_BACKGROUND_TASKS;
+        status = dma_transfer_status(dma_channel);
+    } while ((status & (DMAC_CHINTFLAG_TCMPL | DMAC_CHINTFLAG_TERR)) == 0 && !mp_hal_is_interrupted());
+
+    stop_sampling(self);
+    audio_dma_free_channel(dma_channel);
+    m_free(more_descriptors);
+
+    if ((status & DMAC_CHINTFLAG_TCMPL) == 0) {
+        // Interrupted or the transfer failed, so the buffer is only partly filled.
+        return 0;
+    }
+    for (uint32_t i = 0; i < length; i++) {
+        buffer[i] = scale_result(self, buffer[i]);
+    }
+    return length;
+}
+
+bool common_hal_analogbufio_bufferedin_get_sampling(analogbufio_bufferedin_obj_t* self) {
+    return MP_STATE_PORT(sampling_bufferedin) == self;
+}
+
+void common_hal_analogbufio_bufferedin_start(analogbufio_bufferedin_obj_t* self, uint32_t buffer_length) {
+    // Only one BufferedIn samples continuously at a time.
+    if (MP_STATE_PORT(sampling_bufferedin) != NULL) {
+        mp_raise_RuntimeError(translate("Already recording"));
+    }
+
+    // Allocate everything before claiming channels so a MemoryError doesn't leak them. The
+    // ring has one spare slot so that full and empty can be told apart.
+    m_free(self->ring);
+    self->ring = NULL;
+    self->ring_size = buffer_length + 1;
+    self->ring = m_malloc(self->ring_size * sizeof(uint16_t), false);
+    self->ring_head = 0;
+    self->ring_tail = 0;
+    self->overflows = 0;
+    self->blocks = m_malloc(2 * SAMPLES_PER_STREAM_BLOCK * sizeof(uint16_t), false);
+    self->second_descriptor = (DmacDescriptor*) m_malloc(sizeof(DmacDescriptor), false);
+
+    self->dma_channel = audio_dma_allocate_channel();
+    if (self->dma_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        common_hal_analogbufio_bufferedin_stop(self);
+        mp_raise_RuntimeError(translate("No DMA channel found"));
+    }
+    self->event_channel = find_sync_event_channel();
+    if (self->event_channel >= EVSYS_SYNCH_NUM) {
+        audio_dma_free_channel(self->dma_channel);
+        common_hal_analogbufio_bufferedin_stop(self);
+        mp_raise_RuntimeError(translate("All sync event channels in use"));
+    }
+
+    // Two blocks chain back to each other so the DMA never stops.
+    DmacDescriptor* first_descriptor = dma_descriptor(self->dma_channel);
+    setup_descriptor(self, first_descriptor, self->blocks, SAMPLES_PER_STREAM_BLOCK,
+                     DMAC_BTCTRL_EVOSEL_BLOCK, self->second_descriptor);
+    setup_descriptor(self, self->second_descriptor, self->blocks + SAMPLES_PER_STREAM_BLOCK,
+                     SAMPLES_PER_STREAM_BLOCK, DMAC_BTCTRL_EVOSEL_BLOCK, first_descriptor);
+    self->next_block = 0;
+
+    configure_adc(self);
+    dma_configure(self->dma_channel, result_trigger(self), true);
+    init_event_channel_interrupt(self->event_channel, CORE_GCLK, EVSYS_ID_GEN_DMAC_CH_0 + self->dma_channel);
+    MP_STATE_PORT(sampling_bufferedin) = self;
+    audio_dma_enable_event_interrupt(self->event_channel, true);
+    audio_dma_enable_channel(self->dma_channel);
+    start_timer(self);
+}
+
+void common_hal_analogbufio_bufferedin_stop(analogbufio_bufferedin_obj_t* self) {
+    if (common_hal_analogbufio_bufferedin_get_sampling(self)) {
+        stop_sampling(self);
+        audio_dma_enable_event_interrupt(self->event_channel, false);
+        MP_STATE_PORT(sampling_bufferedin) = NULL;
+        audio_dma_disable_channel(self->dma_channel);
+        disable_event_channel(self->event_channel);
+        audio_dma_free_channel(self->dma_channel);
+    }
+    // Keep the ring so that readinto can still collect what was sampled.
+    m_free(self->blocks);
+    self->blocks = NULL;
+    m_free(self->second_descriptor);
+    self->second_descriptor = NULL;
+}
+
+uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t* self,
+        uint16_t* buffer, uint32_t length) {
+    if (self->ring == NULL) {
+        return 0;
+    }
+    uint32_t tail = self->ring_tail;
+    uint32_t head = self->ring_head;
+    uint32_t available = (head + self->ring_size - tail) % self->ring_size;
+    uint32_t count = MIN(available, length);
+    // Copy in at most two pieces, up to the end of the ring and then from its start.
+    uint32_t first = MIN(count, self->ring_size - tail);
+    memcpy(buffer, self->ring + tail, first * sizeof(uint16_t));
+    memcpy(buffer + first, self->ring, (count - first) * sizeof(uint16_t));
+    // Finish reading the samples before handing their slots back to the interrupt.
+    __asm volatile ("" : : : "memory");
+    self->ring_tail = (tail + count) % self->ring_size;
+    return count;
+}
+
+uint32_t common_hal_analogbufio_bufferedin_get_overflows(analogbufio_bufferedin_obj_t* self) {
+    return self->overflows;
+}
+
+// Copies one finished block into the ring. Samples that don't fit are dropped.
+static void bufferedin_copy_block(analogbufio_bufferedin_obj_t* self, uint16_t* block) {
+    uint32_t head = self->ring_head;
+    uint32_t tail = self->ring_tail;
+    uint32_t i;
+    for (i = 0; i < SAMPLES_PER_STREAM_BLOCK; i++) {
+        uint32_t next = head + 1;
+        if (next == self->ring_size) {
+            next = 0;
+        }
+        if (next == tail) {
+            break;
+        }
+        self->ring[head] = scale_result(self, block[i]);
+        head = next;
+    }
+    self->overflows += SAMPLES_PER_STREAM_BLOCK - i;
+    // Store the samples before readinto can see them.
+    __asm volatile ("" : : : "memory");
+    self->ring_head = head;
+}
+
+// Called from the event system interrupt shared with audio_dma.c.
+void bufferedin_event_handler(void) {
+    analogbufio_bufferedin_obj_t* self = MP_STATE_PORT(sampling_bufferedin);
+    if (self == NULL || !event_interrupt_active(self->event_channel)) {
+        return;
+    }
+    if (event_interrupt_overflow(self->event_channel)) {
+        // The other block finished too before we got here, so the DMA is already writing over
+        // the block we were due to copy. Drop it and take the newer one.
+        self->overflows += SAMPLES_PER_STREAM_BLOCK;
+        self->next_block ^= 1;
+    }
+    bufferedin_copy_block(self, self->blocks + self->next_block * SAMPLES_PER_STREAM_BLOCK);
+    self->next_block ^= 1;
+}
+
+void bufferedin_reset_sampling(void) {
+    analogbufio_bufferedin_obj_t* self = MP_STATE_PORT(sampling_bufferedin);
+    if (self != NULL) {
+        audio_dma_enable_event_interrupt(self->event_channel, false);
+        audio_dma_disable_channel(self->dma_channel);
+        disable_event_channel(self->event_channel);
+        audio_dma_free_channel(self->dma_channel);
+    }
+    MP_STATE_PORT(sampling_bufferedin) = NULL;
+}
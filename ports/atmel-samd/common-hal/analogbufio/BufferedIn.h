@@ -0,0 +1,65 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_ATMEL_SAMD_COMMON_HAL_ANALOGBUFIO_BUFFEREDIN_H
+#define MICROPY_INCLUDED_ATMEL_SAMD_COMMON_HAL_ANALOGBUFIO_BUFFEREDIN_H
+
+#include "common-hal/microcontroller/Pin.h"
+
+#include "hal/include/hal_adc_sync.h"
+#include "py/obj.h"
+
+typedef struct {
+    mp_obj_base_t base;
+    const mcu_pin_obj_t * pin;
+    Adc* instance;
+    struct adc_sync_descriptor adc;
+    uint8_t adc_index;
+    uint8_t channel;
+    // log2 of the number of conversions summed into each sample.
+    uint8_t oversample_shift;
+    uint8_t tc_index;
+    uint8_t tc_event_channel;
+    uint32_t sample_rate;
+    // Continuous sampling started with start(). The DMA loops over two blocks of results and
+    // the block done event copies each finished block into the ring. The interrupt only moves
+    // ring_head and readinto only moves ring_tail.
+    uint8_t dma_channel;
+    uint8_t event_channel;
+    uint8_t next_block;
+    uint16_t* blocks;
+    DmacDescriptor* second_descriptor;
+    uint16_t* ring;
+    uint32_t ring_size;
+    volatile uint32_t ring_head;
+    volatile uint32_t ring_tail;
+    volatile uint32_t overflows;
+} analogbufio_bufferedin_obj_t;
+
+void bufferedin_reset_sampling(void);
+void bufferedin_event_handler(void);
+
+#endif // MICROPY_INCLUDED_ATMEL_SAMD_COMMON_HAL_ANALOGBUFIO_BUFFEREDIN_H
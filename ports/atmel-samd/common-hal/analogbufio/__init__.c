@@ -0,0 +1 @@
+// No analogbufio module functions.
@@ -384,3 +384,8 @@ bool common_hal_audiobusio_i2sout_get_playing(audiobusio_i2sout_obj_t* self) {
     }
     return still_playing;
 }
+
+void common_hal_audiobusio_i2sout_get_stats(audiobusio_i2sout_obj_t* self,
+                                            audioio_output_stats_t* stats) {
+    *stats = self->dma.stats;
+}
@@ -53,6 +53,9 @@
 
 #define OVERSAMPLING 64
 #define SAMPLES_PER_BUFFER 32
+// Samples in each of the two DMA blocks used by start(). The event interrupt filters one block
+// every 4ms at 16kHz.
+#define SAMPLES_PER_STREAM_BLOCK 64
 
 // MEMS microphones must be clocked at at least 1MHz.
 #define MIN_MIC_CLOCK 1000000
@@ -216,6 +219,13 @@ void common_hal_audiobusio_pdmin_construct(audiobusio_pdmin_obj_t* self,
 
     self->bytes_per_sample = oversample >> 3;
     self->bit_depth = bit_depth;
+    self->pdm_blocks = NULL;
+    self->second_descriptor = NULL;
+    self->ring = NULL;
+    self->ring_size = 0;
+    self->ring_head = 0;
+    self->ring_tail = 0;
+    self->overflows = 0;
 }
 
 bool common_hal_audiobusio_pdmin_deinited(audiobusio_pdmin_obj_t* self) {
@@ -227,6 +237,10 @@ void common_hal_audiobusio_pdmin_deinit(audiobusio_pdmin_obj_t* self) {
         return;
     }
 
+    common_hal_audiobusio_pdmin_stop(self);
+    self->ring = NULL;
+    self->ring_size = 0;
+
     i2s_set_serializer_enable(self->serializer, false);
     i2s_set_clock_unit_enable(self->clock_unit, false);
 
@@ -471,6 +485,164 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t* se
     return values_output;
 }
 
+bool common_hal_audiobusio_pdmin_get_recording(audiobusio_pdmin_obj_t* self) {
+    return MP_STATE_PORT(recording_pdmin) == self;
+}
+
+void common_hal_audiobusio_pdmin_start(audiobusio_pdmin_obj_t* self, uint32_t buffer_length) {
+    // There is only one recording peripheral.
+    if (MP_STATE_PORT(recording_pdmin) != NULL) {
+        mp_raise_RuntimeError(translate("Already recording"));
+    }
+    uint8_t bytes_per_output = self->bit_depth / 8;
+    uint8_t words_per_sample = self->bytes_per_sample / 2;
+    uint32_t words_per_block = SAMPLES_PER_STREAM_BLOCK * words_per_sample;
+
+    // Allocate everything before claiming channels so a MemoryError doesn't leak them. The
+    // ring has one spare slot so that full and empty can be told apart.
+    m_free(self->ring);
+    self->ring = NULL;
+    self->ring_size = buffer_length + 1;
+    self->ring = m_malloc(self->ring_size * bytes_per_output, false);
+    self->ring_head = 0;
+    self->ring_tail = 0;
+    self->overflows = 0;
+    self->pdm_blocks = m_malloc(2 * words_per_block * sizeof(uint32_t), false);
+    self->second_descriptor = (DmacDescriptor*) m_malloc(sizeof(DmacDescriptor), false);
+
+    self->dma_channel = audio_dma_allocate_channel();
+    if (self->dma_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        common_hal_audiobusio_pdmin_stop(self);
+        mp_raise_RuntimeError(translate("No DMA channel found"));
+    }
+    self->event_channel = find_sync_event_channel();
+    if (self->event_channel >= EVSYS_SYNCH_NUM) {
+        audio_dma_free_channel(self->dma_channel);
+        common_hal_audiobusio_pdmin_stop(self);
+        mp_raise_RuntimeError(translate("All sync event channels in use"));
+    }
+
+    turn_on_event_system();
+
+    // Two full blocks chain back to each other so the DMA never stops.
+    setup_dma(self, 2 * SAMPLES_PER_STREAM_BLOCK, dma_descriptor(self->dma_channel),
+              self->second_descriptor, words_per_block, words_per_sample,
+              self->pdm_blocks, self->pdm_blocks + words_per_block);
+    self->next_block = 0;
+
+    uint8_t trigger_source = I2S_DMAC_ID_RX_0;
+    #ifdef SAMD21
+    trigger_source += self->serializer;
+    #endif
+
+    dma_configure(self->dma_channel, trigger_source, true);
+    init_event_channel_interrupt(self->event_channel, CORE_GCLK, EVSYS_ID_GEN_DMAC_CH_0 + self->dma_channel);
+    MP_STATE_PORT(recording_pdmin) = self;
+    audio_dma_enable_event_interrupt(self->event_channel, true);
+    // Turn on serializer now to get it in sync with DMA.
+    i2s_set_serializer_enable(self->serializer, true);
+    audio_dma_enable_channel(self->dma_channel);
+}
+
+void common_hal_audiobusio_pdmin_stop(audiobusio_pdmin_obj_t* self) {
+    if (common_hal_audiobusio_pdmin_get_recording(self)) {
+        audio_dma_enable_event_interrupt(self->event_channel, false);
+        MP_STATE_PORT(recording_pdmin) = NULL;
+        audio_dma_disable_channel(self->dma_channel);
+        disable_event_channel(self->event_channel);
+        audio_dma_free_channel(self->dma_channel);
+        // Turn off serializer, but leave clock on, to avoid mic startup delay.
+        i2s_set_serializer_enable(self->serializer, false);
+    }
+    // Keep the ring so that readinto can still collect what was recorded.
+    m_free(self->pdm_blocks);
+    self->pdm_blocks = NULL;
+    m_free(self->second_descriptor);
+    self->second_descriptor = NULL;
+}
+
+uint32_t common_hal_audiobusio_pdmin_readinto(audiobusio_pdmin_obj_t* self,
+        void* buffer, uint32_t length) {
+    if (self->ring == NULL) {
+        return 0;
+    }
+    uint8_t bytes_per_output = self->bit_depth / 8;
+    uint32_t tail = self->ring_tail;
+    uint32_t head = self->ring_head;
+    uint32_t available = (head + self->ring_size - tail) % self->ring_size;
+    uint32_t count = MIN(available, length);
+    // Copy in at most two pieces, up to the end of the ring and then from its start.
+    uint32_t first = MIN(count, self->ring_size - tail);
+    memcpy(buffer, self->ring + tail * bytes_per_output, first * bytes_per_output);
+    memcpy((uint8_t*) buffer + first * bytes_per_output, self->ring,
+           (count - first) * bytes_per_output);
+    // Finish reading the samples before handing their slots back to the interrupt.
+    __asm volatile ("" : : : "memory");
+    self->ring_tail = (tail + count) % self->ring_size;
+    return count;
+}
+
+uint32_t common_hal_audiobusio_pdmin_get_overflows(audiobusio_pdmin_obj_t* self) {
+    return self->overflows;
+}
+
+// Filters one finished block into the ring. Samples that don't fit are dropped.
+static void pdmin_filter_block(audiobusio_pdmin_obj_t* self, uint32_t* block) {
+    uint8_t words_per_sample = self->bytes_per_sample / 2;
+    uint32_t head = self->ring_head;
+    uint32_t tail = self->ring_tail;
+    uint32_t i;
+    for (i = 0; i < SAMPLES_PER_STREAM_BLOCK; i++) {
+        uint32_t next = head + 1;
+        if (next == self->ring_size) {
+            next = 0;
+        }
+        if (next == tail) {
+            break;
+        }
+        uint16_t value = filter_sample(block + i * words_per_sample);
+        if (self->bit_depth == 8) {
+            self->ring[head] = value >> 8;
+        } else {
+            ((uint16_t*) self->ring)[head] = value;
+        }
+        head = next;
+    }
+    self->overflows += SAMPLES_PER_STREAM_BLOCK - i;
+    // Store the samples before readinto can see them.
+    __asm volatile ("" : : : "memory");
+    self->ring_head = head;
+}
+
+// Called from the event system interrupt shared with audio_dma.c.
+void pdmin_event_handler(void) {
+    audiobusio_pdmin_obj_t* self = MP_STATE_PORT(recording_pdmin);
+    if (self == NULL || !event_interrupt_active(self->event_channel)) {
+        return;
+    }
+    uint32_t words_per_block = SAMPLES_PER_STREAM_BLOCK * (self->bytes_per_sample / 2);
+    if (event_interrupt_overflow(self->event_channel)) {
+        // The other block finished too before we got here, so the DMA is already writing over
+        // the block we were due to filter. Drop it and take the newer one.
+        self->overflows += SAMPLES_PER_STREAM_BLOCK;
+        self->next_block ^= 1;
+    }
+    pdmin_filter_block(self, self->pdm_blocks + self->next_block * words_per_block);
+    self->next_block ^= 1;
+}
+
+void pdmin_reset_recording(void) {
+    audiobusio_pdmin_obj_t* self = MP_STATE_PORT(recording_pdmin);
+    if (self != NULL) {
+        audio_dma_enable_event_interrupt(self->event_channel, false);
+        audio_dma_disable_channel(self->dma_channel);
+        disable_event_channel(self->event_channel);
+        audio_dma_free_channel(self->dma_channel);
+        i2s_set_serializer_enable(self->serializer, false);
+    }
+    MP_STATE_PORT(recording_pdmin) = NULL;
+}
+
 void common_hal_audiobusio_pdmin_record_to_file(audiobusio_pdmin_obj_t* self, uint8_t* buffer, uint32_t length) {
 
 }
@@ -42,9 +42,24 @@ typedef struct {
     uint8_t bytes_per_sample;
     uint8_t bit_depth;
     uint8_t gclk;
+    // Continuous recording started with start(). The DMA loops over two blocks of PDM words and
+    // the block done event filters each finished block into the ring. The interrupt only moves
+    // ring_head and readinto only moves ring_tail.
+    uint8_t dma_channel;
+    uint8_t event_channel;
+    uint8_t next_block;
+    uint32_t* pdm_blocks;
+    DmacDescriptor* second_descriptor;
+    uint8_t* ring;
+    uint32_t ring_size;
+    volatile uint32_t ring_head;
+    volatile uint32_t ring_tail;
+    volatile uint32_t overflows;
 } audiobusio_pdmin_obj_t;
 
 void pdmin_reset(void);
+void pdmin_reset_recording(void);
+void pdmin_event_handler(void);
 
 void pdmin_background(void);
 
@@ -229,7 +229,7 @@ void common_hal_audioio_audioout_construct(audioio_audioout_obj_t* self,
     Tc *t = NULL;
     uint8_t tc_index = TC_INST_NUM;
     for (uint8_t i = TC_INST_NUM; i > 0; i--) {
-        if (tc_insts[i - 1]->COUNT16.CTRLA.bit.ENABLE == 0) {
+        if (tc_is_free(i - 1)) {
             t = tc_insts[i - 1];
             tc_index = i - 1;
             break;
@@ -471,3 +471,13 @@ bool common_hal_audioio_audioout_get_playing(audioio_audioout_obj_t* self) {
     }
     return now_playing;
 }
+
+void common_hal_audioio_audioout_get_stats(audioio_audioout_obj_t* self,
+                                           audioio_output_stats_t* stats) {
+    *stats = self->left_dma.stats;
+    #ifdef SAMD51
+    if (self->right_channel != NULL) {
+        audioio_output_stats_merge(stats, &self->right_dma.stats);
+    }
+    #endif
+}
@@ -34,8 +34,14 @@
 
 #include "samd/sercom.h"
 #include "shared-bindings/microcontroller/__init__.h"
+#include "supervisor/shared/tick.h"
 #include "supervisor/shared/translate.h"
 
+#ifdef SAMD51
+#include "audio_dma.h"
+#include "samd/dma.h"
+#endif
+
 #include "common-hal/busio/SPI.h" // for never_reset_sercom
 
 // Number of times to try to send packet if failed.
@@ -206,8 +212,86 @@ uint8_t common_hal_busio_i2c_write(busio_i2c_obj_t *self, uint16_t addr,
     return MP_EIO;
 }
 
+#ifdef SAMD51
+// Reads at least this long are moved by the DMA instead of a byte at a time by the CPU. The
+// SERCOM counts at most 255 bytes per transaction.
+#define DMA_MIN_READ 16
+#define DMA_MAX_READ 255
+// 255 bytes take about 23ms at 100kHz.
+#define DMA_TIMEOUT_MS 50
+
+static void i2c_stop(Sercom* sercom) {
+    if (sercom->I2CM.STATUS.bit.BUSSTATE == 2) {
+        sercom->I2CM.CTRLB.reg |= SERCOM_I2CM_CTRLB_ACKACT | SERCOM_I2CM_CTRLB_CMD(3);
+        while (sercom->I2CM.SYNCBUSY.bit.SYSOP) {}
+    }
+}
+
+// The SERCOM counts the bytes and NACKs the last one itself, and smart mode acks the others as
+// the DMA reads them, so the CPU only starts and stops the transaction. Returns false when no
+// channel is free.
+static bool read_with_dma(busio_i2c_obj_t *self, uint16_t addr, uint8_t *data, size_t len, uint8_t *status) {
+    uint8_t channel = audio_dma_allocate_channel();
+    if (channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        return false;
+    }
+    Sercom* sercom = self->i2c_desc.device.hw;
+    uint8_t sercom_index = 0;
+    while (sercom_index < SERCOM_INST_NUM && sercom_insts[sercom_index] != sercom) {
+        sercom_index++;
+    }
+
+    DmacDescriptor* descriptor = dma_descriptor(channel);
+    descriptor->BTCTRL.reg = DMAC_BTCTRL_VALID |
+                             DMAC_BTCTRL_BLOCKACT_NOACT |
+                             DMAC_BTCTRL_BEATSIZE_BYTE |
+                             DMAC_BTCTRL_DSTINC;
+    descriptor->BTCNT.reg = len;
+    descriptor->SRCADDR.reg = (uint32_t) &sercom->I2CM.DATA.reg;
+    descriptor->DSTADDR.reg = ((uint32_t) data) + len;
+    descriptor->DESCADDR.reg = 0;
+    dma_configure(channel, SERCOM0_DMAC_ID_RX + 2 * sercom_index, false);
+    dma_enable_channel(channel);
+
+    bool smart_mode = sercom->I2CM.CTRLB.bit.SMEN;
+    sercom->I2CM.CTRLB.reg = (sercom->I2CM.CTRLB.reg | SERCOM_I2CM_CTRLB_SMEN) & ~SERCOM_I2CM_CTRLB_ACKACT;
+    while (sercom->I2CM.SYNCBUSY.bit.SYSOP) {}
+    sercom->I2CM.INTFLAG.reg = SERCOM_I2CM_INTFLAG_MB | SERCOM_I2CM_INTFLAG_ERROR;
+    sercom->I2CM.ADDR.reg = SERCOM_I2CM_ADDR_ADDR((addr << 1) | 1) |
+                            SERCOM_I2CM_ADDR_LENEN |
+                            SERCOM_I2CM_ADDR_LEN(len);
+    while (sercom->I2CM.SYNCBUSY.bit.SYSOP) {}
+
+    *status = 0;
+    uint64_t start_ticks = supervisor_ticks_ms64();
+    while ((dma_transfer_status(channel) & (DMAC_CHINTFLAG_TCMPL | DMAC_CHINTFLAG_TERR)) == 0) {
+        // MB is only set on a read when the address isn't acknowledged.
+        if (sercom->I2CM.INTFLAG.bit.MB == 1) {
+            *status = sercom->I2CM.STATUS.bit.RXNACK == 1 ? MP_ENODEV : MP_EIO;
+            break;
+        }
+        if (sercom->I2CM.INTFLAG.bit.ERROR == 1 || supervisor_ticks_ms64() - start_ticks > DMA_TIMEOUT_MS) {
+            *status = MP_EIO;
+            break;
+        }
+    }
+    i2c_stop(sercom);
+
+    sercom->I2CM.CTRLB.bit.SMEN = smart_mode;
+    while (sercom->I2CM.SYNCBUSY.bit.SYSOP) {}
+    audio_dma_free_channel(channel);
+    return true;
+}
+#endif
+
 uint8_t common_hal_busio_i2c_read(busio_i2c_obj_t *self, uint16_t addr,
         uint8_t *data, size_t len) {
+    #ifdef SAMD51
+    uint8_t dma_status;
+    if (len >= DMA_MIN_READ && len <= DMA_MAX_READ && read_with_dma(self, addr, data, len, &dma_status)) {
+        return dma_status;
+    }
+    #endif
 
     uint16_t attempts = ATTEMPTS;
     int32_t status;
@@ -37,6 +37,7 @@
 #include "hal/include/hal_spi_m_sync.h"
 #include "hal/include/hpl_spi_m_sync.h"
 #include "supervisor/shared/rgb_led_status.h"
+#include "audio_dma.h"
 
 #include "samd/dma.h"
 #include "samd/sercom.h"
@@ -208,6 +209,8 @@ void common_hal_busio_spi_construct(busio_spi_obj_t *self,
     gpio_set_pin_function(clock->number, clock_pinmux);
     claim_pin(clock);
     self->clock_pin = clock->number;
+    self->tx_dma_channel = AUDIO_DMA_CHANNEL_COUNT;
+    self->rx_dma_channel = AUDIO_DMA_CHANNEL_COUNT;
 
     if (mosi_none) {
         self->MOSI_pin = NO_PIN;
@@ -248,6 +251,7 @@ void common_hal_busio_spi_deinit(busio_spi_obj_t *self) {
     if (common_hal_busio_spi_deinited(self)) {
         return;
     }
+    while (!common_hal_busio_spi_transfer_done(self)) {}
     allow_reset_sercom(self->spi_desc.dev.prvt);
 
     spi_m_sync_disable(&self->spi_desc);
@@ -358,6 +362,161 @@ bool common_hal_busio_spi_transfer(busio_spi_obj_t *self, uint8_t *data_out, uin
     return status >= 0; // Status is number of chars read or an error code < 0.
 }
 
+static uint8_t sercom_index(Sercom* sercom) {
+    uint8_t i;
+    for (i = 0; i < SERCOM_INST_NUM; i++) {
+        if (sercom_insts[i] == sercom) {
+            break;
+        }
+    }
+    return i;
+}
+
+static void setup_dma_descriptor(DmacDescriptor* descriptor, const volatile void* src, bool src_increment,
+                                 volatile void* dst, bool dst_increment, size_t len) {
+    descriptor->BTCTRL.reg = DMAC_BTCTRL_VALID |
+                             DMAC_BTCTRL_BLOCKACT_NOACT |
+                             DMAC_BTCTRL_BEATSIZE_BYTE |
+                             (src_increment ? DMAC_BTCTRL_SRCINC : 0) |
+                             (dst_increment ? DMAC_BTCTRL_DSTINC : 0);
+    descriptor->BTCNT.reg = len;
+    // Incrementing addresses point at the end of the block.
+    descriptor->SRCADDR.reg = ((uint32_t) src) + (src_increment ? len : 0);
+    descriptor->DSTADDR.reg = ((uint32_t) dst) + (dst_increment ? len : 0);
+    descriptor->DESCADDR.reg = 0;
+}
+
+// Each segment gets its own descriptor, linked to the next, so the DMA moves straight from one
+// buffer to the next without the CPU.
+bool common_hal_busio_spi_write_segments(busio_spi_obj_t *self, const busio_spi_segment_t *segments, size_t count) {
+    size_t used = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (segments[i].len > 0xffff) {
+            used = 0;
+            break;
+        }
+        if (segments[i].len > 0) {
+            used++;
+        }
+    }
+    uint8_t channel = AUDIO_DMA_CHANNEL_COUNT;
+    if (used > 1) {
+        channel = audio_dma_allocate_channel();
+    }
+    if (channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        for (size_t i = 0; i < count; i++) {
+            if (!common_hal_busio_spi_write(self, segments[i].data, segments[i].len)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    Sercom* sercom = self->spi_desc.dev.prvt;
+    // The first descriptor lives in the channel's slot and the rest are linked from it. Heap
+    // blocks are 16 byte aligned as the DMAC needs.
+    DmacDescriptor* linked = m_new(DmacDescriptor, used - 1);
+    DmacDescriptor* descriptor = dma_descriptor(channel);
+    size_t next = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (segments[i].len == 0) {
+            continue;
+        }
+        setup_dma_descriptor(descriptor, segments[i].data, true, &sercom->SPI.DATA.reg, false, segments[i].len);
+        if (next < used - 1) {
+            descriptor->DESCADDR.reg = (uint32_t) &linked[next];
+            descriptor = &linked[next];
+            next++;
+        }
+    }
+
+    sercom->SPI.INTFLAG.reg = SERCOM_SPI_INTFLAG_TXC;
+    dma_configure(channel, SERCOM0_DMAC_ID_TX + 2 * sercom_index(sercom), false);
+    dma_enable_channel(channel);
+    uint8_t status;
+    do {
+        status = dma_transfer_status(channel);
+    } while ((status & (DMAC_CHINTFLAG_TCMPL | DMAC_CHINTFLAG_TERR)) == 0);
+    // The last byte is still being clocked out when the DMA is done with it.
+    while (sercom->SPI.INTFLAG.bit.TXC == 0) {}
+    // Nothing reads what came in so drop it and the overflow it caused.
+    while (sercom->SPI.INTFLAG.bit.RXC == 1) {
+        (void) sercom->SPI.DATA.reg;
+    }
+    sercom->SPI.STATUS.reg = SERCOM_SPI_STATUS_BUFOVF;
+
+    audio_dma_free_channel(channel);
+    m_del(DmacDescriptor, linked, used - 1);
+    return (status & DMAC_CHINTFLAG_TERR) == 0;
+}
+
+// The DMA moves every byte between the buffers and the SERCOM while the CPU goes back to Python.
+// The receive channel runs for writes too because it only completes after the last byte has been
+// clocked out, unlike the transmit channel which completes as it is queued.
+bool common_hal_busio_spi_start_transfer(busio_spi_obj_t *self, const uint8_t *data_out, uint8_t *data_in, size_t len, uint8_t write_value) {
+    Sercom* sercom = self->spi_desc.dev.prvt;
+    uint8_t index = sercom_index(sercom);
+    uint8_t tx_channel = AUDIO_DMA_CHANNEL_COUNT;
+    uint8_t rx_channel = AUDIO_DMA_CHANNEL_COUNT;
+    if (len <= 0xffff && index < SERCOM_INST_NUM) {
+        tx_channel = audio_dma_allocate_channel();
+        rx_channel = audio_dma_allocate_channel();
+    }
+    if (rx_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        // Too long for one block or the channels are taken. Do it now instead.
+        if (tx_channel < AUDIO_DMA_CHANNEL_COUNT) {
+            audio_dma_free_channel(tx_channel);
+        }
+        if (data_out == NULL) {
+            return common_hal_busio_spi_read(self, data_in, len, write_value);
+        }
+        if (data_in == NULL) {
+            return common_hal_busio_spi_write(self, data_out, len);
+        }
+        return common_hal_busio_spi_transfer(self, (uint8_t*) data_out, data_in, len);
+    }
+    self->tx_dma_channel = tx_channel;
+    self->rx_dma_channel = rx_channel;
+    self->dma_write_value = write_value;
+
+    // Drop anything left over from the last transfer so it isn't read into this one.
+    while (sercom->SPI.INTFLAG.bit.RXC == 1) {
+        (void) sercom->SPI.DATA.reg;
+    }
+
+    if (data_in != NULL) {
+        setup_dma_descriptor(dma_descriptor(rx_channel), &sercom->SPI.DATA.reg, false, data_in, true, len);
+    } else {
+        setup_dma_descriptor(dma_descriptor(rx_channel), &sercom->SPI.DATA.reg, false, &self->dma_sink, false, len);
+    }
+    if (data_out != NULL) {
+        setup_dma_descriptor(dma_descriptor(tx_channel), data_out, true, &sercom->SPI.DATA.reg, false, len);
+    } else {
+        setup_dma_descriptor(dma_descriptor(tx_channel), &self->dma_write_value, false, &sercom->SPI.DATA.reg, false, len);
+    }
+
+    // Receive first so that no byte is missed once the transmit starts.
+    dma_configure(rx_channel, SERCOM0_DMAC_ID_RX + 2 * index, false);
+    dma_enable_channel(rx_channel);
+    dma_configure(tx_channel, SERCOM0_DMAC_ID_TX + 2 * index, false);
+    dma_enable_channel(tx_channel);
+    return true;
+}
+
+bool common_hal_busio_spi_transfer_done(busio_spi_obj_t *self) {
+    if (self->rx_dma_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        return true;
+    }
+    if ((dma_transfer_status(self->rx_dma_channel) & (DMAC_CHINTFLAG_TCMPL | DMAC_CHINTFLAG_TERR)) == 0) {
+        return false;
+    }
+    audio_dma_free_channel(self->tx_dma_channel);
+    audio_dma_free_channel(self->rx_dma_channel);
+    self->tx_dma_channel = AUDIO_DMA_CHANNEL_COUNT;
+    self->rx_dma_channel = AUDIO_DMA_CHANNEL_COUNT;
+    return true;
+}
+
 uint32_t common_hal_busio_spi_get_frequency(busio_spi_obj_t* self) {
     return samd_peripherals_spi_baud_reg_value_to_baudrate(hri_sercomspi_read_BAUD_reg(self->spi_desc.dev.prvt));
 }
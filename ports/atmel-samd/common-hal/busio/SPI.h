@@ -40,6 +40,11 @@ typedef struct {
     uint8_t clock_pin;
     uint8_t MOSI_pin;
     uint8_t MISO_pin;
+    // Background transfer state. The channels are AUDIO_DMA_CHANNEL_COUNT when none is running.
+    uint8_t tx_dma_channel;
+    uint8_t rx_dma_channel;
+    uint8_t dma_write_value;
+    uint8_t dma_sink;
 } busio_spi_obj_t;
 
 void reset_sercoms(void);
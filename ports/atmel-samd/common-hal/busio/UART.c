@@ -43,8 +43,74 @@
 #include "hal/include/hal_usart_async.h"
 #include "hal/include/hpl_usart_async.h"
 
+#include "samd/dma.h"
 #include "samd/sercom.h"
 
+#include "audio_dma.h"
+
+// Receive DMA channels in use. They keep writing until stopped so they are stopped on reset even
+// when the UART object is gone.
+static uint32_t rx_dma_channels;
+
+void uart_reset(void) {
+    for (uint8_t channel = 0; channel < AUDIO_DMA_CHANNEL_COUNT; channel++) {
+        if ((rx_dma_channels & (1 << channel)) != 0) {
+            audio_dma_free_channel(channel);
+        }
+    }
+    rx_dma_channels = 0;
+}
+
+// Lets the DMA move each received character into the ring so there is no interrupt per
+// character. The descriptor links to itself so it starts over at the end of the buffer.
+static void start_rx_dma(busio_uart_obj_t *self, Sercom* sercom, uint8_t sercom_index) {
+    if (self->buffer_length < 2 || self->buffer_length > 0xffff) {
+        return;
+    }
+    uint8_t channel = audio_dma_allocate_channel();
+    if (channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        return;
+    }
+    self->rx_dma_channel = channel;
+    self->rx_read = 0;
+    rx_dma_channels |= 1 << channel;
+
+    DmacDescriptor* descriptor = dma_descriptor(channel);
+    descriptor->BTCTRL.reg = DMAC_BTCTRL_VALID |
+                             DMAC_BTCTRL_BLOCKACT_NOACT |
+                             DMAC_BTCTRL_BEATSIZE_BYTE |
+                             DMAC_BTCTRL_DSTINC;
+    descriptor->BTCNT.reg = self->buffer_length;
+    descriptor->SRCADDR.reg = (uint32_t) &sercom->USART.DATA.reg;
+    descriptor->DSTADDR.reg = ((uint32_t) self->buffer) + self->buffer_length;
+    descriptor->DESCADDR.reg = (uint32_t) descriptor;
+
+    // The DMA takes the characters instead of the interrupt handler.
+    sercom->USART.INTENCLR.reg = SERCOM_USART_INTENCLR_RXC;
+    dma_configure(channel, SERCOM0_DMAC_ID_RX + 2 * sercom_index, false);
+    dma_enable_channel(channel);
+}
+
+// Where the DMA will put the next character. The write back copy of the descriptor counts down
+// the characters left before it starts over.
+static uint32_t rx_dma_write(busio_uart_obj_t *self) {
+    DmacDescriptor* write_back = ((DmacDescriptor*) DMAC->WRBADDR.reg) + self->rx_dma_channel;
+    return (self->buffer_length - write_back->BTCNT.reg) % self->buffer_length;
+}
+
+static size_t rx_dma_available(busio_uart_obj_t *self) {
+    return (rx_dma_write(self) + self->buffer_length - self->rx_read) % self->buffer_length;
+}
+
+static size_t rx_dma_read(busio_uart_obj_t *self, uint8_t *data, size_t len) {
+    size_t count = MIN(len, rx_dma_available(self));
+    for (size_t i = 0; i < count; i++) {
+        data[i] = self->buffer[self->rx_read];
+        self->rx_read = (self->rx_read + 1) % self->buffer_length;
+    }
+    return count;
+}
+
 // Do-nothing callback needed so that usart_async code will enable rx interrupts.
 // See comment below re usart_async_register_callback()
 static void usart_async_rxc_callback(const struct usart_async_descriptor *const descr) {
@@ -75,6 +141,7 @@ void common_hal_busio_uart_construct(busio_uart_obj_t *self,
     self->baudrate = baudrate;
     self->character_bits = bits;
     self->timeout_ms = timeout * 1000;
+    self->rx_dma_channel = AUDIO_DMA_CHANNEL_COUNT;
 
     // This assignment is only here because the usart_async routines take a *const argument.
     struct usart_async_descriptor * const usart_desc_p = (struct usart_async_descriptor * const) &self->usart_desc;
@@ -233,6 +300,10 @@ void common_hal_busio_uart_construct(busio_uart_obj_t *self,
     }
 
     usart_async_enable(usart_desc_p);
+
+    if (have_rx) {
+        start_rx_dma(self, sercom, sercom_index);
+    }
 }
 
 bool common_hal_busio_uart_deinited(busio_uart_obj_t *self) {
@@ -245,6 +316,11 @@ void common_hal_busio_uart_deinit(busio_uart_obj_t *self) {
     }
     // This assignment is only here because the usart_async routines take a *const argument.
     struct usart_async_descriptor * const usart_desc_p = (struct usart_async_descriptor * const) &self->usart_desc;
+    if (self->rx_dma_channel < AUDIO_DMA_CHANNEL_COUNT) {
+        audio_dma_free_channel(self->rx_dma_channel);
+        rx_dma_channels &= ~(1 << self->rx_dma_channel);
+        self->rx_dma_channel = AUDIO_DMA_CHANNEL_COUNT;
+    }
     usart_async_disable(usart_desc_p);
     usart_async_deinit(usart_desc_p);
     reset_pin_number(self->rx_pin);
@@ -276,7 +352,12 @@ size_t common_hal_busio_uart_read(busio_uart_obj_t *self, uint8_t *data, size_t
     // Busy-wait until timeout or until we've read enough chars.
     while (supervisor_ticks_ms64() - start_ticks <= self->timeout_ms) {
         // Read as many chars as we can right now, up to len.
-        size_t num_read = io_read(io, data, len);
+        size_t num_read;
+        if (self->rx_dma_channel < AUDIO_DMA_CHANNEL_COUNT) {
+            num_read = rx_dma_read(self, data, len);
+        } else {
+            num_read = io_read(io, data, len);
+        }
 
         // Advance pointer in data buffer, and decrease how many chars left to read.
         data += num_read;
@@ -370,6 +451,9 @@ void common_hal_busio_uart_set_timeout(busio_uart_obj_t *self, mp_float_t timeou
 }
 
 uint32_t common_hal_busio_uart_rx_characters_available(busio_uart_obj_t *self) {
+    if (self->rx_dma_channel < AUDIO_DMA_CHANNEL_COUNT) {
+        return rx_dma_available(self);
+    }
     // This assignment is only here because the usart_async routines take a *const argument.
     struct usart_async_descriptor * const usart_desc_p = (struct usart_async_descriptor * const) &self->usart_desc;
     struct usart_async_status async_status;
@@ -378,6 +462,10 @@ uint32_t common_hal_busio_uart_rx_characters_available(busio_uart_obj_t *self) {
 }
 
 void common_hal_busio_uart_clear_rx_buffer(busio_uart_obj_t *self) {
+    if (self->rx_dma_channel < AUDIO_DMA_CHANNEL_COUNT) {
+        self->rx_read = rx_dma_write(self);
+        return;
+    }
     // This assignment is only here because the usart_async routines take a *const argument.
     struct usart_async_descriptor * const usart_desc_p = (struct usart_async_descriptor * const) &self->usart_desc;
     usart_async_flush_rx_buffer(usart_desc_p);
@@ -44,6 +44,12 @@ typedef struct {
     uint32_t timeout_ms;
     uint32_t buffer_length;
     uint8_t* buffer;
+    // With a DMA channel the receive buffer is a ring the DMA fills on its own and rx_read is
+    // where the next character comes from. The channel is AUDIO_DMA_CHANNEL_COUNT without one.
+    uint8_t rx_dma_channel;
+    uint32_t rx_read;
 } busio_uart_obj_t;
 
+void uart_reset(void);
+
 #endif // MICROPY_INCLUDED_ATMEL_SAMD_COMMON_HAL_BUSIO_UART_H
@@ -184,3 +184,13 @@ digitalio_pull_t common_hal_digitalio_digitalinout_get_pull(
         }
     }
 }
+
+bool common_hal_digitalio_digitalinout_get_registers(digitalio_digitalinout_obj_t* self,
+        digitalio_digitalinout_registers_t *regs) {
+    PortGroup *const group = &PORT->Group[GPIO_PORT(self->pin->number)];
+    regs->set = &group->OUTSET.reg;
+    regs->clear = &group->OUTCLR.reg;
+    regs->in = &group->IN.reg;
+    regs->mask = 1U << GPIO_PIN(self->pin->number);
+    return true;
+}
@@ -35,6 +35,126 @@
 
 #include "tick.h"
 
+#ifdef SAMD51
+#include "atmel_start_pins.h"
+#include "audio_dma.h"
+#include "samd/dma.h"
+
+// The timer and DMA send path has been built for the SAMD51 ParallelBus boards but not yet run on
+// hardware. Check the timing against a display before relying on it.
+
+// Clock cycles spent on each byte sent with DMA. The timer holds the write line low for the last
+// few cycles of each period and the display latches the byte as it rises at the end. The DMA
+// writes the next byte on each rise which leaves most of the period for the write pin to be
+// handed to the timer at the start and back to the port at the end.
+#define DMA_CYCLES_PER_BYTE 24
+#define DMA_WRITE_LOW_CYCLES 4
+// Shorter sends finish quicker with the CPU than setting up the timer and DMA.
+#define DMA_MIN_BYTES 64
+
+static const uint8_t tcc_overflow_triggers[] = {
+    TCC0_DMAC_ID_OVF,
+    TCC1_DMAC_ID_OVF,
+    TCC2_DMAC_ID_OVF,
+    #ifdef TCC3_DMAC_ID_OVF
+    TCC3_DMAC_ID_OVF,
+    #endif
+    #ifdef TCC4_DMAC_ID_OVF
+    TCC4_DMAC_ID_OVF,
+    #endif
+};
+
+// Only one bus sends with DMA at a time.
+static displayio_parallelbus_obj_t* active_dma_bus = NULL;
+
+static void finish_dma(displayio_parallelbus_obj_t* self) {
+    if (self->dma_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        return;
+    }
+    Tcc* tcc = tcc_insts[self->write_timer->index];
+    // Stop waiting if the timer was turned off because nothing will trigger the DMA then.
+    while (DMAC->Channel[self->dma_channel].CHCTRLA.bit.ENABLE == 1 && tcc->CTRLA.bit.ENABLE == 1) {
+    }
+    // The DMA normally does this itself after the last byte.
+    self->write_group->PINCFG[self->write.pin->number % 32].reg = self->write_pincfg;
+    tcc_set_enable(tcc, false);
+    audio_dma_free_channel(self->dma_channel);
+    self->dma_channel = AUDIO_DMA_CHANNEL_COUNT;
+    active_dma_bus = NULL;
+    if (self->release_chip_select) {
+        common_hal_digitalio_digitalinout_set_value(&self->chip_select, true);
+        self->release_chip_select = false;
+    }
+}
+
+static bool start_dma(displayio_parallelbus_obj_t* self, uint8_t *data, uint32_t data_length) {
+    if (self->write_timer == NULL || data_length < DMA_MIN_BYTES || active_dma_bus != NULL) {
+        return false;
+    }
+    Tcc* tcc = tcc_insts[self->write_timer->index];
+    if (tcc->CTRLA.bit.ENABLE == 1) {
+        // In use by PWMOut.
+        return false;
+    }
+    uint8_t dma_channel = audio_dma_allocate_channel();
+    if (dma_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        return false;
+    }
+    self->dma_channel = dma_channel;
+    active_dma_bus = self;
+
+    // Each overflow writes the next byte as the byte before is latched. One more overflow, after
+    // the last byte is latched, returns the write pin to the port.
+    DmacDescriptor* descriptor = dma_descriptor(dma_channel);
+    descriptor->BTCTRL.reg = DMAC_BTCTRL_VALID |
+                             DMAC_BTCTRL_BLOCKACT_NOACT |
+                             DMAC_BTCTRL_BEATSIZE_BYTE |
+                             DMAC_BTCTRL_SRCINC;
+    descriptor->BTCNT.reg = data_length;
+    descriptor->SRCADDR.reg = ((uint32_t) data) + data_length;
+    descriptor->DSTADDR.reg = (uint32_t) self->bus;
+    descriptor->DESCADDR.reg = (uint32_t) &self->release_write_descriptor;
+
+    DmacDescriptor* release = &self->release_write_descriptor;
+    release->BTCTRL.reg = DMAC_BTCTRL_VALID |
+                          DMAC_BTCTRL_BLOCKACT_NOACT |
+                          DMAC_BTCTRL_BEATSIZE_BYTE;
+    release->BTCNT.reg = 1;
+    release->SRCADDR.reg = (uint32_t) &self->write_pincfg;
+    release->DSTADDR.reg = (uint32_t) &self->write_group->PINCFG[self->write.pin->number % 32].reg;
+    release->DESCADDR.reg = 0;
+
+    dma_configure(dma_channel, tcc_overflow_triggers[self->write_timer->index], false);
+    dma_enable_channel(dma_channel);
+
+    // Run the timer at full speed with the write line high for most of each period.
+    turn_on_clocks(false, self->write_timer->index, 0);
+    tcc->CTRLA.bit.PRESCALER = TCC_CTRLA_PRESCALER_DIV1_Val;
+    tcc->WAVE.bit.WAVEGEN = TCC_WAVE_WAVEGEN_NPWM_Val;
+    tcc->PER.bit.PER = DMA_CYCLES_PER_BYTE - 1;
+    tcc->CC[self->write_timer->wave_output % tcc_cc_num[self->write_timer->index]].reg =
+        DMA_CYCLES_PER_BYTE - DMA_WRITE_LOW_CYCLES;
+    while (tcc->SYNCBUSY.reg != 0) {}
+    tcc->INTFLAG.reg = TCC_INTFLAG_OVF;
+
+    tcc_set_enable(tcc, true);
+
+    // The first overflow writes the first byte. Hand the write pin to the timer right after it,
+    // while the timer's output is still high, so the first strobe is a full one.
+    common_hal_mcu_disable_interrupts();
+    while (tcc->INTFLAG.bit.OVF == 0) {}
+    self->write_group->PINCFG[self->write.pin->number % 32].reg = self->write_pincfg | PORT_PINCFG_PMUXEN;
+    common_hal_mcu_enable_interrupts();
+    return true;
+}
+
+void parallelbus_reset(void) {
+    if (active_dma_bus != NULL) {
+        finish_dma(active_dma_bus);
+    }
+}
+#endif
+
 void common_hal_displayio_parallelbus_construct(displayio_parallelbus_obj_t* self,
     const mcu_pin_obj_t* data0, const mcu_pin_obj_t* command, const mcu_pin_obj_t* chip_select,
     const mcu_pin_obj_t* write, const mcu_pin_obj_t* read, const mcu_pin_obj_t* reset) {
@@ -79,6 +199,25 @@ void common_hal_displayio_parallelbus_construct(displayio_parallelbus_obj_t* sel
     self->write_group = &PORT->Group[write->number / 32];
     self->write_mask = 1 << (write->number % 32);
 
+    #ifdef SAMD51
+    // Select a TCC output for the write pin so pixel data can be sent with DMA. The timer only
+    // drives the pin while PMUXEN is set during a send.
+    self->write_timer = NULL;
+    self->dma_channel = AUDIO_DMA_CHANNEL_COUNT;
+    self->release_chip_select = false;
+    for (uint8_t i = 0; i < NUM_TIMERS_PER_PIN; i++) {
+        const pin_timer_t* t = &write->timer[i];
+        if (!t->is_tc && t->index < TCC_INST_NUM) {
+            self->write_timer = t;
+            gpio_set_pin_function(write->number, GPIO_PIN_FUNCTION_E + i);
+            break;
+        }
+    }
+    PortGroup *const write_group = self->write_group;
+    write_group->PINCFG[write->number % 32].bit.PMUXEN = 0;
+    self->write_pincfg = write_group->PINCFG[write->number % 32].reg;
+    #endif
+
     self->reset.base.type = &mp_type_NoneType;
     if (reset != NULL) {
         self->reset.base.type = &digitalio_digitalinout_type;
@@ -98,6 +237,9 @@ void common_hal_displayio_parallelbus_construct(displayio_parallelbus_obj_t* sel
 }
 
 void common_hal_displayio_parallelbus_deinit(displayio_parallelbus_obj_t* self) {
+    #ifdef SAMD51
+    finish_dma(self);
+    #endif
     for (uint8_t i = 0; i < 8; i++) {
         reset_pin_number(self->data0_pin + i);
     }
@@ -122,17 +264,34 @@ bool common_hal_displayio_parallelbus_reset(mp_obj_t obj) {
 }
 
 bool common_hal_displayio_parallelbus_bus_free(mp_obj_t obj) {
+    #ifdef SAMD51
+    // A DMA send in progress is ours. Clean it up if it's done but don't wait for it, the next
+    // transaction will.
+    displayio_parallelbus_obj_t* self = MP_OBJ_TO_PTR(obj);
+    if (self->dma_channel < AUDIO_DMA_CHANNEL_COUNT &&
+        DMAC->Channel[self->dma_channel].CHCTRLA.bit.ENABLE == 0) {
+        finish_dma(self);
+    }
+    #endif
     return true;
 }
 
 bool common_hal_displayio_parallelbus_begin_transaction(mp_obj_t obj) {
     displayio_parallelbus_obj_t* self = MP_OBJ_TO_PTR(obj);
+    #ifdef SAMD51
+    // Chip select is still low when a DMA send from the last transaction is in progress.
+    self->release_chip_select = false;
+    finish_dma(self);
+    #endif
     common_hal_digitalio_digitalinout_set_value(&self->chip_select, false);
     return true;
 }
 
 void common_hal_displayio_parallelbus_send(mp_obj_t obj, display_byte_type_t byte_type, display_chip_select_behavior_t chip_select, uint8_t *data, uint32_t data_length) {
     displayio_parallelbus_obj_t* self = MP_OBJ_TO_PTR(obj);
+    #ifdef SAMD51
+    finish_dma(self);
+    #endif
     common_hal_digitalio_digitalinout_set_value(&self->command, byte_type == DISPLAY_DATA);
     uint32_t* clear_write = (uint32_t*) &self->write_group->OUTCLR.reg;
     uint32_t* set_write = (uint32_t*) &self->write_group->OUTSET.reg;
@@ -144,7 +303,25 @@ void common_hal_displayio_parallelbus_send(mp_obj_t obj, display_byte_type_t byt
     }
 }
 
+void common_hal_displayio_parallelbus_send_async(mp_obj_t obj, display_byte_type_t byte_type, display_chip_select_behavior_t chip_select, uint8_t *data, uint32_t data_length) {
+    #ifdef SAMD51
+    displayio_parallelbus_obj_t* self = MP_OBJ_TO_PTR(obj);
+    finish_dma(self);
+    common_hal_digitalio_digitalinout_set_value(&self->command, byte_type == DISPLAY_DATA);
+    if (start_dma(self, data, data_length)) {
+        return;
+    }
+    #endif
+    common_hal_displayio_parallelbus_send(obj, byte_type, chip_select, data, data_length);
+}
+
 void common_hal_displayio_parallelbus_end_transaction(mp_obj_t obj) {
     displayio_parallelbus_obj_t* self = MP_OBJ_TO_PTR(obj);
+    #ifdef SAMD51
+    if (self->dma_channel < AUDIO_DMA_CHANNEL_COUNT) {
+        self->release_chip_select = true;
+        return;
+    }
+    #endif
     common_hal_digitalio_digitalinout_set_value(&self->chip_select, true);
 }
@@ -29,6 +29,10 @@
 
 #include "common-hal/digitalio/DigitalInOut.h"
 
+#ifdef SAMD51
+#include "samd/timers.h"
+#endif
+
 typedef struct {
     mp_obj_base_t base;
     uint8_t* bus;
@@ -40,6 +44,18 @@ typedef struct {
     uint8_t data0_pin;
     PortGroup* write_group;
     uint32_t write_mask;
+    #ifdef SAMD51
+    // Ends a DMA send by handing the write pin back to the port. Must be 16 byte aligned.
+    DmacDescriptor release_write_descriptor __attribute__((aligned(16)));
+    // TCC output on the write pin used to strobe bytes out during DMA. NULL when there is none.
+    const pin_timer_t* write_timer;
+    uint8_t write_pincfg; // PINCFG of the write pin when the port drives it.
+    uint8_t dma_channel;
+    bool release_chip_select; // Raise chip select once the DMA send in progress finishes.
+    #endif
 } displayio_parallelbus_obj_t;
 
+// Finishes any DMA send before the DMA channels and timers are reset.
+void parallelbus_reset(void);
+
 #endif // MICROPY_INCLUDED_ATMEL_SAMD_COMMON_HAL_DISPLAYIO_PARALLELBUS_H
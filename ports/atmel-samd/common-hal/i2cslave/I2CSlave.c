@@ -27,6 +27,8 @@
 #include "shared-bindings/i2cslave/I2CSlave.h"
 #include "common-hal/busio/I2C.h"
 
+#include <string.h>
+
 #include "lib/utils/interrupt_char.h"
 #include "py/mperrno.h"
 #include "py/mphal.h"
@@ -34,6 +36,32 @@
 
 #include "hal/include/hal_gpio.h"
 #include "peripherals/samd/sercom.h"
+#include "supervisor/shared/background_task.h"
+#include "supervisor/shared/tick.h"
+
+// How long a register transfer may go without bus activity before it's given up on.
+#define REGISTER_TRANSFER_TIMEOUT_MS 25
+
+static void i2cslave_background(void);
+
+static background_task_t i2cslave_task =
+    BACKGROUND_TASK(i2cslave_background, BACKGROUND_TASK_PRIORITY_HIGH, 0);
+
+static void unlink_register_slave(i2cslave_i2c_slave_obj_t *self) {
+    i2cslave_i2c_slave_obj_t **link = (i2cslave_i2c_slave_obj_t **) &MP_STATE_VM(i2cslave_register_slaves);
+    while (*link != NULL && *link != self) {
+        link = &(*link)->next;
+    }
+    if (*link == self) {
+        *link = self->next;
+    }
+    self->next = NULL;
+    self->registers = NULL;
+}
+
+void i2cslave_reset(void) {
+    MP_STATE_VM(i2cslave_register_slaves) = NULL;
+}
 
 void common_hal_i2cslave_i2c_slave_construct(i2cslave_i2c_slave_obj_t *self,
         const mcu_pin_obj_t *scl, const mcu_pin_obj_t *sda,
@@ -84,6 +112,8 @@ void common_hal_i2cslave_i2c_slave_construct(i2cslave_i2c_slave_obj_t *self,
     }
     self->addresses = addresses;
     self->num_addresses = num_addresses;
+    self->next = NULL;
+    self->registers = NULL;
 
     if (smbus) {
         sercom->I2CS.CTRLA.bit.LOWTOUTEN = 1; // Errata 12003
@@ -103,6 +133,7 @@ void common_hal_i2cslave_i2c_slave_deinit(i2cslave_i2c_slave_obj_t *self) {
         return;
     }
 
+    unlink_register_slave(self);
     self->sercom->I2CS.CTRLA.bit.ENABLE = 0;
 
     reset_pin_number(self->sda_pin);
@@ -208,6 +239,131 @@ void common_hal_i2cslave_i2c_slave_ack(i2cslave_i2c_slave_obj_t *self, bool ack)
     self->sercom->I2CS.CTRLB.bit.CMD = 0x03;
 }
 
+void common_hal_i2cslave_i2c_slave_serve_registers(i2cslave_i2c_slave_obj_t *self,
+        uint8_t *registers, const uint8_t *write_mask, size_t len) {
+    unlink_register_slave(self);
+    if (registers == NULL) {
+        return;
+    }
+    self->registers = registers;
+    self->write_mask = write_mask;
+    self->num_registers = len;
+    self->register_pointer = 0;
+    memset(self->changed, 0, sizeof(self->changed));
+    self->next = MP_STATE_VM(i2cslave_register_slaves);
+    MP_STATE_VM(i2cslave_register_slaves) = self;
+    background_task_register(&i2cslave_task);
+}
+
+bool common_hal_i2cslave_i2c_slave_get_serving_registers(i2cslave_i2c_slave_obj_t *self) {
+    return self->registers != NULL;
+}
+
+size_t common_hal_i2cslave_i2c_slave_get_changed(i2cslave_i2c_slave_obj_t *self, uint8_t *changed) {
+    size_t count = 0;
+    for (size_t i = 0; i < self->num_registers; i++) {
+        uint8_t bit = 1 << (i % 8);
+        if (self->changed[i / 8] & bit) {
+            self->changed[i / 8] &= ~bit;
+            changed[count++] = i;
+        }
+    }
+    return count;
+}
+
+static bool register_slave_addressed(i2cslave_i2c_slave_obj_t *self, bool *is_read) {
+    uint8_t address = self->sercom->I2CS.DATA.reg >> 1;
+    *is_read = self->sercom->I2CS.STATUS.bit.DIR;
+    for (unsigned int i = 0; i < self->num_addresses; i++) {
+        if (address == self->addresses[i]) {
+            common_hal_i2cslave_i2c_slave_ack(self, true);
+            return true;
+        }
+    }
+    common_hal_i2cslave_i2c_slave_ack(self, false);
+    return false;
+}
+
+// Serves one whole transfer once the master has addressed us: the first byte written is the
+// register pointer, later bytes are written through the mask and reads auto-increment. Each
+// byte is answered as soon as it's ready so the master only waits for the address match.
+static void serve_register_transfer(i2cslave_i2c_slave_obj_t *self) {
+    Sercom *sercom = self->sercom;
+    bool is_read;
+    if (!register_slave_addressed(self, &is_read)) {
+        return;
+    }
+    bool pointer_byte = !is_read;
+    bool sent = false;
+    uint32_t last_activity = supervisor_ticks_ms32();
+    while (supervisor_ticks_ms32() - last_activity < REGISTER_TRANSFER_TIMEOUT_MS) {
+        uint32_t flags = sercom->I2CS.INTFLAG.reg;
+        if (flags == 0) {
+            continue;
+        }
+        last_activity = supervisor_ticks_ms32();
+        if (flags & SERCOM_I2CS_INTFLAG_ERROR) {
+            sercom->I2CS.INTFLAG.reg = SERCOM_I2CS_INTFLAG_ERROR;
+            return;
+        }
+        if (flags & SERCOM_I2CS_INTFLAG_PREC) {
+            sercom->I2CS.INTFLAG.reg = SERCOM_I2CS_INTFLAG_PREC;
+            return;
+        }
+        if (flags & SERCOM_I2CS_INTFLAG_AMATCH) {
+            // Repeated start, typically to read back from the pointer just written.
+            if (!register_slave_addressed(self, &is_read)) {
+                return;
+            }
+            pointer_byte = !is_read;
+            sent = false;
+            continue;
+        }
+        if (!(flags & SERCOM_I2CS_INTFLAG_DRDY)) {
+            continue;
+        }
+        uint8_t reg = self->register_pointer;
+        if (is_read) {
+            if (sent && sercom->I2CS.STATUS.bit.RXNACK) {
+                // The master has all it wants. Wait for the stop or a repeated start.
+                sercom->I2CS.CTRLB.bit.CMD = 0x02;
+                continue;
+            }
+            sercom->I2CS.DATA.reg = reg < self->num_registers ? self->registers[reg] : 0xff;
+            sent = true;
+        } else {
+            uint8_t data = sercom->I2CS.DATA.reg;
+            if (pointer_byte) {
+                self->register_pointer = data;
+                pointer_byte = false;
+                common_hal_i2cslave_i2c_slave_ack(self, true);
+                continue;
+            }
+            if (reg < self->num_registers) {
+                uint8_t mask = self->write_mask == NULL ? 0xff : self->write_mask[reg];
+                if (mask != 0) {
+                    self->registers[reg] = (self->registers[reg] & ~mask) | (data & mask);
+                    self->changed[reg / 8] |= 1 << (reg % 8);
+                }
+            }
+            common_hal_i2cslave_i2c_slave_ack(self, true);
+        }
+        self->register_pointer = reg + 1 < self->num_registers ? reg + 1 : 0;
+    }
+}
+
+static void i2cslave_background(void) {
+    i2cslave_i2c_slave_obj_t *self = MP_STATE_VM(i2cslave_register_slaves);
+    for (; self != NULL; self = self->next) {
+        Sercom *sercom = self->sercom;
+        if (sercom->I2CS.INTFLAG.bit.ERROR) {
+            sercom->I2CS.INTFLAG.reg = SERCOM_I2CS_INTFLAG_ERROR;
+        } else if (sercom->I2CS.INTFLAG.bit.AMATCH) {
+            serve_register_transfer(self);
+        }
+    }
+}
+
 void common_hal_i2cslave_i2c_slave_close(i2cslave_i2c_slave_obj_t *self) {
     for (int t = 0; !self->sercom->I2CS.INTFLAG.reg && t < 100; t++) {
         mp_hal_delay_us(10);
@@ -30,7 +30,7 @@
 #include "common-hal/microcontroller/Pin.h"
 #include "py/obj.h"
 
-typedef struct {
+typedef struct i2cslave_i2c_slave_obj {
     mp_obj_base_t base;
 
     uint8_t *addresses;
@@ -40,6 +40,18 @@ typedef struct {
     uint8_t scl_pin;
     uint8_t sda_pin;
     bool writing;
+
+    // Register map served from the background instead of through request(). Slaves serving
+    // registers are linked from MP_STATE_VM(i2cslave_register_slaves).
+    struct i2cslave_i2c_slave_obj *next;
+    uint8_t *registers;
+    const uint8_t *write_mask;
+    uint16_t num_registers;
+    uint8_t register_pointer;
+    // Bitmap of the registers the master wrote since the last common_hal_i2cslave_i2c_slave_get_changed().
+    uint8_t changed[32];
 } i2cslave_i2c_slave_obj_t;
 
+void i2cslave_reset(void);
+
 #endif // MICROPY_INCLUDED_ATMEL_SAMD_COMMON_HAL_BUSIO_I2C_SLAVE_H
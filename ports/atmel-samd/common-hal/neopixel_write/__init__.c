@@ -25,15 +25,25 @@
  */
 #include "hpl_gpio.h"
 
+#include "py/gc.h"
 #include "py/mphal.h"
+#include "py/mpstate.h"
 
+#include "common-hal/neopixel_write/__init__.h"
 #include "shared-bindings/neopixel_write/__init__.h"
+#include "supervisor/shared/tick.h"
 
 #include "tick.h"
 
 #ifdef SAMD51
 #include "hri/hri_cmcc_d51.h"
 #include "hri/hri_nvmctrl_d51.h"
+
+#include "samd/dma.h"
+#include "samd/timers.h"
+
+#include "audio_dma.h"
+#include "timer_handler.h"
 #endif
 
 __attribute__((naked,noinline,aligned(16)))
@@ -94,12 +104,163 @@ static void neopixel_send_buffer_core(volatile uint32_t *clraddr, uint32_t pinMa
 uint64_t next_start_tick_ms = 0;
 uint32_t next_start_tick_us = 1000;
 
+// The pixels latch once the line has been low for a while.
+static void start_latch(void) {
+    current_tick(&next_start_tick_ms, &next_start_tick_us);
+    if (next_start_tick_us < 100) {
+        next_start_tick_ms += 1;
+        next_start_tick_us = 100 - next_start_tick_us;
+    } else {
+        next_start_tick_us -= 100;
+    }
+}
+
+#ifdef SAMD51
+// The SAMD51 can also send from a heap pattern and return while the DMA plays it. A TC overflows
+// at 2.4MHz and the DMA writes one byte of the pin's OUTTGL on each overflow, so a bit takes
+// three writes: high, then low after 417ns for a zero or after 833ns for a one. The pattern is
+// kept in MP_STATE_PORT(neopixel_pattern) so the GC doesn't free it while the DMA reads it.
+#define SLOTS_PER_BIT (3)
+#define SLOT_TOP (48000000 / 2400000 - 1)
+// BTCNT is 16 bits.
+#define MAX_DMA_BYTES (0xffff / (8 * SLOTS_PER_BIT))
+
+static uint8_t active_tc = TC_INST_NUM;
+static uint8_t active_dma_channel;
+static size_t active_pattern_length;
+// The ms tick by which the active transfer has surely finished.
+static uint64_t active_done_ms;
+
+static void release_transfer(void) {
+    Tc* t = tc_insts[active_tc];
+    tc_set_enable(t, false);
+    tc_reset(t);
+    audio_dma_disable_channel(active_dma_channel);
+    audio_dma_free_channel(active_dma_channel);
+    active_tc = TC_INST_NUM;
+}
+
+// Waits for the transfer left in the background, if any, to finish.
+static void finish_transfer(void) {
+    if (active_tc == TC_INST_NUM) {
+        return;
+    }
+    while ((dma_transfer_status(active_dma_channel) & (DMAC_CHINTFLAG_TCMPL | DMAC_CHINTFLAG_TERR)) == 0) {
+        RUN_BACKGROUND_TASKS;
+    }
+    release_transfer();
+    m_del(uint8_t, MP_STATE_PORT(neopixel_pattern), active_pattern_length);
+    MP_STATE_PORT(neopixel_pattern) = NULL;
+
+    if (supervisor_ticks_ms64() > active_done_ms) {
+        // Latched long ago.
+        next_start_tick_ms = 0;
+    } else {
+        start_latch();
+    }
+}
+
+// Returns false when there isn't the memory, a timer or a DMA channel to send in the background.
+static bool start_transfer(PortGroup* port, uint32_t pin, const uint8_t* pixels, uint32_t numBytes) {
+    if (!gc_alloc_possible() || numBytes > MAX_DMA_BYTES) {
+        return false;
+    }
+    uint8_t tc_index = TC_INST_NUM;
+    for (uint8_t i = TC_INST_NUM; i > 0; i--) {
+        if (tc_is_free(i - 1)) {
+            tc_index = i - 1;
+            break;
+        }
+    }
+    if (tc_index == TC_INST_NUM) {
+        return false;
+    }
+    size_t length = numBytes * 8 * SLOTS_PER_BIT;
+    uint8_t* pattern = m_new_maybe(uint8_t, length);
+    if (pattern == NULL) {
+        return false;
+    }
+    uint8_t dma_channel = audio_dma_allocate_channel();
+    if (dma_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        m_del(uint8_t, pattern, length);
+        return false;
+    }
+
+    uint8_t toggle = 1 << (pin % 8);
+    uint8_t* slot = pattern;
+    for (uint32_t n = 0; n < numBytes; n++) {
+        uint8_t pix = pixels[n];
+        for (uint8_t mask = 0x80; mask > 0; mask >>= 1) {
+            bool one = (pix & mask) != 0;
+            *slot++ = toggle;
+            *slot++ = one ? 0 : toggle;
+            *slot++ = one ? toggle : 0;
+        }
+    }
+
+    set_timer_handler(true, tc_index, TC_HANDLER_NO_INTERRUPT);
+    turn_on_clocks(true, tc_index, 1);
+    Tc* t = tc_insts[tc_index];
+    tc_set_enable(t, false);
+    tc_reset(t);
+    t->COUNT16.WAVE.reg = TC_WAVE_WAVEGEN_MFRQ;
+    tc_set_enable(t, true);
+    t->COUNT16.CC[0].reg = SLOT_TOP;
+    tc_wait_for_sync(t);
+    t->COUNT16.CTRLBSET.reg = TC_CTRLBSET_CMD_STOP;
+
+    DmacDescriptor* descriptor = dma_descriptor(dma_channel);
+    descriptor->BTCTRL.reg = DMAC_BTCTRL_VALID |
+                             DMAC_BTCTRL_BLOCKACT_NOACT |
+                             DMAC_BTCTRL_BEATSIZE_BYTE |
+                             DMAC_BTCTRL_SRCINC;
+    descriptor->BTCNT.reg = length;
+    descriptor->SRCADDR.reg = (uint32_t) (pattern + length);
+    // Only the byte holding the pin is written so the rest of the port is left alone.
+    descriptor->DSTADDR.reg = ((uint32_t) &port->OUTTGL.reg) + (pin % 32) / 8;
+    descriptor->DESCADDR.reg = 0;
+    dma_configure(dma_channel, TC0_DMAC_ID_OVF + 3 * tc_index, false);
+
+    active_tc = tc_index;
+    active_dma_channel = dma_channel;
+    active_pattern_length = length;
+    MP_STATE_PORT(neopixel_pattern) = pattern;
+    // Each byte takes 10us to send.
+    active_done_ms = supervisor_ticks_ms64() + numBytes / 100 + 2;
+
+    port->OUTCLR.reg = 1 << (pin % 32);
+    wait_until(next_start_tick_ms, next_start_tick_us);
+    dma_enable_channel(dma_channel);
+    t->COUNT16.CTRLBSET.reg = TC_CTRLBSET_CMD_RETRIGGER;
+    return true;
+}
+#endif
+
+void neopixel_write_reset(void) {
+    #ifdef SAMD51
+    // The heap is already gone so stop right away.
+    if (active_tc != TC_INST_NUM) {
+        release_transfer();
+    }
+    MP_STATE_PORT(neopixel_pattern) = NULL;
+    #endif
+}
+
 void common_hal_neopixel_write(const digitalio_digitalinout_obj_t* digitalinout, uint8_t *pixels, uint32_t numBytes) {
     // This is adapted directly from the Adafruit NeoPixel library SAMD21G18A code:
     // https://github.com/adafruit/Adafruit_NeoPixel/blob/master/Adafruit_NeoPixel.cpp
     // and the asm version from https://github.com/microsoft/uf2-samdx1/blob/master/inc/neopixel.h
     uint32_t  pinMask;
     PortGroup* port;
+    uint32_t pin = digitalinout->pin->number;
+    port    =  &PORT->Group[GPIO_PORT(pin)];  // Convert GPIO # to port register
+
+    #ifdef SAMD51
+    finish_transfer();
+    if (start_transfer(port, pin, pixels, numBytes)) {
+        return;
+    }
+    #endif
 
     // This must be called while interrupts are on in case we're waiting for a
     // future ms tick.
@@ -130,8 +291,6 @@ void common_hal_neopixel_write(const digitalio_digitalinout_obj_t* digitalinout,
     hri_nvmctrl_set_CTRLA_CACHEDIS1_bit(NVMCTRL);
     #endif
 
-    uint32_t pin = digitalinout->pin->number;
-    port    =  &PORT->Group[GPIO_PORT(pin)];  // Convert GPIO # to port register
     pinMask =  (1UL << (pin % 32));  // From port_pin_set_output_level ASF code.
     volatile uint32_t *clr = &(port->OUTCLR.reg);
     neopixel_send_buffer_core(clr, pinMask, pixels, numBytes);
@@ -146,13 +305,7 @@ void common_hal_neopixel_write(const digitalio_digitalinout_obj_t* digitalinout,
 
     // ticks_ms may be out of date at this point because we stopped the
     // interrupt. We'll risk it anyway.
-    current_tick(&next_start_tick_ms, &next_start_tick_us);
-    if (next_start_tick_us < 100) {
-        next_start_tick_ms += 1;
-        next_start_tick_us = 100 - next_start_tick_us;
-    } else {
-        next_start_tick_us -= 100;
-    }
+    start_latch();
 
     // Turn on interrupts after timing-sensitive code.
     mp_hal_enable_all_interrupts();
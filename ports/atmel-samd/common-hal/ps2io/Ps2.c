@@ -41,6 +41,7 @@
 #include "samd/pins.h"
 #include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/ps2io/Ps2.h"
+#include "supervisor/shared/tick.h"
 #include "supervisor/shared/translate.h"
 
 #include "tick.h"
@@ -50,6 +51,8 @@
 #define STATE_RECV_PARITY 2
 #define STATE_RECV_STOP 3
 #define STATE_RECV_ERR 10
+#define STATE_TX_INHIBIT 20
+#define STATE_TX 21
 
 #define ERROR_STARTBIT 0x01
 #define ERROR_TIMEOUT 0x02
@@ -64,29 +67,25 @@
 #define ERROR_TX_RTS 0x1000
 #define ERROR_TX_NORESP 0x2000
 
+// Transmit timeouts, in milliseconds. The device has to start clocking within 15ms of the
+// request to send and to answer within 20ms of the ACK; the tick only has 1ms resolution.
+#define TX_INHIBIT_MS 2
+#define TX_RTS_TIMEOUT_MS 16
+#define TX_CLK_TIMEOUT_MS 2
+#define TX_RESPONSE_TIMEOUT_MS 25
+
+#define RESPONSE_ACK 0xfa
+#define RESPONSE_RESEND 0xfe
+
+// The transmit side is driven from the millisecond tick, so it needs to find active objects.
+static ps2io_ps2_obj_t* active_ps2[EIC_EXTINT_NUM];
+
 static void ps2_set_config(ps2io_ps2_obj_t* self) {
     uint32_t sense_setting = EIC_CONFIG_SENSE0_FALL_Val;
     set_eic_handler(self->channel, EIC_HANDLER_PS2);
     turn_on_eic_channel(self->channel, sense_setting);
 }
 
-static void disable_interrupt(ps2io_ps2_obj_t* self) {
-    uint32_t mask = 1 << self->channel;
-    EIC->INTENCLR.reg = mask << EIC_INTENSET_EXTINT_Pos;
-}
-
-static void resume_interrupt(ps2io_ps2_obj_t* self) {
-    disable_interrupt(self);
-
-    self->state = STATE_IDLE;
-    gpio_set_pin_function(self->clk_pin, GPIO_PIN_FUNCTION_A);
-    uint32_t mask = 1 << self->channel;
-    EIC->INTFLAG.reg = mask << EIC_INTFLAG_EXTINT_Pos;
-    EIC->INTENSET.reg = mask << EIC_INTENSET_EXTINT_Pos;
-
-    ps2_set_config(self);
-}
-
 static void clk_hi(ps2io_ps2_obj_t* self) {
     // External pull-up
     // Must set pull after setting direction.
@@ -94,26 +93,6 @@ static void clk_hi(ps2io_ps2_obj_t* self) {
     gpio_set_pin_pull_mode(self->clk_pin, GPIO_PULL_OFF);
 }
 
-static bool wait_clk_lo(ps2io_ps2_obj_t* self, uint32_t us) {
-    clk_hi(self);
-    common_hal_mcu_delay_us(1);
-    while (gpio_get_pin_level(self->clk_pin) && us) {
-        --us;
-        common_hal_mcu_delay_us(1);
-    }
-    return us;
-}
-
-static bool wait_clk_hi(ps2io_ps2_obj_t* self, uint32_t us) {
-    clk_hi(self);
-    common_hal_mcu_delay_us(1);
-    while (!gpio_get_pin_level(self->clk_pin) && us) {
-        --us;
-        common_hal_mcu_delay_us(1);
-    }
-    return us;
-}
-
 static void clk_lo(ps2io_ps2_obj_t* self) {
     gpio_set_pin_pull_mode(self->clk_pin, GPIO_PULL_OFF);
     gpio_set_pin_direction(self->clk_pin, GPIO_DIRECTION_OUT);
@@ -126,26 +105,6 @@ static void data_hi(ps2io_ps2_obj_t* self) {
     gpio_set_pin_pull_mode(self->data_pin, GPIO_PULL_OFF);
 }
 
-static bool wait_data_lo(ps2io_ps2_obj_t* self, uint32_t us) {
-    data_hi(self);
-    common_hal_mcu_delay_us(1);
-    while (gpio_get_pin_level(self->data_pin) && us) {
-        --us;
-        common_hal_mcu_delay_us(1);
-    }
-    return us;
-}
-
-static bool wait_data_hi(ps2io_ps2_obj_t* self, uint32_t us) {
-    data_hi(self);
-    common_hal_mcu_delay_us(1);
-    while (!gpio_get_pin_level(self->data_pin) && us) {
-        --us;
-        common_hal_mcu_delay_us(1);
-    }
-    return us;
-}
-
 static void data_lo(ps2io_ps2_obj_t* self) {
     gpio_set_pin_pull_mode(self->data_pin, GPIO_PULL_OFF);
     gpio_set_pin_direction(self->data_pin, GPIO_DIRECTION_OUT);
@@ -162,8 +121,81 @@ static void inhibit(ps2io_ps2_obj_t* self) {
     data_hi(self);
 }
 
-static void delay_us(uint32_t t) {
-    common_hal_mcu_delay_us(t);
+// Pulls the clock low to take the bus from the device. The tick sends the request to send
+// once the line has been held for at least 100us. Call with interrupts disabled.
+static void start_command(ps2io_ps2_obj_t* self) {
+    self->state = STATE_TX_INHIBIT;
+    self->tx_ms = supervisor_ticks_ms32();
+    inhibit(self);
+}
+
+// Retires the command at the head of the queue with the given response, or -1 on failure,
+// and starts the next one. Call with interrupts disabled.
+static void finish_command(ps2io_ps2_obj_t* self, int16_t response) {
+    self->waiting_cmd_response = false;
+    if (response == RESPONSE_RESEND && self->tx_retries > 0) {
+        self->tx_retries--;
+        start_command(self);
+        return;
+    }
+    if (self->sync_cmd) {
+        self->sync_cmd = false;
+        self->cmd_response = response;
+    } else if (response >= 0 && response != RESPONSE_ACK) {
+        // Nobody waits for the response of a queued command so keep it for popleft().
+        if (self->bufcount >= sizeof(self->buffer)) {
+            self->last_errors |= ERROR_BUFFER;
+        } else {
+            self->buffer[self->bufposw] = response;
+            self->bufposw = (self->bufposw + 1) % sizeof(self->buffer);
+            self->bufcount++;
+        }
+    }
+    self->cmd_pos = (self->cmd_pos + 1) % sizeof(self->cmd_queue);
+    self->cmd_count--;
+    self->tx_retries = 1;
+    if (self->cmd_count > 0) {
+        start_command(self);
+    }
+}
+
+static void tx_failed(ps2io_ps2_obj_t* self, uint16_t error) {
+    self->last_errors |= error;
+    self->tx_retries = 0;
+    idle(self);
+    self->state = STATE_IDLE;
+    finish_command(self, -1);
+}
+
+// The device clocks the command in: on each falling edge the host sets up the next bit, and
+// after the stop bit the device pulls data low for one more clock to ACK.
+static void tx_clock_edge(ps2io_ps2_obj_t* self, int data_bit) {
+    uint8_t bit = self->bitcount++;
+    if (bit < 8) {
+        uint8_t b = self->cmd_queue[self->cmd_pos];
+        if (b & (1 << bit)) {
+            self->parity = !self->parity;
+            data_hi(self);
+        } else {
+            data_lo(self);
+        }
+    } else if (bit == 8) {
+        if (self->parity) {
+            data_hi(self);
+        } else {
+            data_lo(self);
+        }
+    } else if (bit == 9) {
+        // Stop bit
+        data_hi(self);
+    } else if (data_bit) {
+        tx_failed(self, ERROR_TX_ACKDATA);
+    } else {
+        // The response arrives as a normal received byte.
+        self->state = STATE_IDLE;
+        self->waiting_cmd_response = true;
+        self->tx_ms = supervisor_ticks_ms32();
+    }
 }
 
 void ps2_interrupt_handler(uint8_t channel) {
@@ -175,6 +207,16 @@ void ps2_interrupt_handler(uint8_t channel) {
     ps2io_ps2_obj_t* self = get_eic_channel_data(channel);
     int data_bit = gpio_get_pin_level(self->data_pin) ? 1 : 0;
 
+    if (self->state == STATE_TX_INHIBIT) {
+        // Our own clock pulldown.
+        return;
+    }
+    if (self->state == STATE_TX) {
+        self->tx_ms = supervisor_ticks_ms32();
+        tx_clock_edge(self, data_bit);
+        return;
+    }
+
     // test for timeout
     if (self->state != STATE_IDLE) {
         int64_t diff_ms = current_ms - self->last_int_ms;
@@ -224,11 +266,11 @@ void ps2_interrupt_handler(uint8_t channel) {
 
     } else if (self->state == STATE_RECV_STOP) {
         ++self->bitcount;
+        self->state = STATE_IDLE;
         if (! data_bit) {
             self->last_errors |= ERROR_STOPBIT;
         } else if (self->waiting_cmd_response) {
-            self->cmd_response = self->bits;
-            self->waiting_cmd_response = false;
+            finish_command(self, self->bits);
         } else if (self->bufcount >= sizeof(self->buffer)) {
             self->last_errors |= ERROR_BUFFER;
         } else {
@@ -236,7 +278,6 @@ void ps2_interrupt_handler(uint8_t channel) {
             self->bufposw = (self->bufposw + 1) % sizeof(self->buffer);
             self->bufcount++;
         }
-        self->state = STATE_IDLE;
 
     } else if (self->state == STATE_RECV_ERR) {
         // just count the bits until idle
@@ -246,6 +287,48 @@ void ps2_interrupt_handler(uint8_t channel) {
     }
 }
 
+// Called every millisecond to start queued commands and to time out stalled ones.
+void ps2io_tick(void) {
+    uint32_t now = supervisor_ticks_ms32();
+    for (size_t i = 0; i < EIC_EXTINT_NUM; i++) {
+        ps2io_ps2_obj_t* self = active_ps2[i];
+        if (self == NULL || self->cmd_count == 0) {
+            continue;
+        }
+        common_hal_mcu_disable_interrupts();
+        uint32_t elapsed = now - self->tx_ms;
+        if (self->state == STATE_TX_INHIBIT) {
+            if (elapsed >= TX_INHIBIT_MS) {
+                // Request to send; data low is also the start bit.
+                self->state = STATE_TX;
+                self->bitcount = 0;
+                self->parity = true;
+                self->tx_ms = now;
+                data_lo(self);
+                clk_hi(self);
+            }
+        } else if (self->state == STATE_TX) {
+            if (self->bitcount == 0 && elapsed >= TX_RTS_TIMEOUT_MS) {
+                tx_failed(self, ERROR_TX_RTS);
+            } else if (self->bitcount > 0 && elapsed >= TX_CLK_TIMEOUT_MS) {
+                tx_failed(self, self->bitcount == 10 ? ERROR_TX_ACKCLK : ERROR_TX_CLKLO);
+            }
+        } else if (self->waiting_cmd_response && self->state == STATE_IDLE &&
+                   elapsed >= TX_RESPONSE_TIMEOUT_MS) {
+            self->last_errors |= ERROR_TX_NORESP;
+            self->tx_retries = 0;
+            finish_command(self, -1);
+        }
+        common_hal_mcu_enable_interrupts();
+    }
+}
+
+void ps2_reset(void) {
+    for (size_t i = 0; i < EIC_EXTINT_NUM; i++) {
+        active_ps2[i] = NULL;
+    }
+}
+
 void common_hal_ps2io_ps2_construct(ps2io_ps2_obj_t* self,
         const mcu_pin_obj_t* data_pin, const mcu_pin_obj_t* clk_pin) {
     if (!clk_pin->has_extint) {
@@ -266,8 +349,13 @@ void common_hal_ps2io_ps2_construct(ps2io_ps2_obj_t* self,
     self->bufposr = 0;
     self->bufposw = 0;
     self->waiting_cmd_response = false;
+    self->cmd_count = 0;
+    self->cmd_pos = 0;
+    self->tx_retries = 1;
+    self->sync_cmd = false;
 
     set_eic_channel_data(clk_pin->extint_channel, (void*) self);
+    active_ps2[self->channel] = self;
 
     // Check to see if the EIC is enabled and start it up if its not.'
     if (eic_get_enable() == 0) {
@@ -294,6 +382,7 @@ void common_hal_ps2io_ps2_deinit(ps2io_ps2_obj_t* self) {
     if (common_hal_ps2io_ps2_deinited(self)) {
         return;
     }
+    active_ps2[self->channel] = NULL;
     set_eic_handler(self->channel, EIC_HANDLER_NO_INTERRUPT);
     turn_off_eic_channel(self->channel);
     reset_pin_number(self->clk_pin);
@@ -336,106 +425,40 @@ uint16_t common_hal_ps2io_ps2_clear_errors(ps2io_ps2_obj_t* self)
 
 // Based upon TMK implementation of PS/2 protocol
 // https://github.com/tmk/tmk_keyboard/blob/master/tmk_core/protocol/ps2_interrupt.c
+//
+// Commands are queued and clocked out from the EIC interrupt; the tick inhibits the bus and
+// times out stalled transfers, so nothing here busy-waits on the line.
 
-int16_t common_hal_ps2io_ps2_sendcmd(ps2io_ps2_obj_t* self, uint8_t b)
-{
-    disable_interrupt(self);
-    inhibit(self);
-    delay_us(100);
-
-    /* RTS and start bit */
-    data_lo(self);
-    clk_hi(self);
-    if (!wait_clk_lo(self, 10000)) {
-        self->last_errors |= ERROR_TX_RTS;
-        goto ERROR;
-    }
-
-    bool parity = true;
-    for (uint8_t i = 0; i < 8; i++) {
-        delay_us(15);
-        if (b & (1 << i)) {
-            parity = !parity;
-            data_hi(self);
-        } else {
-            data_lo(self);
-        }
-        if (!wait_clk_hi(self, 50)) {
-            self->last_errors |= ERROR_TX_CLKHI;
-            goto ERROR;
-        }
-        if (!wait_clk_lo(self, 50)) {
-            self->last_errors |= ERROR_TX_CLKLO;
-            goto ERROR;
-        }
-    }
-
-    delay_us(15);
-    if (parity) {
-        data_hi(self);
-    } else {
-        data_lo(self);
-    }
-    if (!wait_clk_hi(self, 50)) {
-        self->last_errors |= ERROR_TX_CLKHI;
-        goto ERROR;
-    }
-    if (!wait_clk_lo(self, 50)) {
-        self->last_errors |= ERROR_TX_CLKLO;
-        goto ERROR;
+bool common_hal_ps2io_ps2_queuecmd(ps2io_ps2_obj_t* self, uint8_t b, bool sync) {
+    common_hal_mcu_disable_interrupts();
+    if (self->cmd_count >= sizeof(self->cmd_queue)) {
+        common_hal_mcu_enable_interrupts();
+        return false;
     }
-
-    /* Stop bit */
-    delay_us(15);
-    data_hi(self);
-
-    /* Ack */
-    if (!wait_data_lo(self, 50)) {
-        self->last_errors |= ERROR_TX_ACKDATA;
-        goto ERROR;
+    size_t tail = (self->cmd_pos + self->cmd_count) % sizeof(self->cmd_queue);
+    self->cmd_queue[tail] = b;
+    self->cmd_count++;
+    if (sync) {
+        // Only the head of an otherwise empty queue is waited for.
+        self->sync_cmd = true;
+        self->cmd_response = -1;
     }
-    if (!wait_clk_lo(self, 50)) {
-        self->last_errors |= ERROR_TX_ACKCLK;
-        goto ERROR;
+    if (self->cmd_count == 1) {
+        start_command(self);
     }
+    common_hal_mcu_enable_interrupts();
+    return true;
+}
 
-    /* wait for idle state */
-    if (!wait_clk_hi(self, 50)) {
-        self->last_errors |= ERROR_TX_ACKCLK;
-        goto ERROR;
-    }
-    if (!wait_data_hi(self, 50)) {
-        self->last_errors |= ERROR_TX_ACKDATA;
-        goto ERROR;
+int16_t common_hal_ps2io_ps2_sendcmd(ps2io_ps2_obj_t* self, uint8_t b)
+{
+    // Let earlier queued commands go out first. Each one is bounded by the tick timeouts.
+    while (self->cmd_count > 0) {
+        RUN_BACKGROUND_TASKS;
     }
-
-    /* Wait for response byte */
-    self->waiting_cmd_response = true;
-    idle(self);
-    resume_interrupt(self);
-
-    for (int i = 0; i < 25; ++i) {
-        delay_us(1000);
-        common_hal_mcu_disable_interrupts();
-        bool has_response = !self->waiting_cmd_response;
-        uint8_t response = self->cmd_response;
-        common_hal_mcu_enable_interrupts();
-
-        if (has_response) {
-            return response;
-        }
+    common_hal_ps2io_ps2_queuecmd(self, b, true);
+    while (self->sync_cmd) {
+        RUN_BACKGROUND_TASKS;
     }
-
-    /* No response */
-    common_hal_mcu_disable_interrupts();
-    self->waiting_cmd_response = false;
-    self->last_errors |= ERROR_TX_NORESP;
-    common_hal_mcu_enable_interrupts();
-    return -1;
-
-    /* Other errors */
-ERROR:
-    idle(self);
-    resume_interrupt(self);
-    return -1;
+    return self->cmd_response;
 }
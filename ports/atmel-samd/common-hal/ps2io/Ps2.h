@@ -54,9 +54,21 @@ typedef struct {
     uint16_t last_errors;
 
     bool waiting_cmd_response;
-    uint8_t cmd_response;
+    int16_t cmd_response;
+
+    // Commands waiting to be sent; the head is the one on the wire.
+    uint8_t cmd_queue[8];
+    uint8_t cmd_count;
+    uint8_t cmd_pos;
+    uint8_t tx_retries;
+    // True while sendcmd() waits for the response to the head command.
+    volatile bool sync_cmd;
+    // Tick when the current transmit step started, for timeouts.
+    uint32_t tx_ms;
 } ps2io_ps2_obj_t;
 
 void ps2_interrupt_handler(uint8_t channel);
+void ps2io_tick(void);
+void ps2_reset(void);
 
 #endif // MICROPY_INCLUDED_ATMEL_SAMD_COMMON_HAL_PS2IO_PS2_H
@@ -198,8 +198,7 @@ pwmout_result_t common_hal_pulseio_pwmout_construct(pulseio_pwmout_obj_t* self,
             }
             if (t->is_tc) {
                 found = true;
-                Tc* tc = tc_insts[t->index];
-                if (tc->COUNT16.CTRLA.bit.ENABLE == 0 && t->wave_output == 1) {
+                if (tc_is_free(t->index) && t->wave_output == 1) {
                     timer = t;
                     mux_position = i;
                 }
@@ -0,0 +1,296 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "common-hal/pulseio/PortOut.h"
+
+#include <stdint.h>
+
+#include "py/gc.h"
+#include "py/runtime.h"
+#include "shared-bindings/microcontroller/Pin.h"
+#include "shared-bindings/pulseio/PortOut.h"
+#include "supervisor/shared/translate.h"
+
+#include "atmel_start_pins.h"
+#include "hal/include/hal_gpio.h"
+
+#include "samd/dma.h"
+#include "samd/timers.h"
+
+#include "audio_dma.h"
+#include "timer_handler.h"
+
+// The DMA writes each state to the port's toggle register so pins on the port that aren't part of
+// the PortOut keep whatever they're doing. A timer overflow paces the writes.
+
+// States per second the DMA keeps up with while other channels run.
+#ifdef SAMD21
+#define MAX_FREQUENCY 1000000
+#endif
+#ifdef SAMD51
+#define MAX_FREQUENCY 4000000
+#endif
+
+#ifdef SAMD21
+#define FIRST_TC_DMAC_ID_OVF TC3_DMAC_ID_OVF
+#endif
+#ifdef SAMD51
+#define FIRST_TC_DMAC_ID_OVF TC0_DMAC_ID_OVF
+#endif
+
+static uint32_t set_timer_frequency(Tc* timer, uint32_t frequency) {
+    uint32_t system_clock = 48000000;
+    uint32_t new_top;
+    uint8_t new_divisor;
+    for (new_divisor = 0; new_divisor < 8; new_divisor++) {
+        new_top = (system_clock / prescaler[new_divisor] / frequency) - 1;
+        if (new_top < (1u << 16)) {
+            break;
+        }
+    }
+    tc_set_enable(timer, false);
+    timer->COUNT16.CTRLA.bit.PRESCALER = new_divisor;
+    tc_set_enable(timer, true);
+    tc_wait_for_sync(timer);
+    timer->COUNT16.CC[0].reg = new_top;
+    tc_wait_for_sync(timer);
+    return system_clock / prescaler[new_divisor] / (new_top + 1);
+}
+
+static void link(pulseio_portout_obj_t* self) {
+    self->next = MP_STATE_PORT(portouts);
+    MP_STATE_PORT(portouts) = self;
+}
+
+static void unlink(pulseio_portout_obj_t* self) {
+    pulseio_portout_obj_t** previous = (pulseio_portout_obj_t**) &MP_STATE_PORT(portouts);
+    while (*previous != NULL) {
+        if (*previous == self) {
+            *previous = self->next;
+            break;
+        }
+        previous = &(*previous)->next;
+    }
+    self->next = NULL;
+}
+
+void portout_reset(void) {
+    pulseio_portout_obj_t* self = MP_STATE_PORT(portouts);
+    while (self != NULL) {
+        audio_dma_disable_channel(self->dma_channel);
+        audio_dma_free_channel(self->dma_channel);
+        self = self->next;
+    }
+    MP_STATE_PORT(portouts) = NULL;
+}
+
+void common_hal_pulseio_portout_construct(pulseio_portout_obj_t* self,
+        const mcu_pin_obj_t** pins, uint8_t pin_count, uint32_t frequency) {
+    uint8_t port = GPIO_PORT(pins[0]->number);
+    uint32_t mask = 0;
+    for (uint8_t i = 0; i < pin_count; i++) {
+        uint32_t bit = 1 << GPIO_PIN(pins[i]->number);
+        if (GPIO_PORT(pins[i]->number) != port || (mask & bit) != 0) {
+            mp_raise_ValueError(translate("Invalid pins"));
+        }
+        mask |= bit;
+    }
+    if (frequency > MAX_FREQUENCY) {
+        mp_raise_ValueError_varg(translate("%q must be between %d and %d"), MP_QSTR_frequency, 1, MAX_FREQUENCY);
+    }
+
+    Tc *t = NULL;
+    uint8_t tc_index = TC_INST_NUM;
+    for (uint8_t i = TC_INST_NUM; i > 0; i--) {
+        if (tc_is_free(i - 1)) {
+            t = tc_insts[i - 1];
+            tc_index = i - 1;
+            break;
+        }
+    }
+    if (t == NULL) {
+        mp_raise_RuntimeError(translate("All timers in use"));
+    }
+    uint8_t dma_channel = audio_dma_allocate_channel();
+    if (dma_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        mp_raise_RuntimeError(translate("No DMA channel found"));
+    }
+
+    // Use the 48mhz clocks on both the SAMD21 and 51 like AudioOut.
+    uint8_t tc_gclk = 0;
+    #ifdef SAMD51
+    tc_gclk = 1;
+    #endif
+
+    set_timer_handler(true, tc_index, TC_HANDLER_NO_INTERRUPT);
+    turn_on_clocks(true, tc_index, tc_gclk);
+
+    tc_set_enable(t, false);
+    tc_reset(t);
+    #ifdef SAMD51
+    t->COUNT16.WAVE.reg = TC_WAVE_WAVEGEN_MFRQ;
+    #endif
+    #ifdef SAMD21
+    t->COUNT16.CTRLA.bit.WAVEGEN = TC_CTRLA_WAVEGEN_MFRQ_Val;
+    #endif
+    tc_set_enable(t, true);
+    self->frequency = set_timer_frequency(t, frequency);
+    // The timer stays enabled, so no one else takes it, but only runs while playing.
+    t->COUNT16.CTRLBSET.reg = TC_CTRLBSET_CMD_STOP;
+
+    for (uint8_t i = 0; i < pin_count; i++) {
+        uint8_t number = pins[i]->number;
+        claim_pin(pins[i]);
+        gpio_set_pin_function(number, GPIO_PIN_FUNCTION_OFF);
+        gpio_set_pin_level(number, false);
+        gpio_set_pin_direction(number, GPIO_DIRECTION_OUT);
+        self->pin_bits[i] = GPIO_PIN(number);
+    }
+    self->next = NULL;
+    self->pattern = NULL;
+    self->pattern_length = 0;
+    self->loop_descriptor = NULL;
+    self->mask = mask;
+    self->pin_count = pin_count;
+    self->port = port;
+    self->tc_index = tc_index;
+    self->dma_channel = dma_channel;
+    self->playing = false;
+    self->loop = false;
+    link(self);
+}
+
+bool common_hal_pulseio_portout_deinited(pulseio_portout_obj_t* self) {
+    return self->pin_count == 0;
+}
+
+void common_hal_pulseio_portout_deinit(pulseio_portout_obj_t* self) {
+    if (common_hal_pulseio_portout_deinited(self)) {
+        return;
+    }
+    common_hal_pulseio_portout_stop(self);
+    unlink(self);
+    audio_dma_free_channel(self->dma_channel);
+    Tc* t = tc_insts[self->tc_index];
+    tc_set_enable(t, false);
+    tc_reset(t);
+    for (uint8_t i = 0; i < self->pin_count; i++) {
+        reset_pin_number(self->port * 32 + self->pin_bits[i]);
+    }
+    m_del(uint32_t, self->pattern, self->pattern_length);
+    self->pattern = NULL;
+    m_del(DmacDescriptor, self->loop_descriptor, 1);
+    self->loop_descriptor = NULL;
+    self->pin_count = 0;
+}
+
+static uint32_t port_state(pulseio_portout_obj_t* self, uint32_t state) {
+    uint32_t port_bits = 0;
+    for (uint8_t i = 0; i < self->pin_count && state != 0; i++) {
+        if ((state & 1) != 0) {
+            port_bits |= 1 << self->pin_bits[i];
+        }
+        state >>= 1;
+    }
+    return port_bits;
+}
+
+static void setup_descriptor(DmacDescriptor* descriptor, uint32_t* source, size_t count,
+                             volatile uint32_t* destination, DmacDescriptor* next) {
+    descriptor->BTCTRL.reg = DMAC_BTCTRL_VALID |
+                             DMAC_BTCTRL_BLOCKACT_NOACT |
+                             DMAC_BTCTRL_BEATSIZE_WORD |
+                             DMAC_BTCTRL_SRCINC;
+    descriptor->BTCNT.reg = count;
+    descriptor->SRCADDR.reg = (uint32_t) (source + count);
+    descriptor->DSTADDR.reg = (uint32_t) destination;
+    descriptor->DESCADDR.reg = (uint32_t) next;
+}
+
+void common_hal_pulseio_portout_write(pulseio_portout_obj_t* self,
+        const void* buffer, uint8_t element_size, size_t count, bool loop) {
+    common_hal_pulseio_portout_stop(self);
+    if (count > 0xffff) {
+        mp_raise_ValueError_varg(translate("%q must be between %d and %d"), MP_QSTR_buffer, 1, 0xffff);
+    }
+    if (self->pattern_length != count + 1) {
+        m_del(uint32_t, self->pattern, self->pattern_length);
+        self->pattern = NULL;
+        self->pattern_length = 0;
+        self->pattern = m_new(uint32_t, count + 1);
+        self->pattern_length = count + 1;
+    }
+
+    // Pins only change when their bit is toggled so store the difference from the state before.
+    PortGroup* group = &PORT->Group[self->port];
+    uint32_t previous = group->OUT.reg & self->mask;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t state = port_state(self, pulseio_portout_get_state(buffer, element_size, i));
+        self->pattern[i] = state ^ previous;
+        previous = state;
+    }
+    self->pattern[count] = port_state(self, pulseio_portout_get_state(buffer, element_size, 0)) ^ previous;
+
+    DmacDescriptor* descriptor = dma_descriptor(self->dma_channel);
+    if (loop) {
+        // The first toggle starts from the current pin states. The looped descriptor then plays
+        // the rest and wraps back to the first state.
+        if (self->loop_descriptor == NULL) {
+            self->loop_descriptor = m_new(DmacDescriptor, 1);
+        }
+        setup_descriptor(descriptor, self->pattern, 1, &group->OUTTGL.reg, self->loop_descriptor);
+        setup_descriptor(self->loop_descriptor, self->pattern + 1, count, &group->OUTTGL.reg,
+                         self->loop_descriptor);
+    } else {
+        setup_descriptor(descriptor, self->pattern, count, &group->OUTTGL.reg, NULL);
+    }
+    dma_configure(self->dma_channel, FIRST_TC_DMAC_ID_OVF + 3 * self->tc_index, false);
+    self->loop = loop;
+    self->playing = true;
+    dma_enable_channel(self->dma_channel);
+    tc_insts[self->tc_index]->COUNT16.CTRLBSET.reg = TC_CTRLBSET_CMD_RETRIGGER;
+}
+
+void common_hal_pulseio_portout_stop(pulseio_portout_obj_t* self) {
+    if (!self->playing) {
+        return;
+    }
+    tc_insts[self->tc_index]->COUNT16.CTRLBSET.reg = TC_CTRLBSET_CMD_STOP;
+    audio_dma_disable_channel(self->dma_channel);
+    self->playing = false;
+}
+
+bool common_hal_pulseio_portout_get_playing(pulseio_portout_obj_t* self) {
+    if (self->playing && !self->loop &&
+        (dma_transfer_status(self->dma_channel) & (DMAC_CHINTFLAG_TCMPL | DMAC_CHINTFLAG_TERR)) != 0) {
+        common_hal_pulseio_portout_stop(self);
+    }
+    return self->playing;
+}
+
+uint32_t common_hal_pulseio_portout_get_frequency(pulseio_portout_obj_t* self) {
+    return self->frequency;
+}
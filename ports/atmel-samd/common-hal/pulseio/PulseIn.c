@@ -44,6 +44,33 @@
 
 #include "tick.h"
 
+#ifdef SAMD51
+#include "samd/dma.h"
+#include "samd/events.h"
+#include "samd/timers.h"
+
+#include "audio_dma.h"
+#include "timer_handler.h"
+
+// Edges are timestamped by a TC pair counting 32 bits at 48MHz / 16. The event system takes each
+// edge from the EIC to the timer and the DMA copies the timestamp into a ring, so nothing runs
+// per edge. Durations are worked out when the ring is read.
+#define CAPTURE_TICKS_PER_US (3)
+#define CAPTURE_RING_LENGTH (512)
+// In timestamp mode the timer captures its top value when it wraps around, about every 24 minutes.
+#define CAPTURE_WRAPPED (0xffffffff)
+#endif
+
+static void push_duration(pulseio_pulsein_obj_t* self, uint16_t duration) {
+    uint16_t i = (self->start + self->len) % self->maxlen;
+    self->buffer[i] = duration;
+    if (self->len < self->maxlen) {
+        self->len++;
+    } else {
+        self->start++;
+    }
+}
+
 static void pulsein_set_config(pulseio_pulsein_obj_t* self, bool first_edge) {
     uint32_t sense_setting;
     if (!first_edge) {
@@ -71,6 +98,7 @@ void pulsein_interrupt_handler(uint8_t channel) {
     pulseio_pulsein_obj_t* self = get_eic_channel_data(channel);
     if (!background_tasks_ok() || self->errored_too_fast) {
         self->errored_too_fast = true;
+        self->overflowed = true;
         common_hal_pulseio_pulsein_pause(self);
         return;
     }
@@ -93,17 +121,215 @@ void pulsein_interrupt_handler(uint8_t channel) {
         if (total_diff < duration) {
             duration = total_diff;
         }
+        push_duration(self, duration);
+    }
+    self->last_ms = current_ms;
+    self->last_us = current_us;
+}
+
+#ifdef SAMD51
+static bool capturing(pulseio_pulsein_obj_t* self) {
+    return self->tc_index < TC_INST_NUM;
+}
+
+// Starts the DMA over at the beginning of the ring. The last entry is zeroed because it is checked
+// against last_entry to spot the DMA lapping the reader.
+static void start_capture_dma(pulseio_pulsein_obj_t* self) {
+    Tc* tc = tc_insts[self->tc_index];
+    self->timestamps[CAPTURE_RING_LENGTH - 1] = 0;
+    self->last_entry = 0;
+    self->timestamp_read = 0;
+    self->wraps = 0;
+
+    DmacDescriptor* descriptor = dma_descriptor(self->dma_channel);
+    descriptor->BTCTRL.reg = DMAC_BTCTRL_VALID |
+                             DMAC_BTCTRL_BLOCKACT_NOACT |
+                             DMAC_BTCTRL_BEATSIZE_WORD |
+                             DMAC_BTCTRL_DSTINC;
+    descriptor->BTCNT.reg = CAPTURE_RING_LENGTH;
+    descriptor->SRCADDR.reg = (uint32_t) &tc->COUNT32.CC[0].reg;
+    descriptor->DSTADDR.reg = (uint32_t) (self->timestamps + CAPTURE_RING_LENGTH);
+    descriptor->DESCADDR.reg = (uint32_t) descriptor;
+    dma_configure(self->dma_channel, TC0_DMAC_ID_MC_0 + 3 * self->tc_index, false);
+    dma_enable_channel(self->dma_channel);
+}
+
+// Sets up hardware timing when a timer pair, an event channel and a DMA channel are free. The
+// interrupt handler times the edges otherwise.
+static void setup_capture(pulseio_pulsein_obj_t* self) {
+    self->tc_index = TC_INST_NUM;
+    uint8_t slot;
+    for (slot = 0; slot < PULSEIN_CAPTURE_COUNT; slot++) {
+        if (MP_STATE_PORT(capturing_pulsein)[slot] == NULL) {
+            break;
+        }
+    }
+    if (slot == PULSEIN_CAPTURE_COUNT) {
+        return;
+    }
+    // 32 bit mode pairs an even TC with the odd one after it. tc_is_free() keeps other users
+    // off the client half while we hold it.
+    uint8_t tc_index = TC_INST_NUM;
+    for (uint8_t i = TC_INST_NUM & ~1; i > 0; i -= 2) {
+        if (tc_is_free(i - 2) && tc_is_free(i - 1)) {
+            tc_index = i - 2;
+            break;
+        }
+    }
+    if (tc_index == TC_INST_NUM) {
+        return;
+    }
+    turn_on_event_system();
+    uint8_t event_channel = find_async_event_channel();
+    if (event_channel >= EVSYS_CHANNELS) {
+        return;
+    }
+    uint8_t dma_channel = audio_dma_allocate_channel();
+    if (dma_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        return;
+    }
+    self->timestamps = (uint32_t *) m_malloc_maybe(CAPTURE_RING_LENGTH * sizeof(uint32_t), false);
+    if (self->timestamps == NULL) {
+        audio_dma_free_channel(dma_channel);
+        return;
+    }
+    self->tc_index = tc_index;
+    self->event_channel = event_channel;
+    self->dma_channel = dma_channel;
+    MP_STATE_PORT(capturing_pulsein)[slot] = self;
+
+    Tc* tc = tc_insts[tc_index];
+    set_timer_handler(true, tc_index, TC_HANDLER_NO_INTERRUPT);
+    turn_on_clocks(true, tc_index, 1);
+    turn_on_clocks(true, tc_index + 1, 1);
+    tc_set_enable(tc, false);
+    tc_reset(tc);
+    tc->COUNT32.CTRLA.reg = TC_CTRLA_MODE_COUNT32 |
+                            TC_CTRLA_PRESCALER_DIV16 |
+                            TC_CTRLA_CAPTEN0;
+    tc->COUNT32.EVCTRL.reg = TC_EVCTRL_EVACT_STAMP | TC_EVCTRL_TCEI;
+
+    // Every edge of the pin goes out of the EIC as an event instead of an interrupt.
+    eic_set_enable(false);
+    uint8_t config_index = self->channel / 8;
+    uint8_t position = (self->channel % 8) * 4;
+    uint32_t masked_value = EIC->CONFIG[config_index].reg & ~(0xf << position);
+    EIC->CONFIG[config_index].reg = masked_value | (EIC_CONFIG_SENSE0_BOTH_Val << position);
+    masked_value = EIC->EVCTRL.bit.EXTINTEO;
+    EIC->EVCTRL.bit.EXTINTEO = masked_value | (1 << self->channel);
+    eic_set_enable(true);
+
+    connect_event_user_to_channel(EVSYS_ID_USER_TC0_EVU + tc_index, event_channel);
+    init_async_event_channel(event_channel, EVSYS_ID_GEN_EIC_EXTINT_0 + self->channel);
+}
+
+static void stop_capture(pulseio_pulsein_obj_t* self) {
+    audio_dma_disable_channel(self->dma_channel);
+    audio_dma_free_channel(self->dma_channel);
+    disable_event_channel(self->event_channel);
+    disable_event_user(EVSYS_ID_USER_TC0_EVU + self->tc_index);
+
+    eic_set_enable(false);
+    uint8_t config_index = self->channel / 8;
+    uint8_t position = (self->channel % 8) * 4;
+    EIC->CONFIG[config_index].reg &= ~(0xf << position);
+    uint32_t masked_value = EIC->EVCTRL.bit.EXTINTEO;
+    EIC->EVCTRL.bit.EXTINTEO = masked_value & ~(1 << self->channel);
+    eic_set_enable(true);
+    if (EIC->EVCTRL.reg == 0 && EIC->INTENSET.reg == 0) {
+        eic_reset();
+        turn_off_external_interrupt_controller();
+    }
+
+    Tc* tc = tc_insts[self->tc_index];
+    tc_set_enable(tc, false);
+    tc_reset(tc);
+
+    for (uint8_t slot = 0; slot < PULSEIN_CAPTURE_COUNT; slot++) {
+        if (MP_STATE_PORT(capturing_pulsein)[slot] == self) {
+            MP_STATE_PORT(capturing_pulsein)[slot] = NULL;
+        }
+    }
+    self->timestamps = NULL;
+    self->tc_index = TC_INST_NUM;
+}
+
+// Where the DMA will put the next timestamp. The write back copy of the descriptor counts down the
+// entries left before it starts over.
+static uint16_t capture_write(pulseio_pulsein_obj_t* self) {
+    DmacDescriptor* write_back = ((DmacDescriptor*) DMAC->WRBADDR.reg) + self->dma_channel;
+    return (CAPTURE_RING_LENGTH - write_back->BTCNT.reg) % CAPTURE_RING_LENGTH;
+}
 
-        uint16_t i = (self->start + self->len) % self->maxlen;
-        self->buffer[i] = duration;
-        if (self->len < self->maxlen) {
-            self->len++;
+// Turns the timestamps written since the last call into durations.
+static void update_capture(pulseio_pulsein_obj_t* self) {
+    Tc* tc = tc_insts[self->tc_index];
+    if (tc->COUNT32.INTFLAG.bit.ERR) {
+        // An edge came in before the DMA had taken the timestamp of the one before it.
+        tc->COUNT32.INTFLAG.reg = TC_INTFLAG_ERR;
+        self->overflowed = true;
+    }
+    uint16_t write = capture_write(self);
+    uint16_t previous = (self->timestamp_read + CAPTURE_RING_LENGTH - 1) % CAPTURE_RING_LENGTH;
+    if (self->timestamps[previous] != self->last_entry) {
+        // The DMA went all the way around and wrote over entries that weren't read. Drop the
+        // ring and start timing over at the next edge.
+        self->overflowed = true;
+        self->first_edge = true;
+        self->wraps = 0;
+        self->timestamp_read = write;
+        previous = (write + CAPTURE_RING_LENGTH - 1) % CAPTURE_RING_LENGTH;
+        self->last_entry = self->timestamps[previous];
+        return;
+    }
+    while (self->timestamp_read != write) {
+        uint32_t timestamp = self->timestamps[self->timestamp_read];
+        self->timestamp_read = (self->timestamp_read + 1) % CAPTURE_RING_LENGTH;
+        self->last_entry = timestamp;
+        if (timestamp == CAPTURE_WRAPPED) {
+            if (self->wraps < 2) {
+                self->wraps++;
+            }
+            continue;
+        }
+        if (self->first_edge) {
+            self->first_edge = false;
         } else {
-            self->start++;
+            // Unsigned math covers a single wrap between the two edges.
+            uint32_t duration = 0xffff;
+            if (self->wraps == 0 || (self->wraps == 1 && timestamp < self->last_timestamp)) {
+                duration = MIN(duration, (timestamp - self->last_timestamp) / CAPTURE_TICKS_PER_US);
+            }
+            push_duration(self, duration);
+        }
+        self->wraps = 0;
+        self->last_timestamp = timestamp;
+    }
+}
+
+// Keeps the ring from filling up while the program is busy with other things.
+void pulsein_background(void) {
+    for (uint8_t slot = 0; slot < PULSEIN_CAPTURE_COUNT; slot++) {
+        pulseio_pulsein_obj_t* self = MP_STATE_PORT(capturing_pulsein)[slot];
+        if (self != NULL && !common_hal_pulseio_pulsein_get_paused(self)) {
+            update_capture(self);
         }
     }
-    self->last_ms = current_ms;
-    self->last_us = current_us;
+}
+#endif
+
+void pulsein_reset(void) {
+    #ifdef SAMD51
+    // The timers, events and EIC are reset on their own.
+    for (uint8_t slot = 0; slot < PULSEIN_CAPTURE_COUNT; slot++) {
+        pulseio_pulsein_obj_t* self = MP_STATE_PORT(capturing_pulsein)[slot];
+        if (self != NULL) {
+            audio_dma_disable_channel(self->dma_channel);
+            audio_dma_free_channel(self->dma_channel);
+        }
+        MP_STATE_PORT(capturing_pulsein)[slot] = NULL;
+    }
+    #endif
 }
 
 void common_hal_pulseio_pulsein_construct(pulseio_pulsein_obj_t* self,
@@ -129,6 +355,7 @@ void common_hal_pulseio_pulsein_construct(pulseio_pulsein_obj_t* self,
     self->last_us = 0;
     self->last_ms = 0;
     self->errored_too_fast = false;
+    self->overflowed = false;
 
     set_eic_channel_data(pin->extint_channel, (void*) self);
 
@@ -139,10 +366,19 @@ void common_hal_pulseio_pulsein_construct(pulseio_pulsein_obj_t* self,
 
     gpio_set_pin_function(pin->number, GPIO_PIN_FUNCTION_A);
 
-    turn_on_cpu_interrupt(self->channel);
-
     claim_pin(pin);
 
+    #ifdef SAMD51
+    setup_capture(self);
+    if (capturing(self)) {
+        start_capture_dma(self);
+        tc_set_enable(tc_insts[self->tc_index], true);
+        return;
+    }
+    #endif
+
+    turn_on_cpu_interrupt(self->channel);
+
     // Set config will enable the EIC.
     pulsein_set_config(self, true);
 }
@@ -155,13 +391,31 @@ void common_hal_pulseio_pulsein_deinit(pulseio_pulsein_obj_t* self) {
     if (common_hal_pulseio_pulsein_deinited(self)) {
         return;
     }
-    set_eic_handler(self->channel, EIC_HANDLER_NO_INTERRUPT);
-    turn_off_eic_channel(self->channel);
+    #ifdef SAMD51
+    if (capturing(self)) {
+        stop_capture(self);
+    } else
+    #endif
+    {
+        set_eic_handler(self->channel, EIC_HANDLER_NO_INTERRUPT);
+        turn_off_eic_channel(self->channel);
+    }
     reset_pin_number(self->pin);
     self->pin = NO_PIN;
 }
 
 void common_hal_pulseio_pulsein_pause(pulseio_pulsein_obj_t* self) {
+    #ifdef SAMD51
+    if (capturing(self)) {
+        Tc* tc = tc_insts[self->tc_index];
+        if (tc->COUNT32.CTRLA.bit.ENABLE) {
+            // Keep the edges that came in before the pause.
+            update_capture(self);
+            tc_set_enable(tc, false);
+        }
+        return;
+    }
+    #endif
     uint32_t mask = 1 << self->channel;
     EIC->INTENCLR.reg = mask << EIC_INTENSET_EXTINT_Pos;
 }
@@ -173,6 +427,7 @@ void common_hal_pulseio_pulsein_resume(pulseio_pulsein_obj_t* self,
 
     // Reset erroring
     self->errored_too_fast = false;
+    self->overflowed = false;
 
     // Send the trigger pulse.
     if (trigger_duration > 0) {
@@ -188,6 +443,19 @@ void common_hal_pulseio_pulsein_resume(pulseio_pulsein_obj_t* self,
     self->last_ms = 0;
     self->last_us = 0;
     gpio_set_pin_function(self->pin, GPIO_PIN_FUNCTION_A);
+
+    #ifdef SAMD51
+    if (capturing(self)) {
+        Tc* tc = tc_insts[self->tc_index];
+        audio_dma_disable_channel(self->dma_channel);
+        tc->COUNT32.COUNT.reg = 0;
+        tc->COUNT32.INTFLAG.reg = TC_INTFLAG_MC0 | TC_INTFLAG_ERR | TC_INTFLAG_OVF;
+        start_capture_dma(self);
+        tc_set_enable(tc, true);
+        return;
+    }
+    #endif
+
     uint32_t mask = 1 << self->channel;
     // Clear previous interrupt state and re-enable it.
     EIC->INTFLAG.reg = mask << EIC_INTFLAG_EXTINT_Pos;
@@ -200,10 +468,21 @@ void common_hal_pulseio_pulsein_clear(pulseio_pulsein_obj_t* self) {
     common_hal_mcu_disable_interrupts();
     self->start = 0;
     self->len = 0;
+    self->overflowed = false;
     common_hal_mcu_enable_interrupts();
 }
 
+// Brings the pulses up to date when the timer times the edges.
+static void update(pulseio_pulsein_obj_t* self) {
+    #ifdef SAMD51
+    if (capturing(self) && !common_hal_pulseio_pulsein_get_paused(self)) {
+        update_capture(self);
+    }
+    #endif
+}
+
 uint16_t common_hal_pulseio_pulsein_popleft(pulseio_pulsein_obj_t* self) {
+    update(self);
     if (self->len == 0) {
         mp_raise_IndexError(translate("pop from an empty PulseIn"));
     }
@@ -221,16 +500,28 @@ uint16_t common_hal_pulseio_pulsein_get_maxlen(pulseio_pulsein_obj_t* self) {
 }
 
 uint16_t common_hal_pulseio_pulsein_get_len(pulseio_pulsein_obj_t* self) {
+    update(self);
     return self->len;
 }
 
 bool common_hal_pulseio_pulsein_get_paused(pulseio_pulsein_obj_t* self) {
+    #ifdef SAMD51
+    if (capturing(self)) {
+        return tc_insts[self->tc_index]->COUNT32.CTRLA.bit.ENABLE == 0;
+    }
+    #endif
     uint32_t mask = 1 << self->channel;
     return (EIC->INTENSET.reg & (mask << EIC_INTENSET_EXTINT_Pos)) == 0;
 }
 
+bool common_hal_pulseio_pulsein_get_overflowed(pulseio_pulsein_obj_t* self) {
+    update(self);
+    return self->overflowed;
+}
+
 uint16_t common_hal_pulseio_pulsein_get_item(pulseio_pulsein_obj_t* self,
         int16_t index) {
+    update(self);
     common_hal_mcu_disable_interrupts();
     if (index < 0) {
         index += self->len;
@@ -44,9 +44,22 @@ typedef struct {
     volatile uint64_t last_ms;
     volatile uint16_t last_us;
     volatile bool errored_too_fast;
+    volatile bool overflowed;
+    #ifdef SAMD51
+    // Hardware timing. tc_index is TC_INST_NUM when the interrupt handler times edges instead.
+    uint32_t* timestamps;
+    uint32_t last_timestamp;
+    uint32_t last_entry;
+    uint16_t timestamp_read;
+    uint8_t tc_index;
+    uint8_t event_channel;
+    uint8_t dma_channel;
+    uint8_t wraps;
+    #endif
 } pulseio_pulsein_obj_t;
 
 void pulsein_reset(void);
+void pulsein_background(void);
 
 void pulsein_interrupt_handler(uint8_t channel);
 
@@ -102,7 +102,7 @@ void common_hal_pulseio_pulseout_construct(pulseio_pulseout_obj_t* self,
         Tc *tc = NULL;
         int8_t index = TC_INST_NUM - 1;
         for (; index >= 0; index--) {
-            if (tc_insts[index]->COUNT16.CTRLA.bit.ENABLE == 0) {
+            if (tc_is_free(index)) {
                 tc = tc_insts[index];
                 break;
             }
@@ -39,8 +39,8 @@ void common_hal_rotaryio_incrementalencoder_construct(rotaryio_incrementalencode
         mp_raise_RuntimeError(translate("Both pins must support hardware interrupts"));
     }
 
-    // TODO: The SAMD51 has a peripheral dedicated to quadrature encoder debugging. Use it instead
-    // of the external interrupt.
+    // TODO: The SAMD51 PDEC peripheral can decode quadrature without interrupts but only on
+    // its own pins. Use it when both pins support it.
 
     if (eic_get_enable()) {
         if (!eic_channel_free(pin_a->extint_channel) || !eic_channel_free(pin_b->extint_channel)) {
@@ -147,12 +147,14 @@ void incrementalencoder_interrupt_handler(uint8_t channel) {
         0,    // 11 -> 11 no movement
     };
 
-    // Shift the old AB bits to the "old" position, and set the new AB bits.
-    // TODO(tannewt): If we need more speed then read the pin directly. gpio_get_pin_level has
-    // smarts to compensate for pin direction we don't need.
+    // Shift the old AB bits to the "old" position, and set the new AB bits. Read the IN
+    // registers directly because this runs on every edge of both pins. Both pins are inputs so
+    // gpio_get_pin_level's direction handling isn't needed.
+    uint32_t in_a = PORT->Group[GPIO_PORT(self->pin_a)].IN.reg;
+    uint32_t in_b = PORT->Group[GPIO_PORT(self->pin_b)].IN.reg;
     self->last_state = (self->last_state & 0x3) << 2 |
-        ((uint8_t) gpio_get_pin_level(self->pin_a) << 1) |
-        (uint8_t) gpio_get_pin_level(self->pin_b);
+        (((in_a >> GPIO_PIN(self->pin_a)) & 1) << 1) |
+        ((in_b >> GPIO_PIN(self->pin_b)) & 1);
 
     int8_t quarter_incr = transitions[self->last_state];
     if (quarter_incr == BAD) {
@@ -31,7 +31,9 @@
 #include "py/runtime.h"
 #include "py/binary.h"
 #include "py/mphal.h"
+#include "py/mpstate.h"
 #include "shared-bindings/touchio/TouchIn.h"
+#include "supervisor/shared/background_task.h"
 #include "supervisor/shared/translate.h"
 
 // Native touchio only exists for SAMD21
@@ -47,6 +49,52 @@
 
 bool touch_enabled = false;
 
+// The PTC converts one pad at a time. The background task collects the result and starts the
+// next pad so the CPU never waits on a conversion after the first one.
+static touchio_touchin_obj_t* converting = NULL;
+// Set while a reading is taken directly so the background task leaves the PTC alone.
+static bool reading_directly = false;
+
+static void start_conversion(touchio_touchin_obj_t *self) {
+    converting = self;
+    adafruit_ptc_start_conversion(PTC, &self->config);
+}
+
+static void touchin_background(void) {
+    if (reading_directly) {
+        return;
+    }
+    if (converting != NULL) {
+        if (!adafruit_ptc_is_conversion_finished(PTC)) {
+            return;
+        }
+        touchio_filter_add(&converting->filter, adafruit_ptc_get_conversion_result(PTC));
+    }
+    touchio_touchin_obj_t* next = converting == NULL ? NULL : converting->next;
+    if (next == NULL) {
+        next = MP_STATE_VM(touchio_touchins);
+    }
+    converting = NULL;
+    if (next != NULL) {
+        start_conversion(next);
+    }
+}
+
+static background_task_t touchin_task =
+    BACKGROUND_TASK(touchin_background, BACKGROUND_TASK_PRIORITY_NORMAL, 0);
+
+// Waits for the background conversion, if any, and keeps its result.
+static void finish_conversion(void) {
+    if (converting == NULL) {
+        return;
+    }
+    while (!adafruit_ptc_is_conversion_finished(PTC)) {
+        RUN_BACKGROUND_TASKS;
+    }
+    touchio_filter_add(&converting->filter, adafruit_ptc_get_conversion_result(PTC));
+    converting = NULL;
+}
+
 static uint16_t get_raw_reading(touchio_touchin_obj_t *self) {
     adafruit_ptc_start_conversion(PTC, &self->config);
 
@@ -80,6 +128,9 @@ void common_hal_touchio_touchin_construct(touchio_touchin_obj_t* self,
         _pm_enable_bus_clock(PM_BUS_APBC, PTC);
     }
 
+    reading_directly = true;
+    finish_conversion();
+
     adafruit_ptc_get_config_default(&self->config);
     self->config.pin = pin->number;
     self->config.yline = pin->touch_y_line;
@@ -93,7 +144,13 @@ void common_hal_touchio_touchin_construct(touchio_touchin_obj_t* self,
     // For simple finger touch, the values may vary as much as a factor of two,
     // but for touches using fruit or other objects, the difference is much less.
 
-    self->threshold = get_raw_reading(self) + 100;
+    uint16_t raw_reading = get_raw_reading(self);
+    touchio_filter_init(&self->filter, raw_reading, raw_reading + 100);
+
+    self->next = MP_STATE_VM(touchio_touchins);
+    MP_STATE_VM(touchio_touchins) = self;
+    reading_directly = false;
+    background_task_register(&touchin_task);
 }
 
 bool common_hal_touchio_touchin_deinited(touchio_touchin_obj_t* self) {
@@ -107,11 +164,27 @@ void common_hal_touchio_touchin_deinit(touchio_touchin_obj_t* self) {
     }
     // We leave the clocks running because they may be in use by others.
 
+    if (converting == self) {
+        finish_conversion();
+    }
+    touchio_touchin_obj_t** link = (touchio_touchin_obj_t**) &MP_STATE_VM(touchio_touchins);
+    while (*link != NULL && *link != self) {
+        link = &(*link)->next;
+    }
+    if (*link == self) {
+        *link = self->next;
+    }
+
     reset_pin_number(self->config.pin);
     self->config.pin = NO_PIN;
 }
 
 void touchin_reset() {
+    // The TouchIns are on the heap so stop converting them before it goes away.
+    MP_STATE_VM(touchio_touchins) = NULL;
+    converting = NULL;
+    reading_directly = false;
+
     Ptc* ptc = ((Ptc *) PTC);
     if (ptc->CTRLA.bit.ENABLE == 1) {
         ptc->CTRLA.bit.ENABLE = 0;
@@ -123,20 +196,19 @@ void touchin_reset() {
 }
 
 bool common_hal_touchio_touchin_get_value(touchio_touchin_obj_t *self) {
-    uint16_t reading = get_raw_reading(self);
-    return reading > self->threshold;
+    return touchio_filter_touched(&self->filter);
 }
 
 uint16_t common_hal_touchio_touchin_get_raw_value(touchio_touchin_obj_t *self) {
-    return get_raw_reading(self);
+    return touchio_filter_get_raw_value(&self->filter);
 }
 
 uint16_t common_hal_touchio_touchin_get_threshold(touchio_touchin_obj_t *self) {
-    return self->threshold;
+    return self->filter.threshold;
 }
 
 void common_hal_touchio_touchin_set_threshold(touchio_touchin_obj_t *self, uint16_t new_threshold) {
-    self->threshold = new_threshold;
+    touchio_filter_set_threshold(&self->filter, new_threshold);
 }
 
 #endif // SAMD21
@@ -36,11 +36,14 @@
 #include "adafruit_ptc.h"
 
 #include "py/obj.h"
+#include "shared-module/touchio/__init__.h"
 
-typedef struct {
+typedef struct _touchio_touchin_obj_t {
     mp_obj_base_t base;
     struct adafruit_ptc_config config;
-    uint16_t threshold;
+    // Active TouchIns are linked from MP_STATE_VM(touchio_touchins).
+    struct _touchio_touchin_obj_t* next;
+    touchio_filter_t filter;
 } touchio_touchin_obj_t;
 
 void touchin_reset(void);
@@ -24,6 +24,7 @@
  * THE SOFTWARE.
  */
 
+#include "common-hal/alarm/__init__.h"
 #include "common-hal/pulseio/PulseIn.h"
 #include "common-hal/ps2io/Ps2.h"
 #include "common-hal/rotaryio/IncrementalEncoder.h"
@@ -59,6 +60,12 @@ void shared_eic_handler(uint8_t channel) {
         break;
 #endif
 
+#if CIRCUITPY_ALARM
+    case EIC_HANDLER_ALARM:
+        alarm_pin_interrupt_handler(channel);
+        break;
+#endif
+
     default:
         break;
     }
@@ -42,6 +42,8 @@
 #define CIRCUITPY_MCU_FAMILY                        samd21
 #define MICROPY_PY_SYS_PLATFORM                     "Atmel SAMD21"
 #define SPI_FLASH_MAX_BAUDRATE 8000000
+// Cortex-M0+: one cycle to count down, two for the taken branch.
+#define BITBANGIO_SPIN_CYCLES (3)
 #define MICROPY_PY_BUILTINS_NOTIMPLEMENTED          (0)
 #define MICROPY_PY_COLLECTIONS_ORDEREDDICT          (0)
 #define MICROPY_PY_FUNCTION_ATTRS                   (0)
@@ -73,6 +75,8 @@
 #define CIRCUITPY_MCU_FAMILY                        samd51
 #define MICROPY_PY_SYS_PLATFORM                     "MicroChip SAMD51"
 #define SPI_FLASH_MAX_BAUDRATE 24000000
+// Cortex-M4: a cycle to count down and at least one more for the taken branch.
+#define BITBANGIO_SPIN_CYCLES (2)
 #define MICROPY_PY_BUILTINS_NOTIMPLEMENTED          (1)
 #define MICROPY_PY_COLLECTIONS_ORDEREDDICT          (1)
 #define MICROPY_PY_FUNCTION_ATTRS                   (1)
@@ -217,8 +221,16 @@
 
 #include "peripherals/samd/dma.h"
 
+// PulseIns that can have their edges timestamped by a timer pair at once.
+#define PULSEIN_CAPTURE_COUNT (2)
+
 #define MICROPY_PORT_ROOT_POINTERS \
     CIRCUITPY_COMMON_ROOT_POINTERS \
-    mp_obj_t playing_audio[AUDIO_DMA_CHANNEL_COUNT];
+    mp_obj_t playing_audio[AUDIO_DMA_CHANNEL_COUNT]; \
+    mp_obj_t recording_pdmin; \
+    mp_obj_t sampling_bufferedin; \
+    mp_obj_t capturing_pulsein[PULSEIN_CAPTURE_COUNT]; \
+    mp_obj_t portouts; \
+    void* neopixel_pattern;
 
 #endif  // __INCLUDED_MPCONFIGPORT_H
@@ -49,6 +49,14 @@ CIRCUITPY_TOUCHIO_USE_NATIVE = 0
 
 # The ifndef's allow overriding in mpconfigboard.mk.
 
+ifndef CIRCUITPY_ALARM
+CIRCUITPY_ALARM = 1
+endif
+
+ifndef CIRCUITPY_ANALOGBUFIO
+CIRCUITPY_ANALOGBUFIO = 1
+endif
+
 ifndef CIRCUITPY_NETWORK
 CIRCUITPY_NETWORK = 1
 MICROPY_PY_WIZNET5K = 5500
@@ -62,6 +70,14 @@ ifndef CIRCUITPY_SAMD
 CIRCUITPY_SAMD = 1
 endif
 
+ifndef CIRCUITPY_PULSEIO_PORTOUT
+CIRCUITPY_PULSEIO_PORTOUT = $(CIRCUITPY_PULSEIO)
+endif
+
+ifndef CIRCUITPY_KEYPAD
+CIRCUITPY_KEYPAD = 1
+endif
+
 endif # samd51
 
 INTERNAL_LIBM = 1
@@ -142,6 +142,14 @@ mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32
     return 0; // success
 }
 
+const uint8_t *supervisor_flash_get_mapped_blocks(uint32_t block_num, uint32_t num_blocks) {
+    if (block_num + num_blocks > INTERNAL_FLASH_PART1_NUM_BLOCKS) {
+        return NULL;
+    }
+    // Blocks are written straight through so the flash always holds the latest data.
+    return (const uint8_t *) convert_block_to_flash_addr(block_num);
+}
+
 mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t block_num, uint32_t num_blocks) {
     for (size_t i = 0; i < num_blocks; i++) {
         if (!supervisor_flash_write_block(src + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
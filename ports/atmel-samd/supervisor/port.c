@@ -46,13 +46,19 @@
 #include "hri/hri_rstc_d51.h"
 #endif
 
+#include "common-hal/analogbufio/BufferedIn.h"
 #include "common-hal/analogio/AnalogIn.h"
 #include "common-hal/analogio/AnalogOut.h"
 #include "common-hal/audiobusio/PDMIn.h"
 #include "common-hal/audiobusio/I2SOut.h"
 #include "common-hal/audioio/AudioOut.h"
 #include "common-hal/busio/SPI.h"
+#include "common-hal/busio/UART.h"
+#include "common-hal/displayio/ParallelBus.h"
+#include "common-hal/i2cslave/I2CSlave.h"
 #include "common-hal/microcontroller/Pin.h"
+#include "common-hal/neopixel_write/__init__.h"
+#include "common-hal/pulseio/PortOut.h"
 #include "common-hal/pulseio/PulseIn.h"
 #include "common-hal/pulseio/PulseOut.h"
 #include "common-hal/pulseio/PWMOut.h"
@@ -254,14 +260,24 @@ safe_mode_t port_init(void) {
 }
 
 void reset_port(void) {
+    uart_reset();
     reset_sercoms();
 
+#if CIRCUITPY_NEOPIXEL_WRITE
+    neopixel_write_reset();
+#endif
+
+#if CIRCUITPY_DISPLAYIO && defined(SAMD51)
+    parallelbus_reset();
+#endif
+
 #if CIRCUITPY_AUDIOIO
     audio_dma_reset();
     audioout_reset();
 #endif
 #if CIRCUITPY_AUDIOBUSIO
     i2sout_reset();
+    pdmin_reset_recording();
     //pdmin_reset();
 #endif
 
@@ -269,11 +285,24 @@ void reset_port(void) {
     touchin_reset();
 #endif
     eic_reset();
+#if CIRCUITPY_I2CSLAVE
+    i2cslave_reset();
+#endif
+#if CIRCUITPY_PS2IO
+    ps2_reset();
+#endif
 #if CIRCUITPY_PULSEIO
+    pulsein_reset();
     pulseout_reset();
+#if CIRCUITPY_PULSEIO_PORTOUT
+    portout_reset();
+#endif
     pwmout_reset();
 #endif
 
+#if CIRCUITPY_ANALOGBUFIO
+    bufferedin_reset_sampling();
+#endif
 #if CIRCUITPY_ANALOGIO
     analogin_reset();
     analogout_reset();
@@ -347,6 +376,11 @@ uint32_t port_get_saved_word(void) {
     return *safe_word;
 }
 
+void port_sleep_until_interrupt(void) {
+    // The sleep mode is left at idle so SysTick, USB and DMA interrupts all wake the CPU.
+    __WFI();
+}
+
 /**
  * \brief Default interrupt handler for unused IRQs.
  */
@@ -26,6 +26,8 @@
 
 #include "tick.h"
 
+#include "py/mphal.h"
+
 #include "peripheral_clk_config.h"
 
 #include "supervisor/shared/tick.h"
@@ -64,6 +66,10 @@ void tick_init() {
     NVIC_SetPriority(USB_1_IRQn, 1);
     NVIC_SetPriority(USB_2_IRQn, 1);
     NVIC_SetPriority(USB_3_IRQn, 1);
+
+    // Start the cycle counter for mp_hal_ticks_cpu(). Code timing with it must not reset it.
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
     #endif
 }
 
@@ -105,3 +111,36 @@ void wait_until(uint64_t ms, uint32_t us_until_ms) {
     uint32_t ticks_per_us = common_hal_mcu_processor_get_frequency() / 1000 / 1000;
     while (supervisor_ticks_ms64() <= ms && SysTick->VAL / ticks_per_us >= us_until_ms) {}
 }
+
+// Microseconds from the supervisor tick and how far SysTick has counted down within it.
+mp_uint_t mp_hal_ticks_us(void) {
+    uint32_t ms;
+    uint32_t remaining;
+    // Read again if the tick interrupt ran in between.
+    do {
+        ms = supervisor_ticks_ms32();
+        remaining = SysTick->VAL;
+    } while (ms != supervisor_ticks_ms32());
+    uint32_t period = SysTick->LOAD + 1;
+    return ms * 1000 + (period - 1 - remaining) * 1000 / period;
+}
+
+#ifdef SAMD51
+// CPU cycles from the DWT cycle counter started in tick_init().
+mp_uint_t mp_hal_ticks_cpu(void) {
+    return DWT->CYCCNT;
+}
+#else
+// The Cortex-M0+ has no cycle counter, so count whole SysTick periods plus the cycles into the
+// current one.
+mp_uint_t mp_hal_ticks_cpu(void) {
+    uint32_t ms;
+    uint32_t remaining;
+    do {
+        ms = supervisor_ticks_ms32();
+        remaining = SysTick->VAL;
+    } while (ms != supervisor_ticks_ms32());
+    uint32_t period = SysTick->LOAD + 1;
+    return ms * period + (period - 1 - remaining);
+}
+#endif
@@ -29,6 +29,9 @@
 
 #include "timer_handler.h"
 
+#include "samd/timers.h"
+
+#include "common-hal/alarm/__init__.h"
 #include "common-hal/pulseio/PulseOut.h"
 #include "shared-module/_pew/PewPew.h"
 #include "common-hal/frequencyio/FrequencyIn.h"
@@ -41,6 +44,20 @@ void set_timer_handler(bool is_tc, uint8_t index, uint8_t timer_handler) {
     }
 }
 
+bool tc_is_free(uint8_t index) {
+    Tc* tc = tc_insts[index];
+    if (tc->COUNT16.CTRLA.bit.ENABLE == 1) {
+        return false;
+    }
+    #ifdef SAMD51
+    // A client TC keeps its own CTRLA so it reads as disabled while its host counts.
+    if (tc->COUNT16.STATUS.bit.SLAVE == 1) {
+        return false;
+    }
+    #endif
+    return true;
+}
+
 void shared_timer_handler(bool is_tc, uint8_t index) {
     // Add calls to interrupt handlers for specific functionality here.
     // Make sure to add the handler #define to timer_handler.h
@@ -62,6 +79,11 @@ void shared_timer_handler(bool is_tc, uint8_t index) {
                 frequencyin_interrupt_handler(index);
             #endif
                 break;
+            case TC_HANDLER_ALARM:
+            #if CIRCUITPY_ALARM
+                alarm_timer_interrupt_handler(index);
+            #endif
+                break;
             default:
                 break;
         }
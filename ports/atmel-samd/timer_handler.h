@@ -30,8 +30,12 @@
 #define TC_HANDLER_PULSEOUT 0x1
 #define TC_HANDLER_PEW 0x2
 #define TC_HANDLER_FREQUENCYIN 0x3
+#define TC_HANDLER_ALARM 0x4
 
 void set_timer_handler(bool is_tc, uint8_t index, uint8_t timer_handler);
 void shared_timer_handler(bool is_tc, uint8_t index);
 
+// True when the TC isn't running on its own or as the client half of a 32 bit pair.
+bool tc_is_free(uint8_t index);
+
 #endif  // MICROPY_INCLUDED_ATMEL_SAMD_TIMER_HANDLER_H
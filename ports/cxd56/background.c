@@ -26,12 +26,22 @@
 
 #include "background.h"
 
+#include "py/gc.h"
 #include "supervisor/usb.h"
 #include "supervisor/filesystem.h"
+#include "supervisor/shared/background_task.h"
 #include "supervisor/shared/stack.h"
 
 static bool running_background_tasks = false;
 
+STATIC background_task_t background_tasks[] = {
+    BACKGROUND_TASK(usb_background, BACKGROUND_TASK_PRIORITY_HIGH, 0),
+    BACKGROUND_TASK(filesystem_background, BACKGROUND_TASK_PRIORITY_NORMAL, 0),
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    BACKGROUND_TASK(gc_sweep_background, BACKGROUND_TASK_PRIORITY_LOW, 2),
+    #endif
+};
+
 void background_tasks_reset(void) {
     running_background_tasks = false;
 }
@@ -45,9 +55,8 @@ void run_background_tasks(void) {
     assert_heap_ok();
     running_background_tasks = true;
 
-    usb_background();
-    filesystem_background();
-
+    background_task_register_all(background_tasks, MP_ARRAY_SIZE(background_tasks));
+    background_task_run_all();
     running_background_tasks = false;
     assert_heap_ok();
 }
@@ -0,0 +1,350 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <errno.h>
+#include <string.h>
+
+#include <asmp/asmp.h>
+#include <asmp/mptask.h>
+#include <asmp/mpmq.h>
+#include <asmp/mpshm.h>
+
+#include "lib/utils/context_manager_helpers.h"
+#include "lib/utils/interrupt_char.h"
+#include "py/mphal.h"
+#include "py/mperrno.h"
+#include "py/objproperty.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+#include "bindings/asmp/Worker.h"
+#include "shared-bindings/util.h"
+#include "supervisor/shared/tick.h"
+
+// Shared memory is handed out in whole 64K tiles.
+#define ASMP_SHM_TILE (64 * 1024)
+// How long each wait for a message lasts before background tasks get a turn.
+#define ASMP_POLL_MS (10)
+
+typedef struct {
+    mptask_t task;
+    mpmq_t mq;
+    mpshm_t shm;
+    uint8_t *buffer;
+    size_t buffer_size;
+    bool in_use;
+} asmp_worker_slot_t;
+
+STATIC asmp_worker_slot_t slots[ASMP_MAX_WORKERS];
+
+STATIC void slot_release(asmp_worker_slot_t *slot) {
+    int wret;
+    mptask_destroy(&slot->task, false, &wret);
+    mpmq_destroy(&slot->mq);
+    if (slot->buffer_size != 0) {
+        if (slot->buffer != NULL) {
+            mpshm_detach(&slot->shm);
+        }
+        mpshm_destroy(&slot->shm);
+        slot->buffer = NULL;
+        slot->buffer_size = 0;
+    }
+    slot->in_use = false;
+}
+
+void asmp_reset(void) {
+    for (size_t i = 0; i < ASMP_MAX_WORKERS; i++) {
+        if (slots[i].in_use) {
+            slot_release(&slots[i]);
+        }
+    }
+}
+
+STATIC void check_ret(int ret) {
+    if (ret < 0) {
+        mp_raise_OSError(-ret);
+    }
+}
+
+//| .. currentmodule:: asmp
+//|
+//| :class:`Worker` -- A program running on another core
+//| =====================================================
+//|
+//| Loads a worker program built with the Spresense SDK onto a free core and exchanges
+//| messages with it. The worker does the heavy lifting, such as decoding audio or running an
+//| FFT, while the VM keeps running; `receive` collects its results.
+//|
+//| .. class:: Worker(filename, *, buffer_size=0)
+//|
+//|   Start the worker program stored at ``filename`` in the SDK's file system (not CIRCUITPY).
+//|
+//|   :param str filename: Path of the worker ELF, for example ``"/mnt/spif/fft"``
+//|   :param int buffer_size: Bytes of memory to share with the worker as `buffer`. It is
+//|     rounded up to a multiple of 64K.
+//|
+STATIC mp_obj_t asmp_worker_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_filename, ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_filename, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_buffer_size, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, 0, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    const char *filename = mp_obj_str_get_str(args[ARG_filename].u_obj);
+    mp_int_t buffer_size = args[ARG_buffer_size].u_int;
+    if (buffer_size < 0) {
+        mp_raise_ValueError(translate("Invalid buffer size"));
+    }
+
+    int index = -1;
+    for (size_t i = 0; i < ASMP_MAX_WORKERS; i++) {
+        if (!slots[i].in_use) {
+            index = i;
+            break;
+        }
+    }
+    if (index < 0) {
+        mp_raise_RuntimeError(translate("All cores in use"));
+    }
+    asmp_worker_slot_t *slot = &slots[index];
+    memset(slot, 0, sizeof(*slot));
+
+    int ret = mptask_init(&slot->task, filename);
+    check_ret(ret);
+    ret = mptask_assign(&slot->task);
+    if (ret < 0) {
+        int wret;
+        mptask_destroy(&slot->task, false, &wret);
+        check_ret(ret);
+    }
+    slot->in_use = true;
+
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        // Keys only need to be unique between the workers that are running.
+        check_ret(mpmq_init(&slot->mq, 2 * index + 1, mptask_getcpuid(&slot->task)));
+        check_ret(mptask_bindobj(&slot->task, &slot->mq));
+        if (buffer_size > 0) {
+            size_t size = (buffer_size + ASMP_SHM_TILE - 1) & ~(ASMP_SHM_TILE - 1);
+            check_ret(mpshm_init(&slot->shm, 2 * index + 2, size));
+            slot->buffer_size = size;
+            check_ret(mptask_bindobj(&slot->task, &slot->shm));
+            slot->buffer = mpshm_attach(&slot->shm, 0);
+            if (slot->buffer == NULL) {
+                mp_raise_OSError(MP_ENOMEM);
+            }
+        }
+        check_ret(mptask_exec(&slot->task));
+        nlr_pop();
+    } else {
+        slot_release(slot);
+        nlr_jump(nlr.ret_val);
+    }
+
+    asmp_worker_obj_t *self = m_new_obj(asmp_worker_obj_t);
+    self->base.type = &asmp_worker_type;
+    self->slot = index;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC asmp_worker_slot_t *get_slot(mp_obj_t self_in) {
+    asmp_worker_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->slot < 0) {
+        raise_deinited_error();
+    }
+    return &slots[self->slot];
+}
+
+//|   .. method:: deinit()
+//|
+//|     Stop the worker and free its core and shared memory.
+//|
+STATIC mp_obj_t asmp_worker_deinit(mp_obj_t self_in) {
+    asmp_worker_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->slot >= 0) {
+        slot_release(&slots[self->slot]);
+        self->slot = -1;
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(asmp_worker_deinit_obj, asmp_worker_deinit);
+
+//|   .. method:: __enter__()
+//|
+//|     No-op used by Context Managers.
+//|
+//  Provided by context manager helper.
+
+//|   .. method:: __exit__()
+//|
+//|     Automatically deinitializes the hardware when exiting a context. See
+//|     :ref:`lifetime-and-contextmanagers` for more info.
+//|
+STATIC mp_obj_t asmp_worker_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    asmp_worker_deinit(args[0]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(asmp_worker___exit___obj, 4, 4, asmp_worker_obj___exit__);
+
+//|   .. attribute:: buffer
+//|
+//|     The memory shared with the worker as a `bytearray`, or ``None`` if ``buffer_size`` was
+//|     0. It must not be used after `deinit`. (read-only)
+//|
+STATIC mp_obj_t asmp_worker_obj_get_buffer(mp_obj_t self_in) {
+    asmp_worker_slot_t *slot = get_slot(self_in);
+    if (slot->buffer == NULL) {
+        return mp_const_none;
+    }
+    return mp_obj_new_bytearray_by_ref(slot->buffer_size, slot->buffer);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(asmp_worker_get_buffer_obj, asmp_worker_obj_get_buffer);
+
+const mp_obj_property_t asmp_worker_buffer_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&asmp_worker_get_buffer_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|   .. attribute:: buffer_address
+//|
+//|     The address the worker sees `buffer` at, to send it in a message. (read-only)
+//|
+STATIC mp_obj_t asmp_worker_obj_get_buffer_address(mp_obj_t self_in) {
+    asmp_worker_slot_t *slot = get_slot(self_in);
+    if (slot->buffer == NULL) {
+        return mp_const_none;
+    }
+    return mp_obj_new_int_from_uint(mpshm_virt2phys(&slot->shm, slot->buffer));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(asmp_worker_get_buffer_address_obj, asmp_worker_obj_get_buffer_address);
+
+const mp_obj_property_t asmp_worker_buffer_address_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&asmp_worker_get_buffer_address_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|   .. method:: send(message, value=0)
+//|
+//|     Send the worker a message. What ``message`` and ``value`` mean is up to the worker,
+//|     typically a command and an offset or address within `buffer`.
+//|
+//|     :param int message: Message id, 0 to 127
+//|     :param int value: 32 bit value sent with it
+//|
+STATIC mp_obj_t asmp_worker_send(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_message, ARG_value };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_message, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_value, MP_ARG_OBJ, {.u_obj = MP_OBJ_NEW_SMALL_INT(0)} },
+    };
+    asmp_worker_slot_t *slot = get_slot(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t message = args[ARG_message].u_int;
+    if (message < 0 || message > 127) {
+        mp_raise_ValueError_varg(translate("%q must be between %d and %d"), MP_QSTR_message, 0, 127);
+    }
+    check_ret(mpmq_send(&slot->mq, message, mp_obj_get_int_truncated(args[ARG_value].u_obj)));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(asmp_worker_send_obj, 2, asmp_worker_send);
+
+//|   .. method:: receive(timeout=None)
+//|
+//|     Wait for a message from the worker and return it as a ``(message, value)`` tuple.
+//|     Background tasks keep running while waiting.
+//|
+//|     :param float timeout: Seconds to wait, ``0`` to only check, or ``None`` to wait until
+//|       a message arrives
+//|     :return: the message, or ``None`` if none arrived in time
+//|
+STATIC mp_obj_t asmp_worker_receive(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_timeout };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_timeout, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    asmp_worker_slot_t *slot = get_slot(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    bool forever = args[ARG_timeout].u_obj == mp_const_none;
+    uint64_t timeout_ms = 0;
+    if (!forever) {
+        mp_float_t timeout = mp_obj_get_float(args[ARG_timeout].u_obj);
+        if (timeout > 0) {
+            timeout_ms = (uint64_t)(timeout * 1000);
+        }
+    }
+
+    uint64_t start = supervisor_ticks_ms64();
+    while (true) {
+        uint32_t value;
+        uint64_t waited = supervisor_ticks_ms64() - start;
+        uint32_t step = forever ? ASMP_POLL_MS : MAX(1, MIN(ASMP_POLL_MS, timeout_ms - MIN(waited, timeout_ms)));
+        int ret = mpmq_timedreceive(&slot->mq, &value, step);
+        if (ret >= 0) {
+            mp_obj_t items[2] = { MP_OBJ_NEW_SMALL_INT(ret), mp_obj_new_int_from_uint(value) };
+            return mp_obj_new_tuple(2, items);
+        }
+        if (ret != -ETIMEDOUT && ret != -EAGAIN) {
+            mp_raise_OSError(-ret);
+        }
+        if (!forever && supervisor_ticks_ms64() - start >= timeout_ms) {
+            return mp_const_none;
+        }
+        RUN_BACKGROUND_TASKS;
+        if (mp_hal_is_interrupted()) {
+            return mp_const_none;
+        }
+    }
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(asmp_worker_receive_obj, 1, asmp_worker_receive);
+
+STATIC const mp_rom_map_elem_t asmp_worker_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&asmp_worker_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&asmp_worker___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_buffer), MP_ROM_PTR(&asmp_worker_buffer_obj) },
+    { MP_ROM_QSTR(MP_QSTR_buffer_address), MP_ROM_PTR(&asmp_worker_buffer_address_obj) },
+    { MP_ROM_QSTR(MP_QSTR_send), MP_ROM_PTR(&asmp_worker_send_obj) },
+    { MP_ROM_QSTR(MP_QSTR_receive), MP_ROM_PTR(&asmp_worker_receive_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(asmp_worker_locals_dict, asmp_worker_locals_dict_table);
+
+const mp_obj_type_t asmp_worker_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Worker,
+    .make_new = asmp_worker_make_new,
+    .locals_dict = (mp_obj_dict_t*)&asmp_worker_locals_dict,
+};
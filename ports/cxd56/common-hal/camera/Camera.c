@@ -0,0 +1,195 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <nuttx/video/video.h>
+
+#include "py/mperrno.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/camera/Camera.h"
+
+#define CAMERA_DEVPATH "/dev/video"
+// The image processor's DMA writes whole 32 byte lines.
+#define CAMERA_BUFFER_ALIGN (32)
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+} camera_size_t;
+
+// Sizes the ISX012 sensor produces. Uncompressed frames come from the video path, whose limit
+// is VGA.
+STATIC const camera_size_t camera_sizes[] = {
+    { VIDEO_HSIZE_QVGA, VIDEO_VSIZE_QVGA },
+    { VIDEO_HSIZE_VGA, VIDEO_VSIZE_VGA },
+    { VIDEO_HSIZE_HD, VIDEO_VSIZE_HD },
+    { VIDEO_HSIZE_QUADVGA, VIDEO_VSIZE_QUADVGA },
+    { VIDEO_HSIZE_FULLHD, VIDEO_VSIZE_FULLHD },
+    { VIDEO_HSIZE_3M, VIDEO_VSIZE_3M },
+    { VIDEO_HSIZE_5M, VIDEO_VSIZE_5M },
+};
+#define CAMERA_RGB565_SIZES (2)
+
+// Only one camera; its driver stays initialized between objects until reset.
+STATIC bool video_initialized = false;
+STATIC int camera_fd = -1;
+
+void camera_reset(void) {
+    if (camera_fd >= 0) {
+        close(camera_fd);
+        camera_fd = -1;
+    }
+    if (video_initialized) {
+        video_uninitialize();
+        video_initialized = false;
+    }
+}
+
+STATIC void camera_ioctl(int fd, int request, unsigned long arg) {
+    if (ioctl(fd, request, arg) < 0) {
+        mp_raise_OSError(MP_EIO);
+    }
+}
+
+STATIC void camera_set_format(int fd, enum v4l2_buf_type type, uint32_t pixformat, uint16_t width, uint16_t height) {
+    struct v4l2_format fmt = {0};
+    fmt.type = type;
+    fmt.fmt.pix.width = width;
+    fmt.fmt.pix.height = height;
+    fmt.fmt.pix.field = V4L2_FIELD_ANY;
+    fmt.fmt.pix.pixelformat = pixformat;
+    camera_ioctl(fd, VIDIOC_S_FMT, (unsigned long)&fmt);
+}
+
+// Hands the driver the memory to capture into, so the image lands in place with no copy.
+STATIC void camera_set_buffer(int fd, enum v4l2_buf_type type, uint8_t *buffer, size_t len) {
+    struct v4l2_requestbuffers req = {0};
+    req.type = type;
+    req.memory = V4L2_MEMORY_USERPTR;
+    req.count = 1;
+    req.mode = V4L2_BUF_MODE_RING;
+    camera_ioctl(fd, VIDIOC_REQBUFS, (unsigned long)&req);
+
+    struct v4l2_buffer buf = {0};
+    buf.type = type;
+    buf.memory = V4L2_MEMORY_USERPTR;
+    buf.index = 0;
+    buf.m.userptr = (unsigned long)buffer;
+    buf.length = len;
+    camera_ioctl(fd, VIDIOC_QBUF, (unsigned long)&buf);
+}
+
+STATIC size_t camera_dequeue(int fd, enum v4l2_buf_type type) {
+    struct v4l2_buffer buf = {0};
+    buf.type = type;
+    buf.memory = V4L2_MEMORY_USERPTR;
+    camera_ioctl(fd, VIDIOC_DQBUF, (unsigned long)&buf);
+    return buf.bytesused;
+}
+
+void common_hal_camera_camera_construct(camera_camera_obj_t *self) {
+    if (camera_fd >= 0) {
+        mp_raise_ValueError(translate("Camera in use"));
+    }
+    if (!video_initialized) {
+        if (video_initialize(CAMERA_DEVPATH) < 0) {
+            mp_raise_ValueError(translate("Could not initialize Camera"));
+        }
+        video_initialized = true;
+    }
+    camera_fd = open(CAMERA_DEVPATH, 0);
+    if (camera_fd < 0) {
+        mp_raise_ValueError(translate("Could not initialize Camera"));
+    }
+    self->fd = camera_fd;
+}
+
+bool common_hal_camera_camera_deinited(camera_camera_obj_t *self) {
+    return self->fd < 0;
+}
+
+void common_hal_camera_camera_deinit(camera_camera_obj_t *self) {
+    if (common_hal_camera_camera_deinited(self)) {
+        return;
+    }
+    camera_reset();
+    self->fd = -1;
+}
+
+STATIC size_t camera_capture(int fd, uint8_t *buffer, size_t len, uint16_t width, uint16_t height, camera_imageformat_t format) {
+    size_t size;
+    if (format == IMAGEFORMAT_JPG) {
+        // Still capture runs the sensor's JPEG encoder.
+        enum v4l2_buf_type type = V4L2_BUF_TYPE_STILL_CAPTURE;
+        camera_set_format(fd, type, V4L2_PIX_FMT_JPEG, width, height);
+        camera_set_buffer(fd, type, buffer, len);
+        camera_ioctl(fd, VIDIOC_TAKEPICT_START, 0);
+        size = camera_dequeue(fd, type);
+        camera_ioctl(fd, VIDIOC_TAKEPICT_STOP, false);
+    } else {
+        enum v4l2_buf_type type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        camera_set_format(fd, type, V4L2_PIX_FMT_RGB565, width, height);
+        camera_set_buffer(fd, type, buffer, len);
+        camera_ioctl(fd, VIDIOC_STREAMON, (unsigned long)&type);
+        size = camera_dequeue(fd, type);
+        camera_ioctl(fd, VIDIOC_STREAMOFF, (unsigned long)&type);
+    }
+    return size;
+}
+
+size_t common_hal_camera_camera_take_picture(camera_camera_obj_t *self, uint8_t *buffer, size_t len,
+    uint16_t width, uint16_t height, camera_imageformat_t format) {
+    size_t count = format == IMAGEFORMAT_RGB565 ? CAMERA_RGB565_SIZES : MP_ARRAY_SIZE(camera_sizes);
+    bool supported = false;
+    for (size_t i = 0; i < count; i++) {
+        if (camera_sizes[i].width == width && camera_sizes[i].height == height) {
+            supported = true;
+            break;
+        }
+    }
+    if (!supported) {
+        mp_raise_ValueError(translate("Size not supported"));
+    }
+
+    if (((uintptr_t)buffer & (CAMERA_BUFFER_ALIGN - 1)) == 0) {
+        return camera_capture(self->fd, buffer, len & ~(CAMERA_BUFFER_ALIGN - 1), width, height, format);
+    }
+
+    // Capture into an aligned bounce buffer, then copy.
+    size_t aligned_len = (len + CAMERA_BUFFER_ALIGN - 1) & ~(CAMERA_BUFFER_ALIGN - 1);
+    uint8_t *bounce = m_new(uint8_t, aligned_len + CAMERA_BUFFER_ALIGN);
+    uint8_t *aligned = (uint8_t*)(((uintptr_t)bounce + CAMERA_BUFFER_ALIGN - 1) & ~(CAMERA_BUFFER_ALIGN - 1));
+    size_t size = camera_capture(self->fd, aligned, aligned_len, width, height, format);
+    memcpy(buffer, aligned, MIN(size, len));
+    m_del(uint8_t, bounce, aligned_len + CAMERA_BUFFER_ALIGN);
+    return MIN(size, len);
+}
@@ -25,13 +25,14 @@
  */
 
 #include <sys/boardctl.h>
+#include <cxd56_clock.h>
 
 // For NAN: remove when not needed.
 #include <math.h>
 #include "py/mphal.h"
 
 uint32_t common_hal_mcu_processor_get_frequency(void) {
-    return mp_hal_ticks_cpu();
+    return cxd56_get_cpu_baseclk();
 }
 
 float common_hal_mcu_processor_get_temperature(void) {
@@ -8,8 +8,10 @@ USB_CDC_EP_NUM_DATA_IN = 1
 USB_MSC_EP_NUM_OUT = 5
 USB_MSC_EP_NUM_IN = 4
 
+CIRCUITPY_ASMP = 1
 CIRCUITPY_AUDIOIO = 0
 CIRCUITPY_AUDIOBUSIO = 0
+CIRCUITPY_CAMERA = 1
 CIRCUITPY_I2CSLAVE = 0
 CIRCUITPY_ROTARYIO = 0
 CIRCUITPY_TOUCHIO = 0
@@ -31,6 +31,7 @@
 
 #include "py/mpstate.h"
 
+#include "supervisor/port.h"
 #include "supervisor/shared/tick.h"
 
 #define DELAY_CORRECTION    (700)
@@ -52,8 +53,10 @@ mp_uint_t mp_hal_ticks_us(void) {
     return tv.tv_sec * 1000000 + tv.tv_usec;
 }
 
+// NuttX doesn't expose the DWT cycle counter, so scale the microsecond clock. Wrapping stays
+// continuous because both wrap at 2**32.
 mp_uint_t mp_hal_ticks_cpu(void) {
-    return cxd56_get_cpu_baseclk();
+    return mp_hal_ticks_us() * (cxd56_get_cpu_baseclk() / 1000000);
 }
 
 void mp_hal_delay_ms(mp_uint_t delay) {
@@ -69,7 +72,9 @@ void mp_hal_delay_ms(mp_uint_t delay) {
             break;
         }
         duration = (supervisor_ticks_ms64() - start_tick);
-        // TODO(tannewt): Go to sleep for a little while while we wait.
+        if (duration < delay) {
+            port_sleep_until_interrupt();
+        }
     }
 }
 
@@ -38,6 +38,8 @@
 #include "common-hal/pulseio/PulseOut.h"
 #include "common-hal/pulseio/PWMOut.h"
 #include "common-hal/busio/UART.h"
+#include "bindings/asmp/Worker.h"
+#include "common-hal/camera/Camera.h"
 
 safe_mode_t port_init(void) {
     boardctl(BOARDIOC_INIT, 0);
@@ -66,6 +68,12 @@ void reset_port(void) {
 #if CIRCUITPY_BUSIO
     busio_uart_reset();
 #endif
+#if CIRCUITPY_ASMP
+    asmp_reset();
+#endif
+#if CIRCUITPY_CAMERA
+    camera_reset();
+#endif
 
     reset_all_pins();
 }
@@ -95,3 +103,7 @@ void port_set_saved_word(uint32_t value) {
 uint32_t port_get_saved_word(void) {
     return _ebss;
 }
+
+void port_sleep_until_interrupt(void) {
+    // The core belongs to NuttX, whose idle thread does the sleeping.
+}
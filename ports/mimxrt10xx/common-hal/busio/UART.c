@@ -158,7 +158,8 @@ void common_hal_busio_uart_deinit(busio_uart_obj_t *self) {
 
     gc_free(self->rbuf.buf);
     self->rbuf.size = 0;
-    self->rbuf.iput = self->rbuf.iget = 0;
+    self->rbuf.iput = 0;
+    self->rbuf.get_state = 0;
 
 //    reset_pin_number(self->rx_pin);
 //    reset_pin_number(self->tx_pin);
@@ -168,3 +168,13 @@ digitalio_pull_t common_hal_digitalio_digitalinout_get_pull(
         return self->pull;
     }
 }
+
+bool common_hal_digitalio_digitalinout_get_registers(digitalio_digitalinout_obj_t* self,
+        digitalio_digitalinout_registers_t *regs) {
+    GPIO_Type *gpio = self->pin->gpio;
+    regs->set = &gpio->DR_SET;
+    regs->clear = &gpio->DR_CLEAR;
+    regs->in = &gpio->PSR;
+    regs->mask = 1U << self->pin->number;
+    return true;
+}
@@ -16,5 +16,13 @@ endif
 
 INTERNAL_LIBM = 1
 
+# Copy the VM, GC and displayio hot paths out of XIP flash into ITCM (RAM at address 0) at boot.
+# The 1011's ITCM is only 32K and also holds .data and .bss, so it is left out there.
+ifeq ($(CHIP_FAMILY),MIMXRT1062)
+CIRCUITPY_ITCM_HOT_FUNCS ?= 1
+else
+CIRCUITPY_ITCM_HOT_FUNCS ?= 0
+endif
+
 USB_SERIAL_NUMBER_LENGTH = 32
 USB_MSC_MAX_PACKET_SIZE = 512
@@ -48,8 +48,24 @@ extern uint32_t __fatfs_flash_length[];
 #define NO_CACHE        0xffffffff
 #define SECTOR_SIZE     0x1000 /* 4K */
 
-uint8_t  _flash_cache[SECTOR_SIZE] __attribute__((aligned(4)));
-uint32_t _flash_page_addr = NO_CACHE;
+// Sectors are written back only when a slot is needed for another sector or on flush, so a host
+// writing a file and the FAT entries and directory that go with it doesn't erase any sector twice.
+// The cache lives in .bss, which shares the 32K ITCM with .data on the 1011, so it keeps one.
+#ifndef FLASH_CACHE_SECTORS
+#ifdef MIMXRT1011_SERIES
+#define FLASH_CACHE_SECTORS (1)
+#else
+#define FLASH_CACHE_SECTORS (8)
+#endif
+#endif
+
+uint8_t  _flash_cache[FLASH_CACHE_SECTORS][SECTOR_SIZE] __attribute__((aligned(4)));
+uint32_t _flash_page_addr[FLASH_CACHE_SECTORS];
+// Slots holding changes not yet written to flash, one bit each.
+static uint32_t _flash_cache_dirty;
+// Slot use order for eviction; a higher stamp is more recently used.
+static uint32_t _flash_cache_stamp[FLASH_CACHE_SECTORS];
+static uint32_t _flash_cache_clock;
 static bool init_done = false;
 
 flexspi_device_config_t deviceconfig = {
@@ -142,6 +158,11 @@ void supervisor_flash_init(void) {
     if (init_done)
         return;
 
+    for (size_t i = 0; i < FLASH_CACHE_SECTORS; i++) {
+        _flash_page_addr[i] = NO_CACHE;
+    }
+    _flash_cache_dirty = 0;
+
     SCB_DisableDCache();
 
     status_t status;
@@ -181,42 +202,122 @@ uint32_t supervisor_flash_get_block_count(void) {
     return ((uint32_t) __fatfs_flash_length) / FILESYSTEM_BLOCK_SIZE;
 }
 
-void supervisor_flash_flush(void) {
-    if (_flash_page_addr == NO_CACHE) return;
-    status_t status;
+// Programming can only clear bits, so a sector needs erasing only if some bit goes from 0 to 1.
+STATIC bool sector_needs_erase(const uint32_t *cached, const uint32_t *flash) {
+    for (size_t i = 0; i < SECTOR_SIZE / sizeof(uint32_t); i++) {
+        if ((cached[i] & ~flash[i]) != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+STATIC bool page_is_blank(const uint32_t *page) {
+    for (size_t i = 0; i < FLASH_PAGE_SIZE / sizeof(uint32_t); i++) {
+        if (page[i] != 0xffffffff) {
+            return false;
+        }
+    }
+    return true;
+}
 
+// The erase and program routines run from RAM, but interrupt handlers run from flash and
+// flash can't be read while it is busy, so interrupts stay off for each operation. They are
+// turned back on between pages. A slot stays dirty until its write back succeeds.
+STATIC bool flush_slot(size_t slot) {
+    if ((_flash_cache_dirty & (1 << slot)) == 0) {
+        return true;
+    }
+
+    uint32_t page_addr = _flash_page_addr[slot];
+    uint8_t *cache = _flash_cache[slot];
     // Skip if data is the same
-    if (memcmp(_flash_cache, (void *)_flash_page_addr, SECTOR_SIZE) != 0) {
-        volatile uint32_t sector_addr = (_flash_page_addr - FlexSPI_AMBA_BASE);
+    if (memcmp(cache, (void *)page_addr, SECTOR_SIZE) == 0) {
+        _flash_cache_dirty &= ~(1 << slot);
+        return true;
+    }
 
+    status_t status = kStatus_Success;
+    volatile uint32_t sector_addr = (page_addr - FlexSPI_AMBA_BASE);
+    bool erased = sector_needs_erase((uint32_t*)cache, (uint32_t*)page_addr);
+    if (erased) {
         __disable_irq();
         status = flexspi_nor_flash_erase_sector(FLEXSPI, sector_addr);
+        __enable_irq();
         if (status != kStatus_Success) {
             printf("Page erase failure %ld!\r\n", status);
-            return;
         }
+    }
+
+    for (int i = 0; status == kStatus_Success && i < SECTOR_SIZE / FLASH_PAGE_SIZE; ++i) {
+        uint8_t *page = cache + i * FLASH_PAGE_SIZE;
+        // Only program the pages that change, which after an erase means those that aren't blank.
+        if (erased ? page_is_blank((uint32_t*)page) :
+            memcmp(page, (void*)(page_addr + i * FLASH_PAGE_SIZE), FLASH_PAGE_SIZE) == 0) {
+            continue;
+        }
+        __disable_irq();
+        status = flexspi_nor_flash_page_program(FLEXSPI, sector_addr + i * FLASH_PAGE_SIZE, (void *)page);
         __enable_irq();
+        if (status != kStatus_Success) {
+            printf("Page program failure %ld!\r\n", status);
+        }
+    }
 
-        for (int i = 0; i < SECTOR_SIZE / FLASH_PAGE_SIZE; ++i) {
-            __disable_irq();
-            status = flexspi_nor_flash_page_program(FLEXSPI, sector_addr + i * FLASH_PAGE_SIZE, (void *)_flash_cache + i * FLASH_PAGE_SIZE);
-            if (status != kStatus_Success) {
-                printf("Page program failure %ld!\r\n", status);
-                return;
-            }
-            __enable_irq();
+    // The flash has changed once an erase or program was tried, even one that failed, so
+    // stale lines must not be read back from the cache.
+    DCACHE_CleanInvalidateByRange(page_addr, SECTOR_SIZE);
+
+    if (status != kStatus_Success) {
+        return false;
+    }
+    _flash_cache_dirty &= ~(1 << slot);
+    return true;
+}
+
+STATIC int find_slot(uint32_t page_addr) {
+    for (size_t i = 0; i < FLASH_CACHE_SECTORS; i++) {
+        if (_flash_page_addr[i] == page_addr) {
+            return i;
         }
+    }
+    return -1;
+}
 
-        DCACHE_CleanInvalidateByRange(_flash_page_addr, SECTOR_SIZE);
+void supervisor_flash_flush(void) {
+    // Write back in address order so neighbouring sectors go out together.
+    uint32_t pending = _flash_cache_dirty;
+    while (pending != 0) {
+        size_t lowest = 0;
+        uint32_t lowest_addr = NO_CACHE;
+        for (size_t i = 0; i < FLASH_CACHE_SECTORS; i++) {
+            if ((pending & (1 << i)) != 0 && _flash_page_addr[i] <= lowest_addr) {
+                lowest = i;
+                lowest_addr = _flash_page_addr[i];
+            }
+        }
+        pending &= ~(1 << lowest);
+        flush_slot(lowest);
     }
 }
 
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block, uint32_t num_blocks) {
-    // Must write out anything in cache before trying to read.
-    supervisor_flash_flush();
+    // Blocks still in the cache are read from it, so reads don't force a write back.
+    while (num_blocks) {
+        uint32_t const addr      = lba2addr(block);
+        uint32_t const page_addr = addr & ~(SECTOR_SIZE - 1);
+
+        uint32_t count = 8 - (block % 8); // up to page boundary
+        count = MIN(num_blocks, count);
+
+        int slot = find_slot(page_addr);
+        const uint8_t *src = slot >= 0 ? &_flash_cache[slot][addr & (SECTOR_SIZE - 1)] : (uint8_t*)addr;
+        memcpy(dest, src, count * FILESYSTEM_BLOCK_SIZE);
 
-    uint32_t src = lba2addr(block);
-    memcpy(dest, (uint8_t*)src, FILESYSTEM_BLOCK_SIZE * num_blocks);
+        block      += count;
+        dest       += count * FILESYSTEM_BLOCK_SIZE;
+        num_blocks -= count;
+    }
     return 0; // success
 }
 
@@ -228,18 +329,29 @@ mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t lba, uint32
         uint32_t count = 8 - (lba % 8); // up to page boundary
         count = MIN(num_blocks, count);
 
-        if (page_addr != _flash_page_addr) {
-            // Write out anything in cache before overwriting it.
-            supervisor_flash_flush();
+        int slot = find_slot(page_addr);
+        if (slot < 0) {
+            // Reuse the least recently used slot, writing out anything in it first.
+            slot = 0;
+            for (size_t i = 1; i < FLASH_CACHE_SECTORS; i++) {
+                if (_flash_cache_stamp[i] < _flash_cache_stamp[slot]) {
+                    slot = i;
+                }
+            }
+            if (!flush_slot(slot)) {
+                return 1; // error
+            }
 
-            _flash_page_addr = page_addr;
+            _flash_page_addr[slot] = page_addr;
 
             // Copy the current contents of the entire page into the cache.
-            memcpy(_flash_cache, (void *)page_addr, SECTOR_SIZE);
+            memcpy(_flash_cache[slot], (void *)page_addr, SECTOR_SIZE);
         }
+        _flash_cache_stamp[slot] = ++_flash_cache_clock;
+        _flash_cache_dirty |= 1 << slot;
 
         // Overwrite part or all of the page cache with the src data.
-        memcpy(_flash_cache + (addr & (SECTOR_SIZE - 1)), src, count * FILESYSTEM_BLOCK_SIZE);
+        memcpy(_flash_cache[slot] + (addr & (SECTOR_SIZE - 1)), src, count * FILESYSTEM_BLOCK_SIZE);
 
         // adjust for next run
         lba        += count;
@@ -253,3 +365,7 @@ mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t lba, uint32
 void supervisor_flash_release_cache(void) {
 }
 
+const uint8_t *supervisor_flash_get_mapped_blocks(uint32_t block_num, uint32_t num_blocks) {
+    return NULL;
+}
+
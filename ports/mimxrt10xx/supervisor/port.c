@@ -156,6 +156,11 @@ uint32_t port_get_saved_word(void) {
     return __bss_end__;
 }
 
+void port_sleep_until_interrupt(void) {
+    // The low power mode is left at run so WFI only gates the core clock.
+    __WFI();
+}
+
 /**
  * \brief Default interrupt handler for unused IRQs.
  */
@@ -24,9 +24,11 @@
  * THE SOFTWARE.
  */
 
+#include "py/gc.h"
 #include "py/runtime.h"
 #include "supervisor/filesystem.h"
 #include "supervisor/usb.h"
+#include "supervisor/shared/background_task.h"
 #include "supervisor/shared/stack.h"
 
 #if CIRCUITPY_DISPLAYIO
@@ -48,6 +50,27 @@
 
 static bool running_background_tasks = false;
 
+STATIC background_task_t background_tasks[] = {
+    #if CIRCUITPY_AUDIOPWMIO
+    BACKGROUND_TASK(audiopwmout_background, BACKGROUND_TASK_PRIORITY_HIGH, 0),
+    #endif
+    #if CIRCUITPY_AUDIOBUSIO
+    BACKGROUND_TASK(i2s_background, BACKGROUND_TASK_PRIORITY_HIGH, 0),
+    #endif
+    BACKGROUND_TASK(usb_background, BACKGROUND_TASK_PRIORITY_HIGH, 0),
+    BACKGROUND_TASK(filesystem_background, BACKGROUND_TASK_PRIORITY_NORMAL, 0),
+    #if CIRCUITPY_BLEIO
+    BACKGROUND_TASK(supervisor_bluetooth_background, BACKGROUND_TASK_PRIORITY_NORMAL, 0),
+    BACKGROUND_TASK(bonding_background, BACKGROUND_TASK_PRIORITY_NORMAL, 0),
+    #endif
+    #if CIRCUITPY_DISPLAYIO
+    BACKGROUND_TASK(displayio_background, BACKGROUND_TASK_PRIORITY_LOW, 5),
+    #endif
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    BACKGROUND_TASK(gc_sweep_background, BACKGROUND_TASK_PRIORITY_LOW, 2),
+    #endif
+};
+
 void background_tasks_reset(void) {
     running_background_tasks = false;
 }
@@ -58,23 +81,8 @@ void run_background_tasks(void) {
         return;
     }
     running_background_tasks = true;
-    filesystem_background();
-    usb_background();
-#if CIRCUITPY_AUDIOPWMIO
-    audiopwmout_background();
-#endif
-#if CIRCUITPY_AUDIOBUSIO
-    i2s_background();
-#endif
-
-#if CIRCUITPY_BLEIO
-    supervisor_bluetooth_background();
-    bonding_background();
-#endif
-
-    #if CIRCUITPY_DISPLAYIO
-    displayio_background();
-    #endif
+    background_task_register_all(background_tasks, MP_ARRAY_SIZE(background_tasks));
+    background_task_run_all();
     running_background_tasks = false;
 
     assert_heap_ok();
@@ -48,6 +48,7 @@
 #include "shared-bindings/_bleio/Address.h"
 #include "shared-bindings/nvm/ByteArray.h"
 #include "shared-bindings/_bleio/Connection.h"
+#include "shared-bindings/_bleio/L2CAPChannel.h"
 #include "shared-bindings/_bleio/ScanEntry.h"
 #include "shared-bindings/time/__init__.h"
 
@@ -72,7 +73,7 @@ bleio_connection_internal_t bleio_connections[BLEIO_TOTAL_CONNECTION_COUNT];
 
 // Linker script provided ram start.
 extern uint32_t _ram_start;
-STATIC uint32_t ble_stack_enable(void) {
+STATIC uint32_t ble_stack_enable(bleio_adapter_obj_t *self) {
     nrf_clock_lf_cfg_t clock_config = {
 #if BOARD_HAS_32KHZ_XTAL
         .source       = NRF_CLOCK_LF_SRC_XTAL,
@@ -100,18 +101,20 @@ STATIC uint32_t ble_stack_enable(void) {
     // Start with no event handlers, etc.
     ble_drv_reset();
 
-    // Set everything up to have one persistent code editing connection and one user managed
-    // connection. In the future we could move .data and .bss to the other side of the stack and
-    // dynamically adjust for different memory requirements of the SD based on boot.py
-    // configuration.
+    // By default set everything up to have one persistent code editing connection, one user
+    // managed peripheral connection and one central connection. Adapter.configure can change
+    // the counts. In the future we could move .data and .bss to the other side of the stack and
+    // dynamically adjust for different memory requirements of the SD.
     uint32_t app_ram_start = (uint32_t) &_ram_start;
+    uint8_t connection_count = self->peripheral_connection_count + self->central_connection_count;
 
     ble_cfg_t ble_conf;
     ble_conf.conn_cfg.conn_cfg_tag = BLE_CONN_CFG_TAG_CUSTOM;
-    ble_conf.conn_cfg.params.gap_conn_cfg.conn_count = BLEIO_TOTAL_CONNECTION_COUNT;
-    // Event length here can influence throughput so perhaps make multiple connection profiles
-    // available.
-    ble_conf.conn_cfg.params.gap_conn_cfg.event_length = BLE_GAP_EVENT_LENGTH_DEFAULT;
+    ble_conf.conn_cfg.params.gap_conn_cfg.conn_count = connection_count;
+    // The radio time each connection gets per connection interval. Connection event extension
+    // lets a busy link use more when the others leave it free, so shorter events share the radio
+    // more evenly between many links.
+    ble_conf.conn_cfg.params.gap_conn_cfg.event_length = self->event_length;
     err_code = sd_ble_cfg_set(BLE_CONN_CFG_GAP, &ble_conf, app_ram_start);
     if (err_code != NRF_SUCCESS) {
         return err_code;
@@ -119,21 +122,52 @@ STATIC uint32_t ble_stack_enable(void) {
 
     memset(&ble_conf, 0, sizeof(ble_conf));
     ble_conf.gap_cfg.role_count_cfg.adv_set_count = 1;
-    ble_conf.gap_cfg.role_count_cfg.periph_role_count = 2;
-    ble_conf.gap_cfg.role_count_cfg.central_role_count = 1;
+    ble_conf.gap_cfg.role_count_cfg.periph_role_count = self->peripheral_connection_count;
+    ble_conf.gap_cfg.role_count_cfg.central_role_count = self->central_connection_count;
     err_code = sd_ble_cfg_set(BLE_GAP_CFG_ROLE_COUNT, &ble_conf, app_ram_start);
     if (err_code != NRF_SUCCESS) {
         return err_code;
     }
 
+    // Each connection has its own transmit queues that the SD empties in its own connection
+    // events. Share the default queue space for two links between however many there are so
+    // adding links costs throughput per link rather than running the SD out of RAM.
+    uint8_t tx_queue_size = MAX(2, MAX_TX_IN_PROGRESS * 2 / connection_count);
+
     memset(&ble_conf, 0, sizeof(ble_conf));
     ble_conf.conn_cfg.conn_cfg_tag = BLE_CONN_CFG_TAG_CUSTOM;
-    ble_conf.conn_cfg.params.gatts_conn_cfg.hvn_tx_queue_size = MAX_TX_IN_PROGRESS;
+    ble_conf.conn_cfg.params.gatts_conn_cfg.hvn_tx_queue_size = MIN(tx_queue_size, MAX_TX_IN_PROGRESS);
     err_code = sd_ble_cfg_set(BLE_CONN_CFG_GATTS, &ble_conf, app_ram_start);
     if (err_code != NRF_SUCCESS) {
         return err_code;
     }
 
+    // Queue as many write commands as notifications so a client PacketBuffer can also send
+    // several packets per connection event. The default is one.
+    memset(&ble_conf, 0, sizeof(ble_conf));
+    ble_conf.conn_cfg.conn_cfg_tag = BLE_CONN_CFG_TAG_CUSTOM;
+    ble_conf.conn_cfg.params.gattc_conn_cfg.write_cmd_tx_queue_size = MIN(tx_queue_size, MAX_TX_IN_PROGRESS);
+    err_code = sd_ble_cfg_set(BLE_CONN_CFG_GATTC, &ble_conf, app_ram_start);
+    if (err_code != NRF_SUCCESS) {
+        return err_code;
+    }
+
+    // L2CAP channels carry SDUs in PDUs as large as a link layer packet so bulk transfers don't
+    // pay the ATT overhead of notifications and writes.
+    if (self->l2cap_channel_count > 0) {
+        memset(&ble_conf, 0, sizeof(ble_conf));
+        ble_conf.conn_cfg.conn_cfg_tag = BLE_CONN_CFG_TAG_CUSTOM;
+        ble_conf.conn_cfg.params.l2cap_conn_cfg.rx_mps = BLEIO_L2CAP_MPS;
+        ble_conf.conn_cfg.params.l2cap_conn_cfg.tx_mps = BLEIO_L2CAP_MPS;
+        ble_conf.conn_cfg.params.l2cap_conn_cfg.rx_queue_size = BLEIO_L2CAP_QUEUE_SIZE;
+        ble_conf.conn_cfg.params.l2cap_conn_cfg.tx_queue_size = BLEIO_L2CAP_QUEUE_SIZE;
+        ble_conf.conn_cfg.params.l2cap_conn_cfg.ch_count = self->l2cap_channel_count;
+        err_code = sd_ble_cfg_set(BLE_CONN_CFG_L2CAP, &ble_conf, app_ram_start);
+        if (err_code != NRF_SUCCESS) {
+            return err_code;
+        }
+    }
+
     // Set ATT_MTU so that the maximum MTU we can negotiate is up to the full characteristic size.
     memset(&ble_conf, 0, sizeof(ble_conf));
     ble_conf.conn_cfg.conn_cfg_tag = BLE_CONN_CFG_TAG_CUSTOM;
@@ -214,7 +248,10 @@ STATIC bool adapter_on_ble_evt(ble_evt_t *ble_evt, void *self_in) {
             connection->conn_handle = ble_evt->evt.gap_evt.conn_handle;
             connection->connection_obj = mp_const_none;
             connection->pair_status = PAIR_NOT_PAIRED;
+            connection->ediv = EDIV_INVALID;
             connection->mtu = 0;
+            connection->service_changed_handle = BLE_GATT_HANDLE_INVALID;
+            connection->gatt_db_changed = false;
 
             ble_drv_add_event_handler_entry(&connection->handler_entry, connection_on_ble_evt, connection);
             self->connection_objs = NULL;
@@ -222,6 +259,9 @@ STATIC bool adapter_on_ble_evt(ble_evt_t *ble_evt, void *self_in) {
             // Save the current connection parameters.
             memcpy(&connection->conn_params, &connected->conn_params, sizeof(ble_gap_conn_params_t));
 
+            // Move to the 2M PHY and longer link layer packets if the peer supports them.
+            bleio_connection_start_link_updates(connection);
+
             #if CIRCUITPY_VERBOSE_BLE
             ble_gap_conn_params_t *cp = &connected->conn_params;
             mp_printf(&mp_plat_print, "conn params: min_ci %d max_ci %d s_l %d sup_timeout %d\n", cp->min_conn_interval, cp->max_conn_interval, cp->slave_latency, cp->conn_sup_timeout);
@@ -308,13 +348,20 @@ void common_hal_bleio_adapter_set_enabled(bleio_adapter_obj_t *self, bool enable
         // Occurs when USB is initialized previously
         nrfx_power_uninit();
 
-        err_code = ble_stack_enable();
+        err_code = ble_stack_enable(self);
+        if (err_code != NRF_SUCCESS) {
+            // Don't leave the SD half set up.
+            sd_softdevice_disable();
+        }
     } else {
         err_code = sd_softdevice_disable();
     }
     // Re-init USB hardware
     init_usb_hardware();
 
+    if (enabled && err_code == NRF_ERROR_NO_MEM) {
+        mp_raise_bleio_BluetoothError(translate("Not enough memory reserved for the SoftDevice for this many connections"));
+    }
     check_nrf_error(err_code);
 
     // Add a handler for incoming peripheral connections.
@@ -334,6 +381,21 @@ void common_hal_bleio_adapter_set_enabled(bleio_adapter_obj_t *self, bool enable
     }
 }
 
+void common_hal_bleio_adapter_configure(bleio_adapter_obj_t *self, uint8_t peripheral_connections, uint8_t central_connections, mp_float_t event_length, uint8_t l2cap_channels) {
+    self->peripheral_connection_count = peripheral_connections;
+    self->central_connection_count = central_connections;
+    self->event_length = SEC_TO_UNITS(event_length, UNIT_1_25_MS);
+    if (self->event_length < BLE_GAP_EVENT_LENGTH_MIN) {
+        self->event_length = BLE_GAP_EVENT_LENGTH_MIN;
+    }
+    self->l2cap_channel_count = l2cap_channels;
+    // The SD only takes the configuration when it is enabled.
+    if (common_hal_bleio_adapter_get_enabled(self)) {
+        common_hal_bleio_adapter_set_enabled(self, false);
+        common_hal_bleio_adapter_set_enabled(self, true);
+    }
+}
+
 bool common_hal_bleio_adapter_get_enabled(bleio_adapter_obj_t *self) {
     uint8_t is_enabled;
 
@@ -406,14 +468,16 @@ STATIC bool scan_on_ble_evt(ble_evt_t *ble_evt, void *scan_results_in) {
     return true;
 }
 
-mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self, uint8_t* prefixes, size_t prefix_length, bool extended, mp_int_t buffer_size, mp_float_t timeout, mp_float_t interval, mp_float_t window, mp_int_t minimum_rssi, bool active) {
+mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self, uint8_t* prefixes, size_t prefix_length, bool extended, bool coded, mp_int_t buffer_size, mp_float_t timeout, mp_float_t interval, mp_float_t window, mp_int_t minimum_rssi, bool active, const bleio_scan_filter_t* filter) {
     if (self->scan_results != NULL) {
         if (!shared_module_bleio_scanresults_get_done(self->scan_results)) {
             mp_raise_bleio_BluetoothError(translate("Scan already in progess. Stop with stop_scan."));
         }
         self->scan_results = NULL;
     }
-    self->scan_results = shared_module_bleio_new_scanresults(buffer_size, prefixes, prefix_length, minimum_rssi);
+    self->scan_results = shared_module_bleio_new_scanresults(buffer_size, prefixes, prefix_length, minimum_rssi, filter);
+    // Only extended scans can use the coded PHY.
+    extended = extended || coded;
     size_t max_packet_size = extended ? BLE_GAP_SCAN_BUFFER_EXTENDED_MAX_SUPPORTED : BLE_GAP_SCAN_BUFFER_MAX;
     uint8_t *raw_data = m_malloc(sizeof(ble_data_t) + max_packet_size, false);
     ble_data_t * sd_data = (ble_data_t *) raw_data;
@@ -433,7 +497,8 @@ mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self, uint8_t*
         .interval = SEC_TO_UNITS(interval, UNIT_0_625_MS),
         .timeout = nrf_timeout,
         .window = SEC_TO_UNITS(window, UNIT_0_625_MS),
-        .scan_phys = BLE_GAP_PHY_1MBPS,
+        // Long range advertisers use coded on the primary channels too, so listen on both.
+        .scan_phys = coded ? BLE_GAP_PHY_1MBPS | BLE_GAP_PHY_CODED : BLE_GAP_PHY_1MBPS,
         .active = active
     };
     uint32_t err_code;
@@ -562,7 +627,7 @@ STATIC void check_data_fit(size_t data_len, bool connectable) {
     }
 }
 
-uint32_t _common_hal_bleio_adapter_start_advertising(bleio_adapter_obj_t *self, bool connectable, float interval, uint8_t *advertising_data, uint16_t advertising_data_len, uint8_t *scan_response_data, uint16_t scan_response_data_len) {
+uint32_t _common_hal_bleio_adapter_start_advertising(bleio_adapter_obj_t *self, bool connectable, bool extended, uint8_t phy, float interval, uint8_t *advertising_data, uint16_t advertising_data_len, uint8_t *scan_response_data, uint16_t scan_response_data_len) {
     if (self->current_advertising_data != NULL && self->current_advertising_data == self->advertising_data) {
         return NRF_ERROR_BUSY;
     }
@@ -574,8 +639,10 @@ uint32_t _common_hal_bleio_adapter_start_advertising(bleio_adapter_obj_t *self,
     }
 
 
-    bool extended = advertising_data_len > BLE_GAP_ADV_SET_DATA_SIZE_MAX ||
-                    scan_response_data_len > BLE_GAP_ADV_SET_DATA_SIZE_MAX;
+    // Only extended advertisements can carry more than 31 bytes or use another PHY than 1M.
+    extended = extended || phy != 1 ||
+               advertising_data_len > BLE_GAP_ADV_SET_DATA_SIZE_MAX ||
+               scan_response_data_len > BLE_GAP_ADV_SET_DATA_SIZE_MAX;
 
     uint8_t adv_type;
     if (extended) {
@@ -600,7 +667,9 @@ uint32_t _common_hal_bleio_adapter_start_advertising(bleio_adapter_obj_t *self,
         .properties.type = adv_type,
         .duration = BLE_GAP_ADV_TIMEOUT_GENERAL_UNLIMITED,
         .filter_policy = BLE_GAP_ADV_FP_ANY,
-        .primary_phy = BLE_GAP_PHY_1MBPS,
+        // The primary channels only use 1M or coded. The data goes out on the secondary channels.
+        .primary_phy = phy == 0 ? BLE_GAP_PHY_CODED : BLE_GAP_PHY_1MBPS,
+        .secondary_phy = phy == 0 ? BLE_GAP_PHY_CODED : (phy == 2 ? BLE_GAP_PHY_2MBPS : BLE_GAP_PHY_1MBPS),
     };
 
     const ble_gap_adv_data_t ble_gap_adv_data = {
@@ -624,7 +693,7 @@ uint32_t _common_hal_bleio_adapter_start_advertising(bleio_adapter_obj_t *self,
 }
 
 
-void common_hal_bleio_adapter_start_advertising(bleio_adapter_obj_t *self, bool connectable, mp_float_t interval, mp_buffer_info_t *advertising_data_bufinfo, mp_buffer_info_t *scan_response_data_bufinfo) {
+void common_hal_bleio_adapter_start_advertising(bleio_adapter_obj_t *self, bool connectable, bool extended, uint8_t phy, mp_float_t interval, mp_buffer_info_t *advertising_data_bufinfo, mp_buffer_info_t *scan_response_data_bufinfo) {
     if (self->current_advertising_data != NULL && self->current_advertising_data == self->advertising_data) {
         mp_raise_bleio_BluetoothError(translate("Already advertising."));
     }
@@ -644,7 +713,7 @@ void common_hal_bleio_adapter_start_advertising(bleio_adapter_obj_t *self, bool
     memcpy(self->advertising_data, advertising_data_bufinfo->buf, advertising_data_bufinfo->len);
     memcpy(self->scan_response_data, scan_response_data_bufinfo->buf, scan_response_data_bufinfo->len);
 
-    check_nrf_error(_common_hal_bleio_adapter_start_advertising(self, connectable, interval,
+    check_nrf_error(_common_hal_bleio_adapter_start_advertising(self, connectable, extended, phy, interval,
                                                                 self->advertising_data,
                                                                 advertising_data_bufinfo->len,
                                                                 self->scan_response_data,
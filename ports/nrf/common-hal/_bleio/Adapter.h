@@ -35,7 +35,13 @@
 #include "shared-bindings/_bleio/Connection.h"
 #include "shared-bindings/_bleio/ScanResults.h"
 
-#define BLEIO_TOTAL_CONNECTION_COUNT 2
+// Connection slots. How many the SD is set up for is configurable up to this. Each one it is set up
+// for takes RAM from the space reserved for the SD.
+#define BLEIO_TOTAL_CONNECTION_COUNT 8
+#define BLEIO_DEFAULT_PERIPHERAL_CONNECTION_COUNT 2
+#define BLEIO_DEFAULT_CENTRAL_CONNECTION_COUNT 1
+// L2CAP channels per connection. None are set up by default because each takes SD RAM.
+#define BLEIO_L2CAP_MAX_CHANNEL_COUNT 4
 
 extern bleio_connection_internal_t bleio_connections[BLEIO_TOTAL_CONNECTION_COUNT];
 
@@ -48,6 +54,11 @@ typedef struct {
     mp_obj_t name;
     mp_obj_tuple_t *connection_objs;
     ble_drv_evt_handler_entry_t handler_entry;
+    // Used the next time the SD is enabled. event_length is in 1.25 ms units.
+    uint8_t peripheral_connection_count;
+    uint8_t central_connection_count;
+    uint16_t event_length;
+    uint8_t l2cap_channel_count;
 } bleio_adapter_obj_t;
 
 void bleio_adapter_gc_collect(bleio_adapter_obj_t* adapter);
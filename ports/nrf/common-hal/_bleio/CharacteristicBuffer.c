@@ -43,13 +43,9 @@
 #include "common-hal/_bleio/CharacteristicBuffer.h"
 
 STATIC void write_to_ringbuf(bleio_characteristic_buffer_obj_t *self, uint8_t *data, uint16_t len) {
-    // Push all the data onto the ring buffer.
-    uint8_t is_nested_critical_region;
-    sd_nvic_critical_region_enter(&is_nested_critical_region);
-    for (size_t i = 0; i < len; i++) {
-        ringbuf_put(&self->ringbuf, data[i]);
-    }
-    sd_nvic_critical_region_exit(is_nested_critical_region);
+    // Push all the data onto the ring buffer, overwriting the oldest if it's full. This runs in
+    // the SD event handler and the ring buffer is safe for it to fill while the VM reads.
+    self->overflow_count += ringbuf_put_n(&self->ringbuf, data, len);
 }
 
 STATIC bool characteristic_buffer_on_ble_evt(ble_evt_t *ble_evt, void *param) {
@@ -95,6 +91,7 @@ void common_hal_bleio_characteristic_buffer_construct(bleio_characteristic_buffe
     // This is a macro.
     // true means long-lived, so it won't be moved.
     ringbuf_alloc(&self->ringbuf, buffer_size, true);
+    self->overflow_count = 0;
 
     ble_drv_add_event_handler(characteristic_buffer_on_ble_evt, self);
 
@@ -112,35 +109,20 @@ int common_hal_bleio_characteristic_buffer_read(bleio_characteristic_buffer_obj_
         }
     }
 
-    // Copy received data. Lock out write interrupt handler while copying.
-    uint8_t is_nested_critical_region;
-    sd_nvic_critical_region_enter(&is_nested_critical_region);
-
-    size_t rx_bytes = MIN(ringbuf_count(&self->ringbuf), len);
-    for ( size_t i = 0; i < rx_bytes; i++ ) {
-        data[i] = ringbuf_get(&self->ringbuf);
-    }
-
-    // Writes now OK.
-    sd_nvic_critical_region_exit(is_nested_critical_region);
-
-    return rx_bytes;
+    // Copy received data. The write handler may run meanwhile without locking it out.
+    return ringbuf_get_n(&self->ringbuf, data, MIN(len, self->ringbuf.size));
 }
 
 uint32_t common_hal_bleio_characteristic_buffer_rx_characters_available(bleio_characteristic_buffer_obj_t *self) {
-    uint8_t is_nested_critical_region;
-    sd_nvic_critical_region_enter(&is_nested_critical_region);
-    uint16_t count = ringbuf_count(&self->ringbuf);
-    sd_nvic_critical_region_exit(is_nested_critical_region);
-    return count;
+    return ringbuf_count(&self->ringbuf);
+}
+
+uint32_t common_hal_bleio_characteristic_buffer_get_overflow_count(bleio_characteristic_buffer_obj_t *self) {
+    return self->overflow_count;
 }
 
 void common_hal_bleio_characteristic_buffer_clear_rx_buffer(bleio_characteristic_buffer_obj_t *self) {
-    // prevent conflict with uart irq
-    uint8_t is_nested_critical_region;
-    sd_nvic_critical_region_enter(&is_nested_critical_region);
     ringbuf_clear(&self->ringbuf);
-    sd_nvic_critical_region_exit(is_nested_critical_region);
 }
 
 bool common_hal_bleio_characteristic_buffer_deinited(bleio_characteristic_buffer_obj_t *self) {
@@ -38,6 +38,8 @@ typedef struct {
     uint32_t timeout_ms;
     // Ring buffer storing consecutive incoming values.
     ringbuf_t ringbuf;
+    // Bytes dropped from the ring buffer to make room for newer ones.
+    uint32_t overflow_count;
 } bleio_characteristic_buffer_obj_t;
 
 #endif // MICROPY_INCLUDED_NRF_COMMON_HAL_BLEIO_CHARACTERISTICBUFFER_H
@@ -74,12 +74,84 @@ static const ble_gap_sec_params_t pairing_sec_params = {
   #define CONNECTION_DEBUG_PRINTF(...)
 #endif
 
+// Discovered attributes of bonded peers are cached in the bonding area as a run of these records,
+// each followed by uuid_length bytes of UUID, so reconnecting doesn't need discovery.
+typedef struct __attribute__((packed)) {
+    uint8_t kind;
+    // 0 when the UUID is unknown, otherwise 2 or 16.
+    uint8_t uuid_length;
+    uint16_t handle;
+    // The end handle of a service or the properties of a characteristic.
+    uint16_t extra;
+} gatt_db_record_t;
+
+typedef enum {
+    GATT_DB_SERVICE = 1,
+    GATT_DB_CHARACTERISTIC = 2,
+    GATT_DB_DESCRIPTOR = 3,
+} gatt_db_record_kind_t;
+
+// Larger databases aren't cached so they don't crowd keys out of the bonding area.
+#define GATT_DB_MAX_LENGTH (2048)
+
 static volatile bool m_discovery_in_process;
 static volatile bool m_discovery_successful;
 
 static bleio_service_obj_t *m_char_discovery_service;
 static bleio_characteristic_obj_t *m_desc_discovery_characteristic;
 
+// NULL params ask for the longest payload that fits the connection event length, which the
+// peer then limits to what it supports.
+STATIC uint32_t request_data_length(bleio_connection_internal_t *self, ble_gap_data_length_params_t const *params) {
+    self->data_length_updating = true;
+    uint32_t err_code = sd_ble_gap_data_length_update(self->conn_handle, params, NULL);
+    if (err_code != NRF_SUCCESS) {
+        self->data_length_updating = false;
+    }
+    return err_code;
+}
+
+STATIC void wait_for_update(bleio_connection_internal_t *self, volatile bool *updating) {
+    while (*updating && self->conn_handle != BLE_CONN_HANDLE_INVALID && !mp_hal_is_interrupted()) {
+        RUN_BACKGROUND_TASKS;
+    }
+}
+
+void bleio_connection_start_link_updates(bleio_connection_internal_t *self) {
+    self->phy = BLE_GAP_PHY_1MBPS;
+    self->data_length = BLEIO_DATA_LENGTH_MIN;
+    self->data_length_updating = false;
+    // The data length is asked for once the PHY is settled because the longest payload that fits
+    // in a connection event depends on it.
+    ble_gap_phys_t const phys = {
+        .tx_phys = BLE_GAP_PHY_2MBPS,
+        .rx_phys = BLE_GAP_PHY_2MBPS,
+    };
+    self->phy_updating = true;
+    self->data_length_after_phy = true;
+    if (sd_ble_gap_phy_update(self->conn_handle, &phys) != NRF_SUCCESS) {
+        self->phy_updating = false;
+        self->data_length_after_phy = false;
+        request_data_length(self, NULL);
+    }
+}
+
+STATIC uint16_t find_service_changed_handle(const uint8_t *gatt_db, uint16_t length) {
+    uint16_t offset = 0;
+    while (offset + sizeof(gatt_db_record_t) <= length) {
+        gatt_db_record_t record;
+        memcpy(&record, gatt_db + offset, sizeof(record));
+        offset += sizeof(record);
+        if (record.kind == GATT_DB_CHARACTERISTIC && record.uuid_length == 2 &&
+            offset + 2 <= length &&
+            (gatt_db[offset] | gatt_db[offset + 1] << 8) == BLE_UUID_GATT_CHARACTERISTIC_SERVICE_CHANGED) {
+            return record.handle;
+        }
+        offset += record.uuid_length;
+    }
+    return BLE_GATT_HANDLE_INVALID;
+}
+
 bool connection_on_ble_evt(ble_evt_t *ble_evt, void *self_in) {
     bleio_connection_internal_t *self = (bleio_connection_internal_t*)self_in;
 
@@ -107,6 +179,15 @@ bool connection_on_ble_evt(ble_evt_t *ble_evt, void *self_in) {
         }
 
         case BLE_GAP_EVT_PHY_UPDATE: { // 0x22
+            ble_gap_evt_phy_update_t *update = &ble_evt->evt.gap_evt.params.phy_update;
+            if (update->status == BLE_HCI_STATUS_CODE_SUCCESS) {
+                self->phy = update->tx_phy;
+            }
+            self->phy_updating = false;
+            if (self->data_length_after_phy) {
+                self->data_length_after_phy = false;
+                request_data_length(self, NULL);
+            }
             break;
         }
 
@@ -116,6 +197,9 @@ bool connection_on_ble_evt(ble_evt_t *ble_evt, void *self_in) {
             break;
 
         case BLE_GAP_EVT_DATA_LENGTH_UPDATE: { // 0x24
+            ble_gap_evt_data_length_update_t *update = &ble_evt->evt.gap_evt.params.data_length_update;
+            self->data_length = update->effective_params.max_tx_octets;
+            self->data_length_updating = false;
             break;
         }
 
@@ -164,6 +248,21 @@ bool connection_on_ble_evt(ble_evt_t *ble_evt, void *self_in) {
             }
             break;
 
+        case BLE_GATTC_EVT_HVX: {
+            ble_gattc_evt_hvx_t *hvx = &ble_evt->evt.gattc_evt.params.hvx;
+            if (ble_evt->evt.gattc_evt.conn_handle != self->conn_handle ||
+                self->service_changed_handle == BLE_GATT_HANDLE_INVALID ||
+                hvx->handle != self->service_changed_handle) {
+                return false;
+            }
+            // The peer's services changed so the cached ones are out of date. Forget them in the
+            // background because flash can't be written from here.
+            sd_ble_gattc_hv_confirm(self->conn_handle, hvx->handle);
+            self->gatt_db_changed = true;
+            self->do_forget_gatt_db = true;
+            break;
+        }
+
         case BLE_GATTS_EVT_SYS_ATTR_MISSING:
             sd_ble_gatts_sys_attr_set(self->conn_handle, NULL, 0, 0);
             break;
@@ -312,6 +411,13 @@ bool connection_on_ble_evt(ble_evt_t *ble_evt, void *self_in) {
                     // No matching bonding found, so use fresh system attributes.
                     sd_ble_gatts_sys_attr_set(self->conn_handle, NULL, 0, 0);
                 }
+                // Know where Service Changed indications come from before discovery is asked
+                // for, because the peer sends them as soon as the link is encrypted.
+                uint16_t gatt_db_length;
+                const uint8_t *gatt_db = bonding_load_gatt_db(self->is_central, self->ediv, &gatt_db_length);
+                if (gatt_db != NULL) {
+                    self->service_changed_handle = find_service_changed_handle(gatt_db, gatt_db_length);
+                }
                 self->pair_status = PAIR_PAIRED;
             }
             break;
@@ -383,6 +489,118 @@ void common_hal_bleio_connection_set_connection_interval(bleio_connection_intern
     check_nrf_error(status);
 }
 
+uint16_t common_hal_bleio_connection_get_slave_latency(bleio_connection_internal_t *self) {
+    wait_for_update(self, &self->conn_params_updating);
+    return self->conn_params.slave_latency;
+}
+
+void common_hal_bleio_connection_set_slave_latency(bleio_connection_internal_t *self, uint16_t latency) {
+    wait_for_update(self, &self->conn_params_updating);
+    self->conn_params_updating = true;
+    self->conn_params.slave_latency = latency;
+    uint32_t status = NRF_ERROR_BUSY;
+    while (status == NRF_ERROR_BUSY) {
+        status = sd_ble_gap_conn_param_update(self->conn_handle, &self->conn_params);
+        RUN_BACKGROUND_TASKS;
+    }
+    if (status != NRF_SUCCESS) {
+        self->conn_params_updating = false;
+    }
+    check_nrf_error(status);
+}
+
+uint8_t common_hal_bleio_connection_get_phy(bleio_connection_internal_t *self) {
+    wait_for_update(self, &self->phy_updating);
+    switch (self->phy) {
+        case BLE_GAP_PHY_2MBPS:
+            return 2;
+        case BLE_GAP_PHY_CODED:
+            return 0;
+        default:
+            return 1;
+    }
+}
+
+void common_hal_bleio_connection_set_phy(bleio_connection_internal_t *self, uint8_t phy) {
+    wait_for_update(self, &self->phy_updating);
+    ble_gap_phys_t const phys = {
+        .tx_phys = phy == 2 ? BLE_GAP_PHY_2MBPS : BLE_GAP_PHY_1MBPS,
+        .rx_phys = phy == 2 ? BLE_GAP_PHY_2MBPS : BLE_GAP_PHY_1MBPS,
+    };
+    self->phy_updating = true;
+    uint32_t status = NRF_ERROR_BUSY;
+    while (status == NRF_ERROR_BUSY) {
+        status = sd_ble_gap_phy_update(self->conn_handle, &phys);
+        RUN_BACKGROUND_TASKS;
+    }
+    if (status != NRF_SUCCESS) {
+        self->phy_updating = false;
+    }
+    check_nrf_error(status);
+    // The peer may keep the current PHY, which the property then still reports.
+    wait_for_update(self, &self->phy_updating);
+}
+
+uint16_t common_hal_bleio_connection_get_data_length(bleio_connection_internal_t *self) {
+    wait_for_update(self, &self->phy_updating);
+    wait_for_update(self, &self->data_length_updating);
+    return self->data_length;
+}
+
+void common_hal_bleio_connection_set_data_length(bleio_connection_internal_t *self, uint16_t data_length) {
+    // Don't let the request made at connection time replace this one.
+    self->data_length_after_phy = false;
+    wait_for_update(self, &self->data_length_updating);
+    ble_gap_data_length_params_t const params = {
+        .max_tx_octets = data_length,
+        .max_rx_octets = data_length,
+        .max_tx_time_us = BLE_GAP_DATA_LENGTH_AUTO,
+        .max_rx_time_us = BLE_GAP_DATA_LENGTH_AUTO,
+    };
+    uint32_t status = NRF_ERROR_BUSY;
+    while (status == NRF_ERROR_BUSY) {
+        status = request_data_length(self, &params);
+        RUN_BACKGROUND_TASKS;
+    }
+    check_nrf_error(status);
+    wait_for_update(self, &self->data_length_updating);
+}
+
+STATIC uint16_t connection_mtu(bleio_connection_internal_t *self) {
+    if (self->mtu == 0) {
+        return BLE_GATT_ATT_MTU_DEFAULT;
+    }
+    return self->mtu;
+}
+
+size_t common_hal_bleio_connection_read_multiple(bleio_connection_internal_t *self, bleio_characteristic_obj_t **characteristics, size_t count, uint8_t *buf, size_t len) {
+    if (count == 1) {
+        // Read Multiple takes at least two handles.
+        return common_hal_bleio_gattc_read(characteristics[0]->handle, self->conn_handle, buf, len);
+    }
+    uint16_t *handles = m_new(uint16_t, count);
+    for (size_t i = 0; i < count; i++) {
+        handles[i] = characteristics[i]->handle;
+    }
+    size_t value_length = common_hal_bleio_gattc_read_multiple(handles, count, self->conn_handle, buf, len);
+    m_del(uint16_t, handles, count);
+    return value_length;
+}
+
+size_t common_hal_bleio_connection_get_read_multiple_length(bleio_connection_internal_t *self) {
+    // The response has a one byte opcode and no lengths between the values.
+    return connection_mtu(self) - 1;
+}
+
+void common_hal_bleio_connection_write_multiple(bleio_connection_internal_t *self, bleio_characteristic_obj_t **characteristics, mp_buffer_info_t *bufinfos, size_t count) {
+    uint16_t *handles = m_new(uint16_t, count);
+    for (size_t i = 0; i < count; i++) {
+        handles[i] = characteristics[i]->handle;
+    }
+    common_hal_bleio_gattc_write_multiple(handles, bufinfos, count, self->conn_handle, connection_mtu(self));
+    m_del(uint16_t, handles, count);
+}
+
 // service_uuid may be NULL, to discover all services.
 STATIC bool discover_next_services(bleio_connection_internal_t* connection, uint16_t start_handle, ble_uuid_t *service_uuid) {
     m_discovery_successful = false;
@@ -531,30 +749,34 @@ STATIC void on_char_discovery_rsp(ble_gattc_evt_char_disc_rsp_t *response, bleio
     m_discovery_in_process = false;
 }
 
+// Remember handles for certain well-known descriptors.
+STATIC void remember_descriptor_handle(bleio_characteristic_obj_t *characteristic, const ble_uuid_t *uuid, uint16_t handle) {
+    switch (uuid->uuid) {
+        case BLE_UUID_DESCRIPTOR_CLIENT_CHAR_CONFIG:
+            characteristic->cccd_handle = handle;
+            break;
+
+        case BLE_UUID_DESCRIPTOR_SERVER_CHAR_CONFIG:
+            characteristic->sccd_handle = handle;
+            break;
+
+        case BLE_UUID_DESCRIPTOR_CHAR_USER_DESC:
+            characteristic->user_desc_handle = handle;
+            break;
+
+        default:
+            // TODO: sd_ble_gattc_descriptors_discover() can return things that are not descriptors,
+            // so ignore those.
+            // https://devzone.nordicsemi.com/f/nordic-q-a/49500/sd_ble_gattc_descriptors_discover-is-returning-attributes-that-are-not-descriptors
+            break;
+    }
+}
+
 STATIC void on_desc_discovery_rsp(ble_gattc_evt_desc_disc_rsp_t *response, bleio_connection_internal_t* connection) {
     for (size_t i = 0; i < response->count; ++i) {
         ble_gattc_desc_t *gattc_desc = &response->descs[i];
 
-        // Remember handles for certain well-known descriptors.
-        switch (gattc_desc->uuid.uuid) {
-            case BLE_UUID_DESCRIPTOR_CLIENT_CHAR_CONFIG:
-                m_desc_discovery_characteristic->cccd_handle = gattc_desc->handle;
-                break;
-
-            case BLE_UUID_DESCRIPTOR_SERVER_CHAR_CONFIG:
-                m_desc_discovery_characteristic->sccd_handle = gattc_desc->handle;
-                break;
-
-            case BLE_UUID_DESCRIPTOR_CHAR_USER_DESC:
-                m_desc_discovery_characteristic->user_desc_handle = gattc_desc->handle;
-                break;
-
-            default:
-                // TODO: sd_ble_gattc_descriptors_discover() can return things that are not descriptors,
-                // so ignore those.
-                // https://devzone.nordicsemi.com/f/nordic-q-a/49500/sd_ble_gattc_descriptors_discover-is-returning-attributes-that-are-not-descriptors
-                break;
-        }
+        remember_descriptor_handle(m_desc_discovery_characteristic, &gattc_desc->uuid, gattc_desc->handle);
 
         bleio_descriptor_obj_t *descriptor = m_new_obj(bleio_descriptor_obj_t);
         descriptor->base.type = &bleio_descriptor_type;
@@ -578,7 +800,8 @@ STATIC void on_desc_discovery_rsp(ble_gattc_evt_desc_disc_rsp_t *response, bleio
             GATT_MAX_DATA_LENGTH, false, mp_const_empty_bytes);
         descriptor->handle = gattc_desc->handle;
 
-        mp_obj_list_append(m_desc_discovery_characteristic->descriptor_list, MP_OBJ_FROM_PTR(descriptor));
+        descriptor->next = m_desc_discovery_characteristic->descriptor_list;
+        m_desc_discovery_characteristic->descriptor_list = descriptor;
     }
 
     if (response->count > 0) {
@@ -615,13 +838,213 @@ STATIC bool discovery_on_ble_evt(ble_evt_t *ble_evt, mp_obj_t payload) {
     return true;
 }
 
+STATIC bool put_gatt_db_record(uint8_t *gatt_db, uint16_t *length, gatt_db_record_kind_t kind, uint16_t handle, uint16_t extra, bleio_uuid_obj_t *uuid) {
+    gatt_db_record_t record = {
+        .kind = kind,
+        .uuid_length = uuid == NULL ? 0 : common_hal_bleio_uuid_get_size(uuid) / 8,
+        .handle = handle,
+        .extra = extra,
+    };
+    if (*length + sizeof(record) + record.uuid_length > GATT_DB_MAX_LENGTH) {
+        return false;
+    }
+    memcpy(gatt_db + *length, &record, sizeof(record));
+    *length += sizeof(record);
+    if (uuid != NULL) {
+        common_hal_bleio_uuid_pack_into(uuid, gatt_db + *length);
+        *length += record.uuid_length;
+    }
+    return true;
+}
+
+STATIC void save_gatt_db(bleio_connection_internal_t *self) {
+    uint8_t *gatt_db = m_new(uint8_t, GATT_DB_MAX_LENGTH);
+    uint16_t length = 0;
+    bool fits = true;
+    for (bleio_service_obj_t *service = self->remote_service_list;
+         service != NULL && fits;
+         service = service->next) {
+        fits = put_gatt_db_record(gatt_db, &length, GATT_DB_SERVICE,
+                                  service->start_handle, service->end_handle, service->uuid);
+        for (size_t i = 0; i < service->characteristic_list->len && fits; i++) {
+            bleio_characteristic_obj_t *characteristic = MP_OBJ_TO_PTR(service->characteristic_list->items[i]);
+            fits = put_gatt_db_record(gatt_db, &length, GATT_DB_CHARACTERISTIC,
+                                      characteristic->handle, characteristic->props, characteristic->uuid);
+            for (bleio_descriptor_obj_t *descriptor = characteristic->descriptor_list;
+                 descriptor != NULL && fits;
+                 descriptor = descriptor->next) {
+                fits = put_gatt_db_record(gatt_db, &length, GATT_DB_DESCRIPTOR,
+                                          descriptor->handle, 0, descriptor->uuid);
+            }
+        }
+    }
+    if (fits && length > 0) {
+        bonding_save_gatt_db(self->is_central, self->ediv, gatt_db, length);
+        self->service_changed_handle = find_service_changed_handle(gatt_db, length);
+    }
+    m_del(uint8_t, gatt_db, GATT_DB_MAX_LENGTH);
+}
+
+STATIC bleio_uuid_obj_t *gatt_db_uuid(const uint8_t *raw, uint8_t length) {
+    if (length == 0) {
+        return NULL;
+    }
+    bleio_uuid_obj_t *uuid = m_new_obj(bleio_uuid_obj_t);
+    uuid->base.type = &bleio_uuid_type;
+    if (length == 16) {
+        // Registers the 128-bit base with the SD again since the type it had may have changed.
+        common_hal_bleio_uuid_construct(uuid, raw[12] | raw[13] << 8, raw);
+    } else {
+        common_hal_bleio_uuid_construct(uuid, raw[0] | raw[1] << 8, NULL);
+    }
+    return uuid;
+}
+
+// Rebuild the remote services from the cached GATT database, in the order discovery found them.
+STATIC bool load_gatt_db(bleio_connection_internal_t *self) {
+    uint16_t length;
+    const uint8_t *gatt_db = bonding_load_gatt_db(self->is_central, self->ediv, &length);
+    if (gatt_db == NULL) {
+        return false;
+    }
+
+    bleio_service_obj_t *last_service = NULL;
+    bleio_characteristic_obj_t *characteristic = NULL;
+    bleio_descriptor_obj_t *last_descriptor = NULL;
+    uint16_t offset = 0;
+    self->remote_service_list = NULL;
+    while (offset < length) {
+        gatt_db_record_t record;
+        if (offset + sizeof(record) > length) {
+            return false;
+        }
+        memcpy(&record, gatt_db + offset, sizeof(record));
+        offset += sizeof(record);
+        if (offset + record.uuid_length > length ||
+            (record.uuid_length != 0 && record.uuid_length != 2 && record.uuid_length != 16)) {
+            return false;
+        }
+        bleio_uuid_obj_t *uuid = gatt_db_uuid(gatt_db + offset, record.uuid_length);
+        offset += record.uuid_length;
+
+        if (record.kind == GATT_DB_SERVICE) {
+            bleio_service_obj_t *service = m_new_obj(bleio_service_obj_t);
+            service->base.type = &bleio_service_type;
+            bleio_service_from_connection(service, bleio_connection_new_from_internal(self));
+            service->is_remote = true;
+            service->start_handle = record.handle;
+            service->end_handle = record.extra;
+            service->handle = record.handle;
+            service->uuid = uuid;
+            service->next = NULL;
+            if (last_service == NULL) {
+                self->remote_service_list = service;
+            } else {
+                last_service->next = service;
+            }
+            last_service = service;
+            characteristic = NULL;
+        } else if (record.kind == GATT_DB_CHARACTERISTIC && last_service != NULL) {
+            characteristic = m_new_obj(bleio_characteristic_obj_t);
+            characteristic->base.type = &bleio_characteristic_type;
+            common_hal_bleio_characteristic_construct(
+                characteristic, last_service, record.handle, uuid,
+                record.extra, SECURITY_MODE_OPEN, SECURITY_MODE_OPEN,
+                GATT_MAX_DATA_LENGTH, false,   // max_length, fixed_length: values may not matter for gattc
+                NULL);
+            mp_obj_list_append(last_service->characteristic_list, MP_OBJ_FROM_PTR(characteristic));
+            last_descriptor = NULL;
+        } else if (record.kind == GATT_DB_DESCRIPTOR && characteristic != NULL) {
+            bleio_descriptor_obj_t *descriptor = m_new_obj(bleio_descriptor_obj_t);
+            descriptor->base.type = &bleio_descriptor_type;
+            common_hal_bleio_descriptor_construct(
+                descriptor, characteristic, uuid,
+                SECURITY_MODE_OPEN, SECURITY_MODE_OPEN,
+                GATT_MAX_DATA_LENGTH, false, mp_const_empty_bytes);
+            descriptor->handle = record.handle;
+            if (uuid != NULL) {
+                remember_descriptor_handle(characteristic, &uuid->nrf_ble_uuid, record.handle);
+            }
+            descriptor->next = NULL;
+            if (last_descriptor == NULL) {
+                characteristic->descriptor_list = descriptor;
+            } else {
+                last_descriptor->next = descriptor;
+            }
+            last_descriptor = descriptor;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Keep only the services in the whitelist, in the order discovering them one by one would give.
+STATIC void keep_whitelisted_services(bleio_connection_internal_t *self, mp_obj_t service_uuids_whitelist) {
+    if (service_uuids_whitelist == mp_const_none) {
+        return;
+    }
+    bleio_service_obj_t *kept = NULL;
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t iterable = mp_getiter(service_uuids_whitelist, &iter_buf);
+    mp_obj_t uuid_obj;
+    while ((uuid_obj = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+        if (!MP_OBJ_IS_TYPE(uuid_obj, &bleio_uuid_type)) {
+            mp_raise_TypeError(translate("non-UUID found in service_uuids_whitelist"));
+        }
+        bleio_uuid_obj_t *uuid = MP_OBJ_TO_PTR(uuid_obj);
+
+        bleio_service_obj_t **link = &self->remote_service_list;
+        while (*link != NULL) {
+            bleio_service_obj_t *service = *link;
+            if (service->uuid != NULL &&
+                service->uuid->nrf_ble_uuid.type == uuid->nrf_ble_uuid.type &&
+                service->uuid->nrf_ble_uuid.uuid == uuid->nrf_ble_uuid.uuid) {
+                *link = service->next;
+                service->next = kept;
+                kept = service;
+            } else {
+                link = &service->next;
+            }
+        }
+    }
+    self->remote_service_list = kept;
+}
+
+STATIC void enable_service_changed_indications(bleio_connection_internal_t *self) {
+    for (bleio_service_obj_t *service = self->remote_service_list; service != NULL; service = service->next) {
+        for (size_t i = 0; i < service->characteristic_list->len; i++) {
+            bleio_characteristic_obj_t *characteristic = MP_OBJ_TO_PTR(service->characteristic_list->items[i]);
+            if (characteristic->handle == self->service_changed_handle &&
+                characteristic->cccd_handle != BLE_GATT_HANDLE_INVALID) {
+                // The peer remembers this for as long as we're bonded.
+                common_hal_bleio_characteristic_set_cccd(characteristic, false, true);
+                return;
+            }
+        }
+    }
+}
+
 STATIC void discover_remote_services(bleio_connection_internal_t *self, mp_obj_t service_uuids_whitelist) {
+    // A bonded peer's services stay the same until it indicates that they changed, so use the ones
+    // found last time. Discover all of them when there are none yet so any whitelist can be served
+    // from the cache later.
+    bool bonded = self->ediv != EDIV_INVALID && self->pair_status == PAIR_PAIRED;
+    if (bonded && !self->gatt_db_changed) {
+        if (load_gatt_db(self)) {
+            keep_whitelisted_services(self, service_uuids_whitelist);
+            return;
+        }
+        self->remote_service_list = NULL;
+    }
+    mp_obj_t discovery_whitelist = bonded ? mp_const_none : service_uuids_whitelist;
+
     ble_drv_add_event_handler(discovery_on_ble_evt, self);
 
     // Start over with an empty list.
     self->remote_service_list = NULL;
 
-    if (service_uuids_whitelist == mp_const_none) {
+    if (discovery_whitelist == mp_const_none) {
         // List of service UUID's not given, so discover all available services.
 
         uint16_t next_service_start_handle = BLE_GATT_HANDLE_START;
@@ -636,7 +1059,7 @@ STATIC void discover_remote_services(bleio_connection_internal_t *self, mp_obj_t
         }
     } else {
         mp_obj_iter_buf_t iter_buf;
-        mp_obj_t iterable = mp_getiter(service_uuids_whitelist, &iter_buf);
+        mp_obj_t iterable = mp_getiter(discovery_whitelist, &iter_buf);
         mp_obj_t uuid_obj;
         while ((uuid_obj = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
             if (!MP_OBJ_IS_TYPE(uuid_obj, &bleio_uuid_type)) {
@@ -721,6 +1144,12 @@ STATIC void discover_remote_services(bleio_connection_internal_t *self, mp_obj_t
     // This event handler is no longer needed.
     ble_drv_remove_event_handler(discovery_on_ble_evt, self);
 
+    if (bonded && self->conn_handle != BLE_CONN_HANDLE_INVALID) {
+        save_gatt_db(self);
+        self->gatt_db_changed = false;
+        enable_service_changed_indications(self);
+        keep_whitelisted_services(self, service_uuids_whitelist);
+    }
 }
 
 mp_obj_tuple_t *common_hal_bleio_connection_discover_remote_services(bleio_connection_obj_t *self, mp_obj_t service_uuids_whitelist) {
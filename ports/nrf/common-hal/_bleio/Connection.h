@@ -66,6 +66,13 @@ typedef struct {
     ble_drv_evt_handler_entry_t handler_entry;
     ble_gap_conn_params_t conn_params;
     volatile bool conn_params_updating;
+    // The transmit PHY and link layer payload length in use.
+    uint8_t phy;
+    volatile bool phy_updating;
+    uint16_t data_length;
+    volatile bool data_length_updating;
+    // Ask for the longest link layer payload once the PHY chosen at connection time is settled.
+    volatile bool data_length_after_phy;
     uint16_t mtu;
     // Request that CCCD values for this conenction be saved, using sys_attr values.
     volatile bool do_bond_cccds;
@@ -74,6 +81,12 @@ typedef struct {
     // Time of setting do_bond_ccds: we delay a bit to consolidate multiple CCCD changes
     // into one write. Time is currently in ticks_ms.
     uint64_t do_bond_cccds_request_time;
+    // Handle of the peer's Service Changed characteristic, from its cached GATT database.
+    uint16_t service_changed_handle;
+    // Set when the peer indicates that its services changed so the cached ones aren't used.
+    volatile bool gatt_db_changed;
+    // Request that the cached GATT database for this connection be forgotten.
+    volatile bool do_forget_gatt_db;
 } bleio_connection_internal_t;
 
 typedef struct {
@@ -84,6 +97,7 @@ typedef struct {
 } bleio_connection_obj_t;
 
 bool connection_on_ble_evt(ble_evt_t *ble_evt, void *self_in);
+void bleio_connection_start_link_updates(bleio_connection_internal_t *self);
 
 uint16_t bleio_connection_get_conn_handle(bleio_connection_obj_t *self);
 mp_obj_t bleio_connection_new_from_internal(bleio_connection_internal_t* connection);
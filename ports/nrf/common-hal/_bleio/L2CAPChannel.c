@@ -0,0 +1,342 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "ble_drv.h"
+#include "ble_l2cap.h"
+#include "nrf_nvic.h"
+
+#include "lib/utils/interrupt_char.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/_bleio/__init__.h"
+#include "shared-bindings/_bleio/Adapter.h"
+#include "shared-bindings/_bleio/Connection.h"
+#include "shared-bindings/_bleio/L2CAPChannel.h"
+#include "supervisor/shared/tick.h"
+
+STATIC uint8_t queued_count(uint8_t queued) {
+    uint8_t count = 0;
+    for (size_t i = 0; i < BLEIO_L2CAP_QUEUE_SIZE; i++) {
+        if (queued & (1 << i)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+STATIC void channel_closed(bleio_l2cap_channel_obj_t *self) {
+    self->state = L2CAP_CHANNEL_CLOSED;
+    self->local_cid = BLE_L2CAP_CID_INVALID;
+    // The SD gives up all buffers when the channel goes away.
+    self->rx_queued = 0;
+    self->tx_queued = 0;
+}
+
+// Give the SD reception buffers as long as everything queued fits in the ring buffer. This runs
+// in the SD event handler, or in the VM with the handler locked out.
+STATIC void queue_rx_buffers(bleio_l2cap_channel_obj_t *self) {
+    if (self->state != L2CAP_CHANNEL_OPEN) {
+        return;
+    }
+    for (size_t i = 0; i < BLEIO_L2CAP_QUEUE_SIZE; i++) {
+        if ((self->rx_queued & (1 << i)) != 0) {
+            continue;
+        }
+        if (ringbuf_num_empty(&self->ringbuf) < (queued_count(self->rx_queued) + 1) * self->mtu) {
+            return;
+        }
+        ble_data_t sdu_buf = {
+            .p_data = self->rx_buffers[i],
+            .len = self->mtu,
+        };
+        if (sd_ble_l2cap_ch_rx(self->conn_handle, self->local_cid, &sdu_buf) != NRF_SUCCESS) {
+            return;
+        }
+        self->rx_queued |= 1 << i;
+    }
+}
+
+STATIC void buffer_returned(uint8_t **buffers, volatile uint8_t *queued, uint8_t *p_data) {
+    for (size_t i = 0; i < BLEIO_L2CAP_QUEUE_SIZE; i++) {
+        if (buffers[i] == p_data) {
+            *queued &= ~(1 << i);
+        }
+    }
+}
+
+STATIC void setup_params(bleio_l2cap_channel_obj_t *self, ble_l2cap_ch_setup_params_t *params) {
+    params->rx_params.rx_mtu = self->mtu;
+    params->rx_params.rx_mps = MIN(self->mtu, BLEIO_L2CAP_MPS);
+    // The first reception buffer goes along with the setup so the peer gets credits right away.
+    params->rx_params.sdu_buf.p_data = self->rx_buffers[0];
+    params->rx_params.sdu_buf.len = self->mtu;
+    params->le_psm = self->psm;
+    params->status = BLE_L2CAP_CH_STATUS_CODE_SUCCESS;
+}
+
+STATIC bool l2cap_channel_on_ble_evt(ble_evt_t *ble_evt, void *param) {
+    bleio_l2cap_channel_obj_t *self = (bleio_l2cap_channel_obj_t *) param;
+    uint16_t evt_id = ble_evt->header.evt_id;
+    if (evt_id == BLE_GAP_EVT_DISCONNECTED) {
+        if (ble_evt->evt.gap_evt.conn_handle == self->conn_handle) {
+            channel_closed(self);
+        }
+        // Let the connection see it too.
+        return false;
+    }
+    if (evt_id < BLE_L2CAP_EVT_BASE || evt_id > BLE_L2CAP_EVT_LAST) {
+        return false;
+    }
+    ble_l2cap_evt_t *evt = &ble_evt->evt.l2cap_evt;
+    if (evt->conn_handle != self->conn_handle) {
+        return false;
+    }
+    if (evt_id == BLE_L2CAP_EVT_CH_SETUP_REQUEST) {
+        if (self->state != L2CAP_CHANNEL_LISTENING ||
+            evt->params.ch_setup_request.le_psm != self->psm) {
+            return false;
+        }
+        ble_l2cap_ch_setup_params_t params;
+        setup_params(self, &params);
+        uint16_t local_cid = evt->local_cid;
+        if (sd_ble_l2cap_ch_setup(self->conn_handle, &local_cid, &params) != NRF_SUCCESS) {
+            return false;
+        }
+        self->local_cid = local_cid;
+        self->rx_queued = 1;
+        self->tx_mtu = evt->params.ch_setup_request.tx_params.tx_mtu;
+        self->state = L2CAP_CHANNEL_CONNECTING;
+        return true;
+    }
+    if (evt->local_cid != self->local_cid) {
+        return false;
+    }
+    switch (evt_id) {
+        case BLE_L2CAP_EVT_CH_SETUP:
+            self->tx_mtu = evt->params.ch_setup.tx_params.tx_mtu;
+            self->state = L2CAP_CHANNEL_OPEN;
+            queue_rx_buffers(self);
+            break;
+
+        case BLE_L2CAP_EVT_CH_SETUP_REFUSED:
+            self->refused_status = evt->params.ch_setup_refused.status;
+            channel_closed(self);
+            break;
+
+        case BLE_L2CAP_EVT_CH_RELEASED:
+            channel_closed(self);
+            break;
+
+        case BLE_L2CAP_EVT_CH_SDU_BUF_RELEASED: {
+            uint8_t *p_data = evt->params.ch_sdu_buf_released.sdu_buf.p_data;
+            buffer_returned(self->rx_buffers, &self->rx_queued, p_data);
+            buffer_returned(self->tx_buffers, &self->tx_queued, p_data);
+            break;
+        }
+
+        case BLE_L2CAP_EVT_CH_RX: {
+            ble_l2cap_evt_ch_rx_t *rx = &evt->params.rx;
+            buffer_returned(self->rx_buffers, &self->rx_queued, rx->sdu_buf.p_data);
+            // There's always room because the buffer was only queued when there was. The VM may
+            // be reading meanwhile without locking us out.
+            ringbuf_put_n(&self->ringbuf, rx->sdu_buf.p_data, rx->sdu_len);
+            queue_rx_buffers(self);
+            break;
+        }
+
+        case BLE_L2CAP_EVT_CH_TX:
+            buffer_returned(self->tx_buffers, &self->tx_queued, evt->params.tx.sdu_buf.p_data);
+            break;
+
+        case BLE_L2CAP_EVT_CH_CREDIT:
+            // The SD keeps queued SDUs until the peer gives it credits.
+            break;
+
+        default:
+            return false;
+    }
+    return true;
+}
+
+void common_hal_bleio_l2cap_channel_construct(bleio_l2cap_channel_obj_t *self,
+    bleio_connection_obj_t *connection, uint16_t psm, bool listen, mp_float_t timeout,
+    size_t buffer_size, uint16_t mtu) {
+    if (common_hal_bleio_adapter_obj.l2cap_channel_count == 0) {
+        mp_raise_bleio_BluetoothError(translate("No L2CAP channels configured"));
+    }
+
+    self->connection = MP_OBJ_FROM_PTR(connection);
+    self->conn_handle = bleio_connection_get_conn_handle(connection);
+    self->psm = psm;
+    self->mtu = mtu;
+    self->tx_mtu = 0;
+    self->timeout_ms = timeout * 1000;
+    self->local_cid = BLE_L2CAP_CID_INVALID;
+    self->refused_status = BLE_L2CAP_CH_STATUS_CODE_SUCCESS;
+    self->rx_queued = 0;
+    self->tx_queued = 0;
+
+    // This is a macro. The ring buffer holds one byte less than its size.
+    ringbuf_alloc(&self->ringbuf, buffer_size + 1, false);
+    if (self->ringbuf.buf == NULL) {
+        mp_raise_ValueError(translate("Buffer too large and unable to allocate"));
+    }
+    for (size_t i = 0; i < BLEIO_L2CAP_QUEUE_SIZE; i++) {
+        self->rx_buffers[i] = m_malloc(mtu, false);
+        self->tx_buffers[i] = m_malloc(mtu, false);
+    }
+
+    if (listen) {
+        self->state = L2CAP_CHANNEL_LISTENING;
+        ble_drv_add_event_handler(l2cap_channel_on_ble_evt, self);
+        return;
+    }
+
+    self->state = L2CAP_CHANNEL_CONNECTING;
+    ble_drv_add_event_handler(l2cap_channel_on_ble_evt, self);
+
+    ble_l2cap_ch_setup_params_t params;
+    setup_params(self, &params);
+    // The SD sets local_cid before it can report anything about the channel.
+    uint32_t err_code = sd_ble_l2cap_ch_setup(self->conn_handle, &self->local_cid, &params);
+    if (err_code != NRF_SUCCESS) {
+        self->state = L2CAP_CHANNEL_CLOSED;
+        ble_drv_remove_event_handler(l2cap_channel_on_ble_evt, self);
+        check_nrf_error(err_code);
+    }
+    self->rx_queued = 1;
+
+    while (self->state == L2CAP_CHANNEL_CONNECTING && !mp_hal_is_interrupted()) {
+        RUN_BACKGROUND_TASKS;
+    }
+    if (self->state == L2CAP_CHANNEL_CLOSED) {
+        ble_drv_remove_event_handler(l2cap_channel_on_ble_evt, self);
+        mp_raise_bleio_ConnectionError(translate("L2CAP channel refused with status 0x%04x"),
+                                       self->refused_status);
+    }
+}
+
+bool common_hal_bleio_l2cap_channel_get_connected(bleio_l2cap_channel_obj_t *self) {
+    return self->state == L2CAP_CHANNEL_OPEN;
+}
+
+uint32_t common_hal_bleio_l2cap_channel_get_in_waiting(bleio_l2cap_channel_obj_t *self) {
+    return ringbuf_count(&self->ringbuf);
+}
+
+size_t common_hal_bleio_l2cap_channel_readinto(bleio_l2cap_channel_obj_t *self, uint8_t *data, size_t len) {
+    uint64_t start_ticks = supervisor_ticks_ms64();
+
+    // Wait for something to read, unless there will never be anything more.
+    while (ringbuf_count(&self->ringbuf) == 0 &&
+           self->state != L2CAP_CHANNEL_CLOSED &&
+           supervisor_ticks_ms64() - start_ticks < self->timeout_ms) {
+        RUN_BACKGROUND_TASKS;
+        // Allow user to break out of a timeout with a KeyboardInterrupt.
+        if (mp_hal_is_interrupted()) {
+            return 0;
+        }
+    }
+
+    // The RX handler may fill the ring buffer meanwhile without locking it out.
+    size_t count = ringbuf_get_n(&self->ringbuf, data, MIN(len, self->ringbuf.size));
+
+    // Reading made room so the peer may get credits for more.
+    uint8_t is_nested_critical_region;
+    sd_nvic_critical_region_enter(&is_nested_critical_region);
+    queue_rx_buffers(self);
+    sd_nvic_critical_region_exit(is_nested_critical_region);
+
+    return count;
+}
+
+void common_hal_bleio_l2cap_channel_write(bleio_l2cap_channel_obj_t *self, const uint8_t *data, size_t len) {
+    while (len > 0) {
+        uint8_t free_index = BLEIO_L2CAP_QUEUE_SIZE;
+        while (self->state == L2CAP_CHANNEL_OPEN && !mp_hal_is_interrupted()) {
+            for (size_t i = 0; i < BLEIO_L2CAP_QUEUE_SIZE; i++) {
+                if ((self->tx_queued & (1 << i)) == 0) {
+                    free_index = i;
+                    break;
+                }
+            }
+            if (free_index < BLEIO_L2CAP_QUEUE_SIZE) {
+                break;
+            }
+            RUN_BACKGROUND_TASKS;
+        }
+        if (mp_hal_is_interrupted()) {
+            return;
+        }
+        if (self->state != L2CAP_CHANNEL_OPEN) {
+            mp_raise_bleio_ConnectionError(translate("L2CAP channel is not connected"));
+        }
+
+        // Each SDU goes out in as many PDUs as it takes. Fewer, larger SDUs cost fewer events.
+        uint16_t sdu_len = MIN(len, MIN(self->mtu, self->tx_mtu));
+        memcpy(self->tx_buffers[free_index], data, sdu_len);
+        ble_data_t sdu_buf = {
+            .p_data = self->tx_buffers[free_index],
+            .len = sdu_len,
+        };
+
+        // Lock out the TX handler so it can't return the buffer before it is marked queued.
+        uint8_t is_nested_critical_region;
+        sd_nvic_critical_region_enter(&is_nested_critical_region);
+        uint32_t err_code = sd_ble_l2cap_ch_tx(self->conn_handle, self->local_cid, &sdu_buf);
+        if (err_code == NRF_SUCCESS) {
+            self->tx_queued |= 1 << free_index;
+        }
+        sd_nvic_critical_region_exit(is_nested_critical_region);
+
+        if (err_code == NRF_ERROR_RESOURCES) {
+            // The SD's queue is full. Wait for a TX event to empty it.
+            RUN_BACKGROUND_TASKS;
+            continue;
+        }
+        check_nrf_error(err_code);
+        data += sdu_len;
+        len -= sdu_len;
+    }
+}
+
+bool common_hal_bleio_l2cap_channel_deinited(bleio_l2cap_channel_obj_t *self) {
+    return self->connection == MP_OBJ_NULL;
+}
+
+void common_hal_bleio_l2cap_channel_deinit(bleio_l2cap_channel_obj_t *self) {
+    if (common_hal_bleio_l2cap_channel_deinited(self)) {
+        return;
+    }
+    if (self->state == L2CAP_CHANNEL_OPEN) {
+        sd_ble_l2cap_ch_release(self->conn_handle, self->local_cid);
+    }
+    ble_drv_remove_event_handler(l2cap_channel_on_ble_evt, self);
+    channel_closed(self);
+    self->connection = MP_OBJ_NULL;
+}
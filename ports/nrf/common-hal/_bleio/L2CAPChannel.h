@@ -0,0 +1,71 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_NRF_COMMON_HAL_BLEIO_L2CAPCHANNEL_H
+#define MICROPY_INCLUDED_NRF_COMMON_HAL_BLEIO_L2CAPCHANNEL_H
+
+#include "ble_l2cap.h"
+
+#include "py/ringbuf.h"
+#include "shared-bindings/_bleio/Connection.h"
+
+// Largest L2CAP PDU payload that fits in one link layer packet with Data Length Extension.
+#define BLEIO_L2CAP_MPS (247)
+// SDU buffers queued with the SD per channel in each direction.
+#define BLEIO_L2CAP_QUEUE_SIZE (2)
+
+typedef enum {
+    L2CAP_CHANNEL_CLOSED,
+    L2CAP_CHANNEL_CONNECTING,
+    L2CAP_CHANNEL_LISTENING,
+    L2CAP_CHANNEL_OPEN,
+} l2cap_channel_state_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t connection;
+    // Ring buffer of the incoming stream. A reception buffer is only given to the SD when the
+    // ring buffer has room for it, so the peer runs out of credits rather than data being lost.
+    ringbuf_t ringbuf;
+    // SDU buffers of mtu bytes. The SD owns them from when they are queued until it returns them
+    // in an RX, TX or SDU buffer released event. The masks have a bit set for each it owns.
+    uint8_t* rx_buffers[BLEIO_L2CAP_QUEUE_SIZE];
+    uint8_t* tx_buffers[BLEIO_L2CAP_QUEUE_SIZE];
+    volatile uint8_t rx_queued;
+    volatile uint8_t tx_queued;
+    uint32_t timeout_ms;
+    uint16_t mtu;
+    // Largest SDU the peer takes.
+    uint16_t tx_mtu;
+    uint16_t psm;
+    uint16_t conn_handle;
+    uint16_t local_cid;
+    // Status code the peer refused the channel with.
+    uint16_t refused_status;
+    volatile l2cap_channel_state_t state;
+} bleio_l2cap_channel_obj_t;
+
+#endif // MICROPY_INCLUDED_NRF_COMMON_HAL_BLEIO_L2CAPCHANNEL_H
@@ -43,33 +43,34 @@
 #include "supervisor/shared/tick.h"
 
 STATIC void write_to_ringbuf(bleio_packet_buffer_obj_t *self, uint8_t *data, uint16_t len) {
-    if (len + sizeof(uint16_t) > self->ringbuf.size) {
+    if (len + sizeof(uint16_t) > self->ringbuf.size - 1) {
         // This shouldn't happen.
         return;
     }
-    // Push all the data onto the ring buffer.
-    uint8_t is_nested_critical_region;
-    sd_nvic_critical_region_enter(&is_nested_critical_region);
-    // Make room for the new value by dropping the oldest packets first.
-    while (self->ringbuf.size - ringbuf_count(&self->ringbuf) < (int) (len + sizeof(uint16_t))) {
+    // This runs in the SD event handler. The ring buffer is safe for it to fill while the VM
+    // reads, so there's no need to lock the VM out. Make room for the new value by dropping the
+    // oldest packets first. A read racing with a drop fails to take its packet and starts over.
+    while (ringbuf_num_empty(&self->ringbuf) < len + sizeof(uint16_t)) {
         uint16_t packet_length;
-        ringbuf_get_n(&self->ringbuf, (uint8_t*) &packet_length, sizeof(uint16_t));
-        for (uint16_t i = 0; i < packet_length; i++) {
-            ringbuf_get(&self->ringbuf);
-        }
-        // set an overflow flag?
+        ringbuf_peek_n(&self->ringbuf, (uint8_t*) &packet_length, sizeof(uint16_t));
+        ringbuf_drop_n(&self->ringbuf, sizeof(uint16_t) + packet_length);
+        self->overflow_count++;
     }
+    // The VM can't run until this returns so it won't see the length without the data.
     ringbuf_put_n(&self->ringbuf, (uint8_t*) &len, sizeof(uint16_t));
     ringbuf_put_n(&self->ringbuf, data, len);
-    sd_nvic_critical_region_exit(is_nested_critical_region);
 }
 
 STATIC uint32_t queue_next_write(bleio_packet_buffer_obj_t *self) {
-    // Queue up the next outgoing buffer. We use two, one that has been passed to the SD for
-    // transmission (when packet_queued is true) and the other is `pending` and can still be
-    // modified. By primarily appending to the `pending` buffer we can reduce the protocol overhead
-    // of the lower level link and ATT layers.
-    self->packet_queued = false;
+    // Queue up the `pending` buffer. The SD copies notifications and write commands into the
+    // connection's transmit queue, which ble_stack_enable makes up to MAX_TX_IN_PROGRESS deep
+    // depending on how many connections there can be, so we hand the pending buffer over
+    // whenever there is room and several packets can go out in one connection event.
+    // Once the queue is full the SD returns NRF_ERROR_RESOURCES and writes are appended to the
+    // `pending` buffer until a TX complete event makes room, which reduces the protocol overhead
+    // of the lower level link and ATT layers. Indications and write requests are refused with
+    // NRF_ERROR_BUSY until the previous one is confirmed, and the buffer passed to the SD last
+    // isn't touched until the next one is queued.
     if (self->pending_size > 0) {
         uint16_t conn_handle = self->conn_handle;
         uint32_t err_code;
@@ -101,7 +102,6 @@ STATIC uint32_t queue_next_write(bleio_packet_buffer_obj_t *self) {
         }
         self->pending_size = 0;
         self->pending_index = (self->pending_index + 1) % 2;
-        self->packet_queued = true;
     }
     return NRF_SUCCESS;
 }
@@ -195,8 +195,9 @@ void common_hal_bleio_packet_buffer_construct(
     }
 
     if (incoming) {
-        // This is a macro.
-        ringbuf_alloc(&self->ringbuf, buffer_size * (sizeof(uint16_t) + characteristic->max_length), false);
+        // This is a macro. The ring buffer holds one byte less than its size.
+        ringbuf_alloc(&self->ringbuf, buffer_size * (sizeof(uint16_t) + characteristic->max_length) + 1, false);
+        self->overflow_count = 0;
 
         if (self->ringbuf.buf == NULL) {
             mp_raise_ValueError(translate("Buffer too large and unable to allocate"));
@@ -204,7 +205,6 @@ void common_hal_bleio_packet_buffer_construct(
     }
 
     if (outgoing) {
-        self->packet_queued = false;
         self->pending_index = 0;
         self->pending_size = 0;
         self->outgoing[0] = m_malloc(characteristic->max_length, false);
@@ -243,27 +243,29 @@ void common_hal_bleio_packet_buffer_construct(
 }
 
 int common_hal_bleio_packet_buffer_readinto(bleio_packet_buffer_obj_t *self, uint8_t *data, size_t len) {
-    if (ringbuf_count(&self->ringbuf) < 2) {
-        return 0;
-    }
-
+    // Copy the oldest packet without locking out the write handler. If it drops the packet to
+    // make room while we copy, taking it fails and we copy the new oldest packet instead.
+    uint32_t state;
     uint16_t packet_length;
-    ringbuf_get_n(&self->ringbuf, (uint8_t*) &packet_length, sizeof(uint16_t));
-
-    // Copy received data. Lock out write interrupt handler while copying.
-    uint8_t is_nested_critical_region;
-    sd_nvic_critical_region_enter(&is_nested_critical_region);
+    do {
+        state = ringbuf_get_state(&self->ringbuf);
+        uint16_t count = ringbuf_count_after(&self->ringbuf, state);
+        if (count < sizeof(uint16_t)) {
+            return 0;
+        }
+        ringbuf_peek_after(&self->ringbuf, state, 0, (uint8_t*) &packet_length, sizeof(uint16_t));
+        if (count < sizeof(uint16_t) + packet_length) {
+            return 0;
+        }
+        ringbuf_peek_after(&self->ringbuf, state, sizeof(uint16_t), data, MIN(packet_length, len));
+        // Take the whole packet even if it didn't fit so the next read starts at a packet.
+    } while (!ringbuf_take(&self->ringbuf, state, sizeof(uint16_t) + packet_length));
 
     if (packet_length > len) {
         // TODO: raise an exception.
         packet_length = len;
     }
 
-    ringbuf_get_n(&self->ringbuf, data, packet_length);
-
-    // Writes now OK.
-    sd_nvic_critical_region_exit(is_nested_critical_region);
-
     return packet_length;
 }
 
@@ -294,12 +296,14 @@ void common_hal_bleio_packet_buffer_write(bleio_packet_buffer_obj_t *self, uint8
     memcpy(pending + self->pending_size, data, len);
     self->pending_size += len;
 
+    // Send it straight away if the SD has room for it. Otherwise the next TX complete event will.
+    queue_next_write(self);
+
     sd_nvic_critical_region_exit(is_nested_critical_region);
+}
 
-    // If no writes are queued then sneak in this data.
-    if (!self->packet_queued) {
-        queue_next_write(self);
-    }
+uint32_t common_hal_bleio_packet_buffer_get_overflow_count(bleio_packet_buffer_obj_t *self) {
+    return self->overflow_count;
 }
 
 uint16_t common_hal_bleio_packet_buffer_get_packet_size(bleio_packet_buffer_obj_t *self) {
@@ -314,14 +318,17 @@ uint16_t common_hal_bleio_packet_buffer_get_packet_size(bleio_packet_buffer_obj_
             break;
         }
     }
-    if (connection->mtu == 0) {
+    mtu = connection->mtu;
+    if (mtu == 0) {
         mtu = BLE_GATT_ATT_MTU_DEFAULT;
     }
-    if (self->characteristic->max_length > mtu) {
-        mtu = self->characteristic->max_length;
-    }
     uint16_t att_overhead = 3;
-    return mtu - att_overhead;
+    uint16_t packet_size = mtu - att_overhead;
+    // The outgoing buffers only hold max_length bytes.
+    if (self->characteristic->max_length < packet_size) {
+        packet_size = self->characteristic->max_length;
+    }
+    return packet_size;
 }
 
 bool common_hal_bleio_packet_buffer_deinited(bleio_packet_buffer_obj_t *self) {
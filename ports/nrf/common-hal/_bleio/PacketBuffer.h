@@ -37,15 +37,16 @@ typedef struct {
     bleio_characteristic_obj_t *characteristic;
     // Ring buffer storing consecutive incoming values.
     ringbuf_t ringbuf;
-    // Two outgoing buffers to alternate between. One will be queued for transmission by the SD and
-    // the other is waiting to be queued and can be extended.
+    // Packets dropped from the ring buffer to make room for newer ones.
+    uint32_t overflow_count;
+    // Two outgoing buffers to alternate between. One was the last passed to the SD for transmission
+    // and the other is waiting to be queued and can be extended.
     uint8_t* outgoing[2];
     uint16_t pending_size;
     uint16_t conn_handle;
     uint8_t pending_index;
     uint8_t write_type;
     bool client;
-    bool packet_queued;
 } bleio_packet_buffer_obj_t;
 
 #endif // MICROPY_INCLUDED_NRF_COMMON_HAL_BLEIO_PACKETBUFFER_H
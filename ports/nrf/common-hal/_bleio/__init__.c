@@ -106,6 +106,10 @@ bleio_adapter_obj_t common_hal_bleio_adapter_obj = {
     .base = {
         .type = &bleio_adapter_type,
     },
+    .peripheral_connection_count = BLEIO_DEFAULT_PERIPHERAL_CONNECTION_COUNT,
+    .central_connection_count = BLEIO_DEFAULT_CENTRAL_CONNECTION_COUNT,
+    .event_length = BLE_GAP_EVENT_LENGTH_DEFAULT,
+    .l2cap_channel_count = 0,
 };
 
 void common_hal_bleio_check_connected(uint16_t conn_handle) {
@@ -170,6 +174,19 @@ STATIC bool _on_gattc_read_rsp_evt(ble_evt_t *ble_evt, void *param) {
             break;
         }
 
+        case BLE_GATTC_EVT_CHAR_VALS_READ_RSP: {
+            ble_gattc_evt_t* evt = &ble_evt->evt.gattc_evt;
+            ble_gattc_evt_char_vals_read_rsp_t *response = &evt->params.char_vals_read_rsp;
+            if (read && evt->conn_handle == read->conn_handle) {
+                read->status = evt->gatt_status;
+                size_t len = MIN(read->len, response->len);
+                memcpy(read->buf, response->values, len);
+                read->final_len = len;
+                read->done = true;
+            }
+            break;
+        }
+
         default:
             // For debugging.
             // mp_printf(&mp_plat_print, "Unhandled characteristic event: 0x%04x\n", ble_evt->header.evt_id);
@@ -206,6 +223,36 @@ size_t common_hal_bleio_gattc_read(uint16_t handle, uint16_t conn_handle, uint8_
     return read_info.final_len;
 }
 
+size_t common_hal_bleio_gattc_read_multiple(const uint16_t* handles, size_t handle_count, uint16_t conn_handle, uint8_t* buf, size_t len) {
+    common_hal_bleio_check_connected(conn_handle);
+
+    read_info_t read_info;
+    read_info.buf = buf;
+    read_info.len = len;
+    read_info.final_len = 0;
+    read_info.conn_handle = conn_handle;
+    read_info.done = false;
+    ble_drv_add_event_handler(_on_gattc_read_rsp_evt, &read_info);
+
+    // One ATT Read Multiple request gets all of the values back in a single response.
+    uint32_t nrf_error = NRF_ERROR_BUSY;
+    while (nrf_error == NRF_ERROR_BUSY) {
+        nrf_error = sd_ble_gattc_char_values_read(conn_handle, handles, handle_count);
+    }
+    if (nrf_error != NRF_SUCCESS) {
+        ble_drv_remove_event_handler(_on_gattc_read_rsp_evt, &read_info);
+        check_nrf_error(nrf_error);
+    }
+
+    while (!read_info.done) {
+        RUN_BACKGROUND_TASKS;
+    }
+    ble_drv_remove_event_handler(_on_gattc_read_rsp_evt, &read_info);
+    check_gatt_status(read_info.status);
+
+    return read_info.final_len;
+}
+
 void common_hal_bleio_gattc_write(uint16_t handle, uint16_t conn_handle, mp_buffer_info_t *bufinfo, bool write_no_response) {
     common_hal_bleio_check_connected(conn_handle);
 
@@ -236,6 +283,96 @@ void common_hal_bleio_gattc_write(uint16_t handle, uint16_t conn_handle, mp_buff
 
 }
 
+typedef struct {
+    const uint8_t* data;
+    uint16_t len;
+    uint16_t conn_handle;
+    volatile uint16_t status;
+    volatile bool matches;
+    volatile bool done;
+} write_info_t;
+
+STATIC bool _on_gattc_write_rsp_evt(ble_evt_t *ble_evt, void *param) {
+    write_info_t* write = param;
+    if (ble_evt->header.evt_id != BLE_GATTC_EVT_WRITE_RSP) {
+        return false;
+    }
+    ble_gattc_evt_t* evt = &ble_evt->evt.gattc_evt;
+    if (evt->conn_handle != write->conn_handle) {
+        return false;
+    }
+    ble_gattc_evt_write_rsp_t *response = &evt->params.write_rsp;
+    write->status = evt->gatt_status;
+    // The server echoes prepared data back so we can check it queued what we sent.
+    write->matches = response->write_op != BLE_GATT_OP_PREP_WRITE_REQ ||
+        (response->len == write->len && memcmp(response->data, write->data, write->len) == 0);
+    write->done = true;
+    return true;
+}
+
+STATIC uint16_t gattc_write_and_wait(write_info_t *write_info, ble_gattc_write_params_t *write_params) {
+    write_info->data = write_params->p_value;
+    write_info->len = write_params->len;
+    write_info->done = false;
+
+    uint32_t err_code = NRF_ERROR_BUSY;
+    while (err_code == NRF_ERROR_BUSY) {
+        err_code = sd_ble_gattc_write(write_info->conn_handle, write_params);
+        if (err_code == NRF_ERROR_BUSY) {
+            RUN_BACKGROUND_TASKS;
+        }
+    }
+    if (err_code != NRF_SUCCESS) {
+        ble_drv_remove_event_handler(_on_gattc_write_rsp_evt, write_info);
+        check_nrf_error(err_code);
+    }
+    while (!write_info->done) {
+        RUN_BACKGROUND_TASKS;
+    }
+    if (write_info->status == BLE_GATT_STATUS_SUCCESS && !write_info->matches) {
+        return BLE_GATT_STATUS_ATTERR_INVALID_ATT_VAL_LENGTH;
+    }
+    return write_info->status;
+}
+
+void common_hal_bleio_gattc_write_multiple(const uint16_t* handles, mp_buffer_info_t *bufinfos, size_t count, uint16_t conn_handle, uint16_t mtu) {
+    common_hal_bleio_check_connected(conn_handle);
+
+    write_info_t write_info;
+    write_info.conn_handle = conn_handle;
+    ble_drv_add_event_handler(_on_gattc_write_rsp_evt, &write_info);
+
+    // Queue every value on the server with Prepare Write requests and then have it apply them all
+    // at once with an Execute Write. A Prepare Write carries a handle and offset besides the value.
+    uint16_t chunk_size = mtu - 5;
+    uint16_t status = BLE_GATT_STATUS_SUCCESS;
+    for (size_t i = 0; i < count && status == BLE_GATT_STATUS_SUCCESS; i++) {
+        size_t offset = 0;
+        do {
+            ble_gattc_write_params_t write_params = {
+                .write_op = BLE_GATT_OP_PREP_WRITE_REQ,
+                .handle = handles[i],
+                .offset = offset,
+                .p_value = ((uint8_t*) bufinfos[i].buf) + offset,
+                .len = MIN(bufinfos[i].len - offset, chunk_size),
+            };
+            status = gattc_write_and_wait(&write_info, &write_params);
+            offset += write_params.len;
+        } while (offset < bufinfos[i].len && status == BLE_GATT_STATUS_SUCCESS);
+    }
+
+    ble_gattc_write_params_t exec_params = {
+        .write_op = BLE_GATT_OP_EXEC_WRITE_REQ,
+        .flags = status == BLE_GATT_STATUS_SUCCESS ? BLE_GATT_EXEC_WRITE_FLAG_PREPARED_WRITE :
+                                                     BLE_GATT_EXEC_WRITE_FLAG_PREPARED_CANCEL,
+    };
+    uint16_t exec_status = gattc_write_and_wait(&write_info, &exec_params);
+    ble_drv_remove_event_handler(_on_gattc_write_rsp_evt, &write_info);
+
+    check_gatt_status(status);
+    check_gatt_status(exec_status);
+}
+
 void common_hal_bleio_gc_collect(void) {
     bleio_adapter_gc_collect(&common_hal_bleio_adapter_obj);
 }
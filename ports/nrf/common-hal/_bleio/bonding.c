@@ -30,11 +30,14 @@
 
 #include "ble.h"
 #include "ble_drv.h"
+#include "py/gc.h"
+#include "py/misc.h"
 #include "shared-bindings/_bleio/__init__.h"
 #include "shared-bindings/_bleio/Adapter.h"
 #include "shared-bindings/nvm/ByteArray.h"
 #include "supervisor/shared/tick.h"
 
+#include "nrf_sdm.h"
 #include "nrf_soc.h"
 
 #include "bonding.h"
@@ -56,6 +59,36 @@ const uint32_t BONDING_FLAG = ('1' | '0' << 8 | 'D' << 16 | 'B' << 24);
 // Save both system and user service info.
 #define SYS_ATTR_FLAGS      (BLE_GATTS_SYS_ATTR_FLAG_SYS_SRVCS | BLE_GATTS_SYS_ATTR_FLAG_USR_SRVCS)
 
+// Blocks with up to this much data are copied to RAM and written in the background with the
+// SoftDevice's asynchronous flash calls, so storing keys or CCCDs never stalls the caller.
+// Larger ones, such as a GATT database, are written before returning.
+#define PENDING_DATA_MAX_LENGTH (256)
+
+// A block is written data first, then the header word holding its length and last the header
+// word holding its type. Until then its type reads as BLOCK_UNUSED so readers in event handlers
+// stop before it. The block it replaces is invalidated only afterwards so there is always one
+// complete copy to find.
+typedef enum {
+    PENDING_WRITE_IDLE,
+    PENDING_WRITE_DATA,
+    PENDING_WRITE_TAIL,
+    PENDING_WRITE_LENGTH,
+    PENDING_WRITE_TYPE,
+    PENDING_WRITE_INVALIDATE,
+} pending_write_step_t;
+
+STATIC struct {
+    uint32_t header[sizeof(bonding_block_t) / 4];
+    uint32_t data[PENDING_DATA_MAX_LENGTH / 4];
+    const uint32_t *full_words; // Either data or the caller's word aligned buffer.
+    uint32_t full_word_count;
+    uint32_t tail; // The last partial word of data, padded with 1's.
+    bonding_block_t *dest;
+    bonding_block_t *replaces;
+    pending_write_step_t step;
+    bool in_flight;
+} pending_write;
+
 #if BONDING_DEBUG
 void bonding_print_block(bonding_block_t *block) {
     printf("at 0x%08lx: is_central: %1d, type: 0x%x, ediv: 0x%04x, data_length: %d\n",
@@ -75,7 +108,10 @@ STATIC size_t compute_block_size(uint16_t data_length) {
     return sizeof(bonding_block_t) + ((data_length + 3) & ~0x3);
 }
 
+STATIC void finish_pending_write(void);
+
 void bonding_erase_storage(void) {
+    finish_pending_write();
     // Erase all pages in the bonding area.
     for(uint32_t page_address = BONDING_PAGES_START_ADDR;
         page_address < BONDING_PAGES_END_ADDR;
@@ -139,57 +175,205 @@ STATIC bonding_block_t *find_existing_block(bool is_central, bonding_block_type_
     }
 }
 
-// Get an empty block large enough to store data_length data.
+STATIC bool block_fits(bonding_block_t *block, uint16_t data_length) {
+    return block != NULL &&
+        (uint8_t *) block + compute_block_size(data_length) < (uint8_t *) BONDING_DATA_END_ADDR;
+}
+
+STATIC void write_words_sync(uint32_t *dest, const uint32_t *src, uint32_t word_count) {
+    while (word_count > 0) {
+        uint32_t chunk = MIN(word_count, FLASH_PAGE_SIZE / 4);
+        sd_flash_write_sync(dest, (uint32_t *) src, chunk);
+        dest += chunk;
+        src += chunk;
+        word_count -= chunk;
+    }
+}
+
+// Make room by rewriting the keys and CCCD blocks that are still valid at the start of the
+// bonding area. Cached GATT databases are dropped because discovery rebuilds them. When there's no
+// heap to hold the blocks, everything is erased instead.
+STATIC void compact_storage(void) {
+    size_t keep_length = 0;
+    for (bonding_block_t *block = next_block(NULL);
+         block != NULL && block->type != BLOCK_UNUSED;
+         block = next_block(block)) {
+        if (block->type == BLOCK_KEYS || block->type == BLOCK_SYS_ATTR) {
+            keep_length += compute_block_size(block->data_length);
+        }
+    }
+    uint32_t *kept = NULL;
+    if (keep_length > 0 && gc_alloc_possible()) {
+        kept = m_malloc_maybe(keep_length, false);
+    }
+    if (kept != NULL) {
+        uint8_t *copy = (uint8_t *) kept;
+        for (bonding_block_t *block = next_block(NULL);
+             block != NULL && block->type != BLOCK_UNUSED;
+             block = next_block(block)) {
+            if (block->type == BLOCK_KEYS || block->type == BLOCK_SYS_ATTR) {
+                size_t block_size = compute_block_size(block->data_length);
+                memcpy(copy, block, block_size);
+                copy += block_size;
+            }
+        }
+    }
+    bonding_erase_storage();
+    if (kept != NULL) {
+        write_words_sync((uint32_t *) BONDING_DATA_START_ADDR, kept, keep_length / 4);
+        m_del(uint8_t, kept, keep_length);
+    }
+}
+
+// Get an empty block large enough to store data_length data. Blocks may move so look up the
+// block to replace after this.
 STATIC bonding_block_t* find_unused_block(uint16_t data_length) {
     bonding_block_t *unused_block = find_existing_block(true, BLOCK_UNUSED, EDIV_INVALID);
-    // If no more room, erase all existing blocks and start over.
-    if (!unused_block ||
-        (uint8_t *) unused_block + compute_block_size(data_length) >= (uint8_t *) BONDING_DATA_END_ADDR) {
+    if (!block_fits(unused_block, data_length)) {
+        compact_storage();
+        unused_block = find_existing_block(true, BLOCK_UNUSED, EDIV_INVALID);
+    }
+    // If there's still no room, erase all existing blocks and start over.
+    if (!block_fits(unused_block, data_length)) {
         bonding_erase_storage();
         unused_block = (bonding_block_t *) BONDING_DATA_START_ADDR;
     }
     return unused_block;
 }
 
-// Set the header word to all 0's, to mark the block as invalid.
-// We don't change data_length, so we can still skip over this block.
-STATIC void invalidate_block(bonding_block_t *block) {
-    uint32_t zero = 0;
-    sd_flash_write_sync((uint32_t *) block, &zero, 1);
+STATIC bool sd_flash_write_async(uint32_t *dest, const uint32_t *src, uint32_t word_count) {
+    sd_flash_operation_status = SD_FLASH_OPERATION_IN_PROGRESS;
+    if (sd_flash_write(dest, (uint32_t *) src, word_count) != NRF_SUCCESS) {
+        sd_flash_operation_status = SD_FLASH_OPERATION_DONE;
+        return false;
+    }
+    // Without the SoftDevice running the write is already done and there won't be an event.
+    uint8_t sd_enabled = 0;
+    (void) sd_softdevice_is_enabled(&sd_enabled);
+    if (!sd_enabled) {
+        sd_flash_operation_status = SD_FLASH_OPERATION_DONE;
+    }
+    return true;
 }
 
-// Write bonding block header.
-STATIC void write_block_header(bonding_block_t *dest_block, bonding_block_t *source_block_header) {
-    sd_flash_write_sync((uint32_t *) dest_block, (uint32_t *) source_block_header, sizeof(bonding_block_t) / 4);
+// Start the next flash operation of the pending write once the previous one is done. A failed
+// operation is tried again.
+STATIC void advance_pending_write(void) {
+    if (pending_write.step == PENDING_WRITE_IDLE ||
+        sd_flash_operation_status == SD_FLASH_OPERATION_IN_PROGRESS) {
+        return;
+    }
+    if (pending_write.in_flight) {
+        pending_write.in_flight = false;
+        if (sd_flash_operation_status == SD_FLASH_OPERATION_ERROR) {
+            sd_flash_operation_status = SD_FLASH_OPERATION_DONE;
+        } else {
+            pending_write.step++;
+        }
+    }
+    while (pending_write.step != PENDING_WRITE_IDLE) {
+        uint32_t *block_words = (uint32_t *) pending_write.dest;
+        uint32_t *dest = NULL;
+        const uint32_t *src = NULL;
+        uint32_t word_count = 1;
+        switch (pending_write.step) {
+            case PENDING_WRITE_DATA:
+                dest = block_words + sizeof(bonding_block_t) / 4;
+                src = pending_write.full_words;
+                word_count = pending_write.full_word_count;
+                break;
+            case PENDING_WRITE_TAIL:
+                dest = block_words + sizeof(bonding_block_t) / 4 + pending_write.full_word_count;
+                src = &pending_write.tail;
+                if (pending_write.tail == 0xffffffff) {
+                    word_count = 0;
+                }
+                break;
+            case PENDING_WRITE_LENGTH:
+                dest = block_words + 1;
+                src = &pending_write.header[1];
+                break;
+            case PENDING_WRITE_TYPE:
+                dest = block_words;
+                src = &pending_write.header[0];
+                break;
+            case PENDING_WRITE_INVALIDATE:
+                if (pending_write.replaces != NULL) {
+                    // Set the header word to all 0's, to mark the block as invalid. We don't
+                    // change data_length, so we can still skip over this block.
+                    pending_write.header[0] = 0;
+                    dest = (uint32_t *) pending_write.replaces;
+                    src = &pending_write.header[0];
+                } else {
+                    word_count = 0;
+                }
+                break;
+            default:
+                pending_write.step = PENDING_WRITE_IDLE;
+                return;
+        }
+        if (word_count == 0) {
+            pending_write.step++;
+            continue;
+        }
+        if (sd_flash_write_async(dest, src, word_count)) {
+            pending_write.in_flight = true;
+        }
+        return;
+    }
 }
 
-// Write variable-length data at end of bonding block.
-STATIC void write_block_data(bonding_block_t *dest_block, uint8_t *data, uint16_t data_length) {
-    // Minimize the number of writes. Datasheet says no more than two writes per word before erasing again.
-
-    // Start writing after the current header.
-    uint32_t *flash_word_p = (uint32_t *) ((uint8_t *) dest_block + sizeof(bonding_block_t));
-    while (1) {
-        uint32_t word = 0xffffffff;
-        memcpy(&word, data, data_length >= 4 ? 4 : data_length);
-        sd_flash_write_sync(flash_word_p, &word, 1);
-        if (data_length <= 4) {
-            break;
+STATIC void finish_pending_write(void) {
+    while (pending_write.step != PENDING_WRITE_IDLE) {
+        advance_pending_write();
+        if (sd_flash_operation_status == SD_FLASH_OPERATION_IN_PROGRESS) {
+            sd_app_evt_wait();
         }
-        data_length -= 4;
-        data += 4;
-        // Increment by word size.
-        flash_word_p++;
     }
 }
 
+// Write a block with the given header and data to new_block and then invalidate the block it
+// replaces, if any. The data is copied when it's small enough to write in the background.
+// Otherwise it must be word aligned and is written before returning.
+STATIC void write_block(bonding_block_t *new_block, const bonding_block_t *header,
+                        const uint8_t *data, bonding_block_t *replaces) {
+    uint16_t data_length = header->data_length;
+    memcpy(pending_write.header, header, sizeof(bonding_block_t));
+    pending_write.full_word_count = data_length / 4;
+    pending_write.tail = 0xffffffff;
+    memcpy(&pending_write.tail, data + data_length / 4 * 4, data_length % 4);
+    if (data_length <= PENDING_DATA_MAX_LENGTH) {
+        memcpy(pending_write.data, data, data_length / 4 * 4);
+        pending_write.full_words = pending_write.data;
+    } else {
+        pending_write.full_words = (const uint32_t *) data;
+    }
+    pending_write.dest = new_block;
+    pending_write.replaces = replaces;
+    pending_write.step = PENDING_WRITE_DATA;
+    advance_pending_write();
+    if (data_length > PENDING_DATA_MAX_LENGTH) {
+        finish_pending_write();
+    }
+}
+
+// Invalidate a block in the background.
+STATIC void invalidate_block(bonding_block_t *block) {
+    pending_write.dest = NULL;
+    pending_write.replaces = block;
+    pending_write.step = PENDING_WRITE_INVALIDATE;
+    advance_pending_write();
+}
+
 STATIC void write_sys_attr_block(bleio_connection_internal_t *connection) {
     uint16_t length = 0;
     // First find out how big a buffer we need, then fetch the data.
     if(sd_ble_gatts_sys_attr_get(connection->conn_handle, NULL, &length, SYS_ATTR_FLAGS) != NRF_SUCCESS) {
         return;
     }
-    uint8_t sys_attr[length];
+    // Word aligned in case it's too long to write in the background.
+    uint32_t sys_attr_words[(length + 3) / 4];
+    uint8_t *sys_attr = (uint8_t *) sys_attr_words;
     if(sd_ble_gatts_sys_attr_get(connection->conn_handle, sys_attr, &length, SYS_ATTR_FLAGS) != NRF_SUCCESS) {
         return;
     }
@@ -197,14 +381,11 @@ STATIC void write_sys_attr_block(bleio_connection_internal_t *connection) {
     // Is there an existing sys_attr block that matches the current sys_attr data?
     bonding_block_t *existing_block =
         find_existing_block(connection->is_central, BLOCK_SYS_ATTR, connection->ediv);
-    if (existing_block) {
-        if (length == existing_block->data_length &&
-            memcmp(sys_attr, existing_block->data, length) == 0) {
-            // Identical block found. No need to store again.
-            return;
-        }
-        // Data doesn't match. Invalidate block and store a new one.
-        invalidate_block(existing_block);
+    if (existing_block &&
+        length == existing_block->data_length &&
+        memcmp(sys_attr, existing_block->data, length) == 0) {
+        // Identical block found. No need to store again.
+        return;
     }
 
     bonding_block_t block_header = {
@@ -215,9 +396,9 @@ STATIC void write_sys_attr_block(bleio_connection_internal_t *connection) {
         .data_length = length,
     };
     bonding_block_t *new_block = find_unused_block(length);
-    write_block_header(new_block, &block_header);
-    write_block_data(new_block, sys_attr, length);
-    return;
+    // The old block is invalidated once the new one is written.
+    existing_block = find_existing_block(connection->is_central, BLOCK_SYS_ATTR, connection->ediv);
+    write_block(new_block, &block_header, sys_attr, existing_block);
 }
 
 STATIC void write_keys_block(bleio_connection_internal_t *connection) {
@@ -227,14 +408,11 @@ STATIC void write_keys_block(bleio_connection_internal_t *connection) {
 
     // Is there an existing keys block that matches?
     bonding_block_t *existing_block = find_existing_block(connection->is_central, BLOCK_KEYS, ediv);
-    if (existing_block) {
-        if (existing_block->data_length == sizeof(bonding_keys_t) &&
-            memcmp(existing_block->data, &connection->bonding_keys, sizeof(bonding_keys_t)) == 0) {
-            // Identical block found. No need to store again.
-            return;
-        }
-        // Data doesn't match. Invalidate block and store a new one.
-        invalidate_block(existing_block);
+    if (existing_block &&
+        existing_block->data_length == sizeof(bonding_keys_t) &&
+        memcmp(existing_block->data, &connection->bonding_keys, sizeof(bonding_keys_t)) == 0) {
+        // Identical block found. No need to store again.
+        return;
     }
 
     bonding_block_t block_header = {
@@ -245,8 +423,16 @@ STATIC void write_keys_block(bleio_connection_internal_t *connection) {
         .data_length = sizeof(bonding_keys_t),
     };
     bonding_block_t *new_block = find_unused_block(sizeof(bonding_keys_t));
-    write_block_header(new_block, &block_header);
-    write_block_data(new_block, (uint8_t *) &connection->bonding_keys, sizeof(bonding_keys_t));
+    existing_block = find_existing_block(connection->is_central, BLOCK_KEYS, ediv);
+    write_block(new_block, &block_header, (uint8_t *) &connection->bonding_keys, existing_block);
+}
+
+STATIC void forget_gatt_db(bleio_connection_internal_t *connection) {
+    bonding_block_t *existing_block =
+        find_existing_block(connection->is_central, BLOCK_GATT_DB, connection->ediv);
+    if (existing_block) {
+        invalidate_block(existing_block);
+    }
 }
 
 void bonding_clear_keys(bonding_keys_t *bonding_keys) {
@@ -254,17 +440,23 @@ void bonding_clear_keys(bonding_keys_t *bonding_keys) {
 }
 
 void bonding_reset(void) {
+    finish_pending_write();
     if (BONDING_FLAG != *((uint32_t *) BONDING_START_FLAG_ADDR) ||
         BONDING_FLAG != *((uint32_t *) BONDING_END_FLAG_ADDR)) {
         bonding_erase_storage();
     }
 }
 
-// Write bonding blocks to flash. Requests have been queued during evt handlers.
+// Write bonding blocks to flash. Requests have been queued during evt handlers. One block is
+// written at a time and the next request is only looked at once it's done.
 void bonding_background(void) {
+    advance_pending_write();
+    if (pending_write.step != PENDING_WRITE_IDLE) {
+        return;
+    }
     // A paired connection will request that its keys and CCCD values be stored.
     // The CCCD store  whenever a CCCD value is written.
-    for (size_t i = 0; i < BLEIO_TOTAL_CONNECTION_COUNT; i++) {
+    for (size_t i = 0; i < BLEIO_TOTAL_CONNECTION_COUNT && pending_write.step == PENDING_WRITE_IDLE; i++) {
         bleio_connection_internal_t *connection = &bleio_connections[i];
 
         uint64_t current_ticks_ms = supervisor_ticks_ms64();
@@ -277,10 +469,16 @@ void bonding_background(void) {
             connection->do_bond_cccds = false;
         }
 
-        if (connection->do_bond_keys) {
+        if (connection->do_bond_keys && pending_write.step == PENDING_WRITE_IDLE) {
             write_keys_block(connection);
             connection->do_bond_keys = false;
         }
+
+        // The peer indicated that its services changed.
+        if (connection->do_forget_gatt_db && pending_write.step == PENDING_WRITE_IDLE) {
+            forget_gatt_db(connection);
+            connection->do_forget_gatt_db = false;
+        }
     }
 }
 
@@ -307,3 +505,41 @@ bool bonding_load_keys(bool is_central, uint16_t ediv, bonding_keys_t *bonding_k
     memcpy(bonding_keys, block->data, block->data_length);
     return true;
 }
+
+const uint8_t *bonding_load_gatt_db(bool is_central, uint16_t ediv, uint16_t *length) {
+    bonding_block_t *block = find_existing_block(is_central, BLOCK_GATT_DB, ediv);
+    if (block == NULL) {
+        return NULL;
+    }
+    *length = block->data_length;
+    return block->data;
+}
+
+void bonding_save_gatt_db(bool is_central, uint16_t ediv, const uint8_t *data, uint16_t length) {
+    finish_pending_write();
+    bonding_block_t *existing_block = find_existing_block(is_central, BLOCK_GATT_DB, ediv);
+    if (existing_block &&
+        length == existing_block->data_length &&
+        memcmp(data, existing_block->data, length) == 0) {
+        // Identical block found. No need to store again.
+        return;
+    }
+
+    // The cache can be rebuilt by discovery, so don't erase keys to make room for it.
+    bonding_block_t *new_block = find_existing_block(true, BLOCK_UNUSED, EDIV_INVALID);
+    if (!block_fits(new_block, length)) {
+        if (existing_block) {
+            invalidate_block(existing_block);
+        }
+        return;
+    }
+
+    bonding_block_t block_header = {
+        .is_central = is_central,
+        .type = BLOCK_GATT_DB,
+        .ediv = ediv,
+        .conn_handle = BLE_CONN_HANDLE_INVALID,
+        .data_length = length,
+    };
+    write_block(new_block, &block_header, data, existing_block);
+}
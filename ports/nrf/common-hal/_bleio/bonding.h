@@ -59,6 +59,7 @@ typedef enum {
     BLOCK_INVALID = 0,      // Ignore this block
     BLOCK_KEYS = 1,         // Block contains bonding keys.
     BLOCK_SYS_ATTR = 2,     // Block contains sys_attr values (CCCD settings, etc.).
+    BLOCK_GATT_DB = 3,      // Block contains the peer's discovered GATT database.
     BLOCK_UNUSED = 0xff,    // Initial erased value.
 } bonding_block_type_t;
 
@@ -81,5 +82,9 @@ void bonding_reset(void);
 void bonding_clear_keys(bonding_keys_t *bonding_keys);
 bool bonding_load_cccd_info(bool is_central, uint16_t conn_handle, uint16_t ediv);
 bool bonding_load_keys(bool is_central, uint16_t ediv, bonding_keys_t *bonding_keys);
+// The GATT database is stored in whatever format Connection.c gives it. The data returned points
+// into flash and stays valid until the next bonding write.
+const uint8_t *bonding_load_gatt_db(bool is_central, uint16_t ediv, uint16_t *length);
+void bonding_save_gatt_db(bool is_central, uint16_t ediv, const uint8_t *data, uint16_t length);
 
 #endif // MICROPY_INCLUDED_NRF_COMMON_HAL_BLEIO_BONDING_H
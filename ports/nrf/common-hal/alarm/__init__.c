@@ -0,0 +1,191 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/mphal.h"
+#include "py/runtime.h"
+#include "lib/utils/interrupt_char.h"
+#include "shared-bindings/alarm/__init__.h"
+#include "shared-bindings/alarm/PinAlarm.h"
+#include "supervisor/port.h"
+#include "supervisor/shared/tick.h"
+#include "supervisor/usb.h"
+
+#include "nrf_gpio.h"
+#include "nrf_clock.h"
+#include "nrf_sdm.h"
+#include "nrf_soc.h"
+#include "nrfx_rtc.h"
+
+// RTC0 belongs to the SoftDevice and RTC2 to the rtc module. RTC1 measures the time asleep while
+// SysTick is stopped. 1024Hz keeps the 24 bit counter from wrapping for over four hours.
+#define SLEEP_RTC_HZ (1024)
+#define SLEEP_RTC_MAX_TICKS (1 << 23)
+
+STATIC const nrfx_rtc_t sleep_rtc = NRFX_RTC_INSTANCE(1);
+
+STATIC const nrfx_rtc_config_t sleep_rtc_config = {
+    .prescaler = RTC_FREQ_TO_PRESCALER(SLEEP_RTC_HZ),
+    .reliable = 0,
+    .tick_latency = 0,
+    .interrupt_priority = 6
+};
+
+STATIC void sleep_rtc_handler(nrfx_rtc_int_type_t int_type) {
+    // The compare interrupt only needs to wake the CPU.
+}
+
+STATIC mp_obj_t triggered_pin_alarm(size_t n_alarms, const mp_obj_t* alarms) {
+    for (size_t i = 0; i < n_alarms; i++) {
+        if (!MP_OBJ_IS_TYPE(alarms[i], &alarm_pinalarm_type)) {
+            continue;
+        }
+        alarm_pinalarm_obj_t* alarm = MP_OBJ_TO_PTR(alarms[i]);
+        if ((nrf_gpio_pin_read(alarm->pin->number) != 0) == alarm->value) {
+            return alarms[i];
+        }
+    }
+    return mp_const_none;
+}
+
+STATIC void wait_for_event(void) {
+    uint8_t sd_enabled = 0;
+    (void) sd_softdevice_is_enabled(&sd_enabled);
+    if (sd_enabled) {
+        // The SoftDevice keeps BLE connections going while we wait.
+        sd_app_evt_wait();
+    } else {
+        __WFE();
+    }
+}
+
+// With USB connected the host expects the tick and background tasks to keep running, so sleep a
+// tick at a time as time.sleep does.
+STATIC mp_obj_t sleep_with_tick(size_t n_alarms, const mp_obj_t* alarms, uint64_t wake_ms) {
+    while (true) {
+        RUN_BACKGROUND_TASKS;
+        mp_obj_t woken_by = triggered_pin_alarm(n_alarms, alarms);
+        if (woken_by != mp_const_none) {
+            return woken_by;
+        }
+        if (supervisor_ticks_ms64() >= wake_ms || mp_hal_is_interrupted()) {
+            return mp_const_none;
+        }
+        port_sleep_until_interrupt();
+    }
+}
+
+// Stop SysTick so nothing wakes the CPU but the alarms. RAM and peripherals keep their state so
+// returning is as quick as any other interrupt.
+STATIC mp_obj_t sleep_without_tick(size_t n_alarms, const mp_obj_t* alarms, uint64_t wake_ms) {
+    if (!nrf_clock_lf_is_running(NRF_CLOCK)) {
+        nrf_clock_task_trigger(NRF_CLOCK, NRF_CLOCK_TASK_LFCLKSTART);
+    }
+    nrfx_rtc_init(&sleep_rtc, &sleep_rtc_config, sleep_rtc_handler);
+    nrfx_rtc_counter_clear(&sleep_rtc);
+    nrfx_rtc_enable(&sleep_rtc);
+
+    // A pin reaching its level sets GPIOTE's PORT event. Its interrupt may be disabled so let
+    // the pending interrupt wake WFE instead.
+    bool port_interrupt_was_enabled = (NRF_GPIOTE->INTENSET & GPIOTE_INTENSET_PORT_Msk) != 0;
+    NRF_GPIOTE->EVENTS_PORT = 0;
+    NRF_GPIOTE->INTENSET = GPIOTE_INTENSET_PORT_Msk;
+    SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
+
+    uint64_t start_ms = supervisor_ticks_ms64();
+    SysTick->CTRL &= ~(SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk);
+
+    mp_obj_t woken_by = mp_const_none;
+    uint64_t slept_ticks = 0;
+    uint32_t last_count = 0;
+    while (true) {
+        uint32_t count = nrfx_rtc_counter_get(&sleep_rtc);
+        slept_ticks += (count - last_count) & RTC_COUNTER_COUNTER_Msk;
+        last_count = count;
+        uint64_t now_ms = start_ms + slept_ticks * 1000 / SLEEP_RTC_HZ;
+
+        woken_by = triggered_pin_alarm(n_alarms, alarms);
+        if (woken_by != mp_const_none || now_ms >= wake_ms || mp_hal_is_interrupted()) {
+            break;
+        }
+
+        // The compare only fires reliably at least two ticks ahead of the counter.
+        uint64_t remaining_ms = wake_ms - now_ms;
+        uint32_t remaining_ticks = SLEEP_RTC_MAX_TICKS;
+        if (remaining_ms < (uint64_t) SLEEP_RTC_MAX_TICKS * 1000 / SLEEP_RTC_HZ) {
+            remaining_ticks = remaining_ms * SLEEP_RTC_HZ / 1000 + 2;
+        }
+        nrfx_rtc_cc_set(&sleep_rtc, 0, (count + remaining_ticks) & RTC_COUNTER_COUNTER_Msk, true);
+
+        wait_for_event();
+        NRF_GPIOTE->EVENTS_PORT = 0;
+        NVIC_ClearPendingIRQ(GPIOTE_IRQn);
+    }
+
+    SCB->SCR &= ~SCB_SCR_SEVONPEND_Msk;
+    NRF_GPIOTE->EVENTS_PORT = 0;
+    NVIC_ClearPendingIRQ(GPIOTE_IRQn);
+    if (!port_interrupt_was_enabled) {
+        NRF_GPIOTE->INTENCLR = GPIOTE_INTENCLR_PORT_Msk;
+    }
+
+    supervisor_ticks_ms_advance(slept_ticks * 1000 / SLEEP_RTC_HZ);
+    SysTick->VAL = 0;
+    SysTick->CTRL |= SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+
+    nrfx_rtc_disable(&sleep_rtc);
+    nrfx_rtc_uninit(&sleep_rtc);
+    return woken_by;
+}
+
+mp_obj_t common_hal_alarm_light_sleep_until_alarms(size_t n_alarms, const mp_obj_t* alarms, uint64_t wake_ms) {
+    for (size_t i = 0; i < n_alarms; i++) {
+        if (!MP_OBJ_IS_TYPE(alarms[i], &alarm_pinalarm_type)) {
+            continue;
+        }
+        alarm_pinalarm_obj_t* alarm = MP_OBJ_TO_PTR(alarms[i]);
+        nrf_gpio_pin_pull_t pull = NRF_GPIO_PIN_NOPULL;
+        if (alarm->pull) {
+            pull = alarm->value ? NRF_GPIO_PIN_PULLDOWN : NRF_GPIO_PIN_PULLUP;
+        }
+        nrf_gpio_cfg_sense_input(alarm->pin->number, pull,
+            alarm->value ? NRF_GPIO_PIN_SENSE_HIGH : NRF_GPIO_PIN_SENSE_LOW);
+    }
+
+    mp_obj_t woken_by;
+    if (usb_connected()) {
+        woken_by = sleep_with_tick(n_alarms, alarms, wake_ms);
+    } else {
+        woken_by = sleep_without_tick(n_alarms, alarms, wake_ms);
+    }
+
+    for (size_t i = 0; i < n_alarms; i++) {
+        if (MP_OBJ_IS_TYPE(alarms[i], &alarm_pinalarm_type)) {
+            alarm_pinalarm_obj_t* alarm = MP_OBJ_TO_PTR(alarms[i]);
+            reset_pin_number(alarm->pin->number);
+        }
+    }
+    return woken_by;
+}
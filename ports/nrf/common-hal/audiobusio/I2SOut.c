@@ -35,6 +35,8 @@
 #include "py/obj.h"
 #include "py/runtime.h"
 
+#include "tick.h"
+
 static audiobusio_i2sout_obj_t *instance;
 
 struct { int16_t l, r; } static_sample16 = {0x8000, 0x8000};
@@ -106,6 +108,13 @@ void choose_i2s_clocking(audiobusio_i2sout_obj_t *self, uint32_t sample_rate) {
     self->sample_rate = best.sample_rate;
 }
 
+static uint64_t i2s_now_us(void) {
+    uint64_t ms;
+    uint32_t us_until_ms;
+    current_tick(&ms, &us_until_ms);
+    return ms * 1000 + (1000 - us_until_ms);
+}
+
 static void i2s_buffer_fill(audiobusio_i2sout_obj_t* self) {
     void *buffer = self->buffers[self->next_buffer];
     void *buffer_start = buffer;
@@ -271,6 +280,8 @@ void common_hal_audiobusio_i2sout_play(audiobusio_i2sout_obj_t* self,
     self->buffer_length = (self->buffer_length + 3) & ~3;
     self->buffers[0] = m_malloc(self->buffer_length, false);
     self->buffers[1] = m_malloc(self->buffer_length, false);
+    self->buffer_duration_us = (uint64_t) self->buffer_length * 1000000 /
+        (sample_rate * self->bytes_per_sample * self->channel_count);
 
 
     audiosample_reset_buffer(self->sample, false, 0);
@@ -280,7 +291,9 @@ void common_hal_audiobusio_i2sout_play(audiobusio_i2sout_obj_t* self,
     self->playing = true;
     self->paused = false;
     self->stopping = false;
+    audioio_output_stats_reset(&self->stats);
     i2s_buffer_fill(self);
+    self->last_check = i2s_now_us();
 
     NRF_I2S->RXTXD.MAXCNT = self->buffer_length / 4;
     NRF_I2S->ENABLE = I2S_ENABLE_ENABLE_Enabled;
@@ -316,14 +329,27 @@ bool common_hal_audiobusio_i2sout_get_playing(audiobusio_i2sout_obj_t* self) {
 }
 
 void i2s_background(void) {
+    uint64_t now = 0;
+    if (instance) {
+        now = i2s_now_us();
+    }
     if (NRF_I2S->EVENTS_TXPTRUPD) {
         NRF_I2S->EVENTS_TXPTRUPD = 0;
         if (instance) {
+            uint32_t latency = now - instance->last_check;
             i2s_buffer_fill(instance);
+            // The pointer is latched once per buffer so the event fired at least twice if we
+            // haven't looked for two buffers, and the previous buffer replayed. Firing again
+            // during the fill means the I2S started this buffer before it was ready.
+            bool underrun = latency > 2 * instance->buffer_duration_us || NRF_I2S->EVENTS_TXPTRUPD;
+            audioio_output_stats_record(&instance->stats, underrun, latency, i2s_now_us() - now);
         } else {
             NRF_I2S->TASKS_STOP = 1;
         }
     }
+    if (instance) {
+        instance->last_check = now;
+    }
 }
 
 void i2s_reset(void) {
@@ -336,3 +362,8 @@ void i2s_reset(void) {
     NRF_I2S->PSEL.SDIN = 0xFFFFFFFF;
     instance = NULL;
 }
+
+void common_hal_audiobusio_i2sout_get_stats(audiobusio_i2sout_obj_t* self,
+                                            audioio_output_stats_t* stats) {
+    *stats = self->stats;
+}
@@ -28,6 +28,7 @@
 #define MICROPY_INCLUDED_NRF_COMMON_HAL_AUDIOBUSIO_I2SOUT_H
 
 #include "py/obj.h"
+#include "shared-module/audiocore/__init__.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -55,6 +56,11 @@ typedef struct {
     bool loop : 1;
     bool samples_signed : 1;
     bool single_buffer : 1;
+
+    audioio_output_stats_t stats;
+    // When TXPTRUPD was last polled, in microseconds.
+    uint64_t last_check;
+    uint32_t buffer_duration_us;
 } audiobusio_i2sout_obj_t;
 
 void i2s_reset(void);
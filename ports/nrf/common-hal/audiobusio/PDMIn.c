@@ -24,11 +24,20 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "common-hal/audiobusio/PDMIn.h"
+#include "shared-bindings/audiobusio/PDMIn.h"
 #include "shared-bindings/microcontroller/Pin.h"
 
 #include "py/runtime.h"
 
+#include "nrfx.h"
+
+// 16-bit words in each of the two blocks used by start(), 8ms of stereo or 16ms of mono data.
+#define WORDS_PER_STREAM_BLOCK 256
+#define NO_BLOCK 0xff
+
 __attribute__((used))
 NRF_PDM_Type *nrf_pdm = NRF_PDM;
 
@@ -47,6 +56,12 @@ void common_hal_audiobusio_pdmin_construct(audiobusio_pdmin_obj_t* self,
     claim_pin(data_pin);
 
     self->mono = mono;
+    self->pdm_blocks = NULL;
+    self->ring = NULL;
+    self->ring_size = 0;
+    self->ring_head = 0;
+    self->ring_tail = 0;
+    self->overflows = 0;
     self->clock_pin_number = clock_pin->number;
     self->data_pin_number = data_pin->number;
 
@@ -74,6 +89,9 @@ bool common_hal_audiobusio_pdmin_deinited(audiobusio_pdmin_obj_t* self) {
 }
 
 void common_hal_audiobusio_pdmin_deinit(audiobusio_pdmin_obj_t* self) {
+    common_hal_audiobusio_pdmin_stop(self);
+    self->ring = NULL;
+    self->ring_size = 0;
     nrf_pdm->ENABLE = 0;
 
     reset_pin_number(self->clock_pin_number);
@@ -90,8 +108,7 @@ uint32_t common_hal_audiobusio_pdmin_get_sample_rate(audiobusio_pdmin_obj_t* sel
     return 16000;
 }
 
-uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t* self,
-        uint16_t* output_buffer, uint32_t output_buffer_length) {
+static void set_mode(audiobusio_pdmin_obj_t* self) {
     // Note: Adafruit's module has SELECT pulled to GND, which makes the DATA
     // valid when the CLK is low, therefore it must be sampled on the rising edge.
     if (self->mono) {
@@ -99,6 +116,11 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t* se
     } else {
         nrf_pdm->MODE = PDM_MODE_OPERATION_Mono | PDM_MODE_EDGE_LeftRising;
     }
+}
+
+uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t* self,
+        uint16_t* output_buffer, uint32_t output_buffer_length) {
+    set_mode(self);
 
     // step 1. Redirect to real buffer
     nrf_pdm->SAMPLE.PTR = (uintptr_t)output_buffer;
@@ -128,3 +150,124 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t* se
         return (output_buffer_length / 4) * 4;
     }
 }
+
+bool common_hal_audiobusio_pdmin_get_recording(audiobusio_pdmin_obj_t* self) {
+    return MP_STATE_PORT(recording_pdmin) == self;
+}
+
+void common_hal_audiobusio_pdmin_start(audiobusio_pdmin_obj_t* self, uint32_t buffer_length) {
+    // There is only one recording peripheral.
+    if (MP_STATE_PORT(recording_pdmin) != NULL) {
+        mp_raise_RuntimeError(translate("Already recording"));
+    }
+    // The ring has one spare slot so that full and empty can be told apart.
+    m_free(self->ring);
+    self->ring = NULL;
+    self->ring_size = buffer_length + 1;
+    self->ring = m_malloc(self->ring_size * sizeof(uint16_t), false);
+    self->ring_head = 0;
+    self->ring_tail = 0;
+    self->overflows = 0;
+    self->pdm_blocks = m_malloc(2 * WORDS_PER_STREAM_BLOCK * sizeof(int16_t), false);
+    self->filling_block = NO_BLOCK;
+
+    set_mode(self);
+    MP_STATE_PORT(recording_pdmin) = self;
+
+    // The PDM keeps running into the dummy buffer. It moves to the first block at the next
+    // buffer boundary and the STARTED interrupt then points it at the second.
+    nrf_pdm->EVENTS_STARTED = 0;
+    NVIC_ClearPendingIRQ(PDM_IRQn);
+    NVIC_SetPriority(PDM_IRQn, 7);
+    NVIC_EnableIRQ(PDM_IRQn);
+    nrf_pdm->SAMPLE.PTR = (uintptr_t)self->pdm_blocks;
+    nrf_pdm->SAMPLE.MAXCNT = WORDS_PER_STREAM_BLOCK;
+    nrf_pdm->INTENSET = PDM_INTENSET_STARTED_Msk;
+}
+
+void common_hal_audiobusio_pdmin_stop(audiobusio_pdmin_obj_t* self) {
+    if (common_hal_audiobusio_pdmin_get_recording(self)) {
+        pdmin_reset_recording();
+    }
+    // Keep the ring so that readinto can still collect what was recorded.
+    m_free(self->pdm_blocks);
+    self->pdm_blocks = NULL;
+}
+
+uint32_t common_hal_audiobusio_pdmin_readinto(audiobusio_pdmin_obj_t* self,
+        void* buffer, uint32_t length) {
+    if (self->ring == NULL) {
+        return 0;
+    }
+    uint32_t tail = self->ring_tail;
+    uint32_t head = self->ring_head;
+    uint32_t available = (head + self->ring_size - tail) % self->ring_size;
+    uint32_t count = MIN(available, length);
+    // Copy in at most two pieces, up to the end of the ring and then from its start.
+    uint32_t first = MIN(count, self->ring_size - tail);
+    memcpy(buffer, self->ring + tail, first * sizeof(uint16_t));
+    memcpy((uint16_t*) buffer + first, self->ring, (count - first) * sizeof(uint16_t));
+    // Finish reading the samples before handing their slots back to the interrupt.
+    __asm volatile ("" : : : "memory");
+    self->ring_tail = (tail + count) % self->ring_size;
+    return count;
+}
+
+uint32_t common_hal_audiobusio_pdmin_get_overflows(audiobusio_pdmin_obj_t* self) {
+    return self->overflows;
+}
+
+// Copies a finished block into the ring as unsigned samples. Samples that don't fit are dropped.
+static void pdmin_copy_block(audiobusio_pdmin_obj_t* self, int16_t* block) {
+    uint32_t head = self->ring_head;
+    uint32_t tail = self->ring_tail;
+    uint32_t i;
+    for (i = 0; i < WORDS_PER_STREAM_BLOCK; i++) {
+        uint32_t next = head + 1;
+        if (next == self->ring_size) {
+            next = 0;
+        }
+        if (next == tail) {
+            break;
+        }
+        self->ring[head] = block[i] + 32768;
+        head = next;
+    }
+    self->overflows += WORDS_PER_STREAM_BLOCK - i;
+    // Store the samples before readinto can see them.
+    __asm volatile ("" : : : "memory");
+    self->ring_head = head;
+}
+
+void PDM_IRQHandler(void) {
+    if (!nrf_pdm->EVENTS_STARTED) {
+        return;
+    }
+    nrf_pdm->EVENTS_STARTED = 0;
+    audiobusio_pdmin_obj_t* self = MP_STATE_PORT(recording_pdmin);
+    if (self == NULL) {
+        return;
+    }
+    // STARTED means the PDM has taken the pointer we gave it last time, so the block before it
+    // is finished and the other one can be queued up.
+    uint8_t finished = self->filling_block;
+    self->filling_block = finished == NO_BLOCK ? 0 : finished ^ 1;
+    nrf_pdm->SAMPLE.PTR = (uintptr_t)(self->pdm_blocks + (self->filling_block ^ 1) * WORDS_PER_STREAM_BLOCK);
+    if (finished != NO_BLOCK) {
+        pdmin_copy_block(self, self->pdm_blocks + finished * WORDS_PER_STREAM_BLOCK);
+    }
+}
+
+void pdmin_reset_recording(void) {
+    nrf_pdm->INTENCLR = PDM_INTENCLR_STARTED_Msk;
+    NVIC_DisableIRQ(PDM_IRQn);
+    // Go back to the dummy buffer. The registers are double buffered so the block being filled
+    // now may still be written, so it is freed only after the PDM has moved on.
+    nrf_pdm->SAMPLE.PTR = (uintptr_t)&dummy_buffer;
+    nrf_pdm->SAMPLE.MAXCNT = 1;
+    if (MP_STATE_PORT(recording_pdmin) != NULL && nrf_pdm->ENABLE) {
+        nrf_pdm->EVENTS_STARTED = 0;
+        while (!nrf_pdm->EVENTS_STARTED) {}
+    }
+    MP_STATE_PORT(recording_pdmin) = NULL;
+}
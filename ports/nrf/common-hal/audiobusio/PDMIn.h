@@ -35,6 +35,18 @@ typedef struct {
     mp_obj_base_t base;
     uint8_t clock_pin_number, data_pin_number;
     bool mono;
+    // Continuous recording started with start(). The PDM alternates between two blocks and its
+    // STARTED interrupt copies the block it just finished into the ring. The interrupt only
+    // moves ring_head and readinto only moves ring_tail.
+    uint8_t filling_block;
+    int16_t* pdm_blocks;
+    uint16_t* ring;
+    uint32_t ring_size;
+    volatile uint32_t ring_head;
+    volatile uint32_t ring_tail;
+    volatile uint32_t overflows;
 } audiobusio_pdmin_obj_t;
 
+void pdmin_reset_recording(void);
+
 #endif
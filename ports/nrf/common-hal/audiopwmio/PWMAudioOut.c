@@ -37,10 +37,15 @@
 #include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "supervisor/shared/translate.h"
+#include "tick.h"
+
+#include "nrfx.h"
 
 // TODO: This should be the same size as PWMOut.c:pwms[], but there's no trivial way to accomplish that
 STATIC audiopwmio_pwmaudioout_obj_t* active_audio[4];
 
+#define SEQSTARTED_INTERRUPTS (PWM_INTENSET_SEQSTARTED0_Msk | PWM_INTENSET_SEQSTARTED1_Msk)
+
 #define F_TARGET (62500)
 #define F_PWM (16000000)
 // return the REFRESH value, store the TOP value in an out-parameter
@@ -63,6 +68,13 @@ STATIC uint32_t calculate_pwm_parameters(uint32_t sample_rate, uint32_t *top_out
     return multiplier - 1;
 }
 
+STATIC uint64_t audiopwmout_now_us(void) {
+    uint64_t ms;
+    uint32_t us_until_ms;
+    current_tick(&ms, &us_until_ms);
+    return ms * 1000 + (1000 - us_until_ms);
+}
+
 STATIC void activate_audiopwmout_obj(audiopwmio_pwmaudioout_obj_t *self) {
     for (size_t i=0; i < MP_ARRAY_SIZE(active_audio); i++) {
         if (!active_audio[i]) {
@@ -81,6 +93,9 @@ STATIC void deactivate_audiopwmout_obj(audiopwmio_pwmaudioout_obj_t *self) {
 
 void audiopwmout_reset() {
     for (size_t i=0; i < MP_ARRAY_SIZE(active_audio); i++) {
+        if (active_audio[i]) {
+            active_audio[i]->pwm->INTENCLR = SEQSTARTED_INTERRUPTS;
+        }
         active_audio[i] = NULL;
     }
 }
@@ -133,6 +148,15 @@ STATIC void fill_buffers(audiopwmio_pwmaudioout_obj_t *self, int buf) {
     }
 }
 
+// Refills buf now that the other sequence has started and records the refill in the stats.
+STATIC void refill_buffer(audiopwmio_pwmaudioout_obj_t *self, int buf, uint32_t latency) {
+    uint64_t start = audiopwmout_now_us();
+    fill_buffers(self, buf);
+    // The sequence we were filling has started again so part of it played stale samples.
+    bool underrun = self->pwm->EVENTS_SEQSTARTED[buf];
+    audioio_output_stats_record(&self->stats, underrun, latency, audiopwmout_now_us() - start);
+}
+
 STATIC void audiopwmout_background_obj(audiopwmio_pwmaudioout_obj_t *self) {
     if (!common_hal_audiopwmio_pwmaudioout_get_playing(self))
         return;
@@ -143,11 +167,61 @@ STATIC void audiopwmout_background_obj(audiopwmio_pwmaudioout_obj_t *self) {
         if (stopped)
             self->pwm->TASKS_STOP = 1;
     } else if (!self->paused && !self->single_buffer) {
-        if (self->pwm->EVENTS_SEQSTARTED[0]) fill_buffers(self, 1);
-        if (self->pwm->EVENTS_SEQSTARTED[1]) fill_buffers(self, 0);
+        if (self->background_refill) {
+            uint32_t latency = audiopwmout_now_us() - self->event_time;
+            if (self->pwm->EVENTS_SEQSTARTED[0]) refill_buffer(self, 1, latency);
+            if (self->pwm->EVENTS_SEQSTARTED[1]) refill_buffer(self, 0, latency);
+            self->background_refill = false;
+            self->pwm->INTENSET = SEQSTARTED_INTERRUPTS;
+        }
+        audiosample_fill_ahead(self->sample);
+    }
+}
+
+// Refills from the sequence started interrupt when the sample can supply the next buffer without
+// waiting, so playback doesn't depend on how often background tasks run. Otherwise the refill is
+// left to audiopwmout_background().
+STATIC void audiopwmout_event_handler(void) {
+    for (size_t i=0; i < MP_ARRAY_SIZE(active_audio); i++) {
+        audiopwmio_pwmaudioout_obj_t *self = active_audio[i];
+        if (!self || self->background_refill ||
+            !(self->pwm->EVENTS_SEQSTARTED[0] || self->pwm->EVENTS_SEQSTARTED[1])) {
+            continue;
+        }
+        if (self->paused || self->stopping ||
+            !audiosample_buffer_ready(self->sample, false, 0)) {
+            self->event_time = audiopwmout_now_us();
+            self->pwm->INTENCLR = SEQSTARTED_INTERRUPTS;
+            self->background_refill = true;
+            continue;
+        }
+        // One refill at a time. If both sequences have started the interrupt fires again.
+        if (self->pwm->EVENTS_SEQSTARTED[0]) {
+            refill_buffer(self, 1, 0);
+        } else {
+            refill_buffer(self, 0, 0);
+        }
     }
 }
 
+void PWM0_IRQHandler(void) {
+    audiopwmout_event_handler();
+}
+
+void PWM1_IRQHandler(void) {
+    audiopwmout_event_handler();
+}
+
+void PWM2_IRQHandler(void) {
+    audiopwmout_event_handler();
+}
+
+#ifdef NRF_PWM3
+void PWM3_IRQHandler(void) {
+    audiopwmout_event_handler();
+}
+#endif
+
 void audiopwmout_background() {
     for (size_t i=0; i < MP_ARRAY_SIZE(active_audio); i++) {
         if (!active_audio[i]) continue;
@@ -195,6 +269,7 @@ void common_hal_audiopwmio_pwmaudioout_deinit(audiopwmio_pwmaudioout_obj_t* self
     if (common_hal_audiopwmio_pwmaudioout_deinited(self)) {
         return;
     }
+    self->pwm->INTENCLR = SEQSTARTED_INTERRUPTS;
     deactivate_audiopwmout_obj(self);
 
     // TODO: ramp the pwm down from quiescent value to 0
@@ -250,6 +325,8 @@ void common_hal_audiopwmio_pwmaudioout_play(audiopwmio_pwmaudioout_obj_t* self,
 
     self->pwm->LOOP = 1;
     audiosample_reset_buffer(self->sample, false, 0);
+    audioio_output_stats_reset(&self->stats);
+    self->background_refill = false;
     activate_audiopwmout_obj(self);
     self->stopping = false;
     self->pwm->SHORTS = NRF_PWM_SHORT_LOOPSDONE_SEQSTART0_MASK;
@@ -264,9 +341,18 @@ void common_hal_audiopwmio_pwmaudioout_play(audiopwmio_pwmaudioout_obj_t* self,
     self->pwm->TASKS_SEQSTART[0] = 1;
     self->playing = true;
     self->paused = false;
+    if (!self->single_buffer) {
+        // Below the SoftDevice and USB so refills never hold them up.
+        IRQn_Type irq = nrfx_get_irq_number(self->pwm);
+        NVIC_SetPriority(irq, 7);
+        NVIC_ClearPendingIRQ(irq);
+        NVIC_EnableIRQ(irq);
+        self->pwm->INTENSET = SEQSTARTED_INTERRUPTS;
+    }
 }
 
 void common_hal_audiopwmio_pwmaudioout_stop(audiopwmio_pwmaudioout_obj_t* self) {
+    self->pwm->INTENCLR = SEQSTARTED_INTERRUPTS;
     deactivate_audiopwmout_obj(self);
     self->pwm->TASKS_STOP = 1;
     self->stopping = false;
@@ -320,3 +406,8 @@ void common_hal_audiopwmio_pwmaudioout_resume(audiopwmio_pwmaudioout_obj_t* self
 bool common_hal_audiopwmio_pwmaudioout_get_paused(audiopwmio_pwmaudioout_obj_t* self) {
     return self->paused;
 }
+
+void common_hal_audiopwmio_pwmaudioout_get_stats(audiopwmio_pwmaudioout_obj_t* self,
+                                                 audioio_output_stats_t* stats) {
+    *stats = self->stats;
+}
@@ -28,6 +28,7 @@
 #define MICROPY_INCLUDED_NRF_COMMON_HAL_AUDIOPWM_AUDIOOUT_H
 
 #include "common-hal/microcontroller/Pin.h"
+#include "shared-module/audiocore/__init__.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -50,6 +51,12 @@ typedef struct {
     bool loop;
     bool signed_to_unsigned;
     bool single_buffer;
+
+    audioio_output_stats_t stats;
+    // Set when the sequence interrupt left a refill to background tasks at event_time, in
+    // microseconds.
+    volatile bool background_refill;
+    uint64_t event_time;
 } audiopwmio_pwmaudioout_obj_t;
 
 void audiopwmout_reset(void);
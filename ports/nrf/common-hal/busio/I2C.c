@@ -284,3 +284,26 @@ uint8_t common_hal_busio_i2c_read(busio_i2c_obj_t *self, uint16_t addr, uint8_t
 
     return twi_error_to_mp(err);
 }
+
+// TWIM runs the write, the repeated start and the read in one go when both fit in EasyDMA.
+uint8_t common_hal_busio_i2c_write_then_read(busio_i2c_obj_t *self, uint16_t addr,
+                                             const uint8_t *out_data, size_t out_len,
+                                             uint8_t *in_data, size_t in_len) {
+    if (out_len == 0 || out_len > I2C_MAX_XFER_LEN || in_len > I2C_MAX_XFER_LEN ||
+        !nrfx_is_in_ram(out_data)) {
+        uint8_t status = common_hal_busio_i2c_write(self, addr, out_data, out_len, false);
+        if (status != 0) {
+            return status;
+        }
+        return common_hal_busio_i2c_read(self, addr, in_data, in_len);
+    }
+
+    nrfx_twim_enable(&self->twim_peripheral->twim);
+
+    nrfx_twim_xfer_desc_t xfer_desc = NRFX_TWIM_XFER_DESC_TXRX(addr, (uint8_t*) out_data, out_len, in_data, in_len);
+    nrfx_err_t err = nrfx_twim_xfer(&self->twim_peripheral->twim, &xfer_desc, 0);
+
+    nrfx_twim_disable(&self->twim_peripheral->twim);
+
+    return twi_error_to_mp(err);
+}
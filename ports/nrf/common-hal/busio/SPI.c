@@ -29,34 +29,35 @@
 #include "nrfx_spim.h"
 #include "nrf_gpio.h"
 
+// The MAXCNT sizes are register widths in bits.
 STATIC spim_peripheral_t spim_peripherals[] = {
 #if NRFX_CHECK(NRFX_SPIM3_ENABLED)
     // SPIM3 exists only on nRF52840 and supports 32MHz max. All other SPIM's are only 8MHz max.
     // Allocate SPIM3 first.
     { .spim = NRFX_SPIM_INSTANCE(3),
       .max_frequency_MHz = 32,
-      .max_xfer_size = SPIM3_EASYDMA_MAXCNT_SIZE,
+      .max_xfer_size = (1 << SPIM3_EASYDMA_MAXCNT_SIZE) - 1,
     },
 #endif
 #if NRFX_CHECK(NRFX_SPIM2_ENABLED)
     // SPIM2 is not shared with a TWIM, so allocate before the shared ones.
     { .spim = NRFX_SPIM_INSTANCE(2),
       .max_frequency_MHz = 8,
-      .max_xfer_size = SPIM2_EASYDMA_MAXCNT_SIZE,
+      .max_xfer_size = (1 << SPIM2_EASYDMA_MAXCNT_SIZE) - 1,
     },
 #endif
 #if NRFX_CHECK(NRFX_SPIM1_ENABLED)
     // SPIM1 and TWIM1 share an address.
     { .spim = NRFX_SPIM_INSTANCE(1),
       .max_frequency_MHz = 8,
-      .max_xfer_size = SPIM1_EASYDMA_MAXCNT_SIZE,
+      .max_xfer_size = (1 << SPIM1_EASYDMA_MAXCNT_SIZE) - 1,
     },
 #endif
 #if NRFX_CHECK(NRFX_SPIM0_ENABLED)
     // SPIM0 and TWIM0 share an address.
     { .spim = NRFX_SPIM_INSTANCE(0),
       .max_frequency_MHz = 8,
-      .max_xfer_size = SPIM0_EASYDMA_MAXCNT_SIZE,
+      .max_xfer_size = (1 << SPIM0_EASYDMA_MAXCNT_SIZE) - 1,
     },
 #endif
 };
@@ -159,6 +160,8 @@ void common_hal_busio_spi_construct(busio_spi_obj_t *self, const mcu_pin_obj_t *
         self->MISO_pin_number = NO_PIN;
     }
 
+    self->transfer_running = false;
+
     nrfx_err_t err = nrfx_spim_init(&self->spim_peripheral->spim, &config, NULL, NULL);
     if (err != NRFX_SUCCESS) {
         common_hal_busio_spi_deinit(self);
@@ -174,6 +177,7 @@ void common_hal_busio_spi_deinit(busio_spi_obj_t *self) {
     if (common_hal_busio_spi_deinited(self))
         return;
 
+    while (!common_hal_busio_spi_transfer_done(self)) {}
     nrfx_spim_uninit(&self->spim_peripheral->spim);
 
     reset_pin_number(self->clock_pin_number);
@@ -295,6 +299,60 @@ bool common_hal_busio_spi_transfer(busio_spi_obj_t *self, uint8_t *data_out, uin
     return true;
 }
 
+static void start_transfer_block(busio_spi_obj_t *self) {
+    NRF_SPIM_Type* spim = self->spim_peripheral->spim.p_reg;
+    size_t len = MIN(self->transfer_remaining, self->spim_peripheral->max_xfer_size);
+    nrf_spim_tx_buffer_set(spim, self->transfer_out, self->transfer_out != NULL ? len : 0);
+    nrf_spim_rx_buffer_set(spim, self->transfer_in, self->transfer_in != NULL ? len : 0);
+    if (self->transfer_out != NULL) {
+        self->transfer_out += len;
+    }
+    if (self->transfer_in != NULL) {
+        self->transfer_in += len;
+    }
+    self->transfer_remaining -= len;
+    nrf_spim_event_clear(spim, NRF_SPIM_EVENT_END);
+    nrf_spim_task_trigger(spim, NRF_SPIM_TASK_START);
+}
+
+// EasyDMA moves the data while the CPU goes back to Python. With no transmit buffer the SPIM
+// clocks out its over-read character instead.
+bool common_hal_busio_spi_start_transfer(busio_spi_obj_t *self, const uint8_t *data_out, uint8_t *data_in, size_t len, uint8_t write_value) {
+    if (data_out != NULL && !nrfx_is_in_ram(data_out)) {
+        // EasyDMA can only read RAM. Copying the buffer would cost as much as sending it.
+        if (data_in == NULL) {
+            return common_hal_busio_spi_write(self, data_out, len);
+        }
+        return common_hal_busio_spi_transfer(self, (uint8_t*) data_out, data_in, len);
+    }
+    self->transfer_out = data_out;
+    self->transfer_in = data_in;
+    self->transfer_remaining = len;
+    self->transfer_running = true;
+    nrf_spim_orc_set(self->spim_peripheral->spim.p_reg, write_value);
+    start_transfer_block(self);
+    return true;
+}
+
+bool common_hal_busio_spi_transfer_done(busio_spi_obj_t *self) {
+    if (!self->transfer_running) {
+        return true;
+    }
+    NRF_SPIM_Type* spim = self->spim_peripheral->spim.p_reg;
+    if (!nrf_spim_event_check(spim, NRF_SPIM_EVENT_END)) {
+        return false;
+    }
+    if (self->transfer_remaining > 0) {
+        start_transfer_block(self);
+        return false;
+    }
+    nrf_spim_event_clear(spim, NRF_SPIM_EVENT_END);
+    // Back to the over-read character from NRFX_SPIM_DEFAULT_CONFIG that blocking reads use.
+    nrf_spim_orc_set(spim, 0xff);
+    self->transfer_running = false;
+    return true;
+}
+
 uint32_t common_hal_busio_spi_get_frequency(busio_spi_obj_t* self) {
     switch (self->spim_peripheral->spim.p_reg->FREQUENCY) {
     case NRF_SPIM_FREQ_125K:
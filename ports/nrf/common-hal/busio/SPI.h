@@ -33,7 +33,7 @@
 typedef struct {
     nrfx_spim_t spim;
     uint8_t max_frequency_MHz;
-    uint8_t max_xfer_size;
+    uint16_t max_xfer_size;
 } spim_peripheral_t;
 
 typedef struct {
@@ -43,6 +43,12 @@ typedef struct {
     uint8_t clock_pin_number;
     uint8_t MOSI_pin_number;
     uint8_t MISO_pin_number;
+    // Background transfer state. Transfers longer than one EasyDMA block continue from where
+    // they left off each time completion is checked.
+    const uint8_t* transfer_out;
+    uint8_t* transfer_in;
+    size_t transfer_remaining;
+    bool transfer_running;
 } busio_spi_obj_t;
 
 void spi_reset(void);
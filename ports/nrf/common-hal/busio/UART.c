@@ -92,6 +92,18 @@ static uint32_t get_nrf_baud (uint32_t baudrate) {
     } while (true);
 }
 
+// Queues chunks until one is filling and the next is waiting, starting with the given one.
+static void queue_rx_chunks(busio_uart_obj_t* self, uint8_t* first) {
+    uint8_t* chunk = first;
+    while (self->rx_chunks_queued < 2) {
+        if (nrfx_uarte_rx(self->uarte, chunk, UART_RX_CHUNK_SIZE) != NRFX_SUCCESS) {
+            break;
+        }
+        self->rx_chunks_queued++;
+        chunk = (chunk == self->rx_chunks[0]) ? self->rx_chunks[1] : self->rx_chunks[0];
+    }
+}
+
 static void uart_callback_irq (const nrfx_uarte_event_t * event, void * context) {
     busio_uart_obj_t* self = (busio_uart_obj_t*) context;
 
@@ -99,8 +111,17 @@ static void uart_callback_irq (const nrfx_uarte_event_t * event, void * context)
         case NRFX_UARTE_EVT_RX_DONE:
             ringbuf_put_n(&self->rbuf, event->data.rxtx.p_data, event->data.rxtx.bytes);
 
+            if (event->data.rxtx.bytes == UART_RX_CHUNK_SIZE) {
+                // The other chunk is filling now. Queue this one after it.
+                self->rx_chunks_queued--;
+            } else {
+                // Reception was stopped to hand over a partial chunk.
+                self->rx_chunks_queued = 0;
+                self->rx_stopping = false;
+            }
+            self->rx_pending = false;
             // keep receiving
-            (void) nrfx_uarte_rx(self->uarte, &self->rx_char, 1);
+            queue_rx_chunks(self, event->data.rxtx.p_data);
         break;
 
         case NRFX_UARTE_EVT_TX_DONE:
@@ -113,8 +134,11 @@ static void uart_callback_irq (const nrfx_uarte_event_t * event, void * context)
 
             ringbuf_put_n(&self->rbuf, event->data.error.rxtx.p_data, event->data.error.rxtx.bytes);
 
-            // Keep receiving
-            (void) nrfx_uarte_rx(self->uarte, &self->rx_char, 1);
+            // Keep receiving. The driver drops both chunks on an error.
+            self->rx_chunks_queued = 0;
+            self->rx_stopping = false;
+            self->rx_pending = false;
+            queue_rx_chunks(self, self->rx_chunks[0]);
         break;
 
         default:
@@ -122,6 +146,26 @@ static void uart_callback_irq (const nrfx_uarte_event_t * event, void * context)
     }
 }
 
+// Characters wait in a chunk until it fills. Once RXDRDY shows the line has been quiet for a few
+// character times, stop reception so the driver hands over what has arrived. Nothing is being
+// shifted in then so the four byte receive FIFO is empty. The callback starts receiving again.
+static void flush_idle_rx(busio_uart_obj_t* self) {
+    NRF_UARTE_Type* uarte = self->uarte->p_reg;
+    uint64_t now = supervisor_ticks_ms64();
+    if (nrf_uarte_event_check(uarte, NRF_UARTE_EVENT_RXDRDY)) {
+        nrf_uarte_event_clear(uarte, NRF_UARTE_EVENT_RXDRDY);
+        self->rx_pending = true;
+        self->rx_last_ms = now;
+        return;
+    }
+    // Three characters of ten bits each, rounded up to whole ticks.
+    uint32_t idle_ms = 1 + 30000 / self->baudrate;
+    if (self->rx_pending && !self->rx_stopping && now - self->rx_last_ms > idle_ms) {
+        self->rx_stopping = true;
+        nrfx_uarte_rx_abort(self->uarte);
+    }
+}
+
 void uart_reset(void) {
     for (size_t i = 0 ; i < MP_ARRAY_SIZE(nrfx_uartes); i++) {
         nrfx_uarte_uninit(&nrfx_uartes[i]);
@@ -203,8 +247,14 @@ void common_hal_busio_uart_construct (busio_uart_obj_t *self,
     self->baudrate = baudrate;
     self->timeout_ms = timeout * 1000;
 
-    // Initial wait for incoming byte
-    _VERIFY_ERR(nrfx_uarte_rx(self->uarte, &self->rx_char, 1));
+    // Initial wait for incoming bytes
+    self->rx_chunks_queued = 0;
+    self->rx_pending = false;
+    self->rx_stopping = false;
+    self->rx_last_ms = 0;
+    _VERIFY_ERR(nrfx_uarte_rx(self->uarte, self->rx_chunks[0], UART_RX_CHUNK_SIZE));
+    self->rx_chunks_queued = 1;
+    queue_rx_chunks(self, self->rx_chunks[1]);
 }
 
 bool common_hal_busio_uart_deinited(busio_uart_obj_t *self) {
@@ -221,7 +271,8 @@ void common_hal_busio_uart_deinit(busio_uart_obj_t *self) {
 
         gc_free(self->rbuf.buf);
         self->rbuf.size = 0;
-        self->rbuf.iput = self->rbuf.iget = 0;
+        self->rbuf.iput = 0;
+        self->rbuf.get_state = 0;
     }
 }
 
@@ -236,6 +287,7 @@ size_t common_hal_busio_uart_read(busio_uart_obj_t *self, uint8_t *data, size_t
 
     // Wait for all bytes received or timeout
     while ( (ringbuf_count(&self->rbuf) < len) && (supervisor_ticks_ms64() - start_ticks < self->timeout_ms) ) {
+        flush_idle_rx(self);
         RUN_BACKGROUND_TASKS;
         // Allow user to break out of a timeout with a KeyboardInterrupt.
         if ( mp_hal_is_interrupted() ) {
@@ -308,6 +360,7 @@ void common_hal_busio_uart_set_timeout(busio_uart_obj_t *self, mp_float_t timeou
 }
 
 uint32_t common_hal_busio_uart_rx_characters_available(busio_uart_obj_t *self) {
+    flush_idle_rx(self);
     return ringbuf_count(&self->rbuf);
 }
 
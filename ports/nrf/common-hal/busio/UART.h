@@ -33,6 +33,10 @@
 #include "py/obj.h"
 #include "py/ringbuf.h"
 
+// Characters are received with EasyDMA into two chunks of this size, one filling while the other
+// is copied into the ring buffer.
+#define UART_RX_CHUNK_SIZE 32
+
 typedef struct {
     mp_obj_base_t base;
 
@@ -42,7 +46,12 @@ typedef struct {
     uint32_t timeout_ms;
 
     ringbuf_t rbuf;
-    uint8_t rx_char; // EasyDMA buf
+    uint8_t rx_chunks[2][UART_RX_CHUNK_SIZE]; // EasyDMA bufs
+    uint8_t rx_chunks_queued;
+    // Set once a character lands in a chunk that hasn't been handed over yet.
+    volatile bool rx_pending;
+    volatile bool rx_stopping;
+    uint64_t rx_last_ms;
 
     uint8_t tx_pin_number;
     uint8_t rx_pin_number;
@@ -156,3 +156,14 @@ digitalio_pull_t common_hal_digitalio_digitalinout_get_pull(
             return PULL_NONE;
     }
 }
+
+bool common_hal_digitalio_digitalinout_get_registers(digitalio_digitalinout_obj_t *self,
+        digitalio_digitalinout_registers_t *regs) {
+    uint32_t pin = self->pin->number;
+    NRF_GPIO_Type *reg = nrf_gpio_pin_port_decode(&pin);
+    regs->set = &reg->OUTSET;
+    regs->clear = &reg->OUTCLR;
+    regs->in = &reg->IN;
+    regs->mask = 1UL << pin;
+    return true;
+}
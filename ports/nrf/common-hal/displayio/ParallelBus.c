@@ -156,6 +156,10 @@ void common_hal_displayio_parallelbus_send(mp_obj_t obj, display_byte_type_t byt
     }
 }
 
+void common_hal_displayio_parallelbus_send_async(mp_obj_t obj, display_byte_type_t byte_type, display_chip_select_behavior_t chip_select, uint8_t *data, uint32_t data_length) {
+    common_hal_displayio_parallelbus_send(obj, byte_type, chip_select, data, data_length);
+}
+
 void common_hal_displayio_parallelbus_end_transaction(mp_obj_t obj) {
     displayio_parallelbus_obj_t* self = MP_OBJ_TO_PTR(obj);
     common_hal_digitalio_digitalinout_set_value(&self->chip_select, true);
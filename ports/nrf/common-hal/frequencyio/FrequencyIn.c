@@ -0,0 +1,250 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "common-hal/frequencyio/FrequencyIn.h"
+
+#include <stdint.h>
+
+#include "py/runtime.h"
+#include "shared-bindings/frequencyio/FrequencyIn.h"
+#include "supervisor/shared/translate.h"
+
+#include "nrf/timers.h"
+#include "nrfx_gpiote.h"
+
+// The gate timer runs at 16MHz so a 500ms capture period still fits in 32 bits.
+#define GATE_TICKS_PER_MS (16000)
+
+// The hardware does all of the counting: each rising edge counts the counter and timestamps
+// the gate through PPI, and the end of every capture period captures the count. This runs once
+// per capture period to work out the frequency.
+//
+// When the count hasn't moved since the capture, the timestamp of the last edge is still from
+// the period that ended. The frequency is then the edges between the last edges of two periods
+// over the exact time between them, which stays accurate when there are only a few edges.
+// Otherwise edges are coming too quickly to tell and the plain count over the period is used.
+// It is accurate to one edge in the many counted.
+static void _gate_handler(nrf_timer_event_t event_type, void *p_context) {
+    frequencyio_frequencyin_obj_t* self = p_context;
+    if (event_type != NRF_TIMER_EVENT_COMPARE0 || self->paused) {
+        return;
+    }
+    uint32_t period_ticks = self->capture_period * GATE_TICKS_PER_MS;
+    uint32_t count = nrfx_timer_capture_get(self->counter, NRF_TIMER_CC_CHANNEL0);
+    uint32_t edge_ticks = nrfx_timer_capture_get(self->gate, NRF_TIMER_CC_CHANNEL1);
+    uint32_t now_count = nrfx_timer_capture(self->counter, NRF_TIMER_CC_CHANNEL1);
+    uint32_t edges = count - self->last_count;
+    self->last_count = count;
+    bool timestamp_valid = now_count == count && edge_ticks < period_ticks;
+
+    if (edges == 0) {
+        // No edges. Once it has been longer than the last period the frequency can only be
+        // lower, so let it fall off.
+        if (self->since_edge_valid) {
+            self->since_edge += period_ticks;
+            uint32_t bound = (uint64_t) GATE_TICKS_PER_MS * 1000 / self->since_edge;
+            if (bound < self->frequency) {
+                self->frequency = bound;
+            }
+            // Stop after about four seconds. Anything slower reads as 0.
+            if (self->since_edge > 0x4000000) {
+                self->since_edge_valid = false;
+                self->frequency = 0;
+            }
+        }
+        return;
+    }
+
+    if (self->since_edge_valid && timestamp_valid) {
+        uint32_t ticks = self->since_edge + edge_ticks;
+        self->frequency = (uint64_t) edges * GATE_TICKS_PER_MS * 1000 / ticks;
+    } else {
+        self->frequency = edges * 1000 / self->capture_period;
+    }
+    self->since_edge = period_ticks - edge_ticks;
+    self->since_edge_valid = timestamp_valid;
+}
+
+static void _counter_handler(nrf_timer_event_t event_type, void *p_context) {
+    // The counter only counts. Nothing to do.
+}
+
+static void _set_gate_period(frequencyio_frequencyin_obj_t* self) {
+    nrfx_timer_extended_compare(self->gate, NRF_TIMER_CC_CHANNEL0,
+        self->capture_period * GATE_TICKS_PER_MS, NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK, true);
+}
+
+void common_hal_frequencyio_frequencyin_construct(frequencyio_frequencyin_obj_t* self, const mcu_pin_obj_t* pin, const uint16_t capture_period) {
+    if ((capture_period == 0) || (capture_period > 500)) {
+        mp_raise_ValueError(translate("Invalid capture period. Valid range: 1 - 500"));
+    }
+
+    self->counter = nrf_peripherals_allocate_timer();
+    self->gate = nrf_peripherals_allocate_timer();
+    if (self->counter == NULL || self->gate == NULL) {
+        nrf_peripherals_free_timer(self->counter);
+        nrf_peripherals_free_timer(self->gate);
+        mp_raise_RuntimeError(translate("All timers in use"));
+    }
+    if (nrfx_ppi_channel_alloc(&self->edge_channel) != NRFX_SUCCESS) {
+        nrf_peripherals_free_timer(self->counter);
+        nrf_peripherals_free_timer(self->gate);
+        mp_raise_RuntimeError(translate("All event channels in use"));
+    }
+    if (nrfx_ppi_channel_alloc(&self->gate_channel) != NRFX_SUCCESS) {
+        nrfx_ppi_channel_free(self->edge_channel);
+        nrf_peripherals_free_timer(self->counter);
+        nrf_peripherals_free_timer(self->gate);
+        mp_raise_RuntimeError(translate("All event channels in use"));
+    }
+
+    self->pin = pin->number;
+    self->capture_period = capture_period;
+    self->last_count = 0;
+    self->since_edge = 0;
+    self->since_edge_valid = false;
+    self->frequency = 0;
+    self->paused = false;
+    claim_pin(pin);
+
+    nrfx_timer_config_t counter_config = {
+        .frequency = NRF_TIMER_FREQ_16MHz,
+        .mode = NRF_TIMER_MODE_COUNTER,
+        .bit_width = NRF_TIMER_BIT_WIDTH_32,
+        .interrupt_priority = NRFX_TIMER_DEFAULT_CONFIG_IRQ_PRIORITY,
+        .p_context = self,
+    };
+    nrfx_timer_init(self->counter, &counter_config, &_counter_handler);
+
+    nrfx_timer_config_t gate_config = {
+        .frequency = NRF_TIMER_FREQ_16MHz,
+        .mode = NRF_TIMER_MODE_TIMER,
+        .bit_width = NRF_TIMER_BIT_WIDTH_32,
+        .interrupt_priority = NRFX_TIMER_DEFAULT_CONFIG_IRQ_PRIORITY,
+        .p_context = self,
+    };
+    nrfx_timer_init(self->gate, &gate_config, &_gate_handler);
+    _set_gate_period(self);
+
+    // The GPIOTE event only drives PPI so it doesn't interrupt.
+    nrfx_gpiote_in_config_t cfg = {
+        .sense = NRF_GPIOTE_POLARITY_LOTOHI,
+        .pull = NRF_GPIO_PIN_NOPULL,
+        .is_watcher = false,
+        .hi_accuracy = true,
+        .skip_gpio_setup = false
+    };
+    nrfx_gpiote_in_init(self->pin, &cfg, NULL);
+
+    nrfx_ppi_channel_assign(self->edge_channel, nrfx_gpiote_in_event_addr_get(self->pin),
+                            nrfx_timer_task_address_get(self->counter, NRF_TIMER_TASK_COUNT));
+    nrfx_ppi_channel_fork_assign(self->edge_channel,
+                                 nrfx_timer_task_address_get(self->gate, NRF_TIMER_TASK_CAPTURE1));
+    nrfx_ppi_channel_assign(self->gate_channel,
+                            nrfx_timer_event_address_get(self->gate, NRF_TIMER_EVENT_COMPARE0),
+                            nrfx_timer_task_address_get(self->counter, NRF_TIMER_TASK_CAPTURE0));
+    nrfx_ppi_channel_enable(self->gate_channel);
+    nrfx_ppi_channel_enable(self->edge_channel);
+
+    nrfx_timer_enable(self->counter);
+    nrfx_timer_enable(self->gate);
+    nrfx_gpiote_in_event_enable(self->pin, false);
+}
+
+bool common_hal_frequencyio_frequencyin_deinited(frequencyio_frequencyin_obj_t* self) {
+    return self->pin == NO_PIN;
+}
+
+void common_hal_frequencyio_frequencyin_deinit(frequencyio_frequencyin_obj_t* self) {
+    if (common_hal_frequencyio_frequencyin_deinited(self)) {
+        return;
+    }
+    nrfx_gpiote_in_event_disable(self->pin);
+    nrfx_gpiote_in_uninit(self->pin);
+
+    nrfx_ppi_channel_disable(self->edge_channel);
+    nrfx_ppi_channel_free(self->edge_channel);
+    nrfx_ppi_channel_disable(self->gate_channel);
+    nrfx_ppi_channel_free(self->gate_channel);
+
+    nrf_peripherals_free_timer(self->counter);
+    nrf_peripherals_free_timer(self->gate);
+    self->counter = NULL;
+    self->gate = NULL;
+
+    reset_pin_number(self->pin);
+    self->pin = NO_PIN;
+}
+
+uint32_t common_hal_frequencyio_frequencyin_get_item(frequencyio_frequencyin_obj_t* self) {
+    return self->frequency;
+}
+
+void common_hal_frequencyio_frequencyin_pause(frequencyio_frequencyin_obj_t* self) {
+    if (self->paused) {
+        return;
+    }
+    nrfx_ppi_channel_disable(self->edge_channel);
+    self->paused = true;
+}
+
+void common_hal_frequencyio_frequencyin_resume(frequencyio_frequencyin_obj_t* self) {
+    if (!self->paused) {
+        return;
+    }
+    // The gap while paused isn't a period of the signal.
+    nrfx_timer_disable(self->gate);
+    self->since_edge_valid = false;
+    self->last_count = nrfx_timer_capture(self->counter, NRF_TIMER_CC_CHANNEL0);
+    nrfx_timer_clear(self->gate);
+    nrfx_ppi_channel_enable(self->edge_channel);
+    nrfx_timer_enable(self->gate);
+    self->paused = false;
+}
+
+void common_hal_frequencyio_frequencyin_clear(frequencyio_frequencyin_obj_t* self) {
+    nrfx_timer_disable(self->gate);
+    self->frequency = 0;
+    self->since_edge_valid = false;
+    self->last_count = nrfx_timer_capture(self->counter, NRF_TIMER_CC_CHANNEL0);
+    nrfx_timer_clear(self->gate);
+    nrfx_timer_enable(self->gate);
+}
+
+uint16_t common_hal_frequencyio_frequencyin_get_capture_period(frequencyio_frequencyin_obj_t *self) {
+    return self->capture_period;
+}
+
+void common_hal_frequencyio_frequencyin_set_capture_period(frequencyio_frequencyin_obj_t *self, uint16_t capture_period) {
+    if ((capture_period == 0) || (capture_period > 500)) {
+        mp_raise_ValueError(translate("Invalid capture period. Valid range: 1 - 500"));
+    }
+
+    self->capture_period = capture_period;
+    _set_gate_period(self);
+
+    common_hal_frequencyio_frequencyin_clear(self);
+}
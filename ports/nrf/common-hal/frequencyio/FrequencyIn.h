@@ -0,0 +1,55 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_NRF_COMMON_HAL_FREQUENCYIO_FREQUENCYIN_H
+#define MICROPY_INCLUDED_NRF_COMMON_HAL_FREQUENCYIO_FREQUENCYIN_H
+
+#include "common-hal/microcontroller/Pin.h"
+
+#include "py/obj.h"
+
+#include "nrfx_ppi.h"
+#include "nrfx_timer.h"
+
+typedef struct {
+    mp_obj_base_t base;
+    // Counts the edges of the pin.
+    nrfx_timer_t* counter;
+    // Times the capture period and timestamps each edge in CC[1].
+    nrfx_timer_t* gate;
+    nrf_ppi_channel_t edge_channel;
+    nrf_ppi_channel_t gate_channel;
+    uint32_t last_count;
+    // Gate ticks from the last edge to the end of the previous capture period.
+    uint32_t since_edge;
+    volatile uint32_t frequency;
+    uint16_t capture_period;
+    uint8_t pin;
+    bool since_edge_valid;
+    bool paused;
+} frequencyio_frequencyin_obj_t;
+
+#endif // MICROPY_INCLUDED_NRF_COMMON_HAL_FREQUENCYIO_FREQUENCYIN_H
@@ -0,0 +1 @@
+// No ferquencyio module functions.
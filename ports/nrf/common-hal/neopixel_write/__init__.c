@@ -24,8 +24,12 @@
  * THE SOFTWARE.
  */
 
+#include "py/gc.h"
 #include "py/mphal.h"
+#include "py/mpstate.h"
+#include "common-hal/neopixel_write/__init__.h"
 #include "shared-bindings/neopixel_write/__init__.h"
+#include "supervisor/shared/tick.h"
 #include "nrf_pwm.h"
 
 #include "tick.h"
@@ -100,6 +104,65 @@ static NRF_PWM_Type* find_free_pwm (void) {
 uint64_t next_start_tick_ms = 0;
 uint32_t next_start_tick_us = 1000;
 
+// A heap allocated pattern is left playing when the write returns. The pattern is kept in
+// MP_STATE_PORT(neopixel_pattern) so the GC doesn't free it while the PWM reads it.
+static NRF_PWM_Type* active_pwm = NULL;
+// The ms tick by which the active transfer has surely finished.
+static uint64_t active_done_ms;
+
+// The pixels latch once the line has been low for a while.
+static void start_latch(void) {
+    current_tick(&next_start_tick_ms, &next_start_tick_us);
+    if (next_start_tick_us < 100) {
+        next_start_tick_ms += 1;
+        next_start_tick_us = 100 - next_start_tick_us;
+    } else {
+        next_start_tick_us -= 100;
+    }
+}
+
+static void release_pwm(NRF_PWM_Type* pwm) {
+    nrf_pwm_event_clear(pwm, NRF_PWM_EVENT_SEQEND0);
+
+    // We need to disable the device and disconnect
+    // all the outputs before leave or the device will not
+    // be selected on the next call.
+    // TODO: Check if disabling the device causes performance issues.
+    nrf_pwm_disable(pwm);
+    nrf_pwm_pins_set(pwm, (uint32_t[]) {0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL} );
+}
+
+// Waits for the transfer left in the background, if any, to finish.
+static void finish_transfer(void) {
+    if (active_pwm == NULL) {
+        return;
+    }
+    while ( !nrf_pwm_event_check(active_pwm, NRF_PWM_EVENT_SEQEND0) ) {
+        RUN_BACKGROUND_TASKS;
+    }
+    release_pwm(active_pwm);
+    active_pwm = NULL;
+    m_free(MP_STATE_PORT(neopixel_pattern));
+    MP_STATE_PORT(neopixel_pattern) = NULL;
+
+    if (supervisor_ticks_ms64() > active_done_ms) {
+        // Latched long ago.
+        next_start_tick_ms = 0;
+    } else {
+        start_latch();
+    }
+}
+
+void neopixel_write_reset(void) {
+    // The heap is already gone so stop right away.
+    if (active_pwm != NULL) {
+        nrf_pwm_task_trigger(active_pwm, NRF_PWM_TASK_STOP);
+        release_pwm(active_pwm);
+        active_pwm = NULL;
+    }
+    MP_STATE_PORT(neopixel_pattern) = NULL;
+}
+
 void common_hal_neopixel_write (const digitalio_digitalinout_obj_t* digitalinout, uint8_t *pixels, uint32_t numBytes) {
     // To support both the SoftDevice + Neopixels we use the EasyDMA
     // feature from the NRF25. However this technique implies to
@@ -123,13 +186,16 @@ void common_hal_neopixel_write (const digitalio_digitalinout_obj_t* digitalinout
     // PATTERN_SIZE is a multiple of 4, so we don't need round up to make sure one_pixel is large enough.
     uint32_t one_pixel[PATTERN_SIZE(3)/sizeof(uint32_t)];
 
+    // The last transfer may still hold a PWM.
+    finish_transfer();
+
     NRF_PWM_Type* pwm = find_free_pwm();
 
     // only malloc if there is PWM device available
     if ( pwm != NULL ) {
         if (pattern_size <= sizeof(one_pixel)) {
             pixels_pattern = (uint16_t *) one_pixel;
-        } else {
+        } else if (gc_alloc_possible()) {
             uint8_t sd_en = 0;
             (void) sd_softdevice_is_enabled(&sd_en);
             if (sd_en) {
@@ -190,12 +256,6 @@ void common_hal_neopixel_write (const digitalio_digitalinout_obj_t* digitalinout
         nrf_pwm_seq_refresh_set(pwm, 0, 0);
         nrf_pwm_seq_end_delay_set(pwm, 0, 0);
 
-        // The Neopixel implementation is a blocking algorithm. DMA
-        // allows for non-blocking operation. To "simulate" a blocking
-        // operation we enable the interruption for the end of sequence
-        // and block the execution thread until the event flag is set by
-        // the peripheral.
-        //    pwm->INTEN |= (PWM_INTEN_SEQEND0_Enabled<<PWM_INTEN_SEQEND0_Pos);
 
         // PSEL must be configured before enabling PWM
         nrf_pwm_pins_set(pwm, (uint32_t[]) {digitalinout->pin->number, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL} );
@@ -208,24 +268,20 @@ void common_hal_neopixel_write (const digitalio_digitalinout_obj_t* digitalinout
         nrf_pwm_event_clear(pwm, NRF_PWM_EVENT_SEQEND0);
         nrf_pwm_task_trigger(pwm, NRF_PWM_TASK_SEQSTART0);
 
-        // But we have to wait for the flag to be set.
-        while ( !nrf_pwm_event_check(pwm, NRF_PWM_EVENT_SEQEND0) ) {
-            RUN_BACKGROUND_TASKS;
+        if (pattern_on_heap) {
+            // Return while the PWM plays the pattern. The next write or reset cleans up. Each
+            // byte takes 10us to send.
+            active_pwm = pwm;
+            MP_STATE_PORT(neopixel_pattern) = pixels_pattern;
+            active_done_ms = supervisor_ticks_ms64() + numBytes / 100 + 2;
+            return;
         }
 
-        // Before leave we clear the flag for the event.
-        nrf_pwm_event_clear(pwm, NRF_PWM_EVENT_SEQEND0);
-
-        // We need to disable the device and disconnect
-        // all the outputs before leave or the device will not
-        // be selected on the next call.
-        // TODO: Check if disabling the device causes performance issues.
-        nrf_pwm_disable(pwm);
-        nrf_pwm_pins_set(pwm, (uint32_t[]) {0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL} );
-
-        if (pattern_on_heap) {
-            m_free(pixels_pattern);
+        // The stack pattern must be sent before we return.
+        while ( !nrf_pwm_event_check(pwm, NRF_PWM_EVENT_SEQEND0) ) {
+            RUN_BACKGROUND_TASKS;
         }
+        release_pwm(pwm);
 
     } // End of DMA implementation
     // ---------------------------------------------------------------------
@@ -297,11 +353,5 @@ void common_hal_neopixel_write (const digitalio_digitalinout_obj_t* digitalinout
     }
 
     // Update the next start.
-    current_tick(&next_start_tick_ms, &next_start_tick_us);
-    if (next_start_tick_us < 100) {
-        next_start_tick_ms += 1;
-        next_start_tick_us = 100 - next_start_tick_us;
-    } else {
-        next_start_tick_us -= 100;
-    }
+    start_latch();
 }
@@ -26,6 +26,7 @@
 
 #include "py/runtime.h"
 #include "common-hal/nvm/ByteArray.h"
+#include "shared-module/nvm/ByteArray.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -36,12 +37,12 @@ uint32_t common_hal_nvm_bytearray_get_length(nvm_bytearray_obj_t *self) {
     return self->len;
 }
 
-static bool write_page(uint32_t page_addr, uint32_t offset, uint32_t len, uint8_t *bytes) {
+static bool write_page(uint32_t page_addr, uint32_t offset, uint32_t len, const uint8_t *bytes) {
     // Write a whole page to flash, buffering it first and then erasing and rewriting
     // it since we can only clear a whole page at a time.
 
     if (offset == 0 && len == FLASH_PAGE_SIZE) {
-        return nrf_nvm_safe_flash_page_write(page_addr, bytes);
+        return nrf_nvm_safe_flash_page_write(page_addr, (uint8_t *)bytes);
     } else {
         uint8_t buffer[FLASH_PAGE_SIZE];
         memcpy(buffer, (uint8_t *)page_addr, FLASH_PAGE_SIZE);
@@ -50,8 +51,8 @@ static bool write_page(uint32_t page_addr, uint32_t offset, uint32_t len, uint8_
     }
 }
 
-bool common_hal_nvm_bytearray_set_bytes(nvm_bytearray_obj_t *self,
-        uint32_t start_index, uint8_t* values, uint32_t len) {
+bool nvm_bytearray_write_flash(nvm_bytearray_obj_t *self,
+        uint32_t start_index, const uint8_t* values, uint32_t len) {
 
     uint32_t address = (uint32_t) self->start_address + start_index;
     uint32_t offset = address % FLASH_PAGE_SIZE;
@@ -69,8 +70,3 @@ bool common_hal_nvm_bytearray_set_bytes(nvm_bytearray_obj_t *self,
     }
     return true;
 }
-
-void common_hal_nvm_bytearray_get_bytes(nvm_bytearray_obj_t *self,
-    uint32_t start_index, uint32_t len, uint8_t* values) {
-    memcpy(values, self->start_address + start_index, len);
-}
@@ -0,0 +1,234 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "common-hal/pulseio/PWMSequence.h"
+
+#include <stdint.h>
+
+#include "py/gc.h"
+#include "py/runtime.h"
+#include "common-hal/pulseio/PWMOut.h"
+#include "shared-bindings/microcontroller/Pin.h"
+#include "shared-bindings/pulseio/PWMSequence.h"
+#include "supervisor/shared/translate.h"
+
+#include "nrf_gpio.h"
+
+// The frames are played straight from RAM by the PWM's EasyDMA, one compare value per channel
+// per frame, so a PWM covers up to four pins and they all change duty on the same period.
+
+#define PWM_BASE_FREQ (16000000)
+#define CHANNELS_PER_PWM (4)
+// SEQ[n].CNT is 15 bits and holds four values per frame.
+#define MAX_FRAMES (0x7fff / CHANNELS_PER_PWM)
+// SEQ[n].REFRESH is 24 bits and counts the extra periods each frame is held for.
+#define MAX_HOLD (0x1000000)
+
+static void link(pulseio_pwmsequence_obj_t* self) {
+    self->next = MP_STATE_PORT(pwmsequences);
+    MP_STATE_PORT(pwmsequences) = self;
+}
+
+static void unlink(pulseio_pwmsequence_obj_t* self) {
+    pulseio_pwmsequence_obj_t** previous = (pulseio_pwmsequence_obj_t**) &MP_STATE_PORT(pwmsequences);
+    while (*previous != NULL) {
+        if (*previous == self) {
+            *previous = self->next;
+            break;
+        }
+        previous = &(*previous)->next;
+    }
+    self->next = NULL;
+}
+
+static void disconnect(NRF_PWM_Type* pwm) {
+    pwm->TASKS_STOP = 1;
+    pwm->SHORTS = 0;
+    for (size_t i = 0; i < CHANNELS_PER_PWM; i++) {
+        pwm->PSEL.OUT[i] = 0xFFFFFFFF;
+    }
+    nrf_pwm_disable(pwm);
+}
+
+void pwmsequence_reset(void) {
+    pulseio_pwmsequence_obj_t* self = MP_STATE_PORT(pwmsequences);
+    while (self != NULL) {
+        disconnect(self->pwm);
+        self = self->next;
+    }
+    MP_STATE_PORT(pwmsequences) = NULL;
+}
+
+void common_hal_pulseio_pwmsequence_construct(pulseio_pwmsequence_obj_t* self,
+        const mcu_pin_obj_t** pins, uint8_t pin_count, uint32_t frequency) {
+    if (pin_count > CHANNELS_PER_PWM) {
+        mp_raise_ValueError(translate("Invalid pins"));
+    }
+    for (uint8_t i = 0; i < pin_count; i++) {
+        for (uint8_t j = 0; j < i; j++) {
+            if (pins[i] == pins[j]) {
+                mp_raise_ValueError(translate("Invalid pins"));
+            }
+        }
+    }
+    uint16_t countertop;
+    nrf_pwm_clk_t base_clock;
+    if (frequency == 0 || !convert_frequency(frequency, &countertop, &base_clock)) {
+        mp_raise_ValueError(translate("Invalid PWM frequency"));
+    }
+    NRF_PWM_Type* pwm = pwmout_allocate(countertop, base_clock, true, NULL, NULL);
+    if (pwm == NULL) {
+        mp_raise_RuntimeError(translate("All timers in use"));
+    }
+
+    // Enabling the PWM keeps other users off it.
+    nrf_pwm_configure(pwm, base_clock, NRF_PWM_MODE_UP, countertop);
+    pwm->DECODER = PWM_DECODER_LOAD_Individual | PWM_DECODER_MODE_RefreshCount;
+    pwm->SEQ[0].ENDDELAY = pwm->SEQ[1].ENDDELAY = 0;
+    pwm->SHORTS = 0;
+    for (uint8_t i = 0; i < CHANNELS_PER_PWM; i++) {
+        pwm->PSEL.OUT[i] = 0xFFFFFFFF;
+    }
+    // The GPIO holds the pins low whenever the PWM is stopped.
+    for (uint8_t i = 0; i < pin_count; i++) {
+        uint8_t number = pins[i]->number;
+        claim_pin(pins[i]);
+        nrf_gpio_pin_clear(number);
+        nrf_gpio_cfg_output(number);
+        pwm->PSEL.OUT[i] = number;
+        self->pins[i] = number;
+    }
+    nrf_pwm_enable(pwm);
+
+    self->next = NULL;
+    self->pwm = pwm;
+    self->frames = NULL;
+    self->frames_length = 0;
+    self->frequency = (PWM_BASE_FREQ >> base_clock) / countertop;
+    self->countertop = countertop;
+    self->pin_count = pin_count;
+    self->playing = false;
+    self->loop = false;
+    link(self);
+}
+
+bool common_hal_pulseio_pwmsequence_deinited(pulseio_pwmsequence_obj_t* self) {
+    return self->pwm == NULL;
+}
+
+void common_hal_pulseio_pwmsequence_deinit(pulseio_pwmsequence_obj_t* self) {
+    if (common_hal_pulseio_pwmsequence_deinited(self)) {
+        return;
+    }
+    common_hal_pulseio_pwmsequence_stop(self);
+    unlink(self);
+    disconnect(self->pwm);
+    self->pwm = NULL;
+    for (uint8_t i = 0; i < self->pin_count; i++) {
+        reset_pin_number(self->pins[i]);
+    }
+    m_del(uint16_t, self->frames, self->frames_length);
+    self->frames = NULL;
+    self->frames_length = 0;
+    self->pin_count = 0;
+}
+
+void common_hal_pulseio_pwmsequence_play(pulseio_pwmsequence_obj_t* self,
+        const uint16_t* duty_cycles, size_t frame_count, uint32_t hold, bool loop) {
+    common_hal_pulseio_pwmsequence_stop(self);
+    if (frame_count > MAX_FRAMES) {
+        mp_raise_ValueError_varg(translate("%q must be between %d and %d"), MP_QSTR_frames, 1, MAX_FRAMES);
+    }
+    if (hold == 0 || hold > MAX_HOLD) {
+        mp_raise_ValueError_varg(translate("%q must be between %d and %d"), MP_QSTR_hold, 1, MAX_HOLD);
+    }
+    size_t length = frame_count * CHANNELS_PER_PWM;
+    if (self->frames_length != length) {
+        m_del(uint16_t, self->frames, self->frames_length);
+        self->frames = NULL;
+        self->frames_length = 0;
+        self->frames = m_new(uint16_t, length);
+        self->frames_length = length;
+    }
+
+    // Bit 15 makes each period start high, matching PWMOut.
+    uint16_t* values = self->frames;
+    for (size_t i = 0; i < frame_count; i++) {
+        for (uint8_t pin = 0; pin < CHANNELS_PER_PWM; pin++) {
+            uint32_t duty_cycle = pin < self->pin_count ? *duty_cycles++ : 0;
+            *values++ = ((duty_cycle * self->countertop) / 0xFFFF) | (1 << 15);
+        }
+    }
+
+    NRF_PWM_Type* pwm = self->pwm;
+    pwm->SEQ[0].PTR = pwm->SEQ[1].PTR = (uint32_t) self->frames;
+    pwm->SEQ[0].CNT = pwm->SEQ[1].CNT = length;
+    pwm->SEQ[0].REFRESH = pwm->SEQ[1].REFRESH = hold - 1;
+    if (loop) {
+        // Both sequences play the frames and then start over.
+        pwm->LOOP = 1;
+        pwm->SHORTS = NRF_PWM_SHORT_LOOPSDONE_SEQSTART0_MASK;
+    } else {
+        // Once the sequence ends the PWM keeps generating the last frame.
+        pwm->LOOP = 0;
+        pwm->SHORTS = 0;
+    }
+    pwm->EVENTS_SEQEND[0] = 0;
+    pwm->EVENTS_STOPPED = 0;
+    self->loop = loop;
+    self->playing = true;
+    pwm->TASKS_SEQSTART[0] = 1;
+}
+
+void common_hal_pulseio_pwmsequence_stop(pulseio_pwmsequence_obj_t* self) {
+    NRF_PWM_Type* pwm = self->pwm;
+    if (!self->playing && pwm->EVENTS_SEQEND[0] == 0) {
+        return;
+    }
+    pwm->SHORTS = 0;
+    pwm->TASKS_STOP = 1;
+    // The PWM stops at the end of the current period. Wait so the frames can be rewritten.
+    while (pwm->EVENTS_STOPPED == 0) {
+        RUN_BACKGROUND_TASKS;
+    }
+    pwm->EVENTS_SEQEND[0] = 0;
+    self->playing = false;
+}
+
+bool common_hal_pulseio_pwmsequence_get_playing(pulseio_pwmsequence_obj_t* self) {
+    if (self->playing && !self->loop && self->pwm->EVENTS_SEQEND[0] != 0) {
+        self->playing = false;
+    }
+    return self->playing;
+}
+
+uint32_t common_hal_pulseio_pwmsequence_get_frequency(pulseio_pwmsequence_obj_t* self) {
+    return self->frequency;
+}
+
+uint8_t common_hal_pulseio_pwmsequence_get_pin_count(pulseio_pwmsequence_obj_t* self) {
+    return self->pin_count;
+}
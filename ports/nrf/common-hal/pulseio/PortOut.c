@@ -0,0 +1,232 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "common-hal/pulseio/PortOut.h"
+
+#include <stdint.h>
+
+#include "py/gc.h"
+#include "py/runtime.h"
+#include "common-hal/pulseio/PWMOut.h"
+#include "shared-bindings/microcontroller/Pin.h"
+#include "shared-bindings/pulseio/PortOut.h"
+#include "supervisor/shared/translate.h"
+
+#include "nrf_gpio.h"
+
+// GPIO can't be fed by EasyDMA so the pins are driven by a PWM instead. Every PWM period plays
+// one state with each channel either fully on or fully off, so a PWM covers up to four pins.
+
+#define PWM_BASE_FREQ (16000000)
+#define CHANNELS_PER_PWM (4)
+// SEQ[n].CNT is 15 bits and holds four values per state.
+#define MAX_STATES (0x7fff / CHANNELS_PER_PWM)
+// COUNTERTOP can't go below 4.
+#define MAX_FREQUENCY (PWM_BASE_FREQ / 4)
+
+static void link(pulseio_portout_obj_t* self) {
+    self->next = MP_STATE_PORT(portouts);
+    MP_STATE_PORT(portouts) = self;
+}
+
+static void unlink(pulseio_portout_obj_t* self) {
+    pulseio_portout_obj_t** previous = (pulseio_portout_obj_t**) &MP_STATE_PORT(portouts);
+    while (*previous != NULL) {
+        if (*previous == self) {
+            *previous = self->next;
+            break;
+        }
+        previous = &(*previous)->next;
+    }
+    self->next = NULL;
+}
+
+static void disconnect(NRF_PWM_Type* pwm) {
+    pwm->TASKS_STOP = 1;
+    pwm->SHORTS = 0;
+    for (size_t i = 0; i < CHANNELS_PER_PWM; i++) {
+        pwm->PSEL.OUT[i] = 0xFFFFFFFF;
+    }
+    nrf_pwm_disable(pwm);
+}
+
+void portout_reset(void) {
+    pulseio_portout_obj_t* self = MP_STATE_PORT(portouts);
+    while (self != NULL) {
+        disconnect(self->pwm);
+        self = self->next;
+    }
+    MP_STATE_PORT(portouts) = NULL;
+}
+
+void common_hal_pulseio_portout_construct(pulseio_portout_obj_t* self,
+        const mcu_pin_obj_t** pins, uint8_t pin_count, uint32_t frequency) {
+    if (pin_count > CHANNELS_PER_PWM) {
+        mp_raise_ValueError(translate("Invalid pins"));
+    }
+    for (uint8_t i = 0; i < pin_count; i++) {
+        for (uint8_t j = 0; j < i; j++) {
+            if (pins[i] == pins[j]) {
+                mp_raise_ValueError(translate("Invalid pins"));
+            }
+        }
+    }
+    uint16_t countertop;
+    nrf_pwm_clk_t base_clock;
+    if (frequency > MAX_FREQUENCY || !convert_frequency(frequency, &countertop, &base_clock)) {
+        mp_raise_ValueError_varg(translate("%q must be between %d and %d"), MP_QSTR_frequency, 1, MAX_FREQUENCY);
+    }
+    NRF_PWM_Type* pwm = pwmout_allocate(countertop, base_clock, true, NULL, NULL);
+    if (pwm == NULL) {
+        mp_raise_RuntimeError(translate("All timers in use"));
+    }
+
+    // Enabling the PWM keeps other users off it.
+    nrf_pwm_configure(pwm, base_clock, NRF_PWM_MODE_UP, countertop);
+    pwm->DECODER = PWM_DECODER_LOAD_Individual | PWM_DECODER_MODE_RefreshCount;
+    pwm->SEQ[0].REFRESH = pwm->SEQ[1].REFRESH = 0;
+    pwm->SEQ[0].ENDDELAY = pwm->SEQ[1].ENDDELAY = 0;
+    pwm->SHORTS = 0;
+    for (uint8_t i = 0; i < CHANNELS_PER_PWM; i++) {
+        pwm->PSEL.OUT[i] = 0xFFFFFFFF;
+    }
+    // The GPIO drives the pins whenever the sequence isn't running.
+    for (uint8_t i = 0; i < pin_count; i++) {
+        uint8_t number = pins[i]->number;
+        claim_pin(pins[i]);
+        nrf_gpio_pin_clear(number);
+        nrf_gpio_cfg_output(number);
+        pwm->PSEL.OUT[i] = number;
+        self->pins[i] = number;
+    }
+    nrf_pwm_enable(pwm);
+
+    self->next = NULL;
+    self->pwm = pwm;
+    self->pattern = NULL;
+    self->pattern_length = 0;
+    self->frequency = (PWM_BASE_FREQ >> base_clock) / countertop;
+    self->countertop = countertop;
+    self->pin_count = pin_count;
+    self->playing = false;
+    self->loop = false;
+    link(self);
+}
+
+bool common_hal_pulseio_portout_deinited(pulseio_portout_obj_t* self) {
+    return self->pwm == NULL;
+}
+
+void common_hal_pulseio_portout_deinit(pulseio_portout_obj_t* self) {
+    if (common_hal_pulseio_portout_deinited(self)) {
+        return;
+    }
+    common_hal_pulseio_portout_stop(self);
+    unlink(self);
+    disconnect(self->pwm);
+    self->pwm = NULL;
+    for (uint8_t i = 0; i < self->pin_count; i++) {
+        reset_pin_number(self->pins[i]);
+    }
+    m_del(uint16_t, self->pattern, self->pattern_length);
+    self->pattern = NULL;
+    self->pattern_length = 0;
+    self->pin_count = 0;
+}
+
+void common_hal_pulseio_portout_write(pulseio_portout_obj_t* self,
+        const void* buffer, uint8_t element_size, size_t count, bool loop) {
+    common_hal_pulseio_portout_stop(self);
+    if (count > MAX_STATES) {
+        mp_raise_ValueError_varg(translate("%q must be between %d and %d"), MP_QSTR_buffer, 1, MAX_STATES);
+    }
+    size_t length = count * CHANNELS_PER_PWM;
+    if (self->pattern_length != length) {
+        m_del(uint16_t, self->pattern, self->pattern_length);
+        self->pattern = NULL;
+        self->pattern_length = 0;
+        self->pattern = m_new(uint16_t, length);
+        self->pattern_length = length;
+    }
+
+    // Bit 15 makes each period start high, so a compare value of COUNTERTOP holds a pin high for
+    // the whole state and zero holds it low.
+    uint16_t* values = self->pattern;
+    uint32_t state = 0;
+    for (size_t i = 0; i < count; i++) {
+        state = pulseio_portout_get_state(buffer, element_size, i);
+        for (uint8_t pin = 0; pin < CHANNELS_PER_PWM; pin++) {
+            bool high = pin < self->pin_count && (state & (1 << pin)) != 0;
+            *values++ = (1 << 15) | (high ? self->countertop : 0);
+        }
+    }
+    // Leave the pins in the last state once the PWM lets go of them.
+    for (uint8_t pin = 0; pin < self->pin_count; pin++) {
+        nrf_gpio_pin_write(self->pins[pin], (state & (1 << pin)) != 0);
+    }
+
+    NRF_PWM_Type* pwm = self->pwm;
+    pwm->SEQ[0].PTR = pwm->SEQ[1].PTR = (uint32_t) self->pattern;
+    pwm->SEQ[0].CNT = pwm->SEQ[1].CNT = length;
+    if (loop) {
+        // Both sequences play the pattern and then start over.
+        pwm->LOOP = 1;
+        pwm->SHORTS = NRF_PWM_SHORT_LOOPSDONE_SEQSTART0_MASK;
+    } else {
+        pwm->LOOP = 0;
+        pwm->SHORTS = NRF_PWM_SHORT_SEQEND0_STOP_MASK;
+    }
+    pwm->EVENTS_SEQEND[0] = 0;
+    pwm->EVENTS_STOPPED = 0;
+    self->loop = loop;
+    self->playing = true;
+    pwm->TASKS_SEQSTART[0] = 1;
+}
+
+void common_hal_pulseio_portout_stop(pulseio_portout_obj_t* self) {
+    if (!self->playing) {
+        return;
+    }
+    NRF_PWM_Type* pwm = self->pwm;
+    pwm->SHORTS = 0;
+    pwm->TASKS_STOP = 1;
+    // The PWM stops at the end of the current period. Wait so the pattern can be rewritten.
+    while (pwm->EVENTS_STOPPED == 0) {
+        RUN_BACKGROUND_TASKS;
+    }
+    self->playing = false;
+}
+
+bool common_hal_pulseio_portout_get_playing(pulseio_portout_obj_t* self) {
+    if (self->playing && !self->loop && self->pwm->EVENTS_STOPPED != 0) {
+        self->playing = false;
+    }
+    return self->playing;
+}
+
+uint32_t common_hal_pulseio_portout_get_frequency(pulseio_portout_obj_t* self) {
+    return self->frequency;
+}
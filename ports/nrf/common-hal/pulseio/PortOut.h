@@ -0,0 +1,54 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_NRF_COMMON_HAL_PULSEIO_PORTOUT_H
+#define MICROPY_INCLUDED_NRF_COMMON_HAL_PULSEIO_PORTOUT_H
+
+#include "common-hal/microcontroller/Pin.h"
+
+#include "nrfx_pwm.h"
+#include "py/obj.h"
+
+typedef struct _pulseio_portout_obj_t {
+    mp_obj_base_t base;
+    // PortOuts are linked from MP_STATE_PORT(portouts) so the PWM never reads a freed pattern and
+    // reset can disconnect them.
+    struct _pulseio_portout_obj_t* next;
+    NRF_PWM_Type* pwm;
+    // Four compare values, one per PWM channel, for each state.
+    uint16_t* pattern;
+    size_t pattern_length;
+    uint32_t frequency;
+    uint16_t countertop;
+    uint8_t pins[4];
+    uint8_t pin_count;
+    bool playing;
+    bool loop;
+} pulseio_portout_obj_t;
+
+void portout_reset(void);
+
+#endif // MICROPY_INCLUDED_NRF_COMMON_HAL_PULSEIO_PORTOUT_H
@@ -36,6 +36,7 @@
 #include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/pulseio/PulseIn.h"
 
+#include "nrf/timers.h"
 #include "tick.h"
 #include "nrfx_gpiote.h"
 
@@ -71,18 +72,34 @@ static void _pulsein_handler(nrfx_gpiote_pin_t pin, nrf_gpiote_polarity_t action
     }
     if ( !self ) return;
 
+    // The timer captured the time of the edge through PPI so it doesn't matter how late this runs.
+    uint32_t timestamp = 0;
+    if (self->timer != NULL) {
+        timestamp = nrfx_timer_capture_get(self->timer, NRF_TIMER_CC_CHANNEL0);
+    }
+    bool state = nrf_gpio_pin_read(self->pin);
+
     if (self->first_edge) {
         // first pulse is opposite state from idle
-        bool state = nrf_gpio_pin_read(self->pin);
         if ( self->idle_state != state ) {
             self->first_edge = false;
         }
     }else {
+        // Edges alternate so the pin reading the same as last time means one went unhandled.
+        if (state == self->last_level) {
+            self->overflowed = true;
+        }
         uint32_t ms_diff = current_ms - self->last_ms;
         uint16_t us_diff = current_us - self->last_us;
         uint32_t total_diff = us_diff;
 
-        if (self->last_us > current_us) {
+        if (self->timer != NULL) {
+            // The microsecond timer wraps after about 71 minutes.
+            total_diff = timestamp - self->last_timestamp;
+            if (ms_diff > 60000) {
+                total_diff = 0xffff;
+            }
+        } else if (self->last_us > current_us) {
             total_diff = 1000 + current_us - self->last_us;
             if (ms_diff > 1) {
                 total_diff += (ms_diff - 1) * 1000;
@@ -106,6 +123,12 @@ static void _pulsein_handler(nrfx_gpiote_pin_t pin, nrf_gpiote_polarity_t action
 
     self->last_ms = current_ms;
     self->last_us = current_us;
+    self->last_timestamp = timestamp;
+    self->last_level = state;
+}
+
+static void _pulsein_timer_handler(nrf_timer_event_t event_type, void *p_context) {
+    // The timer only counts. Nothing to do.
 }
 
 void pulsein_reset(void) {
@@ -114,9 +137,48 @@ void pulsein_reset(void) {
     }
     nrfx_gpiote_init(NRFX_GPIOTE_CONFIG_IRQ_PRIORITY);
 
+    // timers_reset() frees the timers.
+    nrfx_ppi_free_all();
+
     memset(_objs, 0, sizeof(_objs));
 }
 
+// Connects the GPIOTE event of the pin to the timer capture. It has to be done again whenever the
+// pin is set up again because the GPIOTE channel may change.
+static void _connect_capture(pulseio_pulsein_obj_t* self) {
+    if (self->timer == NULL) {
+        return;
+    }
+    nrfx_ppi_channel_disable(self->ppi_channel);
+    nrfx_ppi_channel_assign(self->ppi_channel, nrfx_gpiote_in_event_addr_get(self->pin),
+                            nrfx_timer_task_address_get(self->timer, NRF_TIMER_TASK_CAPTURE0));
+    nrfx_ppi_channel_enable(self->ppi_channel);
+}
+
+// Sets up a timer to timestamp every edge when a timer and a PPI channel are free. The tick count
+// read by the interrupt handler times the edges otherwise.
+static void _setup_capture(pulseio_pulsein_obj_t* self) {
+    self->timer = nrf_peripherals_allocate_timer();
+    if (self->timer == NULL) {
+        return;
+    }
+    if (nrfx_ppi_channel_alloc(&self->ppi_channel) != NRFX_SUCCESS) {
+        nrf_peripherals_free_timer(self->timer);
+        self->timer = NULL;
+        return;
+    }
+    nrfx_timer_config_t timer_config = {
+        // PulseIn durations are in microseconds, so this is convenient.
+        .frequency = NRF_TIMER_FREQ_1MHz,
+        .mode = NRF_TIMER_MODE_TIMER,
+        .bit_width = NRF_TIMER_BIT_WIDTH_32,
+        .interrupt_priority = NRFX_TIMER_DEFAULT_CONFIG_IRQ_PRIORITY,
+        .p_context = self,
+    };
+    nrfx_timer_init(self->timer, &timer_config, &_pulsein_timer_handler);
+    nrfx_timer_enable(self->timer);
+}
+
 void common_hal_pulseio_pulsein_construct(pulseio_pulsein_obj_t* self, const mcu_pin_obj_t* pin, uint16_t maxlen, bool idle_state) {
     int idx = _find_pulsein_obj(NULL);
     if ( idx < 0 ) {
@@ -138,8 +200,12 @@ void common_hal_pulseio_pulsein_construct(pulseio_pulsein_obj_t* self, const mcu
     self->paused = false;
     self->last_us = 0;
     self->last_ms = 0;
+    self->last_timestamp = 0;
+    self->last_level = idle_state;
+    self->overflowed = false;
 
     claim_pin(pin);
+    _setup_capture(self);
 
     nrfx_gpiote_in_config_t cfg = {
         .sense = NRF_GPIOTE_POLARITY_TOGGLE,
@@ -149,6 +215,7 @@ void common_hal_pulseio_pulsein_construct(pulseio_pulsein_obj_t* self, const mcu
         .skip_gpio_setup = false
     };
     nrfx_gpiote_in_init(self->pin, &cfg, _pulsein_handler);
+    _connect_capture(self);
     nrfx_gpiote_in_event_enable(self->pin, true);
 }
 
@@ -164,6 +231,13 @@ void common_hal_pulseio_pulsein_deinit(pulseio_pulsein_obj_t* self) {
     nrfx_gpiote_in_event_disable(self->pin);
     nrfx_gpiote_in_uninit(self->pin);
 
+    if (self->timer != NULL) {
+        nrfx_ppi_channel_disable(self->ppi_channel);
+        nrfx_ppi_channel_free(self->ppi_channel);
+        nrf_peripherals_free_timer(self->timer);
+        self->timer = NULL;
+    }
+
     // mark local array as invalid
     int idx = _find_pulsein_obj(self);
     if ( idx < 0 ) {
@@ -203,12 +277,14 @@ void common_hal_pulseio_pulsein_resume(pulseio_pulsein_obj_t* self, uint16_t tri
             .skip_gpio_setup = false
         };
         nrfx_gpiote_in_init(self->pin, &cfg, _pulsein_handler);
+        _connect_capture(self);
     }
 
     self->first_edge = true;
     self->paused = false;
     self->last_ms = 0;
     self->last_us = 0;
+    self->overflowed = false;
 
     nrfx_gpiote_in_event_enable(self->pin, true);
 }
@@ -220,6 +296,7 @@ void common_hal_pulseio_pulsein_clear(pulseio_pulsein_obj_t* self) {
 
     self->start = 0;
     self->len = 0;
+    self->overflowed = false;
 
     if ( !self->paused ) {
         nrfx_gpiote_in_event_enable(self->pin, true);
@@ -280,3 +357,7 @@ bool common_hal_pulseio_pulsein_get_paused(pulseio_pulsein_obj_t* self) {
 uint16_t common_hal_pulseio_pulsein_get_len(pulseio_pulsein_obj_t* self) {
     return self->len;
 }
+
+bool common_hal_pulseio_pulsein_get_overflowed(pulseio_pulsein_obj_t* self) {
+    return self->overflowed;
+}
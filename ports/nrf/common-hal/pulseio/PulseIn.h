@@ -31,6 +31,9 @@
 
 #include "py/obj.h"
 
+#include "nrfx_ppi.h"
+#include "nrfx_timer.h"
+
 typedef struct {
     mp_obj_base_t base;
 
@@ -46,6 +49,13 @@ typedef struct {
     volatile uint16_t len;
     volatile uint16_t last_us;
     volatile uint64_t last_ms;
+
+    // Edges are timestamped by the timer when one is free.
+    nrfx_timer_t* timer;
+    nrf_ppi_channel_t ppi_channel;
+    volatile uint32_t last_timestamp;
+    volatile bool last_level;
+    volatile bool overflowed;
 } pulseio_pulsein_obj_t;
 
 void pulsein_reset(void);
@@ -34,6 +34,70 @@
 // obj array to map pin number -> self since nrfx hide the mapping
 static rotaryio_incrementalencoder_obj_t *_objs[NUMBER_OF_PINS];
 
+// The one encoder using the QDEC peripheral.
+static rotaryio_incrementalencoder_obj_t *_qdec_obj;
+
+// Scale quarter steps down to position 4:1, keeping the remainder.
+static void _add_quarters(rotaryio_incrementalencoder_obj_t *self, int32_t quarters) {
+    quarters += self->quarter;
+    self->position += quarters / 4;
+    self->quarter = quarters % 4;
+}
+
+void QDEC_IRQHandler(void) {
+    if (!NRF_QDEC->EVENTS_REPORTRDY) {
+        return;
+    }
+    NRF_QDEC->EVENTS_REPORTRDY = 0;
+    // The REPORTRDY_READCLRACC short has already moved the count to ACCREAD.
+    if (_qdec_obj != NULL) {
+        _add_quarters(_qdec_obj, (int32_t) NRF_QDEC->ACCREAD);
+    }
+}
+
+static void _qdec_stop(void) {
+    NVIC_DisableIRQ(QDEC_IRQn);
+    NRF_QDEC->TASKS_STOP = 1;
+    NRF_QDEC->ENABLE = QDEC_ENABLE_ENABLE_Disabled;
+    NRF_QDEC->INTENCLR = QDEC_INTENCLR_REPORTRDY_Msk;
+    NRF_QDEC->PSEL.A = 0xFFFFFFFF;
+    NRF_QDEC->PSEL.B = 0xFFFFFFFF;
+    _qdec_obj = NULL;
+}
+
+void rotaryio_reset(void) {
+    _qdec_stop();
+}
+
+static void _qdec_start(rotaryio_incrementalencoder_obj_t* self) {
+    _qdec_obj = self;
+    self->qdec = true;
+
+    nrf_gpio_cfg_input(self->pin_a, NRF_GPIO_PIN_PULLUP);
+    nrf_gpio_cfg_input(self->pin_b, NRF_GPIO_PIN_PULLUP);
+
+    // QDEC counts up when its A phase leads. Give it pin_b as A to keep the direction of the
+    // GPIOTE path below.
+    NRF_QDEC->PSEL.A = self->pin_b;
+    NRF_QDEC->PSEL.B = self->pin_a;
+    NRF_QDEC->PSEL.LED = 0xFFFFFFFF;
+    NRF_QDEC->DBFEN = 0;
+    // Sample as fast as possible and report every 10 samples (1.28ms) so ACC, which only holds
+    // +-1023, never overflows.
+    NRF_QDEC->SAMPLEPER = QDEC_SAMPLEPER_SAMPLEPER_128us;
+    NRF_QDEC->REPORTPER = QDEC_REPORTPER_REPORTPER_10Smpl;
+    NRF_QDEC->SHORTS = QDEC_SHORTS_REPORTRDY_READCLRACC_Msk;
+
+    NRF_QDEC->EVENTS_REPORTRDY = 0;
+    NRF_QDEC->INTENSET = QDEC_INTENSET_REPORTRDY_Msk;
+    NVIC_ClearPendingIRQ(QDEC_IRQn);
+    NVIC_SetPriority(QDEC_IRQn, 7);
+    NVIC_EnableIRQ(QDEC_IRQn);
+
+    NRF_QDEC->ENABLE = QDEC_ENABLE_ENABLE_Enabled;
+    NRF_QDEC->TASKS_START = 1;
+}
+
 static void _intr_handler(nrfx_gpiote_pin_t pin, nrf_gpiote_polarity_t action) {
     rotaryio_incrementalencoder_obj_t *self = _objs[pin];
     if (!self) return;
@@ -43,21 +107,10 @@ static void _intr_handler(nrfx_gpiote_pin_t pin, nrf_gpiote_polarity_t action) {
     new_state = (new_state << 1) + (new_state ^ nrf_gpio_pin_read(self->pin_b));
 
     uint8_t change = (new_state - self->state) & 0x03;
-    if (change == 1) self->quarter++;
-    else if (change == 3) self->quarter--;
     // ignore other state transitions
-
     self->state = new_state;
-
-    // logic from the atmel-samd port: provides some damping and scales movement 
-    // down by 4:1.  
-    if (self->quarter >= 4) { 
-        self->position++;
-        self->quarter = 0;
-    } else if (self->quarter <= -4) {
-        self->position--;
-        self->quarter = 0;
-    }
+    if (change == 1) _add_quarters(self, 1);
+    else if (change == 3) _add_quarters(self, -1);
 }
 
 void common_hal_rotaryio_incrementalencoder_construct(rotaryio_incrementalencoder_obj_t* self,
@@ -65,6 +118,18 @@ void common_hal_rotaryio_incrementalencoder_construct(rotaryio_incrementalencode
 
     self->pin_a = pin_a->number;
     self->pin_b = pin_b->number;
+    self->quarter = 0;
+    self->qdec = false;
+
+    claim_pin(pin_a);
+    claim_pin(pin_b);
+
+    // The QDEC peripheral decodes without interrupting on every edge, so fast encoders don't
+    // miss steps. There is only one so other encoders use GPIOTE interrupts.
+    if (_qdec_obj == NULL) {
+        _qdec_start(self);
+        return;
+    }
 
     _objs[self->pin_a] = self;
     _objs[self->pin_b] = self;
@@ -80,9 +145,6 @@ void common_hal_rotaryio_incrementalencoder_construct(rotaryio_incrementalencode
     nrfx_gpiote_in_init(self->pin_b, &cfg, _intr_handler);
     nrfx_gpiote_in_event_enable(self->pin_a, true);
     nrfx_gpiote_in_event_enable(self->pin_b, true);
-
-    claim_pin(pin_a);
-    claim_pin(pin_b);
 }
 
 bool common_hal_rotaryio_incrementalencoder_deinited(rotaryio_incrementalencoder_obj_t* self) {
@@ -93,13 +155,17 @@ void common_hal_rotaryio_incrementalencoder_deinit(rotaryio_incrementalencoder_o
     if (common_hal_rotaryio_incrementalencoder_deinited(self)) {
         return;
     }
-    _objs[self->pin_a] = NULL;
-    _objs[self->pin_b] = NULL;
-
-    nrfx_gpiote_in_event_disable(self->pin_a);
-    nrfx_gpiote_in_event_disable(self->pin_b);
-    nrfx_gpiote_in_uninit(self->pin_a);
-    nrfx_gpiote_in_uninit(self->pin_b);
+    if (self->qdec) {
+        _qdec_stop();
+    } else {
+        _objs[self->pin_a] = NULL;
+        _objs[self->pin_b] = NULL;
+
+        nrfx_gpiote_in_event_disable(self->pin_a);
+        nrfx_gpiote_in_event_disable(self->pin_b);
+        nrfx_gpiote_in_uninit(self->pin_a);
+        nrfx_gpiote_in_uninit(self->pin_b);
+    }
     reset_pin_number(self->pin_a);
     reset_pin_number(self->pin_b);
     self->pin_a = NO_PIN;
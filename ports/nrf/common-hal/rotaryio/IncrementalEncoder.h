@@ -37,10 +37,12 @@ typedef struct {
     uint8_t pin_b;
     uint8_t state;
     int8_t quarter;
+    bool qdec; // Decoded by the QDEC peripheral instead of GPIOTE interrupts.
     mp_int_t position;
 } rotaryio_incrementalencoder_obj_t;
 
 
 void incrementalencoder_interrupt_handler(uint8_t channel);
+void rotaryio_reset(void);
 
 #endif // MICROPY_INCLUDED_NRF_COMMON_HAL_ROTARYIO_INCREMENTALENCODER_H
@@ -37,3 +37,5 @@
 
 /*BOOTLOADER_SETTINGS_START_ADDR=*/                 BOOTLOADER_SETTINGS_START_ADDR;
 /*BOOTLOADER_SETTINGS_SIZE=*/                       BOOTLOADER_SETTINGS_SIZE;
+
+/*QSPI_XIP_SIZE=*/                                  QSPI_XIP_SIZE;
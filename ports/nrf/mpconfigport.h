@@ -39,6 +39,9 @@
 #define FLASH_SIZE                  (0x100000)  // 1MiB
 #endif
 
+// Cortex-M4: a cycle to count down and at least one more for the taken branch.
+#define BITBANGIO_SPIN_CYCLES                    (2)
+
 #define MICROPY_PY_COLLECTIONS_ORDEREDDICT       (1)
 #define MICROPY_PY_FUNCTION_ATTRS                (1)
 #define MICROPY_PY_IO                            (1)
@@ -151,10 +154,38 @@
 #error No space left in flash for firmware after specifying other regions!
 #endif
 
+// QSPI flash layout
+//
+// - XIP partition (optional), memory mapped at QSPI_XIP_START_ADDR. It holds the bytecode and
+//   constants of frozen modules instead of the firmware region above.
+// - CIRCUITPY flash filesystem
+
+#ifndef QSPI_XIP_SIZE
+#define QSPI_XIP_SIZE (0)
+#endif
+
+#if QSPI_XIP_SIZE > 0
+#if !QSPI_FLASH_FILESYSTEM
+#error QSPI_XIP_SIZE needs QSPI_FLASH_FILESYSTEM.
+#endif
+#if QSPI_XIP_SIZE % 4096 != 0
+#error QSPI_XIP_SIZE must be a multiple of the 4kiB flash sector size.
+#endif
+#define QSPI_XIP_START_ADDR (0x12000000)
+#define EXTERNAL_FLASH_RESERVED_SIZE QSPI_XIP_SIZE
+#define MICROPY_MODULE_FROZEN_MPY_ATTR __attribute__((section(".qspi_xip")))
+#define MICROPY_MODULE_FROZEN_MPY_AVAILABLE() qspi_xip_available()
+extern bool qspi_xip_available(void);
+#endif
+
 
 #define MICROPY_PORT_ROOT_POINTERS \
     CIRCUITPY_COMMON_ROOT_POINTERS \
     ble_drv_evt_handler_entry_t* ble_drv_evt_handler_entries; \
+    mp_obj_t recording_pdmin; \
+    mp_obj_t portouts; \
+    mp_obj_t pwmsequences; \
+    void* neopixel_pattern; \
 
 
 #endif  // NRF5_MPCONFIGPORT_H__
@@ -40,16 +40,40 @@ ifndef CIRCUITPY_AUDIOBUSIO
 CIRCUITPY_AUDIOBUSIO = 1
 endif
 
+# Bytes at the start of the QSPI flash to memory map for frozen modules, in place of the
+# firmware region of internal flash. Needs QSPI_FLASH_FILESYSTEM. The partition is written from
+# firmware.qspi.hex with a debugger and changing its size reformats CIRCUITPY.
+ifndef QSPI_XIP_SIZE
+QSPI_XIP_SIZE = 0
+endif
+CFLAGS += -DQSPI_XIP_SIZE=$(QSPI_XIP_SIZE)
+
 # No I2CSlave implementation
 CIRCUITPY_I2CSLAVE = 0
 
+# light_sleep_until_alarms with an RTC1 wake timer and GPIO SENSE pin wakes
+ifndef CIRCUITPY_ALARM
+CIRCUITPY_ALARM = 1
+endif
+
 # enable RTC
 ifndef CIRCUITPY_RTC
 CIRCUITPY_RTC = 1
 endif
 
-# frequencyio not yet implemented
-CIRCUITPY_FREQUENCYIO = 0
+# PortOut drives up to four pins from one PWM's sequence
+ifndef CIRCUITPY_PULSEIO_PORTOUT
+CIRCUITPY_PULSEIO_PORTOUT = $(CIRCUITPY_PULSEIO)
+endif
+
+# PWMSequence plays duty cycle frames on up to four pins from one PWM's sequence
+ifndef CIRCUITPY_PULSEIO_PWMSEQUENCE
+CIRCUITPY_PULSEIO_PWMSEQUENCE = $(CIRCUITPY_PULSEIO)
+endif
+
+ifndef CIRCUITPY_KEYPAD
+CIRCUITPY_KEYPAD = 1
+endif
 
 # nRF52840-specific
 
@@ -119,4 +119,7 @@
 // NVM controller
 #define NRFX_NVMC_ENABLED 1
 
+// Programmable peripheral interconnect. PulseIn uses it to timestamp edges.
+#define NRFX_PPI_ENABLED 1
+
 #endif // NRFX_CONFIG_H__
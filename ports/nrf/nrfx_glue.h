@@ -220,13 +220,15 @@ static inline bool _NRFX_IRQ_IS_PENDING(IRQn_Type irq_number)
 
 /**
  * @brief Bitmask defining PPI channels reserved to be used outside of nrfx.
+ *        The SoftDevice keeps channels 17 to 31 for itself.
  */
-#define NRFX_PPI_CHANNELS_USED  NRF_PPI_CHANNELS_USED
+#define NRFX_PPI_CHANNELS_USED  0xfffe0000
 
 /**
  * @brief Bitmask defining PPI groups reserved to be used outside of nrfx.
+ *        The SoftDevice keeps groups 4 and 5 for itself.
  */
-#define NRFX_PPI_GROUPS_USED    NRF_PPI_GROUPS_USED
+#define NRFX_PPI_GROUPS_USED    0x30
 
 /**
  * @brief Bitmask defining SWI instances reserved to be used outside of nrfx.
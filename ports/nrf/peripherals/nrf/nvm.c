@@ -44,10 +44,6 @@ STATIC bool sd_is_enabled(void) {
     return sd_en;
 }
 
-STATIC void sd_flash_operation_start(void) {
-    sd_flash_operation_status = SD_FLASH_OPERATION_IN_PROGRESS;
-}
-
 STATIC sd_flash_operation_status_t sd_flash_operation_wait_until_done(void) {
     // If the SD is not enabled, no events are generated, so just return immediately.
     if (sd_is_enabled()) {
@@ -61,6 +57,12 @@ STATIC sd_flash_operation_status_t sd_flash_operation_wait_until_done(void) {
 
 }
 
+STATIC void sd_flash_operation_start(void) {
+    // Let a write started in the background, such as one to the bonding area, finish first.
+    sd_flash_operation_wait_until_done();
+    sd_flash_operation_status = SD_FLASH_OPERATION_IN_PROGRESS;
+}
+
 bool sd_flash_page_erase_sync(uint32_t page_number) {
     sd_flash_operation_start();
     if (sd_flash_page_erase(page_number) != NRF_SUCCESS) {
@@ -87,6 +87,15 @@ mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block, uint32_t n
     return 0; // success
 }
 
+const uint8_t *supervisor_flash_get_mapped_blocks(uint32_t block_num, uint32_t num_blocks) {
+    if (block_num + num_blocks > supervisor_flash_get_block_count()) {
+        return NULL;
+    }
+    // The page cache may hold newer data than the flash.
+    supervisor_flash_flush();
+    return (const uint8_t *) lba2addr(block_num);
+}
+
 mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t lba, uint32_t num_blocks) {
     while (num_blocks) {
         uint32_t const addr      = lba2addr(lba);
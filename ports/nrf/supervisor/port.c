@@ -30,6 +30,8 @@
 
 #include "nrfx/hal/nrf_power.h"
 #include "nrfx/drivers/include/nrfx_power.h"
+#include "nrf_sdm.h"
+#include "nrf_soc.h"
 
 #include "nrf/cache.h"
 #include "nrf/clocks.h"
@@ -43,9 +45,13 @@
 #include "common-hal/busio/I2C.h"
 #include "common-hal/busio/SPI.h"
 #include "common-hal/busio/UART.h"
+#include "common-hal/neopixel_write/__init__.h"
+#include "common-hal/pulseio/PortOut.h"
+#include "common-hal/pulseio/PWMSequence.h"
 #include "common-hal/pulseio/PWMOut.h"
 #include "common-hal/pulseio/PulseOut.h"
 #include "common-hal/pulseio/PulseIn.h"
+#include "common-hal/rotaryio/IncrementalEncoder.h"
 #include "common-hal/rtc/RTC.h"
 #include "tick.h"
 
@@ -53,6 +59,7 @@
 
 #ifdef CIRCUITPY_AUDIOBUSIO
 #include "common-hal/audiobusio/I2SOut.h"
+#include "common-hal/audiobusio/PDMIn.h"
 #endif
 
 #ifdef CIRCUITPY_AUDIOPWMIO
@@ -107,8 +114,13 @@ void reset_port(void) {
     spi_reset();
     uart_reset();
 
+#if CIRCUITPY_NEOPIXEL_WRITE
+    neopixel_write_reset();
+#endif
+
 #if CIRCUITPY_AUDIOBUSIO
     i2s_reset();
+    pdmin_reset_recording();
 #endif
 
 #if CIRCUITPY_AUDIOPWMIO
@@ -117,6 +129,12 @@ void reset_port(void) {
 
 
 #if CIRCUITPY_PULSEIO
+#if CIRCUITPY_PULSEIO_PORTOUT
+    portout_reset();
+#endif
+#if CIRCUITPY_PULSEIO_PWMSEQUENCE
+    pwmsequence_reset();
+#endif
     pwmout_reset();
     pulseout_reset();
     pulsein_reset();
@@ -124,6 +142,10 @@ void reset_port(void) {
 
     timers_reset();
 
+#if CIRCUITPY_ROTARYIO
+    rotaryio_reset();
+#endif
+
 #if CIRCUITPY_RTC
     rtc_reset();
 #endif
@@ -164,6 +186,17 @@ uint32_t port_get_saved_word(void) {
     return _ebss;
 }
 
+void port_sleep_until_interrupt(void) {
+    // The SoftDevice must do the waiting when it is enabled.
+    uint8_t sd_enabled = 0;
+    (void) sd_softdevice_is_enabled(&sd_enabled);
+    if (sd_enabled) {
+        sd_app_evt_wait();
+    } else {
+        __WFI();
+    }
+}
+
 void HardFault_Handler(void) {
     reset_into_safe_mode(HARD_CRASH);
     while (true) {
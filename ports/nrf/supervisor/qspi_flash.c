@@ -38,6 +38,38 @@
 #include "supervisor/shared/external_flash/common_commands.h"
 #include "supervisor/shared/external_flash/qspi_flash.h"
 
+#if QSPI_XIP_SIZE > 0
+// Frozen modules in the XIP partition refer to this firmware's qstrs and objects so they're only
+// used when the partition holds the same build id as the firmware. The Makefile rebuilds this
+// file whenever the frozen modules change.
+#define QSPI_XIP_BUILD_ID __DATE__ " " __TIME__
+__attribute__((section(".qspi_xip_build_id"), used))
+static const char xip_build_id[] = QSPI_XIP_BUILD_ID;
+static const char firmware_build_id[] = QSPI_XIP_BUILD_ID;
+
+static bool xip_ready = false;
+
+bool qspi_xip_available(void) {
+    if (!xip_ready) {
+        return false;
+    }
+    // Read the partition's copy through volatile so it isn't folded into the firmware's.
+    const volatile char* partition = xip_build_id;
+    for (size_t i = 0; i < sizeof(firmware_build_id); i++) {
+        if (partition[i] != firmware_build_id[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Code may read the XIP partition as soon as we return so wait until the flash is done.
+static void wait_for_xip(void) {
+    while (nrfx_qspi_mem_busy_check() == NRFX_ERROR_BUSY) {
+    }
+}
+#endif
+
 bool spi_flash_command(uint8_t command) {
     nrf_qspi_cinstr_conf_t cinstr_cfg = {
         .opcode = command,
@@ -79,11 +111,19 @@ bool spi_flash_sector_command(uint8_t command, uint32_t address) {
     if (command != CMD_SECTOR_ERASE) {
         return false;
     }
-    return nrfx_qspi_erase(NRF_QSPI_ERASE_LEN_4KB, address) == NRFX_SUCCESS;
+    bool ok = nrfx_qspi_erase(NRF_QSPI_ERASE_LEN_4KB, address) == NRFX_SUCCESS;
+    #if QSPI_XIP_SIZE > 0
+    wait_for_xip();
+    #endif
+    return ok;
 }
 
 bool spi_flash_write_data(uint32_t address, uint8_t* data, uint32_t length) {
-    return nrfx_qspi_write(data, length, address) == NRFX_SUCCESS;
+    bool ok = nrfx_qspi_write(data, length, address) == NRFX_SUCCESS;
+    #if QSPI_XIP_SIZE > 0
+    wait_for_xip();
+    #endif
+    return ok;
 }
 
 bool spi_flash_read_data(uint32_t address, uint8_t* data, uint32_t length) {
@@ -154,4 +194,8 @@ void spi_flash_init_device(const external_flash_device* device) {
     }
     NRF_QSPI->IFCONFIG1 &= ~QSPI_IFCONFIG1_SCKFREQ_Msk;
     NRF_QSPI->IFCONFIG1 |=  sckfreq << QSPI_IFCONFIG1_SCKFREQ_Pos;
+
+    #if QSPI_XIP_SIZE > 0
+    xip_ready = true;
+    #endif
 }
@@ -26,6 +26,8 @@
 
 #include "tick.h"
 
+#include "py/mphal.h"
+
 #include "supervisor/shared/tick.h"
 #include "shared-module/gamepad/__init__.h"
 #include "shared-bindings/microcontroller/Processor.h"
@@ -39,6 +41,10 @@ void SysTick_Handler(void) {
 void tick_init() {
     uint32_t ticks_per_ms = common_hal_mcu_processor_get_frequency() / 1000;
     SysTick_Config(ticks_per_ms); // interrupt is enabled
+
+    // Start the cycle counter for mp_hal_ticks_cpu(). Code timing with it must not reset it.
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
 }
 
 void tick_delay(uint32_t us) {
@@ -65,3 +71,21 @@ void wait_until(uint64_t ms, uint32_t us_until_ms) {
     uint32_t ticks_per_us = common_hal_mcu_processor_get_frequency() / 1000 / 1000;
     while(supervisor_ticks_ms64() <= ms && SysTick->VAL / ticks_per_us >= us_until_ms) {}
 }
+
+// Microseconds from the supervisor tick and how far SysTick has counted down within it.
+mp_uint_t mp_hal_ticks_us(void) {
+    uint32_t ms;
+    uint32_t remaining;
+    // Read again if the tick interrupt ran in between.
+    do {
+        ms = supervisor_ticks_ms32();
+        remaining = SysTick->VAL;
+    } while (ms != supervisor_ticks_ms32());
+    uint32_t period = SysTick->LOAD + 1;
+    return ms * 1000 + (period - 1 - remaining) * 1000 / period;
+}
+
+// CPU cycles from the DWT cycle counter started in tick_init().
+mp_uint_t mp_hal_ticks_cpu(void) {
+    return DWT->CYCCNT;
+}
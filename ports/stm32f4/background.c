@@ -24,9 +24,11 @@
  * THE SOFTWARE.
  */
 
+#include "py/gc.h"
 #include "py/runtime.h"
 #include "supervisor/filesystem.h"
 #include "supervisor/usb.h"
+#include "supervisor/shared/background_task.h"
 #include "supervisor/shared/stack.h"
 
 #if CIRCUITPY_DISPLAYIO
@@ -35,6 +37,19 @@
 
 static bool running_background_tasks = false;
 
+STATIC background_task_t background_tasks[] = {
+    #if USB_AVAILABLE
+    BACKGROUND_TASK(usb_background, BACKGROUND_TASK_PRIORITY_HIGH, 0),
+    #endif
+    BACKGROUND_TASK(filesystem_background, BACKGROUND_TASK_PRIORITY_NORMAL, 0),
+    #if CIRCUITPY_DISPLAYIO
+    BACKGROUND_TASK(displayio_background, BACKGROUND_TASK_PRIORITY_LOW, 5),
+    #endif
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    BACKGROUND_TASK(gc_sweep_background, BACKGROUND_TASK_PRIORITY_LOW, 2),
+    #endif
+};
+
 void background_tasks_reset(void) {
     running_background_tasks = false;
 }
@@ -45,15 +60,8 @@ void run_background_tasks(void) {
         return;
     }
     running_background_tasks = true;
-    filesystem_background();
-
-    #if USB_AVAILABLE
-    usb_background();
-    #endif
-
-    #if CIRCUITPY_DISPLAYIO
-    displayio_background();
-    #endif
+    background_task_register_all(background_tasks, MP_ARRAY_SIZE(background_tasks));
+    background_task_run_all();
     running_background_tasks = false;
 
     assert_heap_ok();
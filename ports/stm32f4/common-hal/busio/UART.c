@@ -242,7 +242,8 @@ void common_hal_busio_uart_deinit(busio_uart_obj_t *self) {
     self->rx = mp_const_none;
     gc_free(self->rbuf.buf);
     self->rbuf.size = 0;
-    self->rbuf.iput = self->rbuf.iget = 0;
+    self->rbuf.iput = 0;
+    self->rbuf.get_state = 0;
 }
 
 size_t common_hal_busio_uart_read(busio_uart_obj_t *self, uint8_t *data, size_t len, int *errcode) {
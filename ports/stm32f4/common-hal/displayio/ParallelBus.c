@@ -63,6 +63,10 @@ void common_hal_displayio_parallelbus_send(mp_obj_t obj, display_byte_type_t byt
 
 }
 
+void common_hal_displayio_parallelbus_send_async(mp_obj_t obj, display_byte_type_t byte_type, display_chip_select_behavior_t chip_select, uint8_t *data, uint32_t data_length) {
+    common_hal_displayio_parallelbus_send(obj, byte_type, chip_select, data, data_length);
+}
+
 void common_hal_displayio_parallelbus_end_transaction(mp_obj_t obj) {
 
 }
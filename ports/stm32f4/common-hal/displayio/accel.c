@@ -0,0 +1,122 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shared-module/displayio/display_core.h"
+
+#include <stdint.h>
+
+#include "stm32f4xx_hal.h"
+
+// Only the F427/429/437/439/469/479 have the Chrom-ART accelerator. Everything else keeps the
+// weak software defaults.
+#if defined(DMA2D)
+
+// Below this the register setup costs more than the CPU loop it replaces.
+#define DMA2D_MIN_PIXELS (64)
+
+#define DMA2D_MODE_M2M (0)
+#define DMA2D_MODE_M2M_PFC (DMA2D_CR_MODE_0)
+#define DMA2D_MODE_R2M (DMA2D_CR_MODE_1 | DMA2D_CR_MODE_0)
+#define DMA2D_CM_RGB565 (0x2)
+#define DMA2D_CM_L8 (0x5)
+
+static uint32_t clut_argb8888[256];
+
+// The DMA2D is a bus master but isn't wired to the core coupled memory.
+static bool dma2d_reachable(const void* address) {
+    uint32_t a = (uint32_t) address;
+    return a < CCMDATARAM_BASE || a >= CCMDATARAM_BASE + 0x10000;
+}
+
+static bool dma2d_usable(uint16_t* dest, uint16_t width, uint16_t height) {
+    return (uint32_t) width * height >= DMA2D_MIN_PIXELS && dma2d_reachable(dest) &&
+           width <= (DMA2D_NLR_PL >> DMA2D_NLR_PL_Pos);
+}
+
+static bool dma2d_run(uint32_t mode, uint16_t* dest, uint16_t dest_stride, uint16_t width, uint16_t height) {
+    DMA2D->OPFCCR = DMA2D_CM_RGB565;
+    DMA2D->OMAR = (uint32_t) dest;
+    DMA2D->OOR = dest_stride - width;
+    DMA2D->NLR = (width << DMA2D_NLR_PL_Pos) | height;
+    DMA2D->IFCR = DMA2D_IFCR_CTCIF | DMA2D_IFCR_CTEIF | DMA2D_IFCR_CCEIF;
+    DMA2D->CR = mode | DMA2D_CR_START;
+    while ((DMA2D->CR & DMA2D_CR_START) != 0) {
+    }
+    return (DMA2D->ISR & (DMA2D_ISR_TEIF | DMA2D_ISR_CEIF)) == 0;
+}
+
+static void dma2d_enable(void) {
+    if ((RCC->AHB1ENR & RCC_AHB1ENR_DMA2DEN) == 0) {
+        __HAL_RCC_DMA2D_CLK_ENABLE();
+    }
+}
+
+bool displayio_display_core_accel_fill(uint16_t* dest, uint16_t dest_stride, uint16_t width, uint16_t height,
+                                       uint16_t color) {
+    if (!dma2d_usable(dest, width, height)) {
+        return false;
+    }
+    dma2d_enable();
+    // In RGB565 output mode the register color is written out as is, so no byte order fixup.
+    DMA2D->OCOLR = color;
+    return dma2d_run(DMA2D_MODE_R2M, dest, dest_stride, width, height);
+}
+
+bool displayio_display_core_accel_copy(uint16_t* dest, uint16_t dest_stride, const void* source,
+                                       uint16_t source_stride, uint8_t source_depth,
+                                       uint16_t width, uint16_t height, const _displayio_color_t* clut) {
+    if (!dma2d_usable(dest, width, height) || !dma2d_reachable(source)) {
+        return false;
+    }
+    dma2d_enable();
+    DMA2D->FGMAR = (uint32_t) source;
+    DMA2D->FGOR = source_stride - width;
+    if (clut == NULL) {
+        if (source_depth != 16) {
+            return false;
+        }
+        DMA2D->FGPFCCR = DMA2D_CM_RGB565;
+        return dma2d_run(DMA2D_MODE_M2M, dest, dest_stride, width, height);
+    }
+    if (source_depth != 8) {
+        return false;
+    }
+    // Our colors are byte swapped RGB565, which this DMA2D can't output. Instead each entry is
+    // split into the ARGB8888 components that truncate back to exactly the wanted 16 bits.
+    for (uint32_t i = 0; i < MP_ARRAY_SIZE(clut_argb8888); i++) {
+        uint16_t c = clut[i].rgb565;
+        clut_argb8888[i] = 0xff000000 | ((c >> 11) & 0x1f) << 19 | ((c >> 5) & 0x3f) << 10 | (c & 0x1f) << 3;
+    }
+    DMA2D->FGCMAR = (uint32_t) clut_argb8888;
+    DMA2D->FGPFCCR = DMA2D_CM_L8 | ((MP_ARRAY_SIZE(clut_argb8888) - 1) << DMA2D_FGPFCCR_CS_Pos) |
+                     DMA2D_FGPFCCR_START;
+    while ((DMA2D->FGPFCCR & DMA2D_FGPFCCR_START) != 0) {
+    }
+    return dma2d_run(DMA2D_MODE_M2M_PFC, dest, dest_stride, width, height);
+}
+
+#endif
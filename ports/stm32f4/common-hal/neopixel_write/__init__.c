@@ -70,7 +70,6 @@ void common_hal_neopixel_write (const digitalio_digitalinout_obj_t* digitalinout
     // Enable DWT in debug core. Useable when interrupts disabled, as opposed to Systick->VAL
     CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
     DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
-    DWT->CYCCNT = 0;
 
     for(;;) {
         cyc = (pix & mask) ? t1 : t0;
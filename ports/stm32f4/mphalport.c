@@ -31,6 +31,7 @@
 #include "py/mpstate.h"
 #include "py/gc.h"
 
+#include "supervisor/port.h"
 #include "supervisor/shared/tick.h"
 
 /*------------------------------------------------------------------*/
@@ -49,6 +50,8 @@ void mp_hal_delay_ms(mp_uint_t delay) {
             break;
         }
         duration = (supervisor_ticks_ms64() - start_tick);
-        // TODO(tannewt): Go to sleep for a little while while we wait.
+        if (duration < delay) {
+            port_sleep_until_interrupt();
+        }
     }
 }
@@ -202,3 +202,7 @@ mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t block_num,
 void supervisor_flash_release_cache(void) {
 }
 
+const uint8_t *supervisor_flash_get_mapped_blocks(uint32_t block_num, uint32_t num_blocks) {
+    return NULL;
+}
+
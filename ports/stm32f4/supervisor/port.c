@@ -79,6 +79,30 @@ uint32_t *port_stack_get_top(void) {
     return &_estack;
 }
 
+// Parts with core coupled memory put the stack there, which leaves all of the main RAM to the
+// heap and DMA buffers.
+#ifdef CCMDATARAM_BASE
+extern uint32_t _ccmram_start;
+extern uint32_t _ccmram_end;
+extern uint32_t _ram_end;
+
+uint32_t *port_heap_get_bottom(void) {
+    return &_ebss;
+}
+
+uint32_t *port_heap_get_top(void) {
+    return &_ram_end;
+}
+
+uint32_t *port_fast_memory_get_start(void) {
+    return &_ccmram_start;
+}
+
+uint32_t *port_fast_memory_get_end(void) {
+    return &_ccmram_end;
+}
+#endif
+
 extern uint32_t _ebss;
 // Place the word to save just after our BSS section that gets blanked.
 void port_set_saved_word(uint32_t value) {
@@ -89,6 +113,10 @@ uint32_t port_get_saved_word(void) {
     return _ebss;
 }
 
+void port_sleep_until_interrupt(void) {
+    __WFI();
+}
+
 void HardFault_Handler(void) {
     reset_into_safe_mode(HARD_CRASH);
     while (true) {
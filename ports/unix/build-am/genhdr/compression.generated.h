@@ -0,0 +1,2 @@
+const uint8_t lengths[] = { 0, 0, 0, 9, 7, 6, 7, 7, 12, 14, 5, 10, 8, 0 };
+const uint8_t values[] = { 32, 97, 101, 105, 110, 111, 114, 115, 116, 95, 99, 100, 108, 109, 112, 117, 39, 98, 102, 103, 104, 121, 37, 69, 107, 113, 118, 119, 120, 65, 73, 78, 79, 83, 84, 106, 40, 41, 45, 48, 50, 66, 67, 68, 70, 76, 82, 85, 42, 44, 46, 47, 49, 51, 54, 58, 60, 62, 71, 77, 80, 122, 52, 56, 75, 86, 87, 10, 13, 34, 35, 53, 61, 72, 88, 89, 123, 55, 57, 59, 74, 90, 91, 93, 125 };
@@ -0,0 +1,643 @@
+// This file was automatically generated by makeqstrdata.py
+
+QENUM(MP_QSTR_NULL)
+QENUM(MP_QSTR_)
+QENUM(MP_QSTR___dir__)
+QENUM(MP_QSTR___abs__)
+QENUM(MP_QSTR___add__)
+QENUM(MP_QSTR___aenter__)
+QENUM(MP_QSTR___aexit__)
+QENUM(MP_QSTR___aiter__)
+QENUM(MP_QSTR___and__)
+QENUM(MP_QSTR___anext__)
+QENUM(MP_QSTR___bool__)
+QENUM(MP_QSTR___build_class__)
+QENUM(MP_QSTR___bytes__)
+QENUM(MP_QSTR___call__)
+QENUM(MP_QSTR___class__)
+QENUM(MP_QSTR___contains__)
+QENUM(MP_QSTR___del__)
+QENUM(MP_QSTR___delete__)
+QENUM(MP_QSTR___delitem__)
+QENUM(MP_QSTR___dict__)
+QENUM(MP_QSTR___divmod__)
+QENUM(MP_QSTR___enter__)
+QENUM(MP_QSTR___eq__)
+QENUM(MP_QSTR___exit__)
+QENUM(MP_QSTR___file__)
+QENUM(MP_QSTR___floordiv__)
+QENUM(MP_QSTR___func__)
+QENUM(MP_QSTR___ge__)
+QENUM(MP_QSTR___get__)
+QENUM(MP_QSTR___getattr__)
+QENUM(MP_QSTR___getitem__)
+QENUM(MP_QSTR___gt__)
+QENUM(MP_QSTR___hash__)
+QENUM(MP_QSTR___iadd__)
+QENUM(MP_QSTR___import__)
+QENUM(MP_QSTR___init__)
+QENUM(MP_QSTR___invert__)
+QENUM(MP_QSTR___isub__)
+QENUM(MP_QSTR___iter__)
+QENUM(MP_QSTR___le__)
+QENUM(MP_QSTR___len__)
+QENUM(MP_QSTR___lshift__)
+QENUM(MP_QSTR___lt__)
+QENUM(MP_QSTR___main__)
+QENUM(MP_QSTR___mod__)
+QENUM(MP_QSTR___module__)
+QENUM(MP_QSTR___mul__)
+QENUM(MP_QSTR___name__)
+QENUM(MP_QSTR___neg__)
+QENUM(MP_QSTR___new__)
+QENUM(MP_QSTR___next__)
+QENUM(MP_QSTR___or__)
+QENUM(MP_QSTR___path__)
+QENUM(MP_QSTR___pos__)
+QENUM(MP_QSTR___pow__)
+QENUM(MP_QSTR___qualname__)
+QENUM(MP_QSTR___radd__)
+QENUM(MP_QSTR___rand__)
+QENUM(MP_QSTR___repl_print__)
+QENUM(MP_QSTR___repr__)
+QENUM(MP_QSTR___reversed__)
+QENUM(MP_QSTR___rfloordiv__)
+QENUM(MP_QSTR___rlshift__)
+QENUM(MP_QSTR___rmod__)
+QENUM(MP_QSTR___rmul__)
+QENUM(MP_QSTR___ror__)
+QENUM(MP_QSTR___rpow__)
+QENUM(MP_QSTR___rrshift__)
+QENUM(MP_QSTR___rshift__)
+QENUM(MP_QSTR___rsub__)
+QENUM(MP_QSTR___rtruediv__)
+QENUM(MP_QSTR___rxor__)
+QENUM(MP_QSTR___set__)
+QENUM(MP_QSTR___setitem__)
+QENUM(MP_QSTR___slots__)
+QENUM(MP_QSTR___str__)
+QENUM(MP_QSTR___sub__)
+QENUM(MP_QSTR___traceback__)
+QENUM(MP_QSTR___truediv__)
+QENUM(MP_QSTR___xor__)
+QENUM(MP_QSTR__star_)
+QENUM(MP_QSTR__)
+QENUM(MP_QSTR__slash_)
+QENUM(MP_QSTR__percent__hash_o)
+QENUM(MP_QSTR__percent__hash_x)
+QENUM(MP_QSTR__brace_open__colon__hash_b_brace_close_)
+QENUM(MP_QSTR__space_)
+QENUM(MP_QSTR__0x0a_)
+QENUM(MP_QSTR_maximum_space_recursion_space_depth_space_exceeded)
+QENUM(MP_QSTR__lt_module_gt_)
+QENUM(MP_QSTR__lt_lambda_gt_)
+QENUM(MP_QSTR__lt_listcomp_gt_)
+QENUM(MP_QSTR__lt_dictcomp_gt_)
+QENUM(MP_QSTR__lt_setcomp_gt_)
+QENUM(MP_QSTR__lt_genexpr_gt_)
+QENUM(MP_QSTR__lt_string_gt_)
+QENUM(MP_QSTR__lt_stdin_gt_)
+QENUM(MP_QSTR_utf_hyphen_8)
+QENUM(MP_QSTR__dot_frozen)
+QENUM(MP_QSTR_AF_INET)
+QENUM(MP_QSTR_AF_INET6)
+QENUM(MP_QSTR_AF_UNIX)
+QENUM(MP_QSTR_ARRAY)
+QENUM(MP_QSTR_ArithmeticError)
+QENUM(MP_QSTR_AssertionError)
+QENUM(MP_QSTR_AttributeError)
+QENUM(MP_QSTR_B115200)
+QENUM(MP_QSTR_B57600)
+QENUM(MP_QSTR_B9600)
+QENUM(MP_QSTR_BFINT16)
+QENUM(MP_QSTR_BFINT32)
+QENUM(MP_QSTR_BFINT8)
+QENUM(MP_QSTR_BFUINT16)
+QENUM(MP_QSTR_BFUINT32)
+QENUM(MP_QSTR_BFUINT8)
+QENUM(MP_QSTR_BF_LEN)
+QENUM(MP_QSTR_BF_POS)
+QENUM(MP_QSTR_BIG_ENDIAN)
+QENUM(MP_QSTR_BaseException)
+QENUM(MP_QSTR_BytesIO)
+QENUM(MP_QSTR_DEBUG)
+QENUM(MP_QSTR_EACCES)
+QENUM(MP_QSTR_EADDRINUSE)
+QENUM(MP_QSTR_EAGAIN)
+QENUM(MP_QSTR_EALREADY)
+QENUM(MP_QSTR_EBADF)
+QENUM(MP_QSTR_ECONNABORTED)
+QENUM(MP_QSTR_ECONNREFUSED)
+QENUM(MP_QSTR_ECONNRESET)
+QENUM(MP_QSTR_EEXIST)
+QENUM(MP_QSTR_EHOSTUNREACH)
+QENUM(MP_QSTR_EINPROGRESS)
+QENUM(MP_QSTR_EINVAL)
+QENUM(MP_QSTR_EIO)
+QENUM(MP_QSTR_EISDIR)
+QENUM(MP_QSTR_ENOBUFS)
+QENUM(MP_QSTR_ENODEV)
+QENUM(MP_QSTR_ENOENT)
+QENUM(MP_QSTR_ENOMEM)
+QENUM(MP_QSTR_ENOTCONN)
+QENUM(MP_QSTR_EOFError)
+QENUM(MP_QSTR_EOPNOTSUPP)
+QENUM(MP_QSTR_EPERM)
+QENUM(MP_QSTR_ETIMEDOUT)
+QENUM(MP_QSTR_Ellipsis)
+QENUM(MP_QSTR_Exception)
+QENUM(MP_QSTR_FLOAT32)
+QENUM(MP_QSTR_FLOAT64)
+QENUM(MP_QSTR_FileIO)
+QENUM(MP_QSTR_GeneratorExit)
+QENUM(MP_QSTR_INT16)
+QENUM(MP_QSTR_INT32)
+QENUM(MP_QSTR_INT64)
+QENUM(MP_QSTR_INT8)
+QENUM(MP_QSTR_IOBase)
+QENUM(MP_QSTR_ImportError)
+QENUM(MP_QSTR_IndentationError)
+QENUM(MP_QSTR_IndexError)
+QENUM(MP_QSTR_KeyError)
+QENUM(MP_QSTR_KeyboardInterrupt)
+QENUM(MP_QSTR_LITTLE_ENDIAN)
+QENUM(MP_QSTR_LockType)
+QENUM(MP_QSTR_LookupError)
+QENUM(MP_QSTR_MSG_DONTROUTE)
+QENUM(MP_QSTR_MSG_DONTWAIT)
+QENUM(MP_QSTR_MemoryError)
+QENUM(MP_QSTR_MpyError)
+QENUM(MP_QSTR_NATIVE)
+QENUM(MP_QSTR_NameError)
+QENUM(MP_QSTR_None)
+QENUM(MP_QSTR_NoneType)
+QENUM(MP_QSTR_NotImplemented)
+QENUM(MP_QSTR_NotImplementedError)
+QENUM(MP_QSTR_OSError)
+QENUM(MP_QSTR_OrderedDict)
+QENUM(MP_QSTR_OverflowError)
+QENUM(MP_QSTR_POLLERR)
+QENUM(MP_QSTR_POLLHUP)
+QENUM(MP_QSTR_POLLIN)
+QENUM(MP_QSTR_POLLOUT)
+QENUM(MP_QSTR_PTR)
+QENUM(MP_QSTR_PinBase)
+QENUM(MP_QSTR_ReloadException)
+QENUM(MP_QSTR_RuntimeError)
+QENUM(MP_QSTR_SOCK_DGRAM)
+QENUM(MP_QSTR_SOCK_RAW)
+QENUM(MP_QSTR_SOCK_STREAM)
+QENUM(MP_QSTR_SOL_SOCKET)
+QENUM(MP_QSTR_SO_BROADCAST)
+QENUM(MP_QSTR_SO_ERROR)
+QENUM(MP_QSTR_SO_KEEPALIVE)
+QENUM(MP_QSTR_SO_LINGER)
+QENUM(MP_QSTR_SO_REUSEADDR)
+QENUM(MP_QSTR_Signal)
+QENUM(MP_QSTR_StopAsyncIteration)
+QENUM(MP_QSTR_StopIteration)
+QENUM(MP_QSTR_StringIO)
+QENUM(MP_QSTR_SyntaxError)
+QENUM(MP_QSTR_SystemExit)
+QENUM(MP_QSTR_TCSANOW)
+QENUM(MP_QSTR_TextIOWrapper)
+QENUM(MP_QSTR_TimeoutError)
+QENUM(MP_QSTR_TypeError)
+QENUM(MP_QSTR_UINT16)
+QENUM(MP_QSTR_UINT32)
+QENUM(MP_QSTR_UINT64)
+QENUM(MP_QSTR_UINT8)
+QENUM(MP_QSTR_UnicodeError)
+QENUM(MP_QSTR_VOID)
+QENUM(MP_QSTR_ValueError)
+QENUM(MP_QSTR_ViperTypeError)
+QENUM(MP_QSTR_ZeroDivisionError)
+QENUM(MP_QSTR__thread)
+QENUM(MP_QSTR_a)
+QENUM(MP_QSTR_a2b_base64)
+QENUM(MP_QSTR_abs)
+QENUM(MP_QSTR_accept)
+QENUM(MP_QSTR_acos)
+QENUM(MP_QSTR_acosh)
+QENUM(MP_QSTR_acquire)
+QENUM(MP_QSTR_add)
+QENUM(MP_QSTR_addressof)
+QENUM(MP_QSTR_all)
+QENUM(MP_QSTR_alloc_profile)
+QENUM(MP_QSTR_alloc_samples)
+QENUM(MP_QSTR_allocate_lock)
+QENUM(MP_QSTR_any)
+QENUM(MP_QSTR_append)
+QENUM(MP_QSTR_arena)
+QENUM(MP_QSTR_args)
+QENUM(MP_QSTR_argv)
+QENUM(MP_QSTR_array)
+QENUM(MP_QSTR_arraymath)
+QENUM(MP_QSTR_asin)
+QENUM(MP_QSTR_asinh)
+QENUM(MP_QSTR_atan)
+QENUM(MP_QSTR_atan2)
+QENUM(MP_QSTR_atanh)
+QENUM(MP_QSTR_b)
+QENUM(MP_QSTR_b2a_base64)
+QENUM(MP_QSTR_bin)
+QENUM(MP_QSTR_binascii)
+QENUM(MP_QSTR_bind)
+QENUM(MP_QSTR_bool)
+QENUM(MP_QSTR_bound_method)
+QENUM(MP_QSTR_buffering)
+QENUM(MP_QSTR_builtins)
+QENUM(MP_QSTR_bytearray)
+QENUM(MP_QSTR_bytearray_at)
+QENUM(MP_QSTR_bytecode)
+QENUM(MP_QSTR_byteorder)
+QENUM(MP_QSTR_bytes)
+QENUM(MP_QSTR_bytes_at)
+QENUM(MP_QSTR_calcsize)
+QENUM(MP_QSTR_callable)
+QENUM(MP_QSTR_ceil)
+QENUM(MP_QSTR_center)
+QENUM(MP_QSTR_chr)
+QENUM(MP_QSTR_circuitpython)
+QENUM(MP_QSTR_classmethod)
+QENUM(MP_QSTR_clear)
+QENUM(MP_QSTR_clock)
+QENUM(MP_QSTR_close)
+QENUM(MP_QSTR_closure)
+QENUM(MP_QSTR_cmath)
+QENUM(MP_QSTR_co_argcount)
+QENUM(MP_QSTR_co_cellvars)
+QENUM(MP_QSTR_co_code)
+QENUM(MP_QSTR_co_consts)
+QENUM(MP_QSTR_co_filename)
+QENUM(MP_QSTR_co_firstlineno)
+QENUM(MP_QSTR_co_flags)
+QENUM(MP_QSTR_co_freevars)
+QENUM(MP_QSTR_co_kwonlyargcount)
+QENUM(MP_QSTR_co_lnotab)
+QENUM(MP_QSTR_co_name)
+QENUM(MP_QSTR_co_names)
+QENUM(MP_QSTR_co_nlocals)
+QENUM(MP_QSTR_co_stacksize)
+QENUM(MP_QSTR_co_varnames)
+QENUM(MP_QSTR_code)
+QENUM(MP_QSTR_collect)
+QENUM(MP_QSTR_collections)
+QENUM(MP_QSTR_compile)
+QENUM(MP_QSTR_complex)
+QENUM(MP_QSTR_connect)
+QENUM(MP_QSTR_const)
+QENUM(MP_QSTR_copy)
+QENUM(MP_QSTR_copysign)
+QENUM(MP_QSTR_cos)
+QENUM(MP_QSTR_cosh)
+QENUM(MP_QSTR_count)
+QENUM(MP_QSTR_decode)
+QENUM(MP_QSTR_default)
+QENUM(MP_QSTR_degrees)
+QENUM(MP_QSTR_delattr)
+QENUM(MP_QSTR_deleter)
+QENUM(MP_QSTR_deque)
+QENUM(MP_QSTR_dict)
+QENUM(MP_QSTR_dict_view)
+QENUM(MP_QSTR_difference)
+QENUM(MP_QSTR_difference_update)
+QENUM(MP_QSTR_digest)
+QENUM(MP_QSTR_dir)
+QENUM(MP_QSTR_disable)
+QENUM(MP_QSTR_discard)
+QENUM(MP_QSTR_divmod)
+QENUM(MP_QSTR_doc)
+QENUM(MP_QSTR_dot)
+QENUM(MP_QSTR_dump)
+QENUM(MP_QSTR_dumps)
+QENUM(MP_QSTR_e)
+QENUM(MP_QSTR_enable)
+QENUM(MP_QSTR_encode)
+QENUM(MP_QSTR_encoding)
+QENUM(MP_QSTR_end)
+QENUM(MP_QSTR_endswith)
+QENUM(MP_QSTR_enumerate)
+QENUM(MP_QSTR_erf)
+QENUM(MP_QSTR_erfc)
+QENUM(MP_QSTR_errno)
+QENUM(MP_QSTR_errorcode)
+QENUM(MP_QSTR_eval)
+QENUM(MP_QSTR_exc_info)
+QENUM(MP_QSTR_exec)
+QENUM(MP_QSTR_exit)
+QENUM(MP_QSTR_exp)
+QENUM(MP_QSTR_expm1)
+QENUM(MP_QSTR_extend)
+QENUM(MP_QSTR_f_back)
+QENUM(MP_QSTR_f_builtins)
+QENUM(MP_QSTR_f_code)
+QENUM(MP_QSTR_f_globals)
+QENUM(MP_QSTR_f_lasti)
+QENUM(MP_QSTR_f_lineno)
+QENUM(MP_QSTR_f_locals)
+QENUM(MP_QSTR_f_trace)
+QENUM(MP_QSTR_fabs)
+QENUM(MP_QSTR_factor)
+QENUM(MP_QSTR_fft)
+QENUM(MP_QSTR_file)
+QENUM(MP_QSTR_filename)
+QENUM(MP_QSTR_filename2)
+QENUM(MP_QSTR_fileno)
+QENUM(MP_QSTR_filter)
+QENUM(MP_QSTR_find)
+QENUM(MP_QSTR_float)
+QENUM(MP_QSTR_floor)
+QENUM(MP_QSTR_flush)
+QENUM(MP_QSTR_fmod)
+QENUM(MP_QSTR_format)
+QENUM(MP_QSTR_frame)
+QENUM(MP_QSTR_frexp)
+QENUM(MP_QSTR_from_bytes)
+QENUM(MP_QSTR_fromkeys)
+QENUM(MP_QSTR_frozenset)
+QENUM(MP_QSTR_function)
+QENUM(MP_QSTR_gamma)
+QENUM(MP_QSTR_gc)
+QENUM(MP_QSTR_generator)
+QENUM(MP_QSTR_get)
+QENUM(MP_QSTR_get_ident)
+QENUM(MP_QSTR_getaddrinfo)
+QENUM(MP_QSTR_getattr)
+QENUM(MP_QSTR_getenv)
+QENUM(MP_QSTR_getrandbits)
+QENUM(MP_QSTR_getter)
+QENUM(MP_QSTR_getvalue)
+QENUM(MP_QSTR_globals)
+QENUM(MP_QSTR_group)
+QENUM(MP_QSTR_hasattr)
+QENUM(MP_QSTR_hash)
+QENUM(MP_QSTR_hashlib)
+QENUM(MP_QSTR_heap_lock)
+QENUM(MP_QSTR_heap_unlock)
+QENUM(MP_QSTR_heapify)
+QENUM(MP_QSTR_heappop)
+QENUM(MP_QSTR_heappush)
+QENUM(MP_QSTR_hex)
+QENUM(MP_QSTR_hexlify)
+QENUM(MP_QSTR_id)
+QENUM(MP_QSTR_ilistdir)
+QENUM(MP_QSTR_imag)
+QENUM(MP_QSTR_implementation)
+QENUM(MP_QSTR_index)
+QENUM(MP_QSTR_indices)
+QENUM(MP_QSTR_inet_ntop)
+QENUM(MP_QSTR_inet_pton)
+QENUM(MP_QSTR_input)
+QENUM(MP_QSTR_insert)
+QENUM(MP_QSTR_int)
+QENUM(MP_QSTR_intersection)
+QENUM(MP_QSTR_intersection_update)
+QENUM(MP_QSTR_inverse)
+QENUM(MP_QSTR_invert)
+QENUM(MP_QSTR_ioctl)
+QENUM(MP_QSTR_ipoll)
+QENUM(MP_QSTR_isalpha)
+QENUM(MP_QSTR_isdigit)
+QENUM(MP_QSTR_isdisjoint)
+QENUM(MP_QSTR_isenabled)
+QENUM(MP_QSTR_isfinite)
+QENUM(MP_QSTR_isinf)
+QENUM(MP_QSTR_isinstance)
+QENUM(MP_QSTR_islower)
+QENUM(MP_QSTR_isnan)
+QENUM(MP_QSTR_isspace)
+QENUM(MP_QSTR_issubclass)
+QENUM(MP_QSTR_issubset)
+QENUM(MP_QSTR_issuperset)
+QENUM(MP_QSTR_isupper)
+QENUM(MP_QSTR_items)
+QENUM(MP_QSTR_iter)
+QENUM(MP_QSTR_iterable)
+QENUM(MP_QSTR_iterator)
+QENUM(MP_QSTR_join)
+QENUM(MP_QSTR_kbd_intr)
+QENUM(MP_QSTR_keepends)
+QENUM(MP_QSTR_key)
+QENUM(MP_QSTR_keys)
+QENUM(MP_QSTR_ldexp)
+QENUM(MP_QSTR_len)
+QENUM(MP_QSTR_lgamma)
+QENUM(MP_QSTR_list)
+QENUM(MP_QSTR_listen)
+QENUM(MP_QSTR_little)
+QENUM(MP_QSTR_load)
+QENUM(MP_QSTR_loads)
+QENUM(MP_QSTR_locals)
+QENUM(MP_QSTR_localtime)
+QENUM(MP_QSTR_lock)
+QENUM(MP_QSTR_locked)
+QENUM(MP_QSTR_log)
+QENUM(MP_QSTR_log10)
+QENUM(MP_QSTR_log2)
+QENUM(MP_QSTR_lower)
+QENUM(MP_QSTR_lstrip)
+QENUM(MP_QSTR_makefile)
+QENUM(MP_QSTR_map)
+QENUM(MP_QSTR_match)
+QENUM(MP_QSTR_math)
+QENUM(MP_QSTR_max)
+QENUM(MP_QSTR_maxsize)
+QENUM(MP_QSTR_mem)
+QENUM(MP_QSTR_mem16)
+QENUM(MP_QSTR_mem32)
+QENUM(MP_QSTR_mem8)
+QENUM(MP_QSTR_mem_alloc)
+QENUM(MP_QSTR_mem_current)
+QENUM(MP_QSTR_mem_free)
+QENUM(MP_QSTR_mem_info)
+QENUM(MP_QSTR_mem_peak)
+QENUM(MP_QSTR_mem_total)
+QENUM(MP_QSTR_memoryview)
+QENUM(MP_QSTR_micropython)
+QENUM(MP_QSTR_min)
+QENUM(MP_QSTR_mkdir)
+QENUM(MP_QSTR_mode)
+QENUM(MP_QSTR_modf)
+QENUM(MP_QSTR_modify)
+QENUM(MP_QSTR_module)
+QENUM(MP_QSTR_modules)
+QENUM(MP_QSTR_moving_average)
+QENUM(MP_QSTR_mul)
+QENUM(MP_QSTR_name)
+QENUM(MP_QSTR_namedtuple)
+QENUM(MP_QSTR_native)
+QENUM(MP_QSTR_next)
+QENUM(MP_QSTR_object)
+QENUM(MP_QSTR_oct)
+QENUM(MP_QSTR_off)
+QENUM(MP_QSTR_offset)
+QENUM(MP_QSTR_on)
+QENUM(MP_QSTR_open)
+QENUM(MP_QSTR_opt_level)
+QENUM(MP_QSTR_ord)
+QENUM(MP_QSTR_out)
+QENUM(MP_QSTR_pack)
+QENUM(MP_QSTR_pack_into)
+QENUM(MP_QSTR_partition)
+QENUM(MP_QSTR_path)
+QENUM(MP_QSTR_pause_stats)
+QENUM(MP_QSTR_peektime)
+QENUM(MP_QSTR_pend_throw)
+QENUM(MP_QSTR_phase)
+QENUM(MP_QSTR_pi)
+QENUM(MP_QSTR_platform)
+QENUM(MP_QSTR_polar)
+QENUM(MP_QSTR_poll)
+QENUM(MP_QSTR_pop)
+QENUM(MP_QSTR_popitem)
+QENUM(MP_QSTR_popleft)
+QENUM(MP_QSTR_pow)
+QENUM(MP_QSTR_print)
+QENUM(MP_QSTR_print_exception)
+QENUM(MP_QSTR_profile_dump)
+QENUM(MP_QSTR_profile_start)
+QENUM(MP_QSTR_profile_stop)
+QENUM(MP_QSTR_property)
+QENUM(MP_QSTR_protocol_pin)
+QENUM(MP_QSTR_protocol_stream)
+QENUM(MP_QSTR_ptr)
+QENUM(MP_QSTR_ptr16)
+QENUM(MP_QSTR_ptr32)
+QENUM(MP_QSTR_ptr8)
+QENUM(MP_QSTR_push)
+QENUM(MP_QSTR_qstr_info)
+QENUM(MP_QSTR_r)
+QENUM(MP_QSTR_radians)
+QENUM(MP_QSTR_range)
+QENUM(MP_QSTR_read)
+QENUM(MP_QSTR_readinto)
+QENUM(MP_QSTR_readline)
+QENUM(MP_QSTR_readlines)
+QENUM(MP_QSTR_real)
+QENUM(MP_QSTR_rect)
+QENUM(MP_QSTR_recv)
+QENUM(MP_QSTR_recvfrom)
+QENUM(MP_QSTR_register)
+QENUM(MP_QSTR_release)
+QENUM(MP_QSTR_remove)
+QENUM(MP_QSTR_replace)
+QENUM(MP_QSTR_repr)
+QENUM(MP_QSTR_reverse)
+QENUM(MP_QSTR_reversed)
+QENUM(MP_QSTR_rfind)
+QENUM(MP_QSTR_rindex)
+QENUM(MP_QSTR_round)
+QENUM(MP_QSTR_rpartition)
+QENUM(MP_QSTR_rsplit)
+QENUM(MP_QSTR_rstrip)
+QENUM(MP_QSTR_scale)
+QENUM(MP_QSTR_search)
+QENUM(MP_QSTR_seed)
+QENUM(MP_QSTR_seek)
+QENUM(MP_QSTR_send)
+QENUM(MP_QSTR_sendto)
+QENUM(MP_QSTR_sep)
+QENUM(MP_QSTR_set)
+QENUM(MP_QSTR_setattr)
+QENUM(MP_QSTR_setblocking)
+QENUM(MP_QSTR_setdefault)
+QENUM(MP_QSTR_setraw)
+QENUM(MP_QSTR_setsockopt)
+QENUM(MP_QSTR_setter)
+QENUM(MP_QSTR_sha256)
+QENUM(MP_QSTR_sin)
+QENUM(MP_QSTR_single)
+QENUM(MP_QSTR_sinh)
+QENUM(MP_QSTR_sizeof)
+QENUM(MP_QSTR_sleep)
+QENUM(MP_QSTR_sleep_ms)
+QENUM(MP_QSTR_sleep_us)
+QENUM(MP_QSTR_slice)
+QENUM(MP_QSTR_sockaddr)
+QENUM(MP_QSTR_socket)
+QENUM(MP_QSTR_sort)
+QENUM(MP_QSTR_sorted)
+QENUM(MP_QSTR_split)
+QENUM(MP_QSTR_splitlines)
+QENUM(MP_QSTR_sqrt)
+QENUM(MP_QSTR_stack_size)
+QENUM(MP_QSTR_stack_use)
+QENUM(MP_QSTR_start)
+QENUM(MP_QSTR_start_new_thread)
+QENUM(MP_QSTR_startswith)
+QENUM(MP_QSTR_stat)
+QENUM(MP_QSTR_staticmethod)
+QENUM(MP_QSTR_statvfs)
+QENUM(MP_QSTR_stderr)
+QENUM(MP_QSTR_stdin)
+QENUM(MP_QSTR_stdout)
+QENUM(MP_QSTR_step)
+QENUM(MP_QSTR_stop)
+QENUM(MP_QSTR_str)
+QENUM(MP_QSTR_strerror)
+QENUM(MP_QSTR_strip)
+QENUM(MP_QSTR_struct)
+QENUM(MP_QSTR_sum)
+QENUM(MP_QSTR_super)
+QENUM(MP_QSTR_sweep_budget)
+QENUM(MP_QSTR_symmetric_difference)
+QENUM(MP_QSTR_symmetric_difference_update)
+QENUM(MP_QSTR_sys)
+QENUM(MP_QSTR_system)
+QENUM(MP_QSTR_tan)
+QENUM(MP_QSTR_tanh)
+QENUM(MP_QSTR_tb_frame)
+QENUM(MP_QSTR_tb_lasti)
+QENUM(MP_QSTR_tb_lineno)
+QENUM(MP_QSTR_tb_next)
+QENUM(MP_QSTR_tcgetattr)
+QENUM(MP_QSTR_tcsetattr)
+QENUM(MP_QSTR_tell)
+QENUM(MP_QSTR_termios)
+QENUM(MP_QSTR_threshold)
+QENUM(MP_QSTR_throw)
+QENUM(MP_QSTR_ticks_add)
+QENUM(MP_QSTR_ticks_cpu)
+QENUM(MP_QSTR_ticks_diff)
+QENUM(MP_QSTR_ticks_ms)
+QENUM(MP_QSTR_ticks_us)
+QENUM(MP_QSTR_time)
+QENUM(MP_QSTR_time_pulse_us)
+QENUM(MP_QSTR_to_bytes)
+QENUM(MP_QSTR_traceback)
+QENUM(MP_QSTR_trunc)
+QENUM(MP_QSTR_tuple)
+QENUM(MP_QSTR_type)
+QENUM(MP_QSTR_uctypes)
+QENUM(MP_QSTR_uerrno)
+QENUM(MP_QSTR_uheapq)
+QENUM(MP_QSTR_uint)
+QENUM(MP_QSTR_uio)
+QENUM(MP_QSTR_ujson)
+QENUM(MP_QSTR_umachine)
+QENUM(MP_QSTR_unhexlify)
+QENUM(MP_QSTR_union)
+QENUM(MP_QSTR_unlink)
+QENUM(MP_QSTR_unpack)
+QENUM(MP_QSTR_unpack_from)
+QENUM(MP_QSTR_unregister)
+QENUM(MP_QSTR_uos)
+QENUM(MP_QSTR_update)
+QENUM(MP_QSTR_upper)
+QENUM(MP_QSTR_urandom)
+QENUM(MP_QSTR_ure)
+QENUM(MP_QSTR_uselect)
+QENUM(MP_QSTR_usocket)
+QENUM(MP_QSTR_ustruct)
+QENUM(MP_QSTR_utime)
+QENUM(MP_QSTR_utimeq)
+QENUM(MP_QSTR_value)
+QENUM(MP_QSTR_values)
+QENUM(MP_QSTR_version)
+QENUM(MP_QSTR_version_info)
+QENUM(MP_QSTR_viper)
+QENUM(MP_QSTR_websocket)
+QENUM(MP_QSTR_window)
+QENUM(MP_QSTR_write)
+QENUM(MP_QSTR_zip)
@@ -0,0 +1,2023 @@
+// 32   1043 0000 0
+// 97 a 649 0001 1
+// 101 e 1177 0010 2
+// 105 i 648 0011 3
+// 110 n 746 0100 4
+// 111 o 777 0101 5
+// 114 r 732 0110 6
+// 115 s 619 0111 7
+// 116 t 992 1000 8
+// 95 _ 434 10010 18
+// 99 c 432 10011 19
+// 100 d 382 10100 20
+// 108 l 406 10101 21
+// 109 m 317 10110 22
+// 112 p 336 10111 23
+// 117 u 354 11000 24
+// 39 \' 163 110010 50
+// 98 b 191 110011 51
+// 102 f 250 110100 52
+// 103 g 191 110101 53
+// 104 h 128 110110 54
+// 121 y 149 110111 55
+// 37 % 95 1110000 112
+// 69 E 90 1110001 113
+// 107 k 76 1110010 114
+// 113 q 66 1110011 115
+// 118 v 93 1110100 116
+// 119 w 79 1110101 117
+// 120 x 93 1110110 118
+// 65 A 35 11101110 238
+// 73 I 53 11101111 239
+// 78 N 63 11110000 240
+// 79 O 52 11110001 241
+// 83 S 39 11110010 242
+// 84 T 49 11110011 243
+// 106 j 39 11110100 244
+// 40 ( 28 111101010 490
+// 41 ) 28 111101011 491
+// 45 - 19 111101100 492
+// 48 0 17 111101101 493
+// 50 2 18 111101110 494
+// 66 B 22 111101111 495
+// 67 C 18 111110000 496
+// 68 D 21 111110001 497
+// 70 F 24 111110010 498
+// 76 L 23 111110011 499
+// 82 R 29 111110100 500
+// 85 U 22 111110101 501
+// 42 * 9 1111101100 1004
+// 44 , 11 1111101101 1005
+// 46 . 11 1111101110 1006
+// 47 / 14 1111101111 1007
+// 49 1 15 1111110000 1008
+// 51 3 11 1111110001 1009
+// 54 6 16 1111110010 1010
+// 58 : 11 1111110011 1011
+// 60 < 9 1111110100 1012
+// 62 > 9 1111110101 1013
+// 71 G 10 1111110110 1014
+// 77 M 10 1111110111 1015
+// 80 P 16 1111111000 1016
+// 122 z 14 1111111001 1017
+// 52 4 6 11111110100 2036
+// 56 8 8 11111110101 2037
+// 75 K 7 11111110110 2038
+// 86 V 8 11111110111 2039
+// 87 W 4 11111111000 2040
+// 10 \n 3 111111110010 4082
+// 13 \r 2 111111110011 4083
+// 34 \" 2 111111110100 4084
+// 35 # 4 111111110101 4085
+// 53 5 3 111111110110 4086
+// 61 = 4 111111110111 4087
+// 72 H 4 111111111000 4088
+// 88 X 2 111111111001 4089
+// 89 Y 2 111111111010 4090
+// 123 { 2 111111111011 4091
+// 55 7 1 1111111111000 8184
+// 57 9 1 1111111111001 8185
+// 59 ; 1 1111111111010 8186
+// 74 J 1 1111111111011 8187
+// 90 Z 1 1111111111100 8188
+// 91 [ 1 1111111111101 8189
+// 93 ] 1 1111111111110 8190
+// 125 } 2 1111111111111 8191
+// length count {4: 9, 5: 7, 6: 6, 7: 7, 8: 7, 9: 12, 10: 14, 11: 5, 12: 10, 13: 8}
+// values [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', '_', 'c', 'd', 'l', 'm', 'p', 'u', "'", 'b', 'f', 'g', 'h', 'y', '%', 'E', 'k', 'q', 'v', 'w', 'x', 'A', 'I', 'N', 'O', 'S', 'T', 'j', '(', ')', '-', '0', '2', 'B', 'C', 'D', 'F', 'L', 'R', 'U', '*', ',', '.', '/', '1', '3', '6', ':', '<', '>', 'G', 'M', 'P', 'z', '4', '8', 'K', 'V', 'W', '\n', '\r', '"', '#', '5', '=', 'H', 'X', 'Y', '{', '7', '9', ';', 'J', 'Z', '[', ']', '}'] lengths 14 bytearray(b'\x00\x00\x00\t\x07\x06\x07\x07\x0c\x0e\x05\n\x08\x00')
+// estimated total memory size 61134
+// [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', '_', 'c', 'd', 'l', 'm', 'p', 'u', "'", 'b', 'f', 'g', 'h', 'y', '%', 'E', 'k', 'q', 'v', 'w', 'x', 'A', 'I', 'N', 'O', 'S', 'T', 'j', '(', ')', '-', '0', '2', 'B', 'C', 'D', 'F', 'L', 'R', 'U', '*', ',', '.', '/', '1', '3', '6', ':', '<', '>', 'G', 'M', 'P', 'z', '4', '8', 'K', 'V', 'W', '\n', '\r', '"', '#', '5', '=', 'H', 'X', 'Y', '{', '7', '9', ';', 'J', 'Z', '[', ']', '}'] bytearray(b'\x00\x00\x00\t\x07\x06\x07\x07\x0c\x0e\x05\n\x08\x00')
+// This file was automatically generated by makeqstrdata.py
+
+QDEF(MP_QSTR_NULL, (const byte*)"\x00\x00\x00" "")
+QDEF(MP_QSTR_, (const byte*)"\x05\x15\x00" "")
+QDEF(MP_QSTR___dir__, (const byte*)"\x7a\x8f\x07" "__dir__")
+QDEF(MP_QSTR___abs__, (const byte*)"\x95\xd6\x07" "__abs__")
+QDEF(MP_QSTR___add__, (const byte*)"\xc4\x82\x07" "__add__")
+QDEF(MP_QSTR___aenter__, (const byte*)"\x4c\x84\x0a" "__aenter__")
+QDEF(MP_QSTR___aexit__, (const byte*)"\xc4\xcf\x09" "__aexit__")
+QDEF(MP_QSTR___aiter__, (const byte*)"\x4e\x2b\x09" "__aiter__")
+QDEF(MP_QSTR___and__, (const byte*)"\x0e\xdb\x07" "__and__")
+QDEF(MP_QSTR___anext__, (const byte*)"\x83\xb4\x09" "__anext__")
+QDEF(MP_QSTR___bool__, (const byte*)"\x2b\x65\x08" "__bool__")
+QDEF(MP_QSTR___build_class__, (const byte*)"\x42\x88\x0f" "__build_class__")
+QDEF(MP_QSTR___bytes__, (const byte*)"\xdc\x81\x09" "__bytes__")
+QDEF(MP_QSTR___call__, (const byte*)"\xa7\xf9\x08" "__call__")
+QDEF(MP_QSTR___class__, (const byte*)"\x2b\xc5\x09" "__class__")
+QDEF(MP_QSTR___contains__, (const byte*)"\xc6\x5f\x0c" "__contains__")
+QDEF(MP_QSTR___del__, (const byte*)"\x68\x37\x07" "__del__")
+QDEF(MP_QSTR___delete__, (const byte*)"\xdc\xed\x0a" "__delete__")
+QDEF(MP_QSTR___delitem__, (const byte*)"\xfd\x35\x0b" "__delitem__")
+QDEF(MP_QSTR___dict__, (const byte*)"\x7f\x54\x08" "__dict__")
+QDEF(MP_QSTR___divmod__, (const byte*)"\x78\x11\x0a" "__divmod__")
+QDEF(MP_QSTR___enter__, (const byte*)"\x6d\xba\x09" "__enter__")
+QDEF(MP_QSTR___eq__, (const byte*)"\x71\x3e\x06" "__eq__")
+QDEF(MP_QSTR___exit__, (const byte*)"\x45\xf8\x08" "__exit__")
+QDEF(MP_QSTR___file__, (const byte*)"\x03\x54\x08" "__file__")
+QDEF(MP_QSTR___floordiv__, (const byte*)"\x46\x5f\x0c" "__floordiv__")
+QDEF(MP_QSTR___func__, (const byte*)"\x5b\xe8\x08" "__func__")
+QDEF(MP_QSTR___ge__, (const byte*)"\xa7\x46\x06" "__ge__")
+QDEF(MP_QSTR___get__, (const byte*)"\xb3\x8f\x07" "__get__")
+QDEF(MP_QSTR___getattr__, (const byte*)"\x40\xf8\x0b" "__getattr__")
+QDEF(MP_QSTR___getitem__, (const byte*)"\x26\x39\x0b" "__getitem__")
+QDEF(MP_QSTR___gt__, (const byte*)"\xb6\x82\x06" "__gt__")
+QDEF(MP_QSTR___hash__, (const byte*)"\xf7\xc8\x08" "__hash__")
+QDEF(MP_QSTR___iadd__, (const byte*)"\x6d\x4a\x08" "__iadd__")
+QDEF(MP_QSTR___import__, (const byte*)"\x38\x3e\x0a" "__import__")
+QDEF(MP_QSTR___init__, (const byte*)"\x5f\xa5\x08" "__init__")
+QDEF(MP_QSTR___invert__, (const byte*)"\xf7\x77\x0a" "__invert__")
+QDEF(MP_QSTR___isub__, (const byte*)"\x08\x78\x08" "__isub__")
+QDEF(MP_QSTR___iter__, (const byte*)"\xcf\x32\x08" "__iter__")
+QDEF(MP_QSTR___le__, (const byte*)"\xcc\x13\x06" "__le__")
+QDEF(MP_QSTR___len__, (const byte*)"\xe2\xb0\x07" "__len__")
+QDEF(MP_QSTR___lshift__, (const byte*)"\x09\x88\x0a" "__lshift__")
+QDEF(MP_QSTR___lt__, (const byte*)"\x5d\x68\x06" "__lt__")
+QDEF(MP_QSTR___main__, (const byte*)"\x8e\x13\x08" "__main__")
+QDEF(MP_QSTR___mod__, (const byte*)"\x63\x37\x07" "__mod__")
+QDEF(MP_QSTR___module__, (const byte*)"\xff\x30\x0a" "__module__")
+QDEF(MP_QSTR___mul__, (const byte*)"\x31\x42\x07" "__mul__")
+QDEF(MP_QSTR___name__, (const byte*)"\xe2\x38\x08" "__name__")
+QDEF(MP_QSTR___neg__, (const byte*)"\x69\xd5\x07" "__neg__")
+QDEF(MP_QSTR___new__, (const byte*)"\x79\x15\x07" "__new__")
+QDEF(MP_QSTR___next__, (const byte*)"\x02\x73\x08" "__next__")
+QDEF(MP_QSTR___or__, (const byte*)"\x38\xbb\x06" "__or__")
+QDEF(MP_QSTR___path__, (const byte*)"\xc8\x23\x08" "__path__")
+QDEF(MP_QSTR___pos__, (const byte*)"\x29\xf0\x07" "__pos__")
+QDEF(MP_QSTR___pow__, (const byte*)"\x2d\x00\x07" "__pow__")
+QDEF(MP_QSTR___qualname__, (const byte*)"\x6b\x00\x0c" "__qualname__")
+QDEF(MP_QSTR___radd__, (const byte*)"\x16\xc5\x08" "__radd__")
+QDEF(MP_QSTR___rand__, (const byte*)"\xdc\x2e\x08" "__rand__")
+QDEF(MP_QSTR___repl_print__, (const byte*)"\x00\xbb\x0e" "__repl_print__")
+QDEF(MP_QSTR___repr__, (const byte*)"\x10\x0b\x08" "__repr__")
+QDEF(MP_QSTR___reversed__, (const byte*)"\x61\xff\x0c" "__reversed__")
+QDEF(MP_QSTR___rfloordiv__, (const byte*)"\x54\x98\x0d" "__rfloordiv__")
+QDEF(MP_QSTR___rlshift__, (const byte*)"\x1b\xd1\x0b" "__rlshift__")
+QDEF(MP_QSTR___rmod__, (const byte*)"\x31\x8a\x08" "__rmod__")
+QDEF(MP_QSTR___rmul__, (const byte*)"\x63\x01\x08" "__rmul__")
+QDEF(MP_QSTR___ror__, (const byte*)"\x2a\xdc\x07" "__ror__")
+QDEF(MP_QSTR___rpow__, (const byte*)"\xff\x9a\x08" "__rpow__")
+QDEF(MP_QSTR___rrshift__, (const byte*)"\xc5\x9d\x0b" "__rrshift__")
+QDEF(MP_QSTR___rshift__, (const byte*)"\x57\x98\x0a" "__rshift__")
+QDEF(MP_QSTR___rsub__, (const byte*)"\x73\x77\x08" "__rsub__")
+QDEF(MP_QSTR___rtruediv__, (const byte*)"\x5a\xd7\x0c" "__rtruediv__")
+QDEF(MP_QSTR___rxor__, (const byte*)"\xf2\x86\x08" "__rxor__")
+QDEF(MP_QSTR___set__, (const byte*)"\xa7\xb3\x07" "__set__")
+QDEF(MP_QSTR___setitem__, (const byte*)"\x32\x3e\x0b" "__setitem__")
+QDEF(MP_QSTR___slots__, (const byte*)"\xd2\xa4\x09" "__slots__")
+QDEF(MP_QSTR___str__, (const byte*)"\xd0\xcd\x07" "__str__")
+QDEF(MP_QSTR___sub__, (const byte*)"\x21\x09\x07" "__sub__")
+QDEF(MP_QSTR___traceback__, (const byte*)"\x4f\xcf\x0d" "__traceback__")
+QDEF(MP_QSTR___truediv__, (const byte*)"\x88\xef\x0b" "__truediv__")
+QDEF(MP_QSTR___xor__, (const byte*)"\x20\xec\x07" "__xor__")
+QDEF(MP_QSTR__star_, (const byte*)"\x8f\xb5\x01" "*")
+QDEF(MP_QSTR__, (const byte*)"\xfa\xb5\x01" "_")
+QDEF(MP_QSTR__slash_, (const byte*)"\x8a\xb5\x01" "/")
+QDEF(MP_QSTR__percent__hash_o, (const byte*)"\x6c\x1a\x03" "%#o")
+QDEF(MP_QSTR__percent__hash_x, (const byte*)"\x7b\x1a\x03" "%#x")
+QDEF(MP_QSTR__brace_open__colon__hash_b_brace_close_, (const byte*)"\x58\x37\x05" "{:#b}")
+QDEF(MP_QSTR__space_, (const byte*)"\x85\xb5\x01" " ")
+QDEF(MP_QSTR__0x0a_, (const byte*)"\xaf\xb5\x01" "\x0a")
+QDEF(MP_QSTR_maximum_space_recursion_space_depth_space_exceeded, (const byte*)"\x73\x1e\x20" "maximum recursion depth exceeded")
+QDEF(MP_QSTR__lt_module_gt_, (const byte*)"\xbd\x94\x08" "<module>")
+QDEF(MP_QSTR__lt_lambda_gt_, (const byte*)"\x80\x8c\x08" "<lambda>")
+QDEF(MP_QSTR__lt_listcomp_gt_, (const byte*)"\xd4\x15\x0a" "<listcomp>")
+QDEF(MP_QSTR__lt_dictcomp_gt_, (const byte*)"\xcc\x8d\x0a" "<dictcomp>")
+QDEF(MP_QSTR__lt_setcomp_gt_, (const byte*)"\x54\x51\x09" "<setcomp>")
+QDEF(MP_QSTR__lt_genexpr_gt_, (const byte*)"\x34\x6a\x09" "<genexpr>")
+QDEF(MP_QSTR__lt_string_gt_, (const byte*)"\x52\x53\x08" "<string>")
+QDEF(MP_QSTR__lt_stdin_gt_, (const byte*)"\xe3\x63\x07" "<stdin>")
+QDEF(MP_QSTR_utf_hyphen_8, (const byte*)"\xb7\x82\x05" "utf-8")
+QDEF(MP_QSTR__dot_frozen, (const byte*)"\x81\xf4\x07" ".frozen")
+QDEF(MP_QSTR_AF_INET, (const byte*)"\xeb\xb7\x07" "AF_INET")
+QDEF(MP_QSTR_AF_INET6, (const byte*)"\x7d\xb5\x08" "AF_INET6")
+QDEF(MP_QSTR_AF_UNIX, (const byte*)"\xf7\x01\x07" "AF_UNIX")
+QDEF(MP_QSTR_ARRAY, (const byte*)"\x5c\x7a\x05" "ARRAY")
+QDEF(MP_QSTR_ArithmeticError, (const byte*)"\x2d\x8c\x0f" "ArithmeticError")
+QDEF(MP_QSTR_AssertionError, (const byte*)"\x97\x5a\x0e" "AssertionError")
+QDEF(MP_QSTR_AttributeError, (const byte*)"\x21\xde\x0e" "AttributeError")
+QDEF(MP_QSTR_B115200, (const byte*)"\xa0\xf2\x07" "B115200")
+QDEF(MP_QSTR_B57600, (const byte*)"\x13\x9c\x06" "B57600")
+QDEF(MP_QSTR_B9600, (const byte*)"\x88\x9a\x05" "B9600")
+QDEF(MP_QSTR_BFINT16, (const byte*)"\x95\xe2\x07" "BFINT16")
+QDEF(MP_QSTR_BFINT32, (const byte*)"\x53\xe2\x07" "BFINT32")
+QDEF(MP_QSTR_BFINT8, (const byte*)"\x4a\x9a\x06" "BFINT8")
+QDEF(MP_QSTR_BFUINT16, (const byte*)"\x40\xa6\x08" "BFUINT16")
+QDEF(MP_QSTR_BFUINT32, (const byte*)"\x06\xa6\x08" "BFUINT32")
+QDEF(MP_QSTR_BFUINT8, (const byte*)"\xbf\xaf\x07" "BFUINT8")
+QDEF(MP_QSTR_BF_LEN, (const byte*)"\x19\xb0\x06" "BF_LEN")
+QDEF(MP_QSTR_BF_POS, (const byte*)"\x52\x9d\x06" "BF_POS")
+QDEF(MP_QSTR_BIG_ENDIAN, (const byte*)"\xff\x51\x0a" "BIG_ENDIAN")
+QDEF(MP_QSTR_BaseException, (const byte*)"\x07\x92\x0d" "BaseException")
+QDEF(MP_QSTR_BytesIO, (const byte*)"\x1a\xb7\x07" "BytesIO")
+QDEF(MP_QSTR_DEBUG, (const byte*)"\x34\x6d\x05" "DEBUG")
+QDEF(MP_QSTR_EACCES, (const byte*)"\x37\xc2\x06" "EACCES")
+QDEF(MP_QSTR_EADDRINUSE, (const byte*)"\x17\x11\x0a" "EADDRINUSE")
+QDEF(MP_QSTR_EAGAIN, (const byte*)"\x20\xec\x06" "EAGAIN")
+QDEF(MP_QSTR_EALREADY, (const byte*)"\x46\x15\x08" "EALREADY")
+QDEF(MP_QSTR_EBADF, (const byte*)"\x61\xa3\x05" "EBADF")
+QDEF(MP_QSTR_ECONNABORTED, (const byte*)"\x27\xab\x0c" "ECONNABORTED")
+QDEF(MP_QSTR_ECONNREFUSED, (const byte*)"\x3a\x2c\x0c" "ECONNREFUSED")
+QDEF(MP_QSTR_ECONNRESET, (const byte*)"\x19\xfb\x0a" "ECONNRESET")
+QDEF(MP_QSTR_EEXIST, (const byte*)"\x53\xad\x06" "EEXIST")
+QDEF(MP_QSTR_EHOSTUNREACH, (const byte*)"\x86\x25\x0c" "EHOSTUNREACH")
+QDEF(MP_QSTR_EINPROGRESS, (const byte*)"\x9a\xa0\x0b" "EINPROGRESS")
+QDEF(MP_QSTR_EINVAL, (const byte*)"\x5c\xff\x06" "EINVAL")
+QDEF(MP_QSTR_EIO, (const byte*)"\x86\xa6\x03" "EIO")
+QDEF(MP_QSTR_EISDIR, (const byte*)"\xa5\x4f\x06" "EISDIR")
+QDEF(MP_QSTR_ENOBUFS, (const byte*)"\xe3\x87\x07" "ENOBUFS")
+QDEF(MP_QSTR_ENODEV, (const byte*)"\xb6\x67\x06" "ENODEV")
+QDEF(MP_QSTR_ENOENT, (const byte*)"\x5e\x65\x06" "ENOENT")
+QDEF(MP_QSTR_ENOMEM, (const byte*)"\xa4\x85\x06" "ENOMEM")
+QDEF(MP_QSTR_ENOTCONN, (const byte*)"\x79\xd7\x08" "ENOTCONN")
+QDEF(MP_QSTR_EOFError, (const byte*)"\x91\xbf\x08" "EOFError")
+QDEF(MP_QSTR_EOPNOTSUPP, (const byte*)"\xac\x97\x0a" "EOPNOTSUPP")
+QDEF(MP_QSTR_EPERM, (const byte*)"\xea\x7f\x05" "EPERM")
+QDEF(MP_QSTR_ETIMEDOUT, (const byte*)"\xff\xf8\x09" "ETIMEDOUT")
+QDEF(MP_QSTR_Ellipsis, (const byte*)"\xf0\xe0\x08" "Ellipsis")
+QDEF(MP_QSTR_Exception, (const byte*)"\xf2\x29\x09" "Exception")
+QDEF(MP_QSTR_FLOAT32, (const byte*)"\xb4\x87\x07" "FLOAT32")
+QDEF(MP_QSTR_FLOAT64, (const byte*)"\x17\x87\x07" "FLOAT64")
+QDEF(MP_QSTR_FileIO, (const byte*)"\xc5\x15\x06" "FileIO")
+QDEF(MP_QSTR_GeneratorExit, (const byte*)"\x16\x62\x0d" "GeneratorExit")
+QDEF(MP_QSTR_INT16, (const byte*)"\x91\x76\x05" "INT16")
+QDEF(MP_QSTR_INT32, (const byte*)"\x57\x76\x05" "INT32")
+QDEF(MP_QSTR_INT64, (const byte*)"\xf4\x75\x05" "INT64")
+QDEF(MP_QSTR_INT8, (const byte*)"\xce\xbd\x04" "INT8")
+QDEF(MP_QSTR_IOBase, (const byte*)"\x36\xbe\x06" "IOBase")
+QDEF(MP_QSTR_ImportError, (const byte*)"\x20\x9c\x0b" "ImportError")
+QDEF(MP_QSTR_IndentationError, (const byte*)"\x5c\x20\x10" "IndentationError")
+QDEF(MP_QSTR_IndexError, (const byte*)"\x83\xad\x0a" "IndexError")
+QDEF(MP_QSTR_KeyError, (const byte*)"\xea\x00\x08" "KeyError")
+QDEF(MP_QSTR_KeyboardInterrupt, (const byte*)"\xaf\xe2\x11" "KeyboardInterrupt")
+QDEF(MP_QSTR_LITTLE_ENDIAN, (const byte*)"\xbf\x5b\x0d" "LITTLE_ENDIAN")
+QDEF(MP_QSTR_LockType, (const byte*)"\x36\x20\x08" "LockType")
+QDEF(MP_QSTR_LookupError, (const byte*)"\xff\x69\x0b" "LookupError")
+QDEF(MP_QSTR_MSG_DONTROUTE, (const byte*)"\xeb\x5d\x0d" "MSG_DONTROUTE")
+QDEF(MP_QSTR_MSG_DONTWAIT, (const byte*)"\x99\xc8\x0c" "MSG_DONTWAIT")
+QDEF(MP_QSTR_MemoryError, (const byte*)"\xdc\x83\x0b" "MemoryError")
+QDEF(MP_QSTR_MpyError, (const byte*)"\x39\x7f\x08" "MpyError")
+QDEF(MP_QSTR_NATIVE, (const byte*)"\x04\x8e\x06" "NATIVE")
+QDEF(MP_QSTR_NameError, (const byte*)"\xba\x2d\x09" "NameError")
+QDEF(MP_QSTR_None, (const byte*)"\x6f\xd1\x04" "None")
+QDEF(MP_QSTR_NoneType, (const byte*)"\x17\x68\x08" "NoneType")
+QDEF(MP_QSTR_NotImplemented, (const byte*)"\x3e\xc6\x0e" "NotImplemented")
+QDEF(MP_QSTR_NotImplementedError, (const byte*)"\xc6\x98\x13" "NotImplementedError")
+QDEF(MP_QSTR_OSError, (const byte*)"\xa1\x65\x07" "OSError")
+QDEF(MP_QSTR_OrderedDict, (const byte*)"\xf0\x7e\x0b" "OrderedDict")
+QDEF(MP_QSTR_OverflowError, (const byte*)"\x81\xe1\x0d" "OverflowError")
+QDEF(MP_QSTR_POLLERR, (const byte*)"\xdf\xc0\x07" "POLLERR")
+QDEF(MP_QSTR_POLLHUP, (const byte*)"\x77\x8a\x07" "POLLHUP")
+QDEF(MP_QSTR_POLLIN, (const byte*)"\x7d\x61\x06" "POLLIN")
+QDEF(MP_QSTR_POLLOUT, (const byte*)"\x74\x85\x07" "POLLOUT")
+QDEF(MP_QSTR_PTR, (const byte*)"\xb3\x0c\x03" "PTR")
+QDEF(MP_QSTR_PinBase, (const byte*)"\x47\x43\x07" "PinBase")
+QDEF(MP_QSTR_ReloadException, (const byte*)"\x03\xc2\x0f" "ReloadException")
+QDEF(MP_QSTR_RuntimeError, (const byte*)"\x61\xf1\x0c" "RuntimeError")
+QDEF(MP_QSTR_SOCK_DGRAM, (const byte*)"\xb3\x14\x0a" "SOCK_DGRAM")
+QDEF(MP_QSTR_SOCK_RAW, (const byte*)"\xca\x96\x08" "SOCK_RAW")
+QDEF(MP_QSTR_SOCK_STREAM, (const byte*)"\x32\xbe\x0b" "SOCK_STREAM")
+QDEF(MP_QSTR_SOL_SOCKET, (const byte*)"\x0f\xdf\x0a" "SOL_SOCKET")
+QDEF(MP_QSTR_SO_BROADCAST, (const byte*)"\xf9\xc6\x0c" "SO_BROADCAST")
+QDEF(MP_QSTR_SO_ERROR, (const byte*)"\x3e\x2a\x08" "SO_ERROR")
+QDEF(MP_QSTR_SO_KEEPALIVE, (const byte*)"\x2a\xa3\x0c" "SO_KEEPALIVE")
+QDEF(MP_QSTR_SO_LINGER, (const byte*)"\xfd\x90\x09" "SO_LINGER")
+QDEF(MP_QSTR_SO_REUSEADDR, (const byte*)"\x21\x53\x0c" "SO_REUSEADDR")
+QDEF(MP_QSTR_Signal, (const byte*)"\x9b\xe4\x06" "Signal")
+QDEF(MP_QSTR_StopAsyncIteration, (const byte*)"\xec\xf0\x12" "StopAsyncIteration")
+QDEF(MP_QSTR_StopIteration, (const byte*)"\xea\x1c\x0d" "StopIteration")
+QDEF(MP_QSTR_StringIO, (const byte*)"\x76\x76\x08" "StringIO")
+QDEF(MP_QSTR_SyntaxError, (const byte*)"\x94\x8f\x0b" "SyntaxError")
+QDEF(MP_QSTR_SystemExit, (const byte*)"\x20\xff\x0a" "SystemExit")
+QDEF(MP_QSTR_TCSANOW, (const byte*)"\x56\x25\x07" "TCSANOW")
+QDEF(MP_QSTR_TextIOWrapper, (const byte*)"\xad\x8d\x0d" "TextIOWrapper")
+QDEF(MP_QSTR_TimeoutError, (const byte*)"\x66\x4b\x0c" "TimeoutError")
+QDEF(MP_QSTR_TypeError, (const byte*)"\x25\x96\x09" "TypeError")
+QDEF(MP_QSTR_UINT16, (const byte*)"\xc4\x17\x06" "UINT16")
+QDEF(MP_QSTR_UINT32, (const byte*)"\x82\x17\x06" "UINT32")
+QDEF(MP_QSTR_UINT64, (const byte*)"\x61\x18\x06" "UINT64")
+QDEF(MP_QSTR_UINT8, (const byte*)"\xbb\xe1\x05" "UINT8")
+QDEF(MP_QSTR_UnicodeError, (const byte*)"\x22\xd1\x0c" "UnicodeError")
+QDEF(MP_QSTR_VOID, (const byte*)"\x31\xf2\x04" "VOID")
+QDEF(MP_QSTR_ValueError, (const byte*)"\x96\x87\x0a" "ValueError")
+QDEF(MP_QSTR_ViperTypeError, (const byte*)"\xdd\x05\x0e" "ViperTypeError")
+QDEF(MP_QSTR_ZeroDivisionError, (const byte*)"\xb6\x27\x11" "ZeroDivisionError")
+QDEF(MP_QSTR__thread, (const byte*)"\xd4\x02\x07" "_thread")
+QDEF(MP_QSTR_a, (const byte*)"\xc4\xb5\x01" "a")
+QDEF(MP_QSTR_a2b_base64, (const byte*)"\x3c\x0b\x0a" "a2b_base64")
+QDEF(MP_QSTR_abs, (const byte*)"\x95\x32\x03" "abs")
+QDEF(MP_QSTR_accept, (const byte*)"\x85\x89\x06" "accept")
+QDEF(MP_QSTR_acos, (const byte*)"\x1b\xa0\x04" "acos")
+QDEF(MP_QSTR_acosh, (const byte*)"\x13\xa3\x05" "acosh")
+QDEF(MP_QSTR_acquire, (const byte*)"\x1d\xd3\x07" "acquire")
+QDEF(MP_QSTR_add, (const byte*)"\x44\x32\x03" "add")
+QDEF(MP_QSTR_addressof, (const byte*)"\x5a\xf9\x09" "addressof")
+QDEF(MP_QSTR_all, (const byte*)"\x44\x33\x03" "all")
+QDEF(MP_QSTR_alloc_profile, (const byte*)"\xfc\xc1\x0d" "alloc_profile")
+QDEF(MP_QSTR_alloc_samples, (const byte*)"\xa2\x72\x0d" "alloc_samples")
+QDEF(MP_QSTR_allocate_lock, (const byte*)"\xec\xed\x0d" "allocate_lock")
+QDEF(MP_QSTR_any, (const byte*)"\x13\x33\x03" "any")
+QDEF(MP_QSTR_append, (const byte*)"\x6b\x97\x06" "append")
+QDEF(MP_QSTR_arena, (const byte*)"\x5c\x9a\x05" "arena")
+QDEF(MP_QSTR_args, (const byte*)"\xc2\xc6\x04" "args")
+QDEF(MP_QSTR_argv, (const byte*)"\xc7\xc6\x04" "argv")
+QDEF(MP_QSTR_array, (const byte*)"\x7c\x72\x05" "array")
+QDEF(MP_QSTR_arraymath, (const byte*)"\x4c\x22\x09" "arraymath")
+QDEF(MP_QSTR_asin, (const byte*)"\x50\xe5\x04" "asin")
+QDEF(MP_QSTR_asinh, (const byte*)"\x38\x8f\x05" "asinh")
+QDEF(MP_QSTR_atan, (const byte*)"\x1f\xbe\x04" "atan")
+QDEF(MP_QSTR_atan2, (const byte*)"\xcd\x81\x05" "atan2")
+QDEF(MP_QSTR_atanh, (const byte*)"\x97\x81\x05" "atanh")
+QDEF(MP_QSTR_b, (const byte*)"\xc7\xb5\x01" "b")
+QDEF(MP_QSTR_b2a_base64, (const byte*)"\x3c\x8f\x0a" "b2a_base64")
+QDEF(MP_QSTR_bin, (const byte*)"\xe0\x48\x03" "bin")
+QDEF(MP_QSTR_binascii, (const byte*)"\x91\x3c\x08" "binascii")
+QDEF(MP_QSTR_bind, (const byte*)"\x84\x64\x04" "bind")
+QDEF(MP_QSTR_bool, (const byte*)"\xeb\x3c\x04" "bool")
+QDEF(MP_QSTR_bound_method, (const byte*)"\x97\xa2\x0c" "bound_method")
+QDEF(MP_QSTR_buffering, (const byte*)"\x25\xdb\x09" "buffering")
+QDEF(MP_QSTR_builtins, (const byte*)"\xf7\x31\x08" "builtins")
+QDEF(MP_QSTR_bytearray, (const byte*)"\x76\xa3\x09" "bytearray")
+QDEF(MP_QSTR_bytearray_at, (const byte*)"\x9c\x5c\x0c" "bytearray_at")
+QDEF(MP_QSTR_bytecode, (const byte*)"\x22\x7d\x08" "bytecode")
+QDEF(MP_QSTR_byteorder, (const byte*)"\x61\x99\x09" "byteorder")
+QDEF(MP_QSTR_bytes, (const byte*)"\x5c\xb2\x05" "bytes")
+QDEF(MP_QSTR_bytes_at, (const byte*)"\xb6\x5d\x08" "bytes_at")
+QDEF(MP_QSTR_calcsize, (const byte*)"\x4d\x38\x08" "calcsize")
+QDEF(MP_QSTR_callable, (const byte*)"\x0d\x70\x08" "callable")
+QDEF(MP_QSTR_ceil, (const byte*)"\x06\xb0\x04" "ceil")
+QDEF(MP_QSTR_center, (const byte*)"\x4e\xbf\x06" "center")
+QDEF(MP_QSTR_chr, (const byte*)"\xdc\x4c\x03" "chr")
+QDEF(MP_QSTR_circuitpython, (const byte*)"\x02\x3b\x0d" "circuitpython")
+QDEF(MP_QSTR_classmethod, (const byte*)"\xb4\x8c\x0b" "classmethod")
+QDEF(MP_QSTR_clear, (const byte*)"\x7c\xa0\x05" "clear")
+QDEF(MP_QSTR_clock, (const byte*)"\x2d\x65\x05" "clock")
+QDEF(MP_QSTR_close, (const byte*)"\x33\x67\x05" "close")
+QDEF(MP_QSTR_closure, (const byte*)"\x74\xca\x07" "closure")
+QDEF(MP_QSTR_cmath, (const byte*)"\xb6\xf4\x05" "cmath")
+QDEF(MP_QSTR_co_argcount, (const byte*)"\xa1\xae\x0b" "co_argcount")
+QDEF(MP_QSTR_co_cellvars, (const byte*)"\x66\xfa\x0b" "co_cellvars")
+QDEF(MP_QSTR_co_code, (const byte*)"\xfb\x51\x07" "co_code")
+QDEF(MP_QSTR_co_consts, (const byte*)"\xa0\x03\x09" "co_consts")
+QDEF(MP_QSTR_co_filename, (const byte*)"\x77\x1b\x0b" "co_filename")
+QDEF(MP_QSTR_co_firstlineno, (const byte*)"\x23\x5a\x0e" "co_firstlineno")
+QDEF(MP_QSTR_co_flags, (const byte*)"\x49\xa8\x08" "co_flags")
+QDEF(MP_QSTR_co_freevars, (const byte*)"\xf4\x4c\x0b" "co_freevars")
+QDEF(MP_QSTR_co_kwonlyargcount, (const byte*)"\xe9\x55\x11" "co_kwonlyargcount")
+QDEF(MP_QSTR_co_lnotab, (const byte*)"\x0c\xbc\x09" "co_lnotab")
+QDEF(MP_QSTR_co_name, (const byte*)"\xb1\xb3\x07" "co_name")
+QDEF(MP_QSTR_co_names, (const byte*)"\xa2\x29\x08" "co_names")
+QDEF(MP_QSTR_co_nlocals, (const byte*)"\xc6\xdc\x0a" "co_nlocals")
+QDEF(MP_QSTR_co_stacksize, (const byte*)"\x7d\x1a\x0c" "co_stacksize")
+QDEF(MP_QSTR_co_varnames, (const byte*)"\x87\x79\x0b" "co_varnames")
+QDEF(MP_QSTR_code, (const byte*)"\x68\xda\x04" "code")
+QDEF(MP_QSTR_collect, (const byte*)"\x9b\x65\x07" "collect")
+QDEF(MP_QSTR_collections, (const byte*)"\xe0\xc8\x0b" "collections")
+QDEF(MP_QSTR_compile, (const byte*)"\xf4\xc9\x07" "compile")
+QDEF(MP_QSTR_complex, (const byte*)"\xc5\x9d\x07" "complex")
+QDEF(MP_QSTR_connect, (const byte*)"\xdb\x3d\x07" "connect")
+QDEF(MP_QSTR_const, (const byte*)"\xc0\xff\x05" "const")
+QDEF(MP_QSTR_copy, (const byte*)"\xe0\xdb\x04" "copy")
+QDEF(MP_QSTR_copysign, (const byte*)"\x33\x14\x08" "copysign")
+QDEF(MP_QSTR_cos, (const byte*)"\x7a\x4c\x03" "cos")
+QDEF(MP_QSTR_cosh, (const byte*)"\xd2\xdb\x04" "cosh")
+QDEF(MP_QSTR_count, (const byte*)"\xa6\x4d\x05" "count")
+QDEF(MP_QSTR_decode, (const byte*)"\xa9\x59\x06" "decode")
+QDEF(MP_QSTR_default, (const byte*)"\xce\x7d\x07" "default")
+QDEF(MP_QSTR_degrees, (const byte*)"\x02\x41\x07" "degrees")
+QDEF(MP_QSTR_delattr, (const byte*)"\xdb\xc8\x07" "delattr")
+QDEF(MP_QSTR_deleter, (const byte*)"\x6e\xdb\x07" "deleter")
+QDEF(MP_QSTR_deque, (const byte*)"\x05\x99\x05" "deque")
+QDEF(MP_QSTR_dict, (const byte*)"\x3f\xfc\x04" "dict")
+QDEF(MP_QSTR_dict_view, (const byte*)"\x2d\xa9\x09" "dict_view")
+QDEF(MP_QSTR_difference, (const byte*)"\x72\x24\x0a" "difference")
+QDEF(MP_QSTR_difference_update, (const byte*)"\x9c\xfa\x11" "difference_update")
+QDEF(MP_QSTR_digest, (const byte*)"\xcd\xc4\x06" "digest")
+QDEF(MP_QSTR_dir, (const byte*)"\xfa\x1e\x03" "dir")
+QDEF(MP_QSTR_disable, (const byte*)"\x91\x76\x07" "disable")
+QDEF(MP_QSTR_discard, (const byte*)"\x0f\x71\x07" "discard")
+QDEF(MP_QSTR_divmod, (const byte*)"\xb8\x04\x06" "divmod")
+QDEF(MP_QSTR_doc, (const byte*)"\x2d\x1f\x03" "doc")
+QDEF(MP_QSTR_dot, (const byte*)"\x3a\x1f\x03" "dot")
+QDEF(MP_QSTR_dump, (const byte*)"\xe9\x2f\x04" "dump")
+QDEF(MP_QSTR_dumps, (const byte*)"\x7a\x2d\x05" "dumps")
+QDEF(MP_QSTR_e, (const byte*)"\xc0\xb5\x01" "e")
+QDEF(MP_QSTR_enable, (const byte*)"\x04\xde\x06" "enable")
+QDEF(MP_QSTR_encode, (const byte*)"\x43\xca\x06" "encode")
+QDEF(MP_QSTR_encoding, (const byte*)"\x06\x9c\x08" "encoding")
+QDEF(MP_QSTR_end, (const byte*)"\x0a\x23\x03" "end")
+QDEF(MP_QSTR_endswith, (const byte*)"\x1b\xa3\x08" "endswith")
+QDEF(MP_QSTR_enumerate, (const byte*)"\x71\xba\x09" "enumerate")
+QDEF(MP_QSTR_erf, (const byte*)"\x94\x23\x03" "erf")
+QDEF(MP_QSTR_erfc, (const byte*)"\x77\x96\x04" "erfc")
+QDEF(MP_QSTR_errno, (const byte*)"\xc1\x11\x05" "errno")
+QDEF(MP_QSTR_errorcode, (const byte*)"\x10\xdd\x09" "errorcode")
+QDEF(MP_QSTR_eval, (const byte*)"\x9b\xa6\x04" "eval")
+QDEF(MP_QSTR_exc_info, (const byte*)"\x0a\xff\x08" "exc_info")
+QDEF(MP_QSTR_exec, (const byte*)"\x1e\xc0\x04" "exec")
+QDEF(MP_QSTR_exit, (const byte*)"\x85\xbe\x04" "exit")
+QDEF(MP_QSTR_exp, (const byte*)"\xc8\x24\x03" "exp")
+QDEF(MP_QSTR_expm1, (const byte*)"\x74\x72\x05" "expm1")
+QDEF(MP_QSTR_extend, (const byte*)"\x63\xe8\x06" "extend")
+QDEF(MP_QSTR_f_back, (const byte*)"\x97\x48\x06" "f_back")
+QDEF(MP_QSTR_f_builtins, (const byte*)"\x8e\x92\x0a" "f_builtins")
+QDEF(MP_QSTR_f_code, (const byte*)"\x91\x81\x06" "f_code")
+QDEF(MP_QSTR_f_globals, (const byte*)"\x44\x1c\x09" "f_globals")
+QDEF(MP_QSTR_f_lasti, (const byte*)"\xff\x15\x07" "f_lasti")
+QDEF(MP_QSTR_f_lineno, (const byte*)"\xf3\x27\x08" "f_lineno")
+QDEF(MP_QSTR_f_locals, (const byte*)"\xc2\x24\x08" "f_locals")
+QDEF(MP_QSTR_f_trace, (const byte*)"\xbd\xd4\x07" "f_trace")
+QDEF(MP_QSTR_fabs, (const byte*)"\x93\x12\x04" "fabs")
+QDEF(MP_QSTR_factor, (const byte*)"\xc8\xd1\x06" "factor")
+QDEF(MP_QSTR_fft, (const byte*)"\x91\x36\x03" "fft")
+QDEF(MP_QSTR_file, (const byte*)"\xc3\x34\x04" "file")
+QDEF(MP_QSTR_filename, (const byte*)"\xe4\x54\x08" "filename")
+QDEF(MP_QSTR_filename2, (const byte*)"\x56\xf1\x09" "filename2")
+QDEF(MP_QSTR_fileno, (const byte*)"\x82\x76\x06" "fileno")
+QDEF(MP_QSTR_filter, (const byte*)"\x25\xbe\x06" "filter")
+QDEF(MP_QSTR_find, (const byte*)"\x00\x34\x04" "find")
+QDEF(MP_QSTR_float, (const byte*)"\x35\x44\x05" "float")
+QDEF(MP_QSTR_floor, (const byte*)"\x7d\x46\x05" "floor")
+QDEF(MP_QSTR_flush, (const byte*)"\x61\xc1\x05" "flush")
+QDEF(MP_QSTR_fmod, (const byte*)"\xe5\x44\x04" "fmod")
+QDEF(MP_QSTR_format, (const byte*)"\x26\x33\x06" "format")
+QDEF(MP_QSTR_frame, (const byte*)"\x78\x8a\x05" "frame")
+QDEF(MP_QSTR_frexp, (const byte*)"\x1c\x98\x05" "frexp")
+QDEF(MP_QSTR_from_bytes, (const byte*)"\x35\x74\x0a" "from_bytes")
+QDEF(MP_QSTR_fromkeys, (const byte*)"\x37\xbd\x08" "fromkeys")
+QDEF(MP_QSTR_frozenset, (const byte*)"\xed\x9c\x09" "frozenset")
+QDEF(MP_QSTR_function, (const byte*)"\x27\x02\x08" "function")
+QDEF(MP_QSTR_gamma, (const byte*)"\x02\x90\x05" "gamma")
+QDEF(MP_QSTR_gc, (const byte*)"\x61\x6e\x02" "gc")
+QDEF(MP_QSTR_generator, (const byte*)"\x96\xc3\x09" "generator")
+QDEF(MP_QSTR_get, (const byte*)"\x33\x3b\x03" "get")
+QDEF(MP_QSTR_get_ident, (const byte*)"\xfe\xb1\x09" "get_ident")
+QDEF(MP_QSTR_getaddrinfo, (const byte*)"\x6e\x18\x0b" "getaddrinfo")
+QDEF(MP_QSTR_getattr, (const byte*)"\xc0\x17\x07" "getattr")
+QDEF(MP_QSTR_getenv, (const byte*)"\xae\xfb\x06" "getenv")
+QDEF(MP_QSTR_getrandbits, (const byte*)"\x66\x7d\x0b" "getrandbits")
+QDEF(MP_QSTR_getter, (const byte*)"\x90\xb2\x06" "getter")
+QDEF(MP_QSTR_getvalue, (const byte*)"\x78\xac\x08" "getvalue")
+QDEF(MP_QSTR_globals, (const byte*)"\x9d\x49\x07" "globals")
+QDEF(MP_QSTR_group, (const byte*)"\xba\xb0\x05" "group")
+QDEF(MP_QSTR_hasattr, (const byte*)"\x8c\xb0\x07" "hasattr")
+QDEF(MP_QSTR_hash, (const byte*)"\xb7\x70\x04" "hash")
+QDEF(MP_QSTR_hashlib, (const byte*)"\x10\x6d\x07" "hashlib")
+QDEF(MP_QSTR_heap_lock, (const byte*)"\xad\x8c\x09" "heap_lock")
+QDEF(MP_QSTR_heap_unlock, (const byte*)"\x56\x2d\x0b" "heap_unlock")
+QDEF(MP_QSTR_heapify, (const byte*)"\xaf\x2d\x07" "heapify")
+QDEF(MP_QSTR_heappop, (const byte*)"\xd6\x27\x07" "heappop")
+QDEF(MP_QSTR_heappush, (const byte*)"\x87\x6b\x08" "heappush")
+QDEF(MP_QSTR_hex, (const byte*)"\x70\x50\x03" "hex")
+QDEF(MP_QSTR_hexlify, (const byte*)"\x2a\x7f\x07" "hexlify")
+QDEF(MP_QSTR_id, (const byte*)"\x28\x6f\x02" "id")
+QDEF(MP_QSTR_ilistdir, (const byte*)"\x71\x6a\x08" "ilistdir")
+QDEF(MP_QSTR_imag, (const byte*)"\x47\xb7\x04" "imag")
+QDEF(MP_QSTR_implementation, (const byte*)"\x17\x2d\x0e" "implementation")
+QDEF(MP_QSTR_index, (const byte*)"\x7b\x28\x05" "index")
+QDEF(MP_QSTR_indices, (const byte*)"\x5a\x48\x07" "indices")
+QDEF(MP_QSTR_inet_ntop, (const byte*)"\x89\x1d\x09" "inet_ntop")
+QDEF(MP_QSTR_inet_pton, (const byte*)"\xc9\x94\x09" "inet_pton")
+QDEF(MP_QSTR_input, (const byte*)"\x73\x5a\x05" "input")
+QDEF(MP_QSTR_insert, (const byte*)"\x12\x54\x06" "insert")
+QDEF(MP_QSTR_int, (const byte*)"\x16\x53\x03" "int")
+QDEF(MP_QSTR_intersection, (const byte*)"\x28\x2a\x0c" "intersection")
+QDEF(MP_QSTR_intersection_update, (const byte*)"\x06\xdd\x13" "intersection_update")
+QDEF(MP_QSTR_inverse, (const byte*)"\xd5\x16\x07" "inverse")
+QDEF(MP_QSTR_invert, (const byte*)"\xb7\x00\x06" "invert")
+QDEF(MP_QSTR_ioctl, (const byte*)"\x78\xc2\x05" "ioctl")
+QDEF(MP_QSTR_ipoll, (const byte*)"\x53\x5d\x05" "ipoll")
+QDEF(MP_QSTR_isalpha, (const byte*)"\xeb\x37\x07" "isalpha")
+QDEF(MP_QSTR_isdigit, (const byte*)"\xa8\x9a\x07" "isdigit")
+QDEF(MP_QSTR_isdisjoint, (const byte*)"\xf7\x68\x0a" "isdisjoint")
+QDEF(MP_QSTR_isenabled, (const byte*)"\x9a\xe5\x09" "isenabled")
+QDEF(MP_QSTR_isfinite, (const byte*)"\xa6\xab\x08" "isfinite")
+QDEF(MP_QSTR_isinf, (const byte*)"\x3e\x11\x05" "isinf")
+QDEF(MP_QSTR_isinstance, (const byte*)"\xb6\xbe\x0a" "isinstance")
+QDEF(MP_QSTR_islower, (const byte*)"\xfc\x80\x07" "islower")
+QDEF(MP_QSTR_isnan, (const byte*)"\x9e\x03\x05" "isnan")
+QDEF(MP_QSTR_isspace, (const byte*)"\x5b\xf8\x07" "isspace")
+QDEF(MP_QSTR_issubclass, (const byte*)"\xb5\x7f\x0a" "issubclass")
+QDEF(MP_QSTR_issubset, (const byte*)"\xb9\xc1\x08" "issubset")
+QDEF(MP_QSTR_issuperset, (const byte*)"\xfc\xec\x0a" "issuperset")
+QDEF(MP_QSTR_isupper, (const byte*)"\xdd\xa7\x07" "isupper")
+QDEF(MP_QSTR_items, (const byte*)"\xe3\x53\x05" "items")
+QDEF(MP_QSTR_iter, (const byte*)"\x8f\x21\x04" "iter")
+QDEF(MP_QSTR_iterable, (const byte*)"\x25\x92\x08" "iterable")
+QDEF(MP_QSTR_iterator, (const byte*)"\x47\xbe\x08" "iterator")
+QDEF(MP_QSTR_join, (const byte*)"\xa7\x5c\x04" "join")
+QDEF(MP_QSTR_kbd_intr, (const byte*)"\xf6\x13\x08" "kbd_intr")
+QDEF(MP_QSTR_keepends, (const byte*)"\x62\x8b\x08" "keepends")
+QDEF(MP_QSTR_key, (const byte*)"\x32\x6d\x03" "key")
+QDEF(MP_QSTR_keys, (const byte*)"\x01\x13\x04" "keys")
+QDEF(MP_QSTR_ldexp, (const byte*)"\x40\x6f\x05" "ldexp")
+QDEF(MP_QSTR_len, (const byte*)"\x62\x40\x03" "len")
+QDEF(MP_QSTR_lgamma, (const byte*)"\xce\x6c\x06" "lgamma")
+QDEF(MP_QSTR_list, (const byte*)"\x27\x1d\x04" "list")
+QDEF(MP_QSTR_listen, (const byte*)"\xcc\x0e\x06" "listen")
+QDEF(MP_QSTR_little, (const byte*)"\x89\x6a\x06" "little")
+QDEF(MP_QSTR_load, (const byte*)"\x63\x24\x04" "load")
+QDEF(MP_QSTR_loads, (const byte*)"\xb0\xb0\x05" "loads")
+QDEF(MP_QSTR_locals, (const byte*)"\x3b\xa1\x06" "locals")
+QDEF(MP_QSTR_localtime, (const byte*)"\x7d\x46\x09" "localtime")
+QDEF(MP_QSTR_lock, (const byte*)"\xae\x23\x04" "lock")
+QDEF(MP_QSTR_locked, (const byte*)"\x0f\xba\x06" "locked")
+QDEF(MP_QSTR_log, (const byte*)"\x21\x3f\x03" "log")
+QDEF(MP_QSTR_log10, (const byte*)"\x40\x91\x05" "log10")
+QDEF(MP_QSTR_log2, (const byte*)"\x73\x23\x04" "log2")
+QDEF(MP_QSTR_lower, (const byte*)"\xc6\xcb\x05" "lower")
+QDEF(MP_QSTR_lstrip, (const byte*)"\xe5\xb9\x06" "lstrip")
+QDEF(MP_QSTR_makefile, (const byte*)"\xc1\xd5\x08" "makefile")
+QDEF(MP_QSTR_map, (const byte*)"\xb9\x43\x03" "map")
+QDEF(MP_QSTR_match, (const byte*)"\x96\x22\x05" "match")
+QDEF(MP_QSTR_math, (const byte*)"\x35\xbb\x04" "math")
+QDEF(MP_QSTR_max, (const byte*)"\xb1\x43\x03" "max")
+QDEF(MP_QSTR_maxsize, (const byte*)"\xd4\x70\x07" "maxsize")
+QDEF(MP_QSTR_mem, (const byte*)"\x20\x44\x03" "mem")
+QDEF(MP_QSTR_mem16, (const byte*)"\x07\xca\x05" "mem16")
+QDEF(MP_QSTR_mem32, (const byte*)"\x41\xca\x05" "mem32")
+QDEF(MP_QSTR_mem8, (const byte*)"\x18\xc8\x04" "mem8")
+QDEF(MP_QSTR_mem_alloc, (const byte*)"\x52\x2b\x09" "mem_alloc")
+QDEF(MP_QSTR_mem_current, (const byte*)"\x16\xba\x0b" "mem_current")
+QDEF(MP_QSTR_mem_free, (const byte*)"\xcb\x62\x08" "mem_free")
+QDEF(MP_QSTR_mem_info, (const byte*)"\xd1\xf1\x08" "mem_info")
+QDEF(MP_QSTR_mem_peak, (const byte*)"\x40\x25\x08" "mem_peak")
+QDEF(MP_QSTR_mem_total, (const byte*)"\xfd\x6a\x09" "mem_total")
+QDEF(MP_QSTR_memoryview, (const byte*)"\x69\x44\x0a" "memoryview")
+QDEF(MP_QSTR_micropython, (const byte*)"\x0b\x7c\x0b" "micropython")
+QDEF(MP_QSTR_min, (const byte*)"\xaf\x42\x03" "min")
+QDEF(MP_QSTR_mkdir, (const byte*)"\x9c\xb5\x05" "mkdir")
+QDEF(MP_QSTR_mode, (const byte*)"\x26\xc0\x04" "mode")
+QDEF(MP_QSTR_modf, (const byte*)"\x25\xc0\x04" "modf")
+QDEF(MP_QSTR_modify, (const byte*)"\xf5\x66\x06" "modify")
+QDEF(MP_QSTR_module, (const byte*)"\xbf\x99\x06" "module")
+QDEF(MP_QSTR_modules, (const byte*)"\xec\xd1\x07" "modules")
+QDEF(MP_QSTR_moving_average, (const byte*)"\x8d\xc4\x0e" "moving_average")
+QDEF(MP_QSTR_mul, (const byte*)"\x31\x46\x03" "mul")
+QDEF(MP_QSTR_name, (const byte*)"\xa2\x75\x04" "name")
+QDEF(MP_QSTR_namedtuple, (const byte*)"\x1e\x16\x0a" "namedtuple")
+QDEF(MP_QSTR_native, (const byte*)"\x84\x0b\x06" "native")
+QDEF(MP_QSTR_next, (const byte*)"\x42\x88\x04" "next")
+QDEF(MP_QSTR_object, (const byte*)"\x90\x8d\x06" "object")
+QDEF(MP_QSTR_oct, (const byte*)"\xfd\x5c\x03" "oct")
+QDEF(MP_QSTR_off, (const byte*)"\x8a\x5c\x03" "off")
+QDEF(MP_QSTR_offset, (const byte*)"\x48\x3c\x06" "offset")
+QDEF(MP_QSTR_on, (const byte*)"\x64\x6f\x02" "on")
+QDEF(MP_QSTR_open, (const byte*)"\xd1\x3a\x04" "open")
+QDEF(MP_QSTR_opt_level, (const byte*)"\x87\x67\x09" "opt_level")
+QDEF(MP_QSTR_ord, (const byte*)"\x1c\x5e\x03" "ord")
+QDEF(MP_QSTR_out, (const byte*)"\x2b\x5f\x03" "out")
+QDEF(MP_QSTR_pack, (const byte*)"\xbc\xd1\x04" "pack")
+QDEF(MP_QSTR_pack_into, (const byte*)"\x1f\xa9\x09" "pack_into")
+QDEF(MP_QSTR_partition, (const byte*)"\x87\xe5\x09" "partition")
+QDEF(MP_QSTR_path, (const byte*)"\x88\xce\x04" "path")
+QDEF(MP_QSTR_pause_stats, (const byte*)"\x89\x12\x0b" "pause_stats")
+QDEF(MP_QSTR_peektime, (const byte*)"\x8b\x5c\x08" "peektime")
+QDEF(MP_QSTR_pend_throw, (const byte*)"\xf3\x74\x0a" "pend_throw")
+QDEF(MP_QSTR_phase, (const byte*)"\x6a\xd5\x05" "phase")
+QDEF(MP_QSTR_pi, (const byte*)"\x1c\x70\x02" "pi")
+QDEF(MP_QSTR_platform, (const byte*)"\x3a\x19\x08" "platform")
+QDEF(MP_QSTR_polar, (const byte*)"\x05\x0c\x05" "polar")
+QDEF(MP_QSTR_poll, (const byte*)"\x9a\xd9\x04" "poll")
+QDEF(MP_QSTR_pop, (const byte*)"\x2a\x73\x03" "pop")
+QDEF(MP_QSTR_popitem, (const byte*)"\xbf\x2c\x07" "popitem")
+QDEF(MP_QSTR_popleft, (const byte*)"\x71\x9a\x07" "popleft")
+QDEF(MP_QSTR_pow, (const byte*)"\x2d\x73\x03" "pow")
+QDEF(MP_QSTR_print, (const byte*)"\x54\xc6\x05" "print")
+QDEF(MP_QSTR_print_exception, (const byte*)"\x1c\x22\x0f" "print_exception")
+QDEF(MP_QSTR_profile_dump, (const byte*)"\x3d\x96\x0c" "profile_dump")
+QDEF(MP_QSTR_profile_start, (const byte*)"\xd1\x9f\x0d" "profile_start")
+QDEF(MP_QSTR_profile_stop, (const byte*)"\xc9\xbf\x0c" "profile_stop")
+QDEF(MP_QSTR_property, (const byte*)"\xc2\x29\x08" "property")
+QDEF(MP_QSTR_protocol_pin, (const byte*)"\x1b\x57\x0c" "protocol_pin")
+QDEF(MP_QSTR_protocol_stream, (const byte*)"\x90\x24\x0f" "protocol_stream")
+QDEF(MP_QSTR_ptr, (const byte*)"\x53\x70\x03" "ptr")
+QDEF(MP_QSTR_ptr16, (const byte*)"\xf4\xca\x05" "ptr16")
+QDEF(MP_QSTR_ptr32, (const byte*)"\xb2\xca\x05" "ptr32")
+QDEF(MP_QSTR_ptr8, (const byte*)"\x8b\x7a\x04" "ptr8")
+QDEF(MP_QSTR_push, (const byte*)"\xbb\x7e\x04" "push")
+QDEF(MP_QSTR_qstr_info, (const byte*)"\xb0\x81\x09" "qstr_info")
+QDEF(MP_QSTR_r, (const byte*)"\xd7\xb5\x01" "r")
+QDEF(MP_QSTR_radians, (const byte*)"\x87\x3f\x07" "radians")
+QDEF(MP_QSTR_range, (const byte*)"\x1a\x5e\x05" "range")
+QDEF(MP_QSTR_read, (const byte*)"\xb7\xf9\x04" "read")
+QDEF(MP_QSTR_readinto, (const byte*)"\x4b\xbf\x08" "readinto")
+QDEF(MP_QSTR_readline, (const byte*)"\xf9\x19\x08" "readline")
+QDEF(MP_QSTR_readlines, (const byte*)"\x6a\x59\x09" "readlines")
+QDEF(MP_QSTR_real, (const byte*)"\xbf\xf9\x04" "real")
+QDEF(MP_QSTR_rect, (const byte*)"\xe5\xf9\x04" "rect")
+QDEF(MP_QSTR_recv, (const byte*)"\xe7\xf9\x04" "recv")
+QDEF(MP_QSTR_recvfrom, (const byte*)"\x91\x90\x08" "recvfrom")
+QDEF(MP_QSTR_register, (const byte*)"\xac\xa1\x08" "register")
+QDEF(MP_QSTR_release, (const byte*)"\xec\x8f\x07" "release")
+QDEF(MP_QSTR_remove, (const byte*)"\x63\x8a\x06" "remove")
+QDEF(MP_QSTR_replace, (const byte*)"\x49\x25\x07" "replace")
+QDEF(MP_QSTR_repr, (const byte*)"\xd0\xf7\x04" "repr")
+QDEF(MP_QSTR_reverse, (const byte*)"\x25\x2a\x07" "reverse")
+QDEF(MP_QSTR_reversed, (const byte*)"\xa1\x6e\x08" "reversed")
+QDEF(MP_QSTR_rfind, (const byte*)"\xd2\x9c\x05" "rfind")
+QDEF(MP_QSTR_rindex, (const byte*)"\xe9\x2b\x06" "rindex")
+QDEF(MP_QSTR_round, (const byte*)"\xe7\x25\x05" "round")
+QDEF(MP_QSTR_rpartition, (const byte*)"\x15\xd0\x0a" "rpartition")
+QDEF(MP_QSTR_rsplit, (const byte*)"\xa5\x00\x06" "rsplit")
+QDEF(MP_QSTR_rstrip, (const byte*)"\x3b\x95\x06" "rstrip")
+QDEF(MP_QSTR_scale, (const byte*)"\x7d\x51\x05" "scale")
+QDEF(MP_QSTR_search, (const byte*)"\xab\xc1\x06" "search")
+QDEF(MP_QSTR_seed, (const byte*)"\x92\x75\x04" "seed")
+QDEF(MP_QSTR_seek, (const byte*)"\x9d\x75\x04" "seek")
+QDEF(MP_QSTR_send, (const byte*)"\xb9\x76\x04" "send")
+QDEF(MP_QSTR_sendto, (const byte*)"\x22\x03\x06" "sendto")
+QDEF(MP_QSTR_sep, (const byte*)"\x23\x8f\x03" "sep")
+QDEF(MP_QSTR_set, (const byte*)"\x27\x8f\x03" "set")
+QDEF(MP_QSTR_setattr, (const byte*)"\xd4\xa8\x07" "setattr")
+QDEF(MP_QSTR_setblocking, (const byte*)"\x6e\x18\x0b" "setblocking")
+QDEF(MP_QSTR_setdefault, (const byte*)"\x6c\xa3\x0a" "setdefault")
+QDEF(MP_QSTR_setraw, (const byte*)"\x83\x71\x06" "setraw")
+QDEF(MP_QSTR_setsockopt, (const byte*)"\x38\xe8\x0a" "setsockopt")
+QDEF(MP_QSTR_setter, (const byte*)"\x04\x59\x06" "setter")
+QDEF(MP_QSTR_sha256, (const byte*)"\x2e\x01\x06" "sha256")
+QDEF(MP_QSTR_sin, (const byte*)"\xb1\x90\x03" "sin")
+QDEF(MP_QSTR_single, (const byte*)"\x3f\x20\x06" "single")
+QDEF(MP_QSTR_sinh, (const byte*)"\xb9\xa6\x04" "sinh")
+QDEF(MP_QSTR_sizeof, (const byte*)"\x49\x73\x06" "sizeof")
+QDEF(MP_QSTR_sleep, (const byte*)"\xea\x27\x05" "sleep")
+QDEF(MP_QSTR_sleep_ms, (const byte*)"\x0b\x63\x08" "sleep_ms")
+QDEF(MP_QSTR_sleep_us, (const byte*)"\x13\x60\x08" "sleep_us")
+QDEF(MP_QSTR_slice, (const byte*)"\xb5\xf4\x05" "slice")
+QDEF(MP_QSTR_sockaddr, (const byte*)"\x62\x8c\x08" "sockaddr")
+QDEF(MP_QSTR_socket, (const byte*)"\x60\xcc\x06" "socket")
+QDEF(MP_QSTR_sort, (const byte*)"\xbf\x9d\x04" "sort")
+QDEF(MP_QSTR_sorted, (const byte*)"\x5e\x15\x06" "sorted")
+QDEF(MP_QSTR_split, (const byte*)"\xb7\x33\x05" "split")
+QDEF(MP_QSTR_splitlines, (const byte*)"\x6a\xd3\x0a" "splitlines")
+QDEF(MP_QSTR_sqrt, (const byte*)"\x21\x44\x04" "sqrt")
+QDEF(MP_QSTR_stack_size, (const byte*)"\x31\x3b\x0a" "stack_size")
+QDEF(MP_QSTR_stack_use, (const byte*)"\x97\xf7\x09" "stack_use")
+QDEF(MP_QSTR_start, (const byte*)"\x85\xef\x05" "start")
+QDEF(MP_QSTR_start_new_thread, (const byte*)"\xd7\x25\x10" "start_new_thread")
+QDEF(MP_QSTR_startswith, (const byte*)"\x74\xe8\x0a" "startswith")
+QDEF(MP_QSTR_stat, (const byte*)"\xd7\x35\x04" "stat")
+QDEF(MP_QSTR_staticmethod, (const byte*)"\x62\xaf\x0c" "staticmethod")
+QDEF(MP_QSTR_statvfs, (const byte*)"\x14\x19\x07" "statvfs")
+QDEF(MP_QSTR_stderr, (const byte*)"\xa3\x58\x06" "stderr")
+QDEF(MP_QSTR_stdin, (const byte*)"\x21\x04\x05" "stdin")
+QDEF(MP_QSTR_stdout, (const byte*)"\x08\x83\x06" "stdout")
+QDEF(MP_QSTR_step, (const byte*)"\x57\x36\x04" "step")
+QDEF(MP_QSTR_stop, (const byte*)"\x9d\x36\x04" "stop")
+QDEF(MP_QSTR_str, (const byte*)"\x50\x8d\x03" "str")
+QDEF(MP_QSTR_strerror, (const byte*)"\x48\x71\x08" "strerror")
+QDEF(MP_QSTR_strip, (const byte*)"\x29\x1e\x05" "strip")
+QDEF(MP_QSTR_struct, (const byte*)"\x12\x90\x06" "struct")
+QDEF(MP_QSTR_sum, (const byte*)"\x2e\x8d\x03" "sum")
+QDEF(MP_QSTR_super, (const byte*)"\xc4\xb2\x05" "super")
+QDEF(MP_QSTR_sweep_budget, (const byte*)"\xcb\x75\x0c" "sweep_budget")
+QDEF(MP_QSTR_symmetric_difference, (const byte*)"\xce\x67\x14" "symmetric_difference")
+QDEF(MP_QSTR_symmetric_difference_update, (const byte*)"\x60\xf8\x1b" "symmetric_difference_update")
+QDEF(MP_QSTR_sys, (const byte*)"\xbc\x8e\x03" "sys")
+QDEF(MP_QSTR_system, (const byte*)"\xa0\x14\x06" "system")
+QDEF(MP_QSTR_tan, (const byte*)"\xfe\x61\x03" "tan")
+QDEF(MP_QSTR_tanh, (const byte*)"\xd6\xa1\x04" "tanh")
+QDEF(MP_QSTR_tb_frame, (const byte*)"\x31\xed\x08" "tb_frame")
+QDEF(MP_QSTR_tb_lasti, (const byte*)"\xaf\xe9\x08" "tb_lasti")
+QDEF(MP_QSTR_tb_lineno, (const byte*)"\x23\xcf\x09" "tb_lineno")
+QDEF(MP_QSTR_tb_next, (const byte*)"\xeb\x14\x07" "tb_next")
+QDEF(MP_QSTR_tcgetattr, (const byte*)"\xb7\xc5\x09" "tcgetattr")
+QDEF(MP_QSTR_tcsetattr, (const byte*)"\xa3\x34\x09" "tcsetattr")
+QDEF(MP_QSTR_tell, (const byte*)"\x14\xb1\x04" "tell")
+QDEF(MP_QSTR_termios, (const byte*)"\x7e\xdf\x07" "termios")
+QDEF(MP_QSTR_threshold, (const byte*)"\xf2\x2f\x09" "threshold")
+QDEF(MP_QSTR_throw, (const byte*)"\xb3\x44\x05" "throw")
+QDEF(MP_QSTR_ticks_add, (const byte*)"\x9d\xae\x09" "ticks_add")
+QDEF(MP_QSTR_ticks_cpu, (const byte*)"\x1a\xa5\x09" "ticks_cpu")
+QDEF(MP_QSTR_ticks_diff, (const byte*)"\xb1\xe0\x0a" "ticks_diff")
+QDEF(MP_QSTR_ticks_ms, (const byte*)"\x42\x32\x08" "ticks_ms")
+QDEF(MP_QSTR_ticks_us, (const byte*)"\x5a\x31\x08" "ticks_us")
+QDEF(MP_QSTR_time, (const byte*)"\xf0\xc1\x04" "time")
+QDEF(MP_QSTR_time_pulse_us, (const byte*)"\x89\x0c\x0d" "time_pulse_us")
+QDEF(MP_QSTR_to_bytes, (const byte*)"\xd8\x3e\x08" "to_bytes")
+QDEF(MP_QSTR_traceback, (const byte*)"\xcf\xb2\x09" "traceback")
+QDEF(MP_QSTR_trunc, (const byte*)"\x5b\x99\x05" "trunc")
+QDEF(MP_QSTR_tuple, (const byte*)"\xfd\x41\x05" "tuple")
+QDEF(MP_QSTR_type, (const byte*)"\x9d\x7f\x04" "type")
+QDEF(MP_QSTR_uctypes, (const byte*)"\xf8\x71\x07" "uctypes")
+QDEF(MP_QSTR_uerrno, (const byte*)"\xb4\xe9\x06" "uerrno")
+QDEF(MP_QSTR_uheapq, (const byte*)"\x1d\x43\x06" "uheapq")
+QDEF(MP_QSTR_uint, (const byte*)"\xe3\x3d\x04" "uint")
+QDEF(MP_QSTR_uio, (const byte*)"\xb6\x66\x03" "uio")
+QDEF(MP_QSTR_ujson, (const byte*)"\xe8\x30\x05" "ujson")
+QDEF(MP_QSTR_umachine, (const byte*)"\x95\x7f\x08" "umachine")
+QDEF(MP_QSTR_unhexlify, (const byte*)"\xb1\xb9\x09" "unhexlify")
+QDEF(MP_QSTR_union, (const byte*)"\xf6\x7c\x05" "union")
+QDEF(MP_QSTR_unlink, (const byte*)"\xfe\x8f\x06" "unlink")
+QDEF(MP_QSTR_unpack, (const byte*)"\x07\x3c\x06" "unpack")
+QDEF(MP_QSTR_unpack_from, (const byte*)"\x0e\x6d\x0b" "unpack_from")
+QDEF(MP_QSTR_unregister, (const byte*)"\x17\xd4\x0a" "unregister")
+QDEF(MP_QSTR_uos, (const byte*)"\xec\x67\x03" "uos")
+QDEF(MP_QSTR_update, (const byte*)"\xb4\x76\x06" "update")
+QDEF(MP_QSTR_upper, (const byte*)"\x27\x94\x05" "upper")
+QDEF(MP_QSTR_urandom, (const byte*)"\xab\xae\x07" "urandom")
+QDEF(MP_QSTR_ure, (const byte*)"\x87\x63\x03" "ure")
+QDEF(MP_QSTR_uselect, (const byte*)"\x58\x8e\x07" "uselect")
+QDEF(MP_QSTR_usocket, (const byte*)"\x75\x00\x07" "usocket")
+QDEF(MP_QSTR_ustruct, (const byte*)"\x47\x08\x07" "ustruct")
+QDEF(MP_QSTR_utime, (const byte*)"\xe5\x9d\x05" "utime")
+QDEF(MP_QSTR_utimeq, (const byte*)"\xf4\x5a\x06" "utimeq")
+QDEF(MP_QSTR_value, (const byte*)"\x4e\x34\x05" "value")
+QDEF(MP_QSTR_values, (const byte*)"\x7d\xbe\x06" "values")
+QDEF(MP_QSTR_version, (const byte*)"\xbf\xd3\x07" "version")
+QDEF(MP_QSTR_version_info, (const byte*)"\x6e\x0a\x0c" "version_info")
+QDEF(MP_QSTR_viper, (const byte*)"\x5d\x23\x05" "viper")
+QDEF(MP_QSTR_websocket, (const byte*)"\x90\x8d\x09" "websocket")
+QDEF(MP_QSTR_window, (const byte*)"\x89\xc3\x06" "window")
+QDEF(MP_QSTR_write, (const byte*)"\x98\xa8\x05" "write")
+QDEF(MP_QSTR_zip, (const byte*)"\xe6\xac\x03" "zip")
+QINDEX(MP_QSTR_find)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_gamma)
+QINDEX(MP_QSTR___file__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_polar)
+QINDEX(MP_QSTR_ceil)
+QINDEX(MP_QSTR_encoding)
+QINDEX(MP_QSTR___isub__)
+QINDEX(MP_QSTR___lshift__)
+QINDEX(MP_QSTR_unpack)
+QINDEX(MP_QSTR_micropython)
+QINDEX(MP_QSTR_co_lnotab)
+QINDEX(MP_QSTR_callable)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_insert)
+QINDEX(MP_QSTR_B57600)
+QINDEX(MP_QSTR_sleep_us)
+QINDEX(MP_QSTR_rpartition)
+QINDEX(MP_QSTR_struct)
+QINDEX(MP_QSTR_NoneType)
+QINDEX(MP_QSTR_mem8)
+QINDEX(MP_QSTR_BF_LEN)
+QINDEX(MP_QSTR_unregister)
+QINDEX(MP_QSTR_acos)
+QINDEX(MP_QSTR_frexp)
+QINDEX(MP_QSTR_pi)
+QINDEX(MP_QSTR_exec)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___xor__)
+QINDEX(MP_QSTR_EAGAIN)
+QINDEX(MP_QSTR_ImportError)
+QINDEX(MP_QSTR_mem)
+QINDEX(MP_QSTR_sqrt)
+QINDEX(MP_QSTR_modf)
+QINDEX(MP_QSTR_mode)
+QINDEX(MP_QSTR_stdin)
+QINDEX(MP_QSTR_upper)
+QINDEX(MP_QSTR___pos__)
+QINDEX(MP_QSTR___ror__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___pow__)
+QINDEX(MP_QSTR_ArithmeticError)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_copysign)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_float)
+QINDEX(MP_QSTR_LockType)
+QINDEX(MP_QSTR_from_bytes)
+QINDEX(MP_QSTR_setsockopt)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_ECONNREFUSED)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_dict)
+QINDEX(MP_QSTR___getattr__)
+QINDEX(MP_QSTR_single)
+QINDEX(MP_QSTR___build_class__)
+QINDEX(MP_QSTR_next)
+QINDEX(MP_QSTR_f_globals)
+QINDEX(MP_QSTR___exit__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_ustruct)
+QINDEX(MP_QSTR_offset)
+QINDEX(MP_QSTR_co_flags)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___aenter__)
+QINDEX(MP_QSTR_calcsize)
+QINDEX(MP_QSTR_value)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_ptr)
+QINDEX(MP_QSTR___rfloordiv__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___rshift__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_indices)
+QINDEX(MP_QSTR___func__)
+QINDEX(MP_QSTR_IndentationError)
+QINDEX(MP_QSTR___lt__)
+QINDEX(MP_QSTR_isspace)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_socket)
+QINDEX(MP_QSTR_UINT64)
+QINDEX(MP_QSTR_len)
+QINDEX(MP_QSTR_extend)
+QINDEX(MP_QSTR_load)
+QINDEX(MP_QSTR_sockaddr)
+QINDEX(MP_QSTR_symmetric_difference_update)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_memoryview)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___qualname__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_getaddrinfo)
+QINDEX(MP_QSTR_setblocking)
+QINDEX(MP_QSTR_hex)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_difference)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_startswith)
+QINDEX(MP_QSTR_usocket)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_getvalue)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_cos)
+QINDEX(MP_QSTR_index)
+QINDEX(MP_QSTR_clear)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___dict__)
+QINDEX(MP_QSTR__lt_lambda_gt_)
+QINDEX(MP_QSTR__dot_frozen)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___anext__)
+QINDEX(MP_QSTR_bind)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_time_pulse_us)
+QINDEX(MP_QSTR_off)
+QINDEX(MP_QSTR_peektime)
+QINDEX(MP_QSTR_hasattr)
+QINDEX(MP_QSTR_moving_average)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_protocol_stream)
+QINDEX(MP_QSTR_binascii)
+QINDEX(MP_QSTR_recvfrom)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_f_back)
+QINDEX(MP_QSTR_write)
+QINDEX(MP_QSTR_MSG_DONTWAIT)
+QINDEX(MP_QSTR_EINPROGRESS)
+QINDEX(MP_QSTR_Signal)
+QINDEX(MP_QSTR_bytearray_at)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_system)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_stderr)
+QINDEX(MP_QSTR_tcsetattr)
+QINDEX(MP_QSTR_rsplit)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_join)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_heap_lock)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_loads)
+QINDEX(MP_QSTR_sin)
+QINDEX(MP_QSTR_ticks_diff)
+QINDEX(MP_QSTR_PTR)
+QINDEX(MP_QSTR_SOCK_DGRAM)
+QINDEX(MP_QSTR_classmethod)
+QINDEX(MP_QSTR_cmath)
+QINDEX(MP_QSTR_hash)
+QINDEX(MP_QSTR_divmod)
+QINDEX(MP_QSTR_invert)
+QINDEX(MP_QSTR_group)
+QINDEX(MP_QSTR_slice)
+QINDEX(MP_QSTR_throw)
+QINDEX(MP_QSTR__lt_module_gt_)
+QINDEX(MP_QSTR_f_trace)
+QINDEX(MP_QSTR_popitem)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_f_locals)
+QINDEX(MP_QSTR_file)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NotImplementedError)
+QINDEX(MP_QSTR_co_nlocals)
+QINDEX(MP_QSTR_exp)
+QINDEX(MP_QSTR_inet_pton)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_digest)
+QINDEX(MP_QSTR_lgamma)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___slots__)
+QINDEX(MP_QSTR_rfind)
+QINDEX(MP_QSTR_maxsize)
+QINDEX(MP_QSTR_setattr)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_delattr)
+QINDEX(MP_QSTR_chr)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_POLLERR)
+QINDEX(MP_QSTR_bin)
+QINDEX(MP_QSTR_collections)
+QINDEX(MP_QSTR___len__)
+QINDEX(MP_QSTR___name__)
+QINDEX(MP_QSTR_filename)
+QINDEX(MP_QSTR_fmod)
+QINDEX(MP_QSTR_zip)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_ujson)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_KeyError)
+QINDEX(MP_QSTR_StopIteration)
+QINDEX(MP_QSTR_StopAsyncIteration)
+QINDEX(MP_QSTR_bool)
+QINDEX(MP_QSTR_frozenset)
+QINDEX(MP_QSTR_tb_next)
+QINDEX(MP_QSTR_Ellipsis)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_pend_throw)
+QINDEX(MP_QSTR_co_freevars)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_union)
+QINDEX(MP_QSTR___hash__)
+QINDEX(MP_QSTR_isdisjoint)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_islower)
+QINDEX(MP_QSTR_SO_LINGER)
+QINDEX(MP_QSTR_issuperset)
+QINDEX(MP_QSTR___module__)
+QINDEX(MP_QSTR_ETIMEDOUT)
+QINDEX(MP_QSTR_oct)
+QINDEX(MP_QSTR_degrees)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_setter)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_deque)
+QINDEX(MP_QSTR_intersection_update)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_unpack_from)
+QINDEX(MP_QSTR_discard)
+QINDEX(MP_QSTR_errorcode)
+QINDEX(MP_QSTR_hashlib)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_statvfs)
+QINDEX(MP_QSTR_tell)
+QINDEX(MP_QSTR___radd__)
+QINDEX(MP_QSTR_EADDRINUSE)
+QINDEX(MP_QSTR_implementation)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_ticks_cpu)
+QINDEX(MP_QSTR___rlshift__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_pack_into)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___sub__)
+QINDEX(MP_QSTR_UnicodeError)
+QINDEX(MP_QSTR_bytecode)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___getitem__)
+QINDEX(MP_QSTR_list)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___bool__)
+QINDEX(MP_QSTR___class__)
+QINDEX(MP_QSTR_clock)
+QINDEX(MP_QSTR_dict_view)
+QINDEX(MP_QSTR_sha256)
+QINDEX(MP_QSTR_sum)
+QINDEX(MP_QSTR_tb_frame)
+QINDEX(MP_QSTR_key)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_DEBUG)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_fromkeys)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_platform)
+QINDEX(MP_QSTR_locals)
+QINDEX(MP_QSTR_rstrip)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_isinf)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_log10)
+QINDEX(MP_QSTR_mem_peak)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_EALREADY)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_strerror)
+QINDEX(MP_QSTR_replace)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_asin)
+QINDEX(MP_QSTR_str)
+QINDEX(MP_QSTR_BF_POS)
+QINDEX(MP_QSTR_EEXIST)
+QINDEX(MP_QSTR__lt_setcomp_gt_)
+QINDEX(MP_QSTR_ipoll)
+QINDEX(MP_QSTR_TCSANOW)
+QINDEX(MP_QSTR_filename2)
+QINDEX(MP_QSTR_heap_unlock)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_addressof)
+QINDEX(MP_QSTR_ticks_us)
+QINDEX(MP_QSTR_trunc)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_ENOENT)
+QINDEX(MP_QSTR___init__)
+QINDEX(MP_QSTR_sorted)
+QINDEX(MP_QSTR_RuntimeError)
+QINDEX(MP_QSTR_byteorder)
+QINDEX(MP_QSTR___rmul__)
+QINDEX(MP_QSTR_flush)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_getrandbits)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___neg__)
+QINDEX(MP_QSTR_phase)
+QINDEX(MP_QSTR_readlines)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_None)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_POLLOUT)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___divmod__)
+QINDEX(MP_QSTR___new__)
+QINDEX(MP_QSTR_dumps)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_AF_INET6)
+QINDEX(MP_QSTR_POLLIN)
+QINDEX(MP_QSTR_scale)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_OverflowError)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_IndexError)
+QINDEX(MP_QSTR_setraw)
+QINDEX(MP_QSTR__space_)
+QINDEX(MP_QSTR_EHOSTUNREACH)
+QINDEX(MP_QSTR_accept)
+QINDEX(MP_QSTR_co_varnames)
+QINDEX(MP_QSTR_inet_ntop)
+QINDEX(MP_QSTR__slash_)
+QINDEX(MP_QSTR_partition)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR__star_)
+QINDEX(MP_QSTR_iter)
+QINDEX(MP_QSTR_f_code)
+QINDEX(MP_QSTR_object)
+QINDEX(MP_QSTR_seed)
+QINDEX(MP_QSTR_websocket)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_atanh)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_isenabled)
+QINDEX(MP_QSTR_collect)
+QINDEX(MP_QSTR_mkdir)
+QINDEX(MP_QSTR_globals)
+QINDEX(MP_QSTR_poll)
+QINDEX(MP_QSTR_seek)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_OSError)
+QINDEX(MP_QSTR_co_names)
+QINDEX(MP_QSTR_name)
+QINDEX(MP_QSTR_ENOMEM)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_count)
+QINDEX(MP_QSTR___call__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_decode)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_search)
+QINDEX(MP_QSTR_register)
+QINDEX(MP_QSTR_TextIOWrapper)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR__0x0a_)
+QINDEX(MP_QSTR_heapify)
+QINDEX(MP_QSTR_qstr_info)
+QINDEX(MP_QSTR_tb_lasti)
+QINDEX(MP_QSTR_unhexlify)
+QINDEX(MP_QSTR_uerrno)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_bytes_at)
+QINDEX(MP_QSTR_read)
+QINDEX(MP_QSTR_tcgetattr)
+QINDEX(MP_QSTR_issubset)
+QINDEX(MP_QSTR_NameError)
+QINDEX(MP_QSTR_UINT8)
+QINDEX(MP_QSTR_pack)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_module)
+QINDEX(MP_QSTR_e)
+QINDEX(MP_QSTR_errno)
+QINDEX(MP_QSTR_makefile)
+QINDEX(MP_QSTR_property)
+QINDEX(MP_QSTR_a)
+QINDEX(MP_QSTR___rrshift__)
+QINDEX(MP_QSTR_FileIO)
+QINDEX(MP_QSTR_b)
+QINDEX(MP_QSTR_complex)
+QINDEX(MP_QSTR_factor)
+QINDEX(MP_QSTR_real)
+QINDEX(MP_QSTR_sort)
+QINDEX(MP_QSTR__lt_dictcomp_gt_)
+QINDEX(MP_QSTR_atan2)
+QINDEX(MP_QSTR_INT8)
+QINDEX(MP_QSTR_default)
+QINDEX(MP_QSTR___str__)
+QINDEX(MP_QSTR_mem_info)
+QINDEX(MP_QSTR_sweep_budget)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR__lt_listcomp_gt_)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_tanh)
+QINDEX(MP_QSTR_r)
+QINDEX(MP_QSTR_start_new_thread)
+QINDEX(MP_QSTR_stat)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_connect)
+QINDEX(MP_QSTR___bytes__)
+QINDEX(MP_QSTR___delete__)
+QINDEX(MP_QSTR_ViperTypeError)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_uint)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_lstrip)
+QINDEX(MP_QSTR_rect)
+QINDEX(MP_QSTR_recv)
+QINDEX(MP_QSTR_round)
+QINDEX(MP_QSTR_co_kwonlyargcount)
+QINDEX(MP_QSTR_utime)
+QINDEX(MP_QSTR_MSG_DONTROUTE)
+QINDEX(MP_QSTR_allocate_lock)
+QINDEX(MP_QSTR_modules)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_time)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_Exception)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_INT64)
+QINDEX(MP_QSTR_compile)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_AF_UNIX)
+QINDEX(MP_QSTR_builtins)
+QINDEX(MP_QSTR_readline)
+QINDEX(MP_QSTR__)
+QINDEX(MP_QSTR_co_code)
+QINDEX(MP_QSTR_alloc_profile)
+QINDEX(MP_QSTR___delitem__)
+QINDEX(MP_QSTR_get_ident)
+QINDEX(MP_QSTR_BIG_ENDIAN)
+QINDEX(MP_QSTR_LookupError)
+QINDEX(MP_QSTR_f_lasti)
+QINDEX(MP_QSTR_tan)
+QINDEX(MP_QSTR_ReloadException)
+QINDEX(MP_QSTR_NATIVE)
+QINDEX(MP_QSTR_enable)
+QINDEX(MP_QSTR_BFUINT32)
+QINDEX(MP_QSTR_BaseException)
+QINDEX(MP_QSTR_mem16)
+QINDEX(MP_QSTR_tuple)
+QINDEX(MP_QSTR_uctypes)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_locked)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_GeneratorExit)
+QINDEX(MP_QSTR_mem_current)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_range)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_ord)
+QINDEX(MP_QSTR_print_exception)
+QINDEX(MP_QSTR_namedtuple)
+QINDEX(MP_QSTR_atan)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_AttributeError)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_co_firstlineno)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_TypeError)
+QINDEX(MP_QSTR_filter)
+QINDEX(MP_QSTR_function)
+QINDEX(MP_QSTR_intersection)
+QINDEX(MP_QSTR_iterable)
+QINDEX(MP_QSTR_reverse)
+QINDEX(MP_QSTR_strip)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___mul__)
+QINDEX(MP_QSTR___rmod__)
+QINDEX(MP_QSTR___setitem__)
+QINDEX(MP_QSTR__lt_genexpr_gt_)
+QINDEX(MP_QSTR_SOCK_STREAM)
+QINDEX(MP_QSTR_IOBase)
+QINDEX(MP_QSTR_EACCES)
+QINDEX(MP_QSTR___import__)
+QINDEX(MP_QSTR_VOID)
+QINDEX(MP_QSTR_mul)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_profile_dump)
+QINDEX(MP_QSTR_NotImplemented)
+QINDEX(MP_QSTR_SO_ERROR)
+QINDEX(MP_QSTR_BFUINT16)
+QINDEX(MP_QSTR_mem32)
+QINDEX(MP_QSTR_ticks_ms)
+QINDEX(MP_QSTR_encode)
+QINDEX(MP_QSTR_add)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_iterator)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_BFINT8)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_arraymath)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_BFINT32)
+QINDEX(MP_QSTR_print)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_INT32)
+QINDEX(MP_QSTR_step)
+QINDEX(MP_QSTR_uselect)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_ARRAY)
+QINDEX(MP_QSTR_arena)
+QINDEX(MP_QSTR_bytes)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_gc)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_remove)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_co_cellvars)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_code)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR__percent__hash_o)
+QINDEX(MP_QSTR___enter__)
+QINDEX(MP_QSTR___iadd__)
+QINDEX(MP_QSTR_version_info)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___eq__)
+QINDEX(MP_QSTR_enumerate)
+QINDEX(MP_QSTR_maximum_space_recursion_space_depth_space_exceeded)
+QINDEX(MP_QSTR_closure)
+QINDEX(MP_QSTR_expm1)
+QINDEX(MP_QSTR_StringIO)
+QINDEX(MP_QSTR_POLLHUP)
+QINDEX(MP_QSTR_erfc)
+QINDEX(MP_QSTR_frame)
+QINDEX(MP_QSTR_ilistdir)
+QINDEX(MP_QSTR__percent__hash_x)
+QINDEX(MP_QSTR_array)
+QINDEX(MP_QSTR_co_stacksize)
+QINDEX(MP_QSTR_floor)
+QINDEX(MP_QSTR_input)
+QINDEX(MP_QSTR_ioctl)
+QINDEX(MP_QSTR_localtime)
+QINDEX(MP_QSTR_fileno)
+QINDEX(MP_QSTR_popleft)
+QINDEX(MP_QSTR_values)
+QINDEX(MP_QSTR_exit)
+QINDEX(MP_QSTR_EIO)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_B9600)
+QINDEX(MP_QSTR_little)
+QINDEX(MP_QSTR_path)
+QINDEX(MP_QSTR_pause_stats)
+QINDEX(MP_QSTR_ptr8)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_f_builtins)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_getter)
+QINDEX(MP_QSTR_INT16)
+QINDEX(MP_QSTR_disable)
+QINDEX(MP_QSTR_fabs)
+QINDEX(MP_QSTR_fft)
+QINDEX(MP_QSTR___abs__)
+QINDEX(MP_QSTR_BFINT16)
+QINDEX(MP_QSTR_AssertionError)
+QINDEX(MP_QSTR_abs)
+QINDEX(MP_QSTR_bound_method)
+QINDEX(MP_QSTR_match)
+QINDEX(MP_QSTR_eval)
+QINDEX(MP_QSTR_difference_update)
+QINDEX(MP_QSTR_stop)
+QINDEX(MP_QSTR_ticks_add)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_B115200)
+QINDEX(MP_QSTR_co_argcount)
+QINDEX(MP_QSTR_alloc_samples)
+QINDEX(MP_QSTR_reversed)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___ge__)
+QINDEX(MP_QSTR_isdigit)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_urandom)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_KeyboardInterrupt)
+QINDEX(MP_QSTR_min)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_ptr32)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_update)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___gt__)
+QINDEX(MP_QSTR_utf_hyphen_8)
+QINDEX(MP_QSTR_isinstance)
+QINDEX(MP_QSTR_send)
+QINDEX(MP_QSTR_sinh)
+QINDEX(MP_QSTR_push)
+QINDEX(MP_QSTR_sys)
+QINDEX(MP_QSTR_uio)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_args)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___add__)
+QINDEX(MP_QSTR_super)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_argv)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_SOCK_RAW)
+QINDEX(MP_QSTR_mem_free)
+QINDEX(MP_QSTR_listen)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___iter__)
+QINDEX(MP_QSTR_traceback)
+QINDEX(MP_QSTR_open)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR__thread)
+QINDEX(MP_QSTR_inverse)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_to_bytes)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___rand__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_OrderedDict)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___rxor__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_ptr16)
+QINDEX(MP_QSTR_modify)
+QINDEX(MP_QSTR_utimeq)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_SO_BROADCAST)
+QINDEX(MP_QSTR_dir)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_mem_total)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___rpow__)
+QINDEX(MP_QSTR___repl_print__)
+QINDEX(MP_QSTR_keys)
+QINDEX(MP_QSTR___next__)
+QINDEX(MP_QSTR_circuitpython)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_stdout)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_end)
+QINDEX(MP_QSTR_exc_info)
+QINDEX(MP_QSTR_sleep_ms)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___and__)
+QINDEX(MP_QSTR_SOL_SOCKET)
+QINDEX(MP_QSTR___repr__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_acosh)
+QINDEX(MP_QSTR_any)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_int)
+QINDEX(MP_QSTR_FLOAT64)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_ECONNRESET)
+QINDEX(MP_QSTR_BytesIO)
+QINDEX(MP_QSTR_endswith)
+QINDEX(MP_QSTR_protocol_pin)
+QINDEX(MP_QSTR_acquire)
+QINDEX(MP_QSTR_uheapq)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_SystemExit)
+QINDEX(MP_QSTR_SO_REUSEADDR)
+QINDEX(MP_QSTR_log)
+QINDEX(MP_QSTR_sendto)
+QINDEX(MP_QSTR_sep)
+QINDEX(MP_QSTR_buffering)
+QINDEX(MP_QSTR_format)
+QINDEX(MP_QSTR_ECONNABORTED)
+QINDEX(MP_QSTR_id)
+QINDEX(MP_QSTR_set)
+QINDEX(MP_QSTR_SO_KEEPALIVE)
+QINDEX(MP_QSTR_hexlify)
+QINDEX(MP_QSTR_out)
+QINDEX(MP_QSTR_doc)
+QINDEX(MP_QSTR_pop)
+QINDEX(MP_QSTR_pow)
+QINDEX(MP_QSTR_tb_lineno)
+QINDEX(MP_QSTR_stack_size)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_close)
+QINDEX(MP_QSTR_get)
+QINDEX(MP_QSTR_math)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___or__)
+QINDEX(MP_QSTR_MpyError)
+QINDEX(MP_QSTR_asinh)
+QINDEX(MP_QSTR_dot)
+QINDEX(MP_QSTR_a2b_base64)
+QINDEX(MP_QSTR_b2a_base64)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_ldexp)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_all)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___floordiv__)
+QINDEX(MP_QSTR_PinBase)
+QINDEX(MP_QSTR_imag)
+QINDEX(MP_QSTR_sizeof)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_readinto)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___aiter__)
+QINDEX(MP_QSTR___traceback__)
+QINDEX(MP_QSTR_center)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR__lt_string_gt_)
+QINDEX(MP_QSTR_mem_alloc)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR__brace_open__colon__hash_b_brace_close_)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___rtruediv__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_EINVAL)
+QINDEX(MP_QSTR_viper)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___reversed__)
+QINDEX(MP_QSTR_EBADF)
+QINDEX(MP_QSTR___mod__)
+QINDEX(MP_QSTR_keepends)
+QINDEX(MP_QSTR_on)
+QINDEX(MP_QSTR_TimeoutError)
+QINDEX(MP_QSTR_staticmethod)
+QINDEX(MP_QSTR___del__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_splitlines)
+QINDEX(MP_QSTR_append)
+QINDEX(MP_QSTR_setdefault)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_deleter)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___rsub__)
+QINDEX(MP_QSTR_log2)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_bytearray)
+QINDEX(MP_QSTR_co_filename)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_ENOTCONN)
+QINDEX(MP_QSTR___dir__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_termios)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_UINT32)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_native)
+QINDEX(MP_QSTR_start)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_heappush)
+QINDEX(MP_QSTR___truediv__)
+QINDEX(MP_QSTR_opt_level)
+QINDEX(MP_QSTR_radians)
+QINDEX(MP_QSTR_ure)
+QINDEX(MP_QSTR_window)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___main__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_EOFError)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_SyntaxError)
+QINDEX(MP_QSTR_erf)
+QINDEX(MP_QSTR_ValueError)
+QINDEX(MP_QSTR_generator)
+QINDEX(MP_QSTR_stack_use)
+QINDEX(MP_QSTR_umachine)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_type)
+QINDEX(MP_QSTR_isnan)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_co_consts)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_EISDIR)
+QINDEX(MP_QSTR_isfinite)
+QINDEX(MP_QSTR___set__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_EOPNOTSUPP)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_getenv)
+QINDEX(MP_QSTR_lock)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_co_name)
+QINDEX(MP_QSTR_max)
+QINDEX(MP_QSTR___get__)
+QINDEX(MP_QSTR_FLOAT32)
+QINDEX(MP_QSTR_issubclass)
+QINDEX(MP_QSTR_ENODEV)
+QINDEX(MP_QSTR_ZeroDivisionError)
+QINDEX(MP_QSTR_split)
+QINDEX(MP_QSTR_map)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_BFUINT8)
+QINDEX(MP_QSTR_LITTLE_ENDIAN)
+QINDEX(MP_QSTR_const)
+QINDEX(MP_QSTR_getattr)
+QINDEX(MP_QSTR_version)
+QINDEX(MP_QSTR___aexit__)
+QINDEX(MP_QSTR_UINT16)
+QINDEX(MP_QSTR___contains__)
+QINDEX(MP_QSTR_lower)
+QINDEX(MP_QSTR___path__)
+QINDEX(MP_QSTR_profile_stop)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR___le__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_symmetric_difference)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_repr)
+QINDEX(MP_QSTR_profile_start)
+QINDEX(MP_QSTR_cosh)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_heappop)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_MemoryError)
+QINDEX(MP_QSTR_isupper)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_copy)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR__lt_stdin_gt_)
+QINDEX(MP_QSTR_ENOBUFS)
+QINDEX(MP_QSTR_items)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_dump)
+QINDEX(MP_QSTR_EPERM)
+QINDEX(MP_QSTR_AF_INET)
+QINDEX(MP_QSTR_isalpha)
+QINDEX(MP_QSTR_release)
+QINDEX(MP_QSTR_rindex)
+QINDEX(MP_QSTR_sleep)
+QINDEX(MP_QSTR_uos)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_threshold)
+QINDEX(MP_QSTR_f_lineno)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_kbd_intr)
+QINDEX(MP_QSTR___invert__)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_NULL)
+QINDEX(MP_QSTR_unlink)
+QINDEX(MP_QSTR_NULL)
+TRANSLATION("unknown format code '%c' for object of type '%s'", 49, { 0xc2, 0x72, 0x45, 0xea, 0x81, 0xa2, 0xb5, 0x86, 0x02, 0x6b, 0x42, 0x0c, 0xb8, 0x4f, 0x20, 0xd1, 0x58, 0x17, 0x3f, 0x42, 0x9c, 0x02, 0xe8, 0x11, 0xbd, 0xc8, 0x32, 0xe0, 0xf9, 0x00 }) // unknown format code \'%c\' for object of type \'%s\'
+TRANSLATION("unsupported type for operator", 30, { 0xc2, 0x3e, 0x2f, 0x75, 0x68, 0x2a, 0x04, 0x6f, 0x72, 0x0d, 0x15, 0x81, 0x6e, 0x4c, 0x30, 0xac }) // unsupported type for operator
+TRANSLATION("can't pend throw to just-started generator", 43, { 0x98, 0xa6, 0x50, 0x17, 0x24, 0xa0, 0x46, 0xcc, 0xbd, 0x42, 0x14, 0x3d, 0x30, 0xf1, 0xec, 0x78, 0x16, 0x82, 0xa0, 0x6a, 0x48, 0x4c, 0x30, 0xac }) // can\'t pend throw to just-started generator
+TRANSLATION("Input/output error", 19, { 0xef, 0x4b, 0xe2, 0x3e, 0xf5, 0xc4, 0x5f, 0x10, 0x04, 0xcc, 0xac }) // Input/output error
+TRANSLATION("generator ignored GeneratorExit", 32, { 0xd4, 0x90, 0x98, 0x61, 0x58, 0x0f, 0x54, 0x56, 0x2a, 0x07, 0xec, 0x48, 0x4c, 0x30, 0xad, 0xc7, 0xb1, 0xc0 }) // generator ignored GeneratorExit
+TRANSLATION("can't convert %s to float", 26, { 0x98, 0xa6, 0x50, 0x13, 0x54, 0xe8, 0x4d, 0x01, 0xc1, 0xc2, 0x14, 0x34, 0xaa, 0x8c, 0x00 }) // can\'t convert %s to float
+TRANSLATION("index out of range", 19, { 0x34, 0xa1, 0x76, 0x05, 0xc4, 0x02, 0xe8, 0x0c, 0x29, 0xa9, 0x00 }) // index out of range
+TRANSLATION("No space left on device", 24, { 0xf0, 0x50, 0x7b, 0x8c, 0xc8, 0x2a, 0x5a, 0x40, 0x2a, 0x05, 0x0b, 0xa1, 0xcc, 0x80 }) // No space left on device
+TRANSLATION("struct: no fields", 18, { 0x78, 0x6c, 0x4e, 0x3f, 0x30, 0x45, 0x0d, 0x0c, 0xab, 0x47 }) // struct: no fields
+TRANSLATION("object with buffer protocol required", 37, { 0x5c, 0xfd, 0x0a, 0x70, 0x1d, 0x4e, 0x36, 0x0c, 0xf1, 0xa6, 0x84, 0xc1, 0x76, 0x58, 0x59, 0xad, 0x41, 0x8b, 0x9e, 0x0d, 0x8a, 0x80 }) // object with buffer protocol required
+TRANSLATION("array/bytes required on right side", 35, { 0x16, 0x61, 0xdf, 0xef, 0xcf, 0x78, 0x27, 0x06, 0x2e, 0x78, 0x36, 0x2a, 0x02, 0xa0, 0x31, 0xeb, 0xb4, 0x03, 0x9d, 0x08 }) // array/bytes required on right side
+TRANSLATION("*x must be assignment target", 29, { 0xfb, 0x3b, 0x05, 0xb0, 0xf0, 0x19, 0x90, 0x0b, 0xb9, 0xea, 0x96, 0x24, 0x80, 0x81, 0x6d, 0x4a, 0x00 }) // *x must be assignment target
+TRANSLATION("first argument to super() must be type", 39, { 0xd0, 0xd9, 0xe0, 0x05, 0xb5, 0xc5, 0x89, 0x20, 0x21, 0x41, 0xf1, 0x72, 0x6f, 0x57, 0xac, 0x2d, 0x87, 0x80, 0xcc, 0x82, 0x37, 0xb9, 0x00 }) // first argument to super() must be type
+TRANSLATION("'await' outside function", 25, { 0xc8, 0x7a, 0x89, 0xc6, 0x40, 0xb8, 0x87, 0x3a, 0x10, 0x69, 0x84, 0x9c, 0x1a, 0xa0 }) // \'await\' outside function
+TRANSLATION("arg is an empty sequence", 25, { 0x16, 0xd4, 0x0d, 0xc0, 0x50, 0x0a, 0xd7, 0x8d, 0xc1, 0xcb, 0x9e, 0x09, 0x26, 0x40 }) // arg is an empty sequence
+TRANSLATION("'%s' object does not support '%q'", 34, { 0xcb, 0x83, 0xe4, 0x0b, 0x9f, 0xa1, 0x4e, 0x02, 0x8a, 0x4e, 0x08, 0xb0, 0x0f, 0x8b, 0xdd, 0x5a, 0x03, 0x2e, 0x1c, 0xf2 }) // \'%s\' object does not support \'%q\'
+TRANSLATION("object has no len", 18, { 0x5c, 0xfd, 0x0a, 0x70, 0x1b, 0x0b, 0x82, 0x28, 0x54, 0x90 }) // object has no len
+TRANSLATION("unary op %q not implemented", 28, { 0xc2, 0x0b, 0x6e, 0x0b, 0x70, 0xe1, 0xcc, 0x11, 0x60, 0x0e, 0xd7, 0xa9, 0x58, 0x92, 0x0a, 0x80 }) // unary op %q not implemented
+TRANSLATION("unindent does not match any outer indentation level", 52, { 0xc2, 0x1a, 0x50, 0x92, 0x02, 0x8a, 0x4e, 0x08, 0xb0, 0x16, 0x18, 0x9e, 0xc0, 0x29, 0xb8, 0x2e, 0x20, 0x98, 0x0d, 0x28, 0x49, 0x03, 0x06, 0xa8, 0x15, 0x2e, 0x85, 0x50 }) // unindent does not match any outer indentation level
+TRANSLATION("unknown format code '%c' for object of type 'str'", 50, { 0xc2, 0x72, 0x45, 0xea, 0x81, 0xa2, 0xb5, 0x86, 0x02, 0x6b, 0x42, 0x0c, 0xb8, 0x4f, 0x20, 0xd1, 0x58, 0x17, 0x3f, 0x42, 0x9c, 0x02, 0xe8, 0x11, 0xbd, 0xc8, 0x32, 0x78, 0x6c, 0x80 }) // unknown format code \'%c\' for object of type \'str\'
+TRANSLATION("can't convert NaN to int", 25, { 0x98, 0xa6, 0x50, 0x13, 0x54, 0xe8, 0x4d, 0x01, 0xe0, 0x3e, 0x01, 0x0a, 0x06, 0x90 }) // can\'t convert NaN to int
+TRANSLATION("can't store with '%q' index", 28, { 0x98, 0xa6, 0x50, 0x0f, 0x0a, 0xc4, 0x1d, 0x4e, 0x36, 0x0c, 0xb8, 0x73, 0xc8, 0x0d, 0x28, 0x5d, 0x80 }) // can\'t store with \'%q\' index
+TRANSLATION("value must fit in %d byte(s)", 29, { 0xe8, 0x35, 0xc1, 0x05, 0xb0, 0xf0, 0x1a, 0x1c, 0x01, 0xa0, 0x70, 0xa0, 0x67, 0xbc, 0x17, 0xa9, 0xfd, 0x60 }) // value must fit in %d byte(s)
+TRANSLATION("unsupported type for %q: '%s'", 30, { 0xc2, 0x3e, 0x2f, 0x75, 0x68, 0x2a, 0x04, 0x6f, 0x72, 0x0d, 0x15, 0x83, 0x87, 0x3f, 0xcc, 0x32, 0xe0, 0xf9, 0x00 }) // unsupported type for %q: \'%s\'
+TRANSLATION("exceptions must derive from BaseException", 42, { 0x2e, 0xd3, 0x2b, 0xc1, 0xaa, 0x38, 0x5b, 0x0f, 0x01, 0x42, 0x63, 0xe8, 0x41, 0xa3, 0x2d, 0x83, 0xde, 0x2e, 0x5c, 0x7b, 0x4c, 0xaf, 0x06, 0xa8 }) // exceptions must derive from BaseException
+TRANSLATION("single '}' encountered in format string", 40, { 0x73, 0x4d, 0x6a, 0x41, 0x97, 0xff, 0xf2, 0x02, 0x49, 0xae, 0x12, 0x09, 0x8a, 0x80, 0x68, 0x1a, 0x2b, 0x58, 0x60, 0x1e, 0x18, 0xd3, 0x50 }) // single \'}\' encountered in format string
+TRANSLATION("can't convert to int", 21, { 0x98, 0xa6, 0x50, 0x13, 0x54, 0xe8, 0x4d, 0x01, 0x0a, 0x06, 0x90 }) // can\'t convert to int
+TRANSLATION("empty", 6, { 0x2b, 0x5e, 0x37 }) // empty
+TRANSLATION("name '%q' is not defined", 25, { 0x41, 0xb1, 0x06, 0x5c, 0x39, 0xe4, 0x06, 0xe0, 0x8b, 0x01, 0x42, 0xd0, 0xd0, 0xa8 }) // name \'%q\' is not defined
+TRANSLATION("module not found", 17, { 0xb2, 0xd3, 0x15, 0x20, 0x45, 0x80, 0xd1, 0x70, 0x94 }) // module not found
+TRANSLATION("join expects a list of str/bytes objects consistent with self object", 69, { 0xf4, 0x53, 0x40, 0x2e, 0xd7, 0x29, 0xc3, 0x80, 0x85, 0x4d, 0xe0, 0x17, 0x40, 0x78, 0x6f, 0xbf, 0x3d, 0xe0, 0x9c, 0x17, 0x3f, 0x42, 0x9c, 0x38, 0x4d, 0x51, 0xcd, 0xe0, 0x92, 0x03, 0xa9, 0xc6, 0xc0, 0xe5, 0x5d, 0x01, 0x73, 0xf4, 0x29, 0xc0 }) // join expects a list of str/bytes objects consistent with self object
+TRANSLATION("'%s' object has no attribute '%q'", 34, { 0xcb, 0x83, 0xe4, 0x0b, 0x9f, 0xa1, 0x4e, 0x03, 0x61, 0x70, 0x45, 0x01, 0x88, 0x63, 0xcf, 0x10, 0x41, 0x97, 0x0e, 0x79, 0x00 }) // \'%s\' object has no attribute \'%q\'
+TRANSLATION("Read-only filesystem", 21, { 0xfa, 0x10, 0xd3, 0xd8, 0xa9, 0x5d, 0xc3, 0x43, 0xa9, 0x3e, 0xef, 0x05, 0x60 }) // Read-only filesystem
+TRANSLATION("unreadable attribute", 21, { 0xc2, 0x31, 0x0d, 0x07, 0x3a, 0x90, 0x0c, 0x43, 0x1e, 0x78, 0x82 }) // unreadable attribute
+TRANSLATION("lhs and rhs should be compatible", 33, { 0xae, 0xce, 0x02, 0x94, 0x06, 0xd9, 0xc1, 0xf6, 0x5c, 0x56, 0x81, 0x99, 0x04, 0xd6, 0xd7, 0x18, 0x3c, 0xea, 0x40 }) // lhs and rhs should be compatible
+TRANSLATION("only slices with step=1 (aka None) are supported", 49, { 0x54, 0xae, 0xe0, 0xf5, 0x39, 0x93, 0x87, 0x53, 0x8d, 0x81, 0xe0, 0xaf, 0xfe, 0xff, 0x80, 0x7a, 0x87, 0x90, 0x87, 0x82, 0xa1, 0x7a, 0xc0, 0x58, 0x81, 0xf1, 0x7b, 0xab, 0x41, 0x50 }) // only slices with step=1 (aka None) are supported
+TRANSLATION("sign not allowed with integer format specifier 'c'", 51, { 0x73, 0xd5, 0x01, 0x16, 0x00, 0x6b, 0x55, 0xea, 0x54, 0x0e, 0xa7, 0x1b, 0x01, 0xa4, 0x16, 0xa4, 0xc1, 0xa2, 0xb5, 0x86, 0x01, 0xee, 0x53, 0x3d, 0x0c, 0x98, 0x32, 0x9e, 0x40 }) // sign not allowed with integer format specifier \'c\'
+TRANSLATION("[addrinfo error %d]", 20, { 0xff, 0xe8, 0xd2, 0x8c, 0x69, 0xa2, 0x81, 0x33, 0x2b, 0x07, 0x0a, 0x7f, 0xf8 }) // [addrinfo error %d]
+TRANSLATION("invalid format specifier", 25, { 0x34, 0xe8, 0x35, 0x3a, 0x06, 0x8a, 0xd6, 0x18, 0x07, 0xb9, 0x4c, 0xf4, 0x32, 0x60 }) // invalid format specifier
+TRANSLATION("ord expects a character", 24, { 0x56, 0xa0, 0x17, 0x6b, 0x94, 0xe1, 0xc0, 0x42, 0x7b, 0x0b, 0x0c, 0xe0, 0x98 }) // ord expects a character
+TRANSLATION("type is not an acceptable base type", 36, { 0x8d, 0xee, 0x40, 0x6e, 0x08, 0xb0, 0x02, 0x80, 0x33, 0x99, 0x5e, 0x07, 0x3a, 0x90, 0x66, 0x2e, 0x41, 0x1b, 0xdc, 0x80 }) // type is not an acceptable base type
+TRANSLATION("syntax error in JSON", 21, { 0x7d, 0xd2, 0x07, 0xb0, 0x13, 0x32, 0xb0, 0x1a, 0x07, 0xfe, 0xfc, 0xbc, 0x7c, 0x00 }) // syntax error in JSON
+TRANSLATION("memory allocation failed, allocating %u bytes", 46, { 0xb1, 0x59, 0x5b, 0x70, 0x1a, 0xd5, 0x66, 0x30, 0x6a, 0x81, 0xa0, 0x9d, 0x4a, 0x9f, 0x68, 0x0d, 0x6a, 0xb3, 0x18, 0x34, 0xd4, 0x38, 0x60, 0x33, 0xde, 0x09, 0xc0 }) // memory allocation failed, allocating %u bytes
+TRANSLATION("can't have multiple **x", 24, { 0x98, 0xa6, 0x50, 0x1b, 0x0f, 0x42, 0x0b, 0x62, 0xb0, 0x77, 0xa9, 0x07, 0xd9, 0xf6, 0x76 }) // can\'t have multiple **x
+TRANSLATION("negative arena size", 20, { 0x42, 0xd4, 0x60, 0xfa, 0x10, 0x0b, 0x12, 0x08, 0x39, 0xff, 0x24 }) // negative arena size
+TRANSLATION("buffers must be the same length", 32, { 0xcf, 0x1a, 0x68, 0x4c, 0xe1, 0x6c, 0x3c, 0x06, 0x64, 0x11, 0xb1, 0x03, 0x8d, 0x88, 0x2a, 0x49, 0xac, 0x6c }) // buffers must be the same length
+TRANSLATION("maximum recursion depth exceeded", 33, { 0xb0, 0xf6, 0x3b, 0x62, 0xc0, 0xc5, 0x3c, 0x33, 0x9a, 0xa0, 0x50, 0xaf, 0x1b, 0x01, 0x76, 0x99, 0x15, 0x0a, 0x80 }) // maximum recursion depth exceeded
+TRANSLATION("bad typecode", 13, { 0xcc, 0x68, 0x11, 0xbd, 0xca, 0x6b, 0x42 }) // bad typecode
+TRANSLATION("unsupported format character '%c' (0x%x) at index %d", 53, { 0xc2, 0x3e, 0x2f, 0x75, 0x68, 0x2a, 0x06, 0x8a, 0xd6, 0x18, 0x09, 0xec, 0x2c, 0x33, 0x82, 0x60, 0xcb, 0x84, 0xf2, 0x0f, 0x57, 0xb7, 0xb7, 0x0e, 0xde, 0xb0, 0x18, 0x03, 0x4a, 0x17, 0x60, 0xe1, 0x40 }) // unsupported format character \'%c\' (0x%x) at index %d
+TRANSLATION("keywords must be strings", 25, { 0xe4, 0x5b, 0xf5, 0x56, 0xa3, 0x85, 0xb0, 0xf0, 0x19, 0x90, 0x3c, 0x31, 0xa6, 0xae }) // keywords must be strings
+TRANSLATION("buffer too small", 17, { 0xcf, 0x1a, 0x68, 0x4c, 0x10, 0xaa, 0x0f, 0x61, 0xad, 0x40 }) // buffer too small
+TRANSLATION("'yield' outside function", 25, { 0xcb, 0x73, 0x2a, 0xd3, 0x20, 0x5c, 0x43, 0x9d, 0x08, 0x34, 0xc2, 0x4e, 0x0d, 0x50 }) // \'yield\' outside function
+TRANSLATION("parameter annotation must be an identifier", 43, { 0xb8, 0xb0, 0xd8, 0xa0, 0x98, 0x05, 0x11, 0x60, 0x60, 0xd5, 0x02, 0xd8, 0x78, 0x0c, 0xc8, 0x05, 0x00, 0xe8, 0x49, 0x07, 0xa1, 0x93, 0x00 }) // parameter annotation must be an identifier
+TRANSLATION("'return' outside function", 26, { 0xc9, 0x8a, 0x30, 0xc9, 0x90, 0x2e, 0x21, 0xce, 0x84, 0x1a, 0x61, 0x27, 0x06, 0xa8 }) // \'return\' outside function
+TRANSLATION("local '%q' has type '%q' but source is '%q'", 44, { 0xaa, 0xcc, 0x6a, 0x19, 0x70, 0xe7, 0x90, 0x6c, 0x2e, 0x11, 0xbd, 0xc8, 0x32, 0xe1, 0xcf, 0x20, 0xcf, 0x10, 0x0e, 0xb8, 0x69, 0x90, 0x1b, 0x86, 0x5c, 0x39, 0xe4 }) // local \'%q\' has type \'%q\' but source is \'%q\'
+TRANSLATION("must use keyword argument for key function", 43, { 0xb6, 0x1e, 0x03, 0x0e, 0x41, 0xc8, 0xb7, 0xea, 0xad, 0x40, 0x16, 0xd7, 0x16, 0x24, 0x80, 0xd1, 0x58, 0x39, 0x16, 0xe1, 0xa6, 0x12, 0x70, 0x6a, 0x80 }) // must use keyword argument for key function
+TRANSLATION("substring not found", 20, { 0x7c, 0x66, 0xf0, 0xc6, 0x9a, 0x82, 0x2c, 0x06, 0x8b, 0x84, 0xa0 }) // substring not found
+TRANSLATION("Permission denied", 18, { 0xfe, 0x09, 0xac, 0x6e, 0xe6, 0xa8, 0x14, 0x24, 0x32, 0xa0 }) // Permission denied
+TRANSLATION("Unable to init parser", 22, { 0xfa, 0xa0, 0xe7, 0x52, 0x08, 0x50, 0x34, 0x38, 0x0b, 0x8b, 0x39, 0x30 }) // Unable to init parser
+TRANSLATION("string not supported; use bytes or bytearray", 45, { 0x78, 0x63, 0x4d, 0x41, 0x16, 0x01, 0xf1, 0x7b, 0xab, 0x41, 0x53, 0xff, 0x41, 0x87, 0x20, 0xcf, 0x78, 0x27, 0x05, 0x60, 0xcf, 0x78, 0x21, 0x66, 0x1d, 0xc0 }) // string not supported; use bytes or bytearray
+TRANSLATION("tuple index out of range", 25, { 0x8c, 0x5e, 0xa4, 0x06, 0x94, 0x2e, 0xc0, 0xb8, 0x80, 0x5d, 0x01, 0x85, 0x35, 0x20 }) // tuple index out of range
+TRANSLATION("No such file/directory", 23, { 0xf0, 0x50, 0x7c, 0x4f, 0x60, 0xd0, 0xea, 0x5f, 0x7d, 0x0d, 0x8a, 0x70, 0xad, 0xb8 }) // No such file/directory
+TRANSLATION("no such attribute", 18, { 0x45, 0x07, 0xc4, 0xf6, 0x01, 0x88, 0x63, 0xcf, 0x10, 0x40 }) // no such attribute
+TRANSLATION("can't convert to float", 23, { 0x98, 0xa6, 0x50, 0x13, 0x54, 0xe8, 0x4d, 0x01, 0x0a, 0x1a, 0x55, 0x46, 0x00 }) // can\'t convert to float
+TRANSLATION("string index out of range", 26, { 0x78, 0x63, 0x4d, 0x40, 0xd2, 0x85, 0xd8, 0x17, 0x10, 0x0b, 0xa0, 0x30, 0xa6, 0xa4 }) // string index out of range
+TRANSLATION("small int overflow", 19, { 0x7b, 0x0d, 0x6a, 0x06, 0x90, 0x0b, 0xd0, 0x9b, 0x4a, 0xaf, 0x50 }) // small int overflow
+TRANSLATION("can't implicitly convert '%q' to 'bool'", 40, { 0x98, 0xa6, 0x50, 0x07, 0x6b, 0xd4, 0xe6, 0x71, 0x5d, 0xc2, 0x6a, 0x9d, 0x09, 0xa0, 0x32, 0xe1, 0xcf, 0x20, 0x85, 0x0c, 0xb3, 0x55, 0xae, 0x40 }) // can\'t implicitly convert \'%q\' to \'bool\'
+TRANSLATION("struct: index out of range", 27, { 0x78, 0x6c, 0x4e, 0x3f, 0x30, 0x34, 0xa1, 0x76, 0x05, 0xc4, 0x02, 0xe8, 0x0c, 0x29, 0xa9, 0x00 }) // struct: index out of range
+TRANSLATION("function missing required positional argument #%d", 50, { 0xd3, 0x09, 0x38, 0x35, 0x40, 0xb1, 0xbb, 0x9a, 0x6a, 0x0c, 0x5c, 0xf0, 0x6c, 0x54, 0x0b, 0xab, 0x9c, 0x1a, 0xa0, 0xd4, 0x05, 0xb5, 0xc5, 0x89, 0x20, 0x3f, 0xd7, 0x85, 0x00 }) // function missing required positional argument #%d
+TRANSLATION("local variable referenced before assignment", 44, { 0xaa, 0xcc, 0x6a, 0x1d, 0x05, 0x8c, 0x73, 0xa9, 0x03, 0x16, 0x84, 0xc4, 0x93, 0x2a, 0x06, 0x65, 0xa2, 0xb1, 0x00, 0xbb, 0x9e, 0xa9, 0x62, 0x48 }) // local variable referenced before assignment
+TRANSLATION("object not iterable", 20, { 0x5c, 0xfd, 0x0a, 0x70, 0x08, 0xb0, 0x07, 0x04, 0xc3, 0x9d, 0x48 }) // object not iterable
+TRANSLATION("complex division by zero", 25, { 0x9a, 0xda, 0xf5, 0x2e, 0xc1, 0x43, 0xe8, 0x6e, 0x6a, 0x81, 0x9e, 0xe1, 0xfc, 0x93, 0x28 }) // complex division by zero
+TRANSLATION("unknown format code '%c' for object of type 'float'", 52, { 0xc2, 0x72, 0x45, 0xea, 0x81, 0xa2, 0xb5, 0x86, 0x02, 0x6b, 0x42, 0x0c, 0xb8, 0x4f, 0x20, 0xd1, 0x58, 0x17, 0x3f, 0x42, 0x9c, 0x02, 0xe8, 0x11, 0xbd, 0xc8, 0x32, 0xd2, 0xaa, 0x31, 0x90 }) // unknown format code \'%c\' for object of type \'float\'
+TRANSLATION("binary op %q not implemented", 29, { 0xcc, 0xd0, 0x5b, 0x70, 0x5b, 0x87, 0x0e, 0x60, 0x8b, 0x00, 0x76, 0xbd, 0x4a, 0xc4, 0x90, 0x54 }) // binary op %q not implemented
+TRANSLATION("LHS of keyword arg must be an id", 33, { 0xf9, 0xff, 0xc7, 0x90, 0x2e, 0x81, 0xc8, 0xb7, 0xea, 0xad, 0x40, 0x16, 0xd4, 0x2d, 0x87, 0x80, 0xcc, 0x80, 0x50, 0x0e, 0x80 }) // LHS of keyword arg must be an id
+TRANSLATION("unexpected keyword argument '%q'", 33, { 0xc2, 0x17, 0x6b, 0x94, 0xe0, 0xa8, 0x1c, 0x8b, 0x7e, 0xaa, 0xd4, 0x01, 0x6d, 0x71, 0x62, 0x48, 0x0c, 0xb8, 0x73, 0xc8 }) // unexpected keyword argument \'%q\'
+TRANSLATION("can't add special method to already-subclassed class", 53, { 0x98, 0xa6, 0x50, 0x03, 0x4a, 0x03, 0xdc, 0xa6, 0x63, 0x50, 0xb1, 0x46, 0xcb, 0x40, 0x85, 0x01, 0xab, 0x10, 0xd3, 0x7f, 0x63, 0xe3, 0x39, 0xd4, 0x5d, 0xca, 0x81, 0x3a, 0x8b, 0xb8 }) // can\'t add special method to already-subclassed class
+TRANSLATION("'%s' object does not support item deletion", 43, { 0xcb, 0x83, 0xe4, 0x0b, 0x9f, 0xa1, 0x4e, 0x02, 0x8a, 0x4e, 0x08, 0xb0, 0x0f, 0x8b, 0xdd, 0x5a, 0x00, 0xe0, 0xac, 0x14, 0x2a, 0x94, 0x1a, 0xa0 }) // \'%s\' object does not support item deletion
+TRANSLATION("can't convert %s to complex", 28, { 0x98, 0xa6, 0x50, 0x13, 0x54, 0xe8, 0x4d, 0x01, 0xc1, 0xc2, 0x14, 0x26, 0xb6, 0xbd, 0x4b, 0xb0 }) // can\'t convert %s to complex
+TRANSLATION("can't load with '%q' index", 27, { 0x98, 0xa6, 0x50, 0x15, 0x51, 0xa0, 0x75, 0x38, 0xd8, 0x32, 0xe1, 0xcf, 0x20, 0x34, 0xa1, 0x76 }) // can\'t load with \'%q\' index
+TRANSLATION("can't load from '%q'", 21, { 0x98, 0xa6, 0x50, 0x15, 0x51, 0xa0, 0x68, 0xcb, 0x60, 0xcb, 0x87, 0x3c, 0x80 }) // can\'t load from \'%q\'
+TRANSLATION("%%c requires int or char", 25, { 0xe1, 0xc2, 0x60, 0xc5, 0xcf, 0x06, 0xc4, 0xe0, 0x69, 0x00, 0xac, 0x13, 0xd8, 0x58 }) // %%c requires int or char
+TRANSLATION("non-default argument follows default argument", 46, { 0x45, 0x4f, 0x65, 0x0b, 0x41, 0xc5, 0x60, 0x05, 0xb5, 0xc5, 0x89, 0x20, 0x34, 0x5a, 0xd5, 0x7a, 0xb8, 0x50, 0xb4, 0x1c, 0x56, 0x00, 0x5b, 0x5c, 0x58, 0x92, 0x00 }) // non-default argument follows default argument
+TRANSLATION("%q() takes %d positional arguments but %d were given", 53, { 0xe1, 0xcf, 0xd5, 0xeb, 0x08, 0x1e, 0x44, 0xe1, 0xc2, 0x81, 0x75, 0x73, 0x83, 0x54, 0x1a, 0x80, 0xb6, 0xb8, 0xb1, 0x24, 0x38, 0x67, 0x88, 0x0e, 0x14, 0x0e, 0xa4, 0xc4, 0x1a, 0x9f, 0x42, 0x40 }) // %q() takes %d positional arguments but %d were given
+TRANSLATION("bad conversion specifier", 25, { 0xcc, 0x68, 0x13, 0x54, 0xe8, 0x4c, 0xe6, 0xa8, 0x0f, 0x72, 0x99, 0xe8, 0x64, 0xc0 }) // bad conversion specifier
+TRANSLATION("a bytes-like object is required", 32, { 0x10, 0xcf, 0x78, 0x27, 0xf6, 0x54, 0xf9, 0x10, 0x2e, 0x7e, 0x85, 0x38, 0x03, 0x70, 0x62, 0xe7, 0x83, 0x62, 0xa0 }) // a bytes-like object is required
+TRANSLATION("no binding for nonlocal found", 30, { 0x45, 0x0c, 0xcd, 0x28, 0x69, 0xa8, 0x68, 0xac, 0x08, 0xa9, 0x55, 0x98, 0xd4, 0x34, 0x5c, 0x25, 0x00 }) // no binding for nonlocal found
+TRANSLATION("FFT needs arrays of floats (type 'f')", 38, { 0xf9, 0x7c, 0xbc, 0xc1, 0x08, 0xa8, 0xe0, 0x2c, 0xc3, 0xbb, 0x82, 0xe8, 0x1a, 0x55, 0x46, 0x1c, 0x3d, 0x51, 0xbd, 0xc8, 0x32, 0xd3, 0x2f, 0x58 }) // FFT needs arrays of floats (type \'f\')
+TRANSLATION("negative shift count", 21, { 0x42, 0xd4, 0x60, 0xfa, 0x10, 0x3e, 0xc7, 0xa4, 0x04, 0xd7, 0x09, 0x00 }) // negative shift count
+TRANSLATION("dict update sequence has wrong length", 38, { 0xa1, 0xce, 0x03, 0x17, 0xa0, 0xc1, 0x03, 0x97, 0x3c, 0x12, 0x4c, 0x83, 0x61, 0x70, 0xea, 0xca, 0x9a, 0x85, 0x49, 0x35, 0x8d, 0x80 }) // dict update sequence has wrong length
+TRANSLATION("expected tuple/list", 20, { 0x2e, 0xd7, 0x29, 0xc1, 0x50, 0x23, 0x17, 0xa9, 0x7d, 0xf5, 0x37, 0x80 }) // expected tuple/list
+TRANSLATION("Array must contain halfwords (type 'h') or floats (type 'f')", 61, { 0xee, 0x66, 0x1d, 0xc2, 0xd8, 0x78, 0x09, 0xaa, 0x40, 0x9a, 0x06, 0xc3, 0x5d, 0x3a, 0xab, 0x51, 0xc3, 0xd5, 0x1b, 0xdc, 0x83, 0x2d, 0xb2, 0xf5, 0x82, 0xb0, 0x69, 0x55, 0x18, 0x70, 0xf5, 0x46, 0xf7, 0x20, 0xcb, 0x4c, 0xbd, 0x60 }) // Array must contain halfwords (type \'h\') or floats (type \'f\')
+TRANSLATION("function expected at most %d arguments, got %d", 47, { 0xd3, 0x09, 0x38, 0x35, 0x40, 0x2e, 0xd7, 0x29, 0xc1, 0x50, 0x06, 0x02, 0xca, 0xf0, 0x1c, 0x28, 0x02, 0xda, 0xe2, 0xc4, 0x90, 0xff, 0x68, 0x6a, 0xb0, 0x1c, 0x28 }) // function expected at most %d arguments, got %d
+TRANSLATION("can't convert %s to int", 24, { 0x98, 0xa6, 0x50, 0x13, 0x54, 0xe8, 0x4d, 0x01, 0xc1, 0xc2, 0x14, 0x0d, 0x20 }) // can\'t convert %s to int
+TRANSLATION("odd-length string", 18, { 0x5a, 0x53, 0xd9, 0x52, 0x4d, 0x63, 0x60, 0x78, 0x63, 0x4d, 0x40 }) // odd-length string
+TRANSLATION("rsplit(None,n)", 15, { 0x67, 0xbd, 0x4e, 0x3d, 0x5e, 0x0a, 0x85, 0xf6, 0xa7, 0xac }) // rsplit(None,n)
+TRANSLATION("__init__() should return None, not '%s'", 40, { 0x94, 0x8d, 0x0e, 0x25, 0x2f, 0x57, 0xac, 0x1f, 0x65, 0xc5, 0x68, 0x0c, 0x51, 0x86, 0x40, 0xf0, 0x54, 0x2f, 0xb4, 0x11, 0x60, 0x32, 0xe0, 0xf9, 0x00 }) // __init__() should return None, not \'%s\'
+TRANSLATION("File exists", 12, { 0xf9, 0x1d, 0x48, 0x0b, 0xb1, 0xbc, 0x38 }) // File exists
+TRANSLATION("__new__ arg must be a user-type", 32, { 0x94, 0x90, 0xba, 0xca, 0x40, 0x2d, 0xa8, 0x5b, 0x0f, 0x01, 0x99, 0x00, 0x86, 0x1c, 0x9b, 0xd9, 0x1b, 0xdc, 0x80 }) // __new__ arg must be a user-type
+TRANSLATION("offset out of bounds", 21, { 0x5d, 0x34, 0x72, 0x80, 0x5c, 0x40, 0x2e, 0x81, 0x9a, 0xe1, 0x28, 0xe0 }) // offset out of bounds
+TRANSLATION("invalid micropython decorator", 30, { 0x34, 0xe8, 0x35, 0x3a, 0x05, 0x8e, 0x6c, 0xb7, 0xde, 0x36, 0x54, 0x0a, 0x14, 0xd5, 0x86, 0x15, 0x80 }) // invalid micropython decorator
+TRANSLATION("string indices must be integers, not %s", 40, { 0x78, 0x63, 0x4d, 0x40, 0xd2, 0x87, 0x32, 0x70, 0xb6, 0x1e, 0x03, 0x32, 0x03, 0x48, 0x2d, 0x49, 0x9f, 0xed, 0x04, 0x58, 0x0e, 0x0e }) // string indices must be integers, not %s
+TRANSLATION("identifier redefined as global", 31, { 0x3a, 0x12, 0x41, 0xe8, 0x64, 0xc0, 0xc5, 0x42, 0xd0, 0xd0, 0xa8, 0x02, 0xe1, 0xad, 0x57, 0x31, 0xa8 }) // identifier redefined as global
+TRANSLATION("slice step cannot be zero", 26, { 0x7a, 0x9c, 0xc8, 0x1e, 0x0a, 0xe1, 0x31, 0x44, 0x58, 0x0c, 0xc8, 0x3f, 0x92, 0x65 }) // slice step cannot be zero
+TRANSLATION("return expected '%q' but got '%q'", 34, { 0x62, 0x8c, 0x32, 0x01, 0x76, 0xb9, 0x4e, 0x0a, 0x81, 0x97, 0x0e, 0x79, 0x06, 0x78, 0x80, 0xd5, 0x60, 0x32, 0xe1, 0xcf, 0x20 }) // return expected \'%q\' but got \'%q\'
+TRANSLATION("syntax error in uctypes descriptor", 35, { 0x7d, 0xd2, 0x07, 0xb0, 0x13, 0x32, 0xb0, 0x1a, 0x06, 0x27, 0x1b, 0xdc, 0x9c, 0x28, 0x4f, 0x36, 0x3b, 0xc2, 0xb0 }) // syntax error in uctypes descriptor
+TRANSLATION("'continue' outside loop", 24, { 0xca, 0x6a, 0x90, 0x69, 0x82, 0xc8, 0x17, 0x10, 0xe7, 0x42, 0x0a, 0xaa, 0xdc }) // \'continue\' outside loop
+TRANSLATION("function got multiple values for argument '%q'", 47, { 0xd3, 0x09, 0x38, 0x35, 0x40, 0xd5, 0x60, 0x2d, 0x8a, 0xc1, 0xde, 0xa4, 0x1d, 0x06, 0xb8, 0x27, 0x0d, 0x15, 0x80, 0x5b, 0x5c, 0x58, 0x92, 0x03, 0x2e, 0x1c, 0xf2 }) // function got multiple values for argument \'%q\'
+TRANSLATION("return annotation must be an identifier", 40, { 0x62, 0x8c, 0x32, 0x00, 0xa2, 0x2c, 0x0c, 0x1a, 0xa0, 0x5b, 0x0f, 0x01, 0x99, 0x00, 0xa0, 0x1d, 0x09, 0x20, 0xf4, 0x32, 0x60 }) // return annotation must be an identifier
+TRANSLATION("must raise an object", 21, { 0xb6, 0x1e, 0x01, 0x84, 0xdc, 0x80, 0x50, 0x17, 0x3f, 0x42, 0x9c, 0x00 }) // must raise an object
+TRANSLATION("wrong number of values to unpack", 33, { 0xea, 0xca, 0x9a, 0x82, 0x62, 0xd9, 0x93, 0x02, 0xe8, 0x1d, 0x06, 0xb8, 0x27, 0x08, 0x50, 0xc2, 0x5c, 0x67, 0xc8 }) // wrong number of values to unpack
+TRANSLATION("name reused for argument", 25, { 0x41, 0xb1, 0x03, 0x16, 0x1c, 0xa8, 0x1a, 0x2b, 0x00, 0xb6, 0xb8, 0xb1, 0x24, 0x00 }) // name reused for argument
+TRANSLATION("'%s' object is not callable", 28, { 0xcb, 0x83, 0xe4, 0x0b, 0x9f, 0xa1, 0x4e, 0x00, 0xdc, 0x11, 0x60, 0x26, 0x35, 0xa8, 0xe7, 0x52 }) // \'%s\' object is not callable
+TRANSLATION("integer required", 17, { 0x34, 0x82, 0xd4, 0x98, 0x18, 0xb9, 0xe0, 0xd8, 0xa8 }) // integer required
+TRANSLATION("heap must be a list", 20, { 0xd8, 0x86, 0xe1, 0x6c, 0x3c, 0x06, 0x64, 0x02, 0x15, 0x37, 0x80 }) // heap must be a list
+TRANSLATION("invalid syntax for integer with base %d", 40, { 0x34, 0xe8, 0x35, 0x3a, 0x03, 0xee, 0x90, 0x3d, 0x83, 0x45, 0x60, 0x34, 0x82, 0xd4, 0x98, 0x3a, 0x9c, 0x6c, 0x19, 0x8b, 0x90, 0x70, 0xa0 }) // invalid syntax for integer with base %d
+TRANSLATION("invalid syntax", 15, { 0x34, 0xe8, 0x35, 0x3a, 0x03, 0xee, 0x90, 0x3d, 0x80 }) // invalid syntax
+TRANSLATION("multiple bases have instance lay-out conflict", 46, { 0xb6, 0x2b, 0x07, 0x7a, 0x90, 0x66, 0x2e, 0x4e, 0x1b, 0x0f, 0x42, 0x03, 0x47, 0x81, 0x49, 0x90, 0x54, 0x77, 0xf6, 0x2e, 0x20, 0x26, 0xa9, 0xa5, 0x4e, 0x70 }) // multiple bases have instance lay-out conflict
+TRANSLATION("bad compile mode", 17, { 0xcc, 0x68, 0x13, 0x5b, 0x5c, 0xea, 0x41, 0x65, 0xa1, 0x00 }) // bad compile mode
+TRANSLATION("can't switch from manual field specification to automatic field numbering", 74, { 0x98, 0xa6, 0x50, 0x0f, 0xd4, 0xe2, 0x7b, 0x06, 0x8c, 0xb6, 0x0b, 0x0a, 0x60, 0x6a, 0x1a, 0x19, 0x56, 0x80, 0xf7, 0x29, 0x9e, 0x87, 0x31, 0x83, 0x54, 0x08, 0x50, 0x1c, 0x42, 0xd8, 0x60, 0xe6, 0x1a, 0x19, 0x56, 0x80, 0x98, 0xb6, 0x64, 0xc6, 0x9a, 0x80 }) // can\'t switch from manual field specification to automatic field numbering
+TRANSLATION("%q indices must be integers, not %s", 36, { 0xe1, 0xcc, 0x0d, 0x28, 0x73, 0x27, 0x0b, 0x61, 0xe0, 0x33, 0x20, 0x34, 0x82, 0xd4, 0x99, 0xfe, 0xd0, 0x45, 0x80, 0xe0, 0xe0 }) // %q indices must be integers, not %s
+TRANSLATION("can't switch from automatic field numbering to manual field specification", 74, { 0x98, 0xa6, 0x50, 0x0f, 0xd4, 0xe2, 0x7b, 0x06, 0x8c, 0xb6, 0x01, 0xc4, 0x2d, 0x86, 0x0e, 0x61, 0xa1, 0x95, 0x68, 0x09, 0x8b, 0x66, 0x4c, 0x69, 0xa8, 0x42, 0x85, 0x85, 0x30, 0x35, 0x0d, 0x0c, 0xab, 0x40, 0x7b, 0x94, 0xcf, 0x43, 0x98, 0xc1, 0xaa, 0x00 }) // can\'t switch from automatic field numbering to manual field specification
+TRANSLATION("address %08x is not aligned to %d bytes", 40, { 0x1a, 0x51, 0x89, 0xdc, 0x38, 0x7b, 0x7f, 0xaf, 0x60, 0x37, 0x04, 0x58, 0x01, 0xa9, 0xea, 0x85, 0x40, 0x85, 0x0e, 0x14, 0x0c, 0xf7, 0x82, 0x70 }) // address %08x is not aligned to %d bytes
+TRANSLATION("cannot create instance", 23, { 0x98, 0xa2, 0x2c, 0x04, 0xd8, 0x86, 0x08, 0x0d, 0x1e, 0x05, 0x26, 0x40 }) // cannot create instance
+TRANSLATION("unsupported types for %q: '%s', '%s'", 37, { 0xc2, 0x3e, 0x2f, 0x75, 0x68, 0x2a, 0x04, 0x6f, 0x72, 0x70, 0xd1, 0x58, 0x38, 0x73, 0xfc, 0xc3, 0x2e, 0x0f, 0x97, 0xda, 0x19, 0x70, 0x7c, 0x80 }) // unsupported types for %q: \'%s\', \'%s\'
+TRANSLATION("pow() 3rd argument cannot be 0", 31, { 0xba, 0xf5, 0xf5, 0x7a, 0xc3, 0xf1, 0x6a, 0x00, 0xb6, 0xb8, 0xb1, 0x24, 0x04, 0xc5, 0x11, 0x60, 0x33, 0x20, 0xf6, 0x80 }) // pow() 3rd argument cannot be 0
+TRANSLATION("can't convert '%q' object to %q implicitly", 43, { 0x98, 0xa6, 0x50, 0x13, 0x54, 0xe8, 0x4d, 0x01, 0x97, 0x0e, 0x79, 0x02, 0xe7, 0xe8, 0x53, 0x80, 0x85, 0x0e, 0x1c, 0xc0, 0xed, 0x7a, 0x9c, 0xce, 0x2b, 0xb8 }) // can\'t convert \'%q\' object to %q implicitly
+TRANSLATION("cannot perform relative import", 31, { 0x98, 0xa2, 0x2c, 0x05, 0xc9, 0xb4, 0x56, 0xb0, 0x31, 0x54, 0x60, 0xfa, 0x10, 0x1d, 0xae, 0xad, 0x00 }) // cannot perform relative import
+TRANSLATION("Traceback (most recent call last):\n", 37, { 0xf3, 0x61, 0x99, 0x66, 0x33, 0xe4, 0x1e, 0xab, 0x2b, 0xc0, 0x31, 0x4c, 0x92, 0x02, 0x63, 0x5a, 0x85, 0x45, 0xe3, 0xd7, 0xf9, 0xff, 0x9f, 0xf9, 0x00 }) // Traceback (most recent call last):\r\n
+TRANSLATION("object not in sequence", 23, { 0x5c, 0xfd, 0x0a, 0x70, 0x08, 0xb0, 0x06, 0x80, 0xe5, 0xcf, 0x04, 0x93, 0x20 }) // object not in sequence
+TRANSLATION("argument should be a '%q' not a '%q'", 37, { 0x16, 0xd7, 0x16, 0x24, 0x80, 0x7d, 0x97, 0x15, 0xa0, 0x66, 0x40, 0x21, 0x97, 0x0e, 0x79, 0x02, 0x2c, 0x00, 0x86, 0x5c, 0x39, 0xe4 }) // argument should be a \'%q\' not a \'%q\'
+TRANSLATION("function does not take keyword arguments", 41, { 0xd3, 0x09, 0x38, 0x35, 0x40, 0xa2, 0x93, 0x82, 0x2c, 0x04, 0x0f, 0x22, 0x0e, 0x45, 0xbf, 0x55, 0x6a, 0x00, 0xb6, 0xb8, 0xb1, 0x24, 0x38 }) // function does not take keyword arguments
+TRANSLATION("issubclass() arg 2 must be a class or a tuple of classes", 57, { 0x37, 0x7c, 0x67, 0x3a, 0x8b, 0xbf, 0xab, 0xd6, 0x02, 0xda, 0x87, 0xb8, 0x2d, 0x87, 0x80, 0xcc, 0x80, 0x42, 0x75, 0x17, 0x70, 0x56, 0x01, 0x08, 0xc5, 0xea, 0x40, 0xba, 0x04, 0xea, 0x2e, 0xe4, 0xe0 }) // issubclass() arg 2 must be a class or a tuple of classes
+TRANSLATION("pow() with 3 arguments requires integers", 41, { 0xba, 0xf5, 0xf5, 0x7a, 0xc3, 0xa9, 0xc6, 0xc1, 0xf8, 0x80, 0xb6, 0xb8, 0xb1, 0x24, 0x38, 0x31, 0x73, 0xc1, 0xb1, 0x38, 0x1a, 0x41, 0x6a, 0x4c, 0xe0 }) // pow() with 3 arguments requires integers
+TRANSLATION("cannot import name %q", 22, { 0x98, 0xa2, 0x2c, 0x01, 0xda, 0xea, 0xd0, 0x08, 0x36, 0x20, 0xe1, 0xcc }) // cannot import name %q
+TRANSLATION("can't declare nonlocal in outer code", 37, { 0x98, 0xa6, 0x50, 0x14, 0x29, 0xd4, 0x58, 0x81, 0x15, 0x2a, 0xb3, 0x1a, 0x81, 0xa0, 0x2e, 0x20, 0x98, 0x26, 0xb4, 0x20 }) // can\'t declare nonlocal in outer code
+TRANSLATION("attributes not supported yet", 29, { 0x18, 0x86, 0x3c, 0xf1, 0x04, 0xe0, 0x8b, 0x00, 0xf8, 0xbd, 0xd5, 0xa0, 0xa8, 0x1b, 0x94, 0x00 }) // attributes not supported yet
+TRANSLATION(", in %q\n", 10, { 0xfb, 0x40, 0xd0, 0x38, 0x73, 0xff, 0x3f, 0xf2 }) // , in %q\r\n
+TRANSLATION("division by zero", 17, { 0xa1, 0xf4, 0x37, 0x35, 0x40, 0xcf, 0x70, 0xfe, 0x49, 0x94 }) // division by zero
+TRANSLATION("can't delete expression", 24, { 0x98, 0xa6, 0x50, 0x14, 0x2a, 0x94, 0x10, 0x17, 0x6b, 0xb1, 0x3b, 0x9a, 0xa0 }) // can\'t delete expression
+TRANSLATION("object not an iterator", 23, { 0x5c, 0xfd, 0x0a, 0x70, 0x08, 0xb0, 0x02, 0x80, 0x70, 0x4c, 0x30, 0xac }) // object not an iterator
+TRANSLATION("'break' outside loop", 21, { 0xcb, 0x36, 0x21, 0xe5, 0x90, 0x2e, 0x21, 0xce, 0x84, 0x15, 0x55, 0xb8 }) // \'break\' outside loop
+TRANSLATION("'%q' argument required", 23, { 0xcb, 0x87, 0x3c, 0x80, 0x5b, 0x5c, 0x58, 0x92, 0x01, 0x8b, 0x9e, 0x0d, 0x8a, 0x80 }) // \'%q\' argument required
+TRANSLATION("pop from an empty set", 22, { 0xba, 0xdc, 0x34, 0x65, 0xb0, 0x0a, 0x01, 0x5a, 0xf1, 0xb8, 0x39, 0x40 }) // pop from an empty set
+TRANSLATION("function takes %d positional arguments but %d were given", 57, { 0xd3, 0x09, 0x38, 0x35, 0x40, 0x81, 0xe4, 0x4e, 0x1c, 0x28, 0x17, 0x57, 0x38, 0x35, 0x41, 0xa8, 0x0b, 0x6b, 0x8b, 0x12, 0x43, 0x86, 0x78, 0x80, 0xe1, 0x40, 0xea, 0x4c, 0x41, 0xa9, 0xf4, 0x24 }) // function takes %d positional arguments but %d were given
+TRANSLATION("generator already executing", 28, { 0xd4, 0x90, 0x98, 0x61, 0x58, 0x06, 0xac, 0x43, 0x4d, 0xc0, 0xbb, 0x14, 0xf1, 0x06, 0x9a, 0x80 }) // generator already executing
+TRANSLATION("not all arguments converted during string formatting", 53, { 0x45, 0x80, 0x1a, 0xd4, 0x05, 0xb5, 0xc5, 0x89, 0x21, 0xc2, 0x6a, 0x9d, 0x09, 0xa0, 0xa8, 0x14, 0xc3, 0x1a, 0x6a, 0x0f, 0x0c, 0x69, 0xa8, 0x68, 0xad, 0x61, 0x88, 0x34, 0xd4 }) // not all arguments converted during string formatting
+TRANSLATION("incomplete format", 18, { 0x34, 0x9a, 0xda, 0xf5, 0x28, 0x20, 0xd1, 0x5a, 0xc3, 0x00 }) // incomplete format
+TRANSLATION("start/end indices", 18, { 0x78, 0x16, 0x8f, 0xbc, 0x92, 0x80, 0x69, 0x43, 0x99, 0x38 }) // start/end indices
+TRANSLATION("Call super().__init__() before accessing native object.", 56, { 0xf8, 0x0d, 0x6a, 0x0f, 0x8b, 0x93, 0x7a, 0xbd, 0x7f, 0x74, 0xa4, 0x68, 0x71, 0x29, 0x7a, 0xbd, 0x61, 0x99, 0x68, 0xac, 0x40, 0x33, 0x99, 0x3b, 0x9a, 0x6a, 0x08, 0x30, 0x7d, 0x08, 0x17, 0x3f, 0x42, 0x9c, 0x7d, 0xc0 }) // Call super().__init__() before accessing native object.
+TRANSLATION("pop from empty list", 20, { 0xba, 0xdc, 0x34, 0x65, 0xb0, 0x15, 0xaf, 0x1b, 0x85, 0x4d, 0xe0 }) // pop from empty list
+TRANSLATION("Incompatible .mpy file. Please update all .mpy files. See http://adafru.it/mpy-update for more info.", 101, { 0xef, 0x49, 0xad, 0xae, 0x30, 0x79, 0xd4, 0x83, 0xee, 0xb5, 0xf7, 0x0d, 0x0e, 0xa5, 0xf7, 0x07, 0xf1, 0x52, 0x17, 0x20, 0xc5, 0xe8, 0x30, 0x40, 0x35, 0xa8, 0x7d, 0xd6, 0xbe, 0xe1, 0xa1, 0xd4, 0x9f, 0xee, 0x0f, 0x22, 0x20, 0xda, 0x22, 0xff, 0x9f, 0xdf, 0xf7, 0x8d, 0x07, 0x46, 0xc7, 0xdc, 0x71, 0xf7, 0xda, 0xfb, 0xfb, 0x31, 0x7a, 0x0c, 0x10, 0x68, 0xac, 0x16, 0x56, 0x20, 0x34, 0xd1, 0x7e, 0xe0 }) // Incompatible .mpy file. Please update all .mpy files. See http://adafru.it/mpy-update for more info.
+TRANSLATION("Unsupported operation", 22, { 0xfa, 0xa3, 0xe2, 0xf7, 0x56, 0x82, 0xa0, 0x2d, 0xc9, 0x86, 0x0d, 0x50 }) // Unsupported operation
+TRANSLATION("identifier redefined as nonlocal", 33, { 0x3a, 0x12, 0x41, 0xe8, 0x64, 0xc0, 0xc5, 0x42, 0xd0, 0xd0, 0xa8, 0x02, 0xe0, 0x8a, 0x95, 0x59, 0x8d, 0x40 }) // identifier redefined as nonlocal
+TRANSLATION("abort() called", 15, { 0x1c, 0xd5, 0xa3, 0xd5, 0xeb, 0x09, 0x8d, 0x6a, 0x54 }) // abort() called
+TRANSLATION("popitem(): dictionary is empty", 31, { 0xba, 0xdc, 0xe0, 0xad, 0xea, 0xf5, 0xfe, 0x61, 0x43, 0x9c, 0x1a, 0xa0, 0xb6, 0xe0, 0x6e, 0x05, 0x6b, 0xc6, 0xe0 }) // popitem(): dictionary is empty
+TRANSLATION("chr() arg not in range(0x110000)", 33, { 0x9e, 0xcd, 0xea, 0xf5, 0x80, 0xb6, 0xa0, 0x8b, 0x00, 0x68, 0x0c, 0x29, 0xa9, 0x7a, 0xbd, 0xbd, 0xbf, 0x0f, 0xc3, 0xdb, 0xed, 0xf6, 0xfb, 0x7d, 0x60 }) // chr() arg not in range(0x110000)
+TRANSLATION("no active exception to reraise", 31, { 0x45, 0x01, 0x9c, 0x1f, 0x42, 0x02, 0xed, 0x32, 0xbc, 0x1a, 0xa0, 0x42, 0x83, 0x13, 0x09, 0xb9, 0x00 }) // no active exception to reraise
+TRANSLATION("ord() expected a character, but string of length %d found", 58, { 0x56, 0xa7, 0xab, 0xd6, 0x05, 0xda, 0xe5, 0x38, 0x2a, 0x00, 0x84, 0xf6, 0x16, 0x19, 0xc1, 0x37, 0xda, 0x19, 0xe2, 0x01, 0xe1, 0x8d, 0x35, 0x05, 0xd0, 0x2a, 0x49, 0xac, 0x6c, 0x1c, 0x28, 0x1a, 0x2e, 0x12, 0x80 }) // ord() expected a character, but string of length %d found
+TRANSLATION("memory allocation failed, heap is locked", 41, { 0xb1, 0x59, 0x5b, 0x70, 0x1a, 0xd5, 0x66, 0x30, 0x6a, 0x81, 0xa0, 0x9d, 0x4a, 0x9f, 0x68, 0x6c, 0x43, 0x70, 0x37, 0x0a, 0xac, 0xf9, 0x15, 0x00 }) // memory allocation failed, heap is locked
+TRANSLATION("I/O operation on closed file", 29, { 0xef, 0xfb, 0xfc, 0x41, 0x6e, 0x4c, 0x30, 0x6a, 0x80, 0xa8, 0x13, 0xaa, 0xb9, 0x50, 0x34, 0x3a, 0x90 }) // I/O operation on closed file
+TRANSLATION("can't convert inf to int", 25, { 0x98, 0xa6, 0x50, 0x13, 0x54, 0xe8, 0x4d, 0x00, 0x69, 0xa0, 0x42, 0x81, 0xa4, 0x00 }) // can\'t convert inf to int
+TRANSLATION("can't have multiple *x", 23, { 0x98, 0xa6, 0x50, 0x1b, 0x0f, 0x42, 0x0b, 0x62, 0xb0, 0x77, 0xa9, 0x07, 0xd9, 0xd8 }) // can\'t have multiple *x
+TRANSLATION("conversion to object", 21, { 0x9a, 0xa7, 0x42, 0x67, 0x35, 0x40, 0x85, 0x05, 0xcf, 0xd0, 0xa7, 0x00 }) // conversion to object
+TRANSLATION("unknown conversion specifier %c", 32, { 0xc2, 0x72, 0x45, 0xea, 0x81, 0x35, 0x4e, 0x84, 0xce, 0x6a, 0x80, 0xf7, 0x29, 0x9e, 0x86, 0x4c, 0x1c, 0x26 }) // unknown conversion specifier %c
+TRANSLATION("issubclass() arg 1 must be a class", 35, { 0x37, 0x7c, 0x67, 0x3a, 0x8b, 0xbf, 0xab, 0xd6, 0x02, 0xda, 0x87, 0xe0, 0x16, 0xc3, 0xc0, 0x66, 0x40, 0x21, 0x3a, 0x8b, 0xb8 }) // issubclass() arg 1 must be a class
+TRANSLATION("FFT length must be a power of 2", 32, { 0xf9, 0x7c, 0xbc, 0xc2, 0xa4, 0x9a, 0xc6, 0xc1, 0x6c, 0x3c, 0x06, 0x64, 0x02, 0x17, 0x5e, 0xa4, 0xc0, 0xba, 0x07, 0xb8 }) // FFT length must be a power of 2
+TRANSLATION("can't assign to expression", 27, { 0x98, 0xa6, 0x50, 0x02, 0xee, 0x7a, 0xa0, 0x42, 0x81, 0x76, 0xbb, 0x13, 0xb9, 0xaa, 0x00 }) // can\'t assign to expression
+TRANSLATION("tuple/list has wrong length", 28, { 0x8c, 0x5e, 0xa5, 0xf7, 0xd4, 0xde, 0x03, 0x61, 0x70, 0xea, 0xca, 0x9a, 0x85, 0x49, 0x35, 0x8d, 0x80 }) // tuple/list has wrong length
+TRANSLATION("unicode name escapes", 21, { 0xc2, 0x1c, 0xd6, 0x84, 0x08, 0x36, 0x20, 0x27, 0x98, 0xdc, 0x9c }) // unicode name escapes
+TRANSLATION("bytes value out of range", 25, { 0xcf, 0x78, 0x27, 0x0e, 0x83, 0x5c, 0x10, 0x2e, 0x20, 0x17, 0x40, 0x61, 0x4d, 0x48 }) // bytes value out of range
+TRANSLATION("multiple *x in assignment", 26, { 0xb6, 0x2b, 0x07, 0x7a, 0x90, 0x7d, 0x9d, 0x80, 0xd0, 0x05, 0xdc, 0xf5, 0x4b, 0x12, 0x40 }) // multiple *x in assignment
+TRANSLATION("'%s' object is not iterable", 28, { 0xcb, 0x83, 0xe4, 0x0b, 0x9f, 0xa1, 0x4e, 0x00, 0xdc, 0x11, 0x60, 0x0e, 0x09, 0x87, 0x3a, 0x90 }) // \'%s\' object is not iterable
+TRANSLATION("Splitting with sub-captures", 28, { 0xf2, 0xbd, 0x4e, 0x20, 0xd3, 0x50, 0xea, 0x71, 0xb0, 0x3e, 0x33, 0xf6, 0x4c, 0x6f, 0x18, 0x62, 0x70 }) // Splitting with sub-captures
+TRANSLATION("struct: cannot index", 21, { 0x78, 0x6c, 0x4e, 0x3f, 0x30, 0x98, 0xa2, 0x2c, 0x01, 0xa5, 0x0b, 0xb0 }) // struct: cannot index
+TRANSLATION("Length must be an int", 22, { 0xf9, 0x92, 0x6b, 0x1b, 0x05, 0xb0, 0xf0, 0x19, 0x90, 0x0a, 0x01, 0xa4, 0x00 }) // Length must be an int
+TRANSLATION("object is not subscriptable", 28, { 0x5c, 0xfd, 0x0a, 0x70, 0x06, 0xe0, 0x8b, 0x00, 0xf8, 0xcd, 0xe6, 0xc7, 0x78, 0x1c, 0xea, 0x40 }) // object is not subscriptable
+TRANSLATION("byte code not implemented", 26, { 0xcf, 0x78, 0x20, 0x9a, 0xd0, 0x81, 0x16, 0x00, 0xed, 0x7a, 0x95, 0x89, 0x20, 0xa8 }) // byte code not implemented
+TRANSLATION("overflow converting long int to machine word", 45, { 0x5e, 0x84, 0xda, 0x55, 0x7a, 0x84, 0xd5, 0x3a, 0x13, 0x41, 0xa6, 0xa1, 0x55, 0x4d, 0x40, 0xd2, 0x02, 0x14, 0x2c, 0x33, 0xd8, 0xd0, 0x83, 0xaa, 0xb5, 0x00 }) // overflow converting long int to machine word
+TRANSLATION("queue overflow", 15, { 0xe7, 0x82, 0xc1, 0x02, 0xf4, 0x26, 0xd2, 0xab, 0xd4 }) // queue overflow
+TRANSLATION("can't send non-None value to a just-started generator", 54, { 0x98, 0xa6, 0x50, 0x0e, 0x49, 0x40, 0x45, 0x4f, 0x67, 0x82, 0xa1, 0x07, 0x41, 0xae, 0x08, 0x21, 0x40, 0x43, 0xd3, 0x0f, 0x1e, 0xc7, 0x81, 0x68, 0x2a, 0x06, 0xa4, 0x84, 0xc3, 0x0a, 0xc0 }) // can\'t send non-None value to a just-started generator
+TRANSLATION("can't do binary op between '%q' and '%q'", 41, { 0x98, 0xa6, 0x50, 0x14, 0x50, 0xcc, 0xd0, 0x5b, 0x70, 0x5b, 0x86, 0x65, 0x1d, 0x48, 0x90, 0x32, 0xe1, 0xcf, 0x20, 0x14, 0xa0, 0x65, 0xc3, 0x9e, 0x40 }) // can\'t do binary op between \'%q\' and \'%q\'
+TRANSLATION("__init__() should return None", 30, { 0x94, 0x8d, 0x0e, 0x25, 0x2f, 0x57, 0xac, 0x1f, 0x65, 0xc5, 0x68, 0x0c, 0x51, 0x86, 0x40, 0xf0, 0x54, 0x20 }) // __init__() should return None
+TRANSLATION("argument num/types mismatch", 28, { 0x16, 0xd7, 0x16, 0x24, 0x80, 0x4c, 0x5b, 0xef, 0x8d, 0xee, 0x4e, 0x16, 0x37, 0xb0, 0xc4, 0xf6 }) // argument num/types mismatch
+TRANSLATION("cannot create '%q' instances", 29, { 0x98, 0xa2, 0x2c, 0x04, 0xd8, 0x86, 0x08, 0x32, 0xe1, 0xcf, 0x20, 0x34, 0x78, 0x14, 0x99, 0x38 }) // cannot create \'%q\' instances
+TRANSLATION("incorrect padding", 18, { 0x34, 0x9a, 0xb3, 0x14, 0xe0, 0x2e, 0x34, 0xa1, 0xa6, 0xa0 }) // incorrect padding
+TRANSLATION("indices must be integers", 25, { 0x34, 0xa1, 0xcc, 0x9c, 0x2d, 0x87, 0x80, 0xcc, 0x80, 0xd2, 0x0b, 0x52, 0x67 }) // indices must be integers
+TRANSLATION("can't set attribute", 20, { 0x98, 0xa6, 0x50, 0x0e, 0x50, 0x03, 0x10, 0xc7, 0x9e, 0x20, 0x80 }) // can\'t set attribute
+TRANSLATION("object does not support item assignment", 40, { 0x5c, 0xfd, 0x0a, 0x70, 0x14, 0x52, 0x70, 0x45, 0x80, 0x7c, 0x5e, 0xea, 0xd0, 0x07, 0x05, 0x60, 0x17, 0x73, 0xd5, 0x2c, 0x49, 0x00 }) // object does not support item assignment
+TRANSLATION("type takes 1 or 3 arguments", 28, { 0x8d, 0xee, 0x41, 0x03, 0xc8, 0x9c, 0x3f, 0x00, 0x56, 0x0f, 0xc4, 0x05, 0xb5, 0xc5, 0x89, 0x21, 0xc0 }) // type takes 1 or 3 arguments
+TRANSLATION("non-keyword arg after */**", 27, { 0x45, 0x4f, 0x67, 0x22, 0xdf, 0xaa, 0xb5, 0x00, 0x5b, 0x50, 0x1d, 0x20, 0x98, 0x3e, 0xcf, 0xbf, 0xec, 0xfb, 0x00 }) // non-keyword arg after */**
+TRANSLATION("native yield", 13, { 0x41, 0x83, 0xe8, 0x41, 0xb9, 0x95, 0x68 }) // native yield
+TRANSLATION("type '%q' is not an acceptable base type", 41, { 0x8d, 0xee, 0x41, 0x97, 0x0e, 0x79, 0x01, 0xb8, 0x22, 0xc0, 0x0a, 0x00, 0xce, 0x65, 0x78, 0x1c, 0xea, 0x41, 0x98, 0xb9, 0x04, 0x6f, 0x72 }) // type \'%q\' is not an acceptable base type
+TRANSLATION("can't convert to str implicitly", 32, { 0x98, 0xa6, 0x50, 0x13, 0x54, 0xe8, 0x4d, 0x01, 0x0a, 0x0f, 0x0c, 0x07, 0x6b, 0xd4, 0xe6, 0x71, 0x5d, 0xc0 }) // can\'t convert to str implicitly
+TRANSLATION("Cannot subclass slice", 22, { 0xf8, 0x0a, 0x22, 0xc0, 0x3e, 0x33, 0x9d, 0x45, 0xdc, 0x1e, 0xa7, 0x32 }) // Cannot subclass slice
+TRANSLATION("int() arg 2 must be >= 2 and <= 36", 35, { 0x34, 0x8f, 0x57, 0xac, 0x05, 0xb5, 0x0f, 0x70, 0x5b, 0x0f, 0x01, 0x99, 0x07, 0xeb, 0xfe, 0xe1, 0xee, 0x01, 0x4a, 0x07, 0xe9, 0xfe, 0xe1, 0xf8, 0xfe, 0x40 }) // int() arg 2 must be >= 2 and <= 36
+TRANSLATION("%q must be between %d and %d", 29, { 0xe1, 0xcc, 0x2d, 0x87, 0x80, 0xcc, 0x83, 0x32, 0x8e, 0xa4, 0x48, 0x1c, 0x28, 0x02, 0x94, 0x0e, 0x14 }) // %q must be between %d and %d
+TRANSLATION("Error in regex", 15, { 0xe2, 0xcc, 0xac, 0x06, 0x80, 0xc5, 0xa9, 0x76 }) // Error in regex
+TRANSLATION("not enough arguments for format string", 39, { 0x45, 0x80, 0x24, 0x5c, 0x6b, 0xb0, 0x0b, 0x6b, 0x8b, 0x12, 0x43, 0x86, 0x8a, 0xc1, 0xa2, 0xb5, 0x86, 0x01, 0xe1, 0x8d, 0x35 }) // not enough arguments for format string
+TRANSLATION("keyword argument(s) not yet implemented - use normal args instead", 66, { 0xe4, 0x5b, 0xf5, 0x56, 0xa0, 0x0b, 0x6b, 0x8b, 0x12, 0x47, 0xa9, 0xfd, 0x60, 0x8b, 0x01, 0xb9, 0x40, 0x1d, 0xaf, 0x52, 0xb1, 0x24, 0x15, 0x03, 0xd8, 0x18, 0x72, 0x04, 0x56, 0xb0, 0xd4, 0x05, 0xb5, 0x70, 0x34, 0x78, 0x21, 0xa0 }) // keyword argument(s) not yet implemented - use normal args instead
+TRANSLATION("expected ':' after format specifier", 36, { 0x2e, 0xd7, 0x29, 0xc1, 0x50, 0x32, 0xfc, 0xf2, 0x01, 0xd2, 0x09, 0x83, 0x45, 0x6b, 0x0c, 0x03, 0xdc, 0xa6, 0x7a, 0x19, 0x30 }) // expected \':\' after format specifier
+TRANSLATION("type object '%q' has no attribute '%q'", 39, { 0x8d, 0xee, 0x40, 0xb9, 0xfa, 0x14, 0xe0, 0x32, 0xe1, 0xcf, 0x20, 0xd8, 0x5c, 0x11, 0x40, 0x62, 0x18, 0xf3, 0xc4, 0x10, 0x65, 0xc3, 0x9e, 0x40 }) // type object \'%q\' has no attribute \'%q\'
+TRANSLATION("%q index out of range", 22, { 0xe1, 0xcc, 0x0d, 0x28, 0x5d, 0x81, 0x71, 0x00, 0xba, 0x03, 0x0a, 0x6a, 0x40 }) // %q index out of range
+TRANSLATION("argument has wrong type", 24, { 0x16, 0xd7, 0x16, 0x24, 0x80, 0xd8, 0x5c, 0x3a, 0xb2, 0xa6, 0xa1, 0x1b, 0xdc, 0x80 }) // argument has wrong type
+TRANSLATION("extra keyword arguments given", 30, { 0x2e, 0xd0, 0xc2, 0x1c, 0x8b, 0x7e, 0xaa, 0xd4, 0x01, 0x6d, 0x71, 0x62, 0x48, 0x70, 0xd4, 0xfa, 0x12, 0x00 }) // extra keyword arguments given
+TRANSLATION("function missing required keyword argument '%q'", 48, { 0xd3, 0x09, 0x38, 0x35, 0x40, 0xb1, 0xbb, 0x9a, 0x6a, 0x0c, 0x5c, 0xf0, 0x6c, 0x54, 0x0e, 0x45, 0xbf, 0x55, 0x6a, 0x00, 0xb6, 0xb8, 0xb1, 0x24, 0x06, 0x5c, 0x39, 0xe4 }) // function missing required keyword argument \'%q\'
+TRANSLATION("invalid syntax for number", 26, { 0x34, 0xe8, 0x35, 0x3a, 0x03, 0xee, 0x90, 0x3d, 0x83, 0x45, 0x60, 0x4c, 0x5b, 0x32, 0x60 }) // invalid syntax for number
+TRANSLATION("object not callable", 20, { 0x5c, 0xfd, 0x0a, 0x70, 0x08, 0xb0, 0x13, 0x1a, 0xd4, 0x73, 0xa9, 0x00 }) // object not callable
+TRANSLATION("expecting a dict for keyword args", 34, { 0x2e, 0xd7, 0x29, 0xc1, 0xa6, 0xa0, 0x21, 0x43, 0x9c, 0x06, 0x8a, 0xc1, 0xc8, 0xb7, 0xea, 0xad, 0x40, 0x16, 0xd5, 0xc0 }) // expecting a dict for keyword args
+TRANSLATION("too many values to unpack (expected %d)", 40, { 0x85, 0x50, 0xb0, 0xa6, 0xe1, 0xd0, 0x6b, 0x82, 0x70, 0x85, 0x0c, 0x25, 0xc6, 0x7c, 0x83, 0xd4, 0x5d, 0xae, 0x53, 0x82, 0xa0, 0x70, 0xa7, 0xac }) // too many values to unpack (expected %d)
+TRANSLATION("end of format while looking for conversion specifier", 53, { 0x24, 0xa0, 0x2e, 0x81, 0xa2, 0xb5, 0x86, 0x03, 0xae, 0xc7, 0x52, 0x0a, 0xaa, 0xf2, 0x34, 0xd4, 0x34, 0x56, 0x09, 0xaa, 0x74, 0x26, 0x73, 0x54, 0x07, 0xb9, 0x4c, 0xf4, 0x32, 0x60 }) // end of format while looking for conversion specifier
+TRANSLATION("expecting just a value for set", 31, { 0x2e, 0xd7, 0x29, 0xc1, 0xa6, 0xa1, 0xe9, 0x87, 0x80, 0x10, 0xe8, 0x35, 0xc1, 0x06, 0x8a, 0xc0, 0xe5, 0x00 }) // expecting just a value for set
+TRANSLATION("Invalid argument", 17, { 0xef, 0x4e, 0x83, 0x53, 0xa0, 0x0b, 0x6b, 0x8b, 0x12, 0x40 }) // Invalid argument
+TRANSLATION("local '%q' used before type known", 34, { 0xaa, 0xcc, 0x6a, 0x19, 0x70, 0xe7, 0x90, 0x61, 0xca, 0x81, 0x99, 0x68, 0xac, 0x41, 0x1b, 0xdc, 0x83, 0x92, 0x2f, 0x54 }) // local \'%q\' used before type known
+TRANSLATION("non-hex digit found", 20, { 0x45, 0x4f, 0x66, 0xc5, 0xd8, 0x28, 0x7a, 0x9c, 0x06, 0x8b, 0x84, 0xa0 }) // non-hex digit found
+TRANSLATION("object '%s' is not a tuple or list", 35, { 0x5c, 0xfd, 0x0a, 0x70, 0x19, 0x70, 0x7c, 0x80, 0xdc, 0x11, 0x60, 0x04, 0x23, 0x17, 0xa9, 0x02, 0xb0, 0x54, 0xde, 0x00 }) // object \'%s\' is not a tuple or list
+TRANSLATION("Length must be non-negative", 28, { 0xf9, 0x92, 0x6b, 0x1b, 0x05, 0xb0, 0xf0, 0x19, 0x90, 0x22, 0xa7, 0xb1, 0x0b, 0x51, 0x83, 0xe8, 0x40 }) // Length must be non-negative
+TRANSLATION("wrong number of arguments", 26, { 0xea, 0xca, 0x9a, 0x82, 0x62, 0xd9, 0x93, 0x02, 0xe8, 0x02, 0xda, 0xe2, 0xc4, 0x90, 0xe0 }) // wrong number of arguments
+TRANSLATION("incomplete format key", 22, { 0x34, 0x9a, 0xda, 0xf5, 0x28, 0x20, 0xd1, 0x5a, 0xc3, 0x01, 0xc8, 0xb7 }) // incomplete format key
+TRANSLATION("0.0 to a complex power", 23, { 0xf6, 0xfd, 0xde, 0xd0, 0x85, 0x01, 0x09, 0xad, 0xaf, 0x52, 0xec, 0x17, 0x5e, 0xa4, 0xc0 }) // 0.0 to a complex power
+TRANSLATION("function missing keyword-only argument", 39, { 0xd3, 0x09, 0x38, 0x35, 0x40, 0xb1, 0xbb, 0x9a, 0x6a, 0x1c, 0x8b, 0x7e, 0xaa, 0xd4, 0xf6, 0x2a, 0x57, 0x70, 0x16, 0xd7, 0x16, 0x24, 0x80 }) // function missing keyword-only argument
+TRANSLATION("sign not allowed in string format specifier", 44, { 0x73, 0xd5, 0x01, 0x16, 0x00, 0x6b, 0x55, 0xea, 0x54, 0x03, 0x40, 0x78, 0x63, 0x4d, 0x43, 0x45, 0x6b, 0x0c, 0x03, 0xdc, 0xa6, 0x7a, 0x19, 0x30 }) // sign not allowed in string format specifier
+TRANSLATION("no module named '%q'", 21, { 0x45, 0x0b, 0x2d, 0x31, 0x52, 0x04, 0x1b, 0x15, 0x03, 0x2e, 0x1c, 0xf2 }) // no module named \'%q\'
+TRANSLATION("need more than %d values to unpack", 35, { 0x42, 0x2a, 0x05, 0x95, 0x88, 0x23, 0x61, 0x40, 0xe1, 0x40, 0xe8, 0x35, 0xc1, 0x38, 0x42, 0x86, 0x12, 0xe3, 0x3e, 0x40 }) // need more than %d values to unpack
+TRANSLATION("Cannot unambiguously get sizeof scalar", 39, { 0xf8, 0x0a, 0x22, 0xc0, 0x61, 0x06, 0xd9, 0x9e, 0xb8, 0x5c, 0x3d, 0x77, 0x0d, 0x4a, 0x01, 0xcf, 0xf9, 0x25, 0xd0, 0x1e, 0x63, 0x51, 0x60 }) // Cannot unambiguously get sizeof scalar
+TRANSLATION("casting", 8, { 0x98, 0xbc, 0x1a, 0x6a }) // casting
+TRANSLATION("can't store '%q'", 17, { 0x98, 0xa6, 0x50, 0x0f, 0x0a, 0xc4, 0x19, 0x70, 0xe7, 0x90 }) // can\'t store \'%q\'
+TRANSLATION("name not defined", 17, { 0x41, 0xb1, 0x02, 0x2c, 0x05, 0x0b, 0x43, 0x42, 0xa0 }) // name not defined
+TRANSLATION("zero step", 10, { 0xfe, 0x49, 0x94, 0x1e, 0x0a, 0xe0 }) // zero step
+TRANSLATION("  File \"%q\", line %d", 21, { 0x00, 0xf9, 0x1d, 0x48, 0x3f, 0xd3, 0x87, 0x3f, 0xf4, 0xfb, 0x42, 0xa6, 0x84, 0x1c, 0x28 }) //   File \"%q\", line %d
+TRANSLATION("length argument not allowed for this type", 42, { 0xa9, 0x26, 0xb1, 0xb0, 0x0b, 0x6b, 0x8b, 0x12, 0x40, 0x22, 0xc0, 0x0d, 0x6a, 0xbd, 0x4a, 0x81, 0xa2, 0xb0, 0x46, 0xc6, 0xe1, 0x1b, 0xdc, 0x80 }) // length argument not allowed for this type
+TRANSLATION("object does not support item deletion", 38, { 0x5c, 0xfd, 0x0a, 0x70, 0x14, 0x52, 0x70, 0x45, 0x80, 0x7c, 0x5e, 0xea, 0xd0, 0x07, 0x05, 0x60, 0xa1, 0x54, 0xa0, 0xd5, 0x00 }) // object does not support item deletion
+TRANSLATION("constant must be an integer", 28, { 0x9a, 0xa3, 0xc0, 0xa4, 0x05, 0xb0, 0xf0, 0x19, 0x90, 0x0a, 0x01, 0xa4, 0x16, 0xa4, 0xc0 }) // constant must be an integer
+TRANSLATION("can't do truncated division of a complex number", 48, { 0x98, 0xa6, 0x50, 0x14, 0x50, 0x86, 0xc2, 0x4c, 0x60, 0xa8, 0x14, 0x3e, 0x86, 0xe6, 0xa8, 0x0b, 0xa0, 0x08, 0x4d, 0x6d, 0x7a, 0x97, 0x60, 0x4c, 0x5b, 0x32, 0x60 }) // can\'t do truncated division of a complex number
+TRANSLATION("unmatched '{' in format", 24, { 0xc2, 0x58, 0x62, 0x7b, 0x15, 0x03, 0x2f, 0xfb, 0xc8, 0x0d, 0x03, 0x45, 0x6b, 0x0c, 0x00 }) // unmatched \'{\' in format
+TRANSLATION("Arrays must be of the same type", 32, { 0xee, 0x66, 0x1d, 0xdc, 0x2d, 0x87, 0x80, 0xcc, 0x81, 0x74, 0x08, 0xd8, 0x81, 0xc6, 0xc4, 0x11, 0xbd, 0xc8 }) // Arrays must be of the same type
+TRANSLATION("function missing %d required positional arguments", 50, { 0xd3, 0x09, 0x38, 0x35, 0x40, 0xb1, 0xbb, 0x9a, 0x6a, 0x1c, 0x28, 0x0c, 0x5c, 0xf0, 0x6c, 0x54, 0x0b, 0xab, 0x9c, 0x1a, 0xa0, 0xd4, 0x05, 0xb5, 0xc5, 0x89, 0x21, 0xc0 }) // function missing %d required positional arguments
+TRANSLATION("'%s' object is not an iterator", 31, { 0xcb, 0x83, 0xe4, 0x0b, 0x9f, 0xa1, 0x4e, 0x00, 0xdc, 0x11, 0x60, 0x05, 0x00, 0xe0, 0x98, 0x61, 0x58 }) // \'%s\' object is not an iterator
+TRANSLATION("'=' alignment not allowed in string format specifier", 53, { 0xcb, 0xfd, 0xf2, 0x01, 0xa9, 0xea, 0x96, 0x24, 0x80, 0x45, 0x80, 0x1a, 0xd5, 0x7a, 0x95, 0x00, 0xd0, 0x1e, 0x18, 0xd3, 0x50, 0xd1, 0x5a, 0xc3, 0x00, 0xf7, 0x29, 0x9e, 0x86, 0x4c }) // \'=\' alignment not allowed in string format specifier
+TRANSLATION("non-keyword arg after keyword arg", 34, { 0x45, 0x4f, 0x67, 0x22, 0xdf, 0xaa, 0xb5, 0x00, 0x5b, 0x50, 0x1d, 0x20, 0x98, 0x39, 0x16, 0xfd, 0x55, 0xa8, 0x02, 0xda, 0x80 }) // non-keyword arg after keyword arg
+TRANSLATION("Corrupt .mpy file", 18, { 0xf8, 0x2b, 0x36, 0x2f, 0x01, 0xf7, 0x5a, 0xfb, 0x86, 0x87, 0x52 }) // Corrupt .mpy file
+TRANSLATION("stream operation not supported", 31, { 0x78, 0x62, 0x1b, 0x02, 0xdc, 0x98, 0x60, 0xd5, 0x01, 0x16, 0x01, 0xf1, 0x7b, 0xab, 0x41, 0x50 }) // stream operation not supported
+TRANSLATION("Corrupt raw code", 17, { 0xf8, 0x2b, 0x36, 0x2f, 0x00, 0xc3, 0xd4, 0x26, 0xb4, 0x20 }) // Corrupt raw code
+TRANSLATION("extra positional arguments given", 33, { 0x2e, 0xd0, 0xc2, 0x17, 0x57, 0x38, 0x35, 0x41, 0xa8, 0x0b, 0x6b, 0x8b, 0x12, 0x43, 0x86, 0xa7, 0xd0, 0x90 }) // extra positional arguments given
+TRANSLATION("'%s' object is not subscriptable", 33, { 0xcb, 0x83, 0xe4, 0x0b, 0x9f, 0xa1, 0x4e, 0x00, 0xdc, 0x11, 0x60, 0x1f, 0x19, 0xbc, 0xd8, 0xef, 0x03, 0x9d, 0x48 }) // \'%s\' object is not subscriptable
+TRANSLATION("object of type '%s' has no len()", 33, { 0x5c, 0xfd, 0x0a, 0x70, 0x0b, 0xa0, 0x46, 0xf7, 0x20, 0xcb, 0x83, 0xe4, 0x1b, 0x0b, 0x82, 0x28, 0x54, 0x93, 0xd5, 0xeb }) // object of type \'%s\' has no len()
+TRANSLATION("empty heap", 11, { 0x2b, 0x5e, 0x37, 0x0d, 0x88, 0x6e }) // empty heap
+TRANSLATION("invalid syntax for integer", 27, { 0x34, 0xe8, 0x35, 0x3a, 0x03, 0xee, 0x90, 0x3d, 0x83, 0x45, 0x60, 0x34, 0x82, 0xd4, 0x98 }) // invalid syntax for integer
+TRANSLATION("math domain error", 18, { 0xb0, 0xc6, 0xc1, 0x45, 0xb0, 0x9a, 0x01, 0x33, 0x2b, 0x00 }) // math domain error
+TRANSLATION("empty separator", 16, { 0x2b, 0x5e, 0x37, 0x07, 0x2b, 0x8b, 0x0c, 0x2b, 0x00 }) // empty separator
+TRANSLATION("requested length %d but object has length %d", 45, { 0x62, 0xe7, 0x82, 0x78, 0x2a, 0x05, 0x49, 0x35, 0x8d, 0x83, 0x85, 0x03, 0x3c, 0x40, 0x2e, 0x7e, 0x85, 0x38, 0x0d, 0x85, 0xc2, 0xa4, 0x9a, 0xc6, 0xc1, 0xc2, 0x80 }) // requested length %d but object has length %d
+TRANSLATION("super() can't find self", 24, { 0x7c, 0x5c, 0x9b, 0xd5, 0xeb, 0x09, 0x8a, 0x65, 0x01, 0xa1, 0xa5, 0x01, 0xca, 0xba, 0x00 }) // super() can\'t find self
+TRANSLATION("full", 5, { 0xd3, 0x15, 0xa8 }) // full
+TRANSLATION("format requires a dict", 23, { 0xd1, 0x5a, 0xc3, 0x00, 0xc5, 0xcf, 0x06, 0xc4, 0xe0, 0x21, 0x43, 0x9c, 0x00 }) // format requires a dict
+TRANSLATION("unexpected indent", 18, { 0xc2, 0x17, 0x6b, 0x94, 0xe0, 0xa8, 0x06, 0x94, 0x24, 0x80 }) // unexpected indent
+TRANSLATION("Viper functions don't currently support more than 4 arguments", 62, { 0xfe, 0xe7, 0x72, 0x60, 0xd3, 0x09, 0x38, 0x35, 0x47, 0x0a, 0x2a, 0x65, 0x01, 0x3c, 0x33, 0x12, 0x45, 0x77, 0x07, 0xc5, 0xee, 0xad, 0x01, 0x65, 0x62, 0x08, 0xd8, 0x50, 0x3f, 0xa0, 0x0b, 0x6b, 0x8b, 0x12, 0x43, 0x80 }) // Viper functions don\'t currently support more than 4 arguments
+TRANSLATION("expecting key:value for dict", 29, { 0x2e, 0xd7, 0x29, 0xc1, 0xa6, 0xa1, 0xc8, 0xb7, 0xfc, 0xfa, 0x0d, 0x70, 0x41, 0xa2, 0xb0, 0x50, 0xe7, 0x00 }) // expecting key:value for dict
+TRANSLATION("unknown type '%q'", 18, { 0xc2, 0x72, 0x45, 0xea, 0x81, 0x1b, 0xdc, 0x83, 0x2e, 0x1c, 0xf2 }) // unknown type \'%q\'
+TRANSLATION("default 'except' must be last", 30, { 0xa1, 0x68, 0x38, 0xac, 0x06, 0x45, 0xda, 0x65, 0x78, 0xc8, 0x2d, 0x87, 0x80, 0xcc, 0x82, 0xa2, 0xf0 }) // default \'except\' must be last
+TRANSLATION("can't convert to complex", 25, { 0x98, 0xa6, 0x50, 0x13, 0x54, 0xe8, 0x4d, 0x01, 0x0a, 0x13, 0x5b, 0x5e, 0xa5, 0xd8 }) // can\'t convert to complex
+TRANSLATION("'%s' object does not support item assignment", 45, { 0xcb, 0x83, 0xe4, 0x0b, 0x9f, 0xa1, 0x4e, 0x02, 0x8a, 0x4e, 0x08, 0xb0, 0x0f, 0x8b, 0xdd, 0x5a, 0x00, 0xe0, 0xac, 0x02, 0xee, 0x7a, 0xa5, 0x89, 0x20 }) // \'%s\' object does not support item assignment
+TRANSLATION("can't store to '%q'", 20, { 0x98, 0xa6, 0x50, 0x0f, 0x0a, 0xc4, 0x10, 0xa1, 0x97, 0x0e, 0x79, 0x00 }) // can\'t store to \'%q\'
+
+// 4674 bytes worth of qstr
+// 7869 bytes worth of translations
+// 4726 bytes worth of translations compressed
+// 3143 bytes saved
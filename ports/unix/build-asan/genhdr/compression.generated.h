@@ -0,0 +1,4 @@
+const uint8_t lengths[] = { 0, 0, 1, 7, 8, 4, 7, 8, 9, 16, 6, 6, 11, 2, 0 };
+const uint8_t values[] = { 101, 32, 97, 105, 110, 111, 114, 116, 95, 99, 100, 108, 109, 112, 115, 117, 39, 98, 102, 103, 37, 69, 104, 107, 118, 120, 121, 73, 78, 79, 83, 84, 106, 113, 119, 40, 41, 65, 66, 68, 70, 76, 82, 85, 44, 45, 46, 47, 48, 49, 50, 51, 54, 58, 60, 67, 71, 77, 80, 122, 42, 52, 56, 62, 75, 86, 10, 35, 53, 61, 72, 87, 13, 34, 55, 57, 59, 88, 89, 90, 93, 123, 125, 74, 91 };
+#define DECODE_TABLE_BITS (8)
+const uint16_t decode_table[] = { 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 16385, 16385, 16385, 16385, 16385, 16385, 16385, 16385, 16385, 16385, 16385, 16385, 16385, 16385, 16385, 16385, 16386, 16386, 16386, 16386, 16386, 16386, 16386, 16386, 16386, 16386, 16386, 16386, 16386, 16386, 16386, 16386, 16387, 16387, 16387, 16387, 16387, 16387, 16387, 16387, 16387, 16387, 16387, 16387, 16387, 16387, 16387, 16387, 16388, 16388, 16388, 16388, 16388, 16388, 16388, 16388, 16388, 16388, 16388, 16388, 16388, 16388, 16388, 16388, 16389, 16389, 16389, 16389, 16389, 16389, 16389, 16389, 16389, 16389, 16389, 16389, 16389, 16389, 16389, 16389, 16390, 16390, 16390, 16390, 16390, 16390, 16390, 16390, 16390, 16390, 16390, 16390, 16390, 16390, 16390, 16390, 16391, 16391, 16391, 16391, 16391, 16391, 16391, 16391, 16391, 16391, 16391, 16391, 16391, 16391, 16391, 16391, 20488, 20488, 20488, 20488, 20488, 20488, 20488, 20488, 20489, 20489, 20489, 20489, 20489, 20489, 20489, 20489, 20490, 20490, 20490, 20490, 20490, 20490, 20490, 20490, 20491, 20491, 20491, 20491, 20491, 20491, 20491, 20491, 20492, 20492, 20492, 20492, 20492, 20492, 20492, 20492, 20493, 20493, 20493, 20493, 20493, 20493, 20493, 20493, 20494, 20494, 20494, 20494, 20494, 20494, 20494, 20494, 20495, 20495, 20495, 20495, 20495, 20495, 20495, 20495, 24592, 24592, 24592, 24592, 24593, 24593, 24593, 24593, 24594, 24594, 24594, 24594, 24595, 24595, 24595, 24595, 28692, 28692, 28693, 28693, 28694, 28694, 28695, 28695, 28696, 28696, 28697, 28697, 28698, 28698, 32795, 32796, 32797, 32798, 32799, 32800, 32801, 32802, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };